@@ -1,2781 +0,0 @@
-unsigned char assets_Pixeboy_ttf[] = {
-  0x00, 0x01, 0x00, 0x00, 0x00, 0x12, 0x01, 0x00, 0x00, 0x04, 0x00, 0x20,
-  0x44, 0x53, 0x49, 0x47, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x82, 0x28,
-  0x00, 0x00, 0x00, 0x08, 0x47, 0x44, 0x45, 0x46, 0x00, 0x10, 0x00, 0x75,
-  0x00, 0x00, 0x01, 0x2c, 0x00, 0x00, 0x00, 0x16, 0x47, 0x50, 0x4f, 0x53,
-  0xde, 0x50, 0xee, 0x2e, 0x00, 0x00, 0x01, 0x44, 0x00, 0x00, 0x01, 0x96,
-  0x47, 0x53, 0x55, 0x42, 0x6c, 0x91, 0x74, 0x8f, 0x00, 0x00, 0x02, 0xdc,
-  0x00, 0x00, 0x00, 0x20, 0x4f, 0x53, 0x2f, 0x32, 0x3e, 0x4e, 0x87, 0x21,
-  0x00, 0x00, 0x02, 0xfc, 0x00, 0x00, 0x00, 0x60, 0x63, 0x6d, 0x61, 0x70,
-  0x9a, 0xc1, 0x9f, 0x22, 0x00, 0x00, 0x03, 0x5c, 0x00, 0x00, 0x02, 0xce,
-  0x63, 0x76, 0x74, 0x20, 0x17, 0x32, 0x0a, 0xf8, 0x00, 0x00, 0x73, 0x2c,
-  0x00, 0x00, 0x00, 0x3c, 0x66, 0x70, 0x67, 0x6d, 0x9e, 0x36, 0x11, 0xca,
-  0x00, 0x00, 0x73, 0x68, 0x00, 0x00, 0x0e, 0x15, 0x67, 0x61, 0x73, 0x70,
-  0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x73, 0x24, 0x00, 0x00, 0x00, 0x08,
-  0x67, 0x6c, 0x79, 0x66, 0xbc, 0x4f, 0x9f, 0x8c, 0x00, 0x00, 0x06, 0x2c,
-  0x00, 0x00, 0x65, 0xe0, 0x68, 0x65, 0x61, 0x64, 0x19, 0x08, 0x2c, 0x0d,
-  0x00, 0x00, 0x6c, 0x0c, 0x00, 0x00, 0x00, 0x36, 0x68, 0x68, 0x65, 0x61,
-  0x0d, 0x56, 0x05, 0xdd, 0x00, 0x00, 0x6c, 0x44, 0x00, 0x00, 0x00, 0x24,
-  0x68, 0x6d, 0x74, 0x78, 0x84, 0xd2, 0x1f, 0x2b, 0x00, 0x00, 0x6c, 0x68,
-  0x00, 0x00, 0x01, 0xd4, 0x6c, 0x6f, 0x63, 0x61, 0xca, 0x41, 0xe3, 0x5a,
-  0x00, 0x00, 0x6e, 0x3c, 0x00, 0x00, 0x00, 0xec, 0x6d, 0x61, 0x78, 0x70,
-  0x01, 0xe2, 0x0e, 0xed, 0x00, 0x00, 0x6f, 0x28, 0x00, 0x00, 0x00, 0x20,
-  0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x6f, 0x61, 0x1c, 0x00, 0x00, 0x6f, 0x48,
-  0x00, 0x00, 0x02, 0xd0, 0x70, 0x6f, 0x73, 0x74, 0x0f, 0x7b, 0x10, 0x4f,
-  0x00, 0x00, 0x72, 0x18, 0x00, 0x00, 0x01, 0x0c, 0x70, 0x72, 0x65, 0x70,
-  0x6e, 0x4a, 0xcc, 0x9e, 0x00, 0x00, 0x81, 0x80, 0x00, 0x00, 0x00, 0xa7,
-  0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x74, 0x00, 0x01, 0x00, 0x00,
-  0x00, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x1e, 0x00, 0x2c, 0x00, 0x01,
-  0x6c, 0x61, 0x74, 0x6e, 0x00, 0x08, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-  0xff, 0xff, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x6b, 0x65, 0x72, 0x6e,
-  0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04,
-  0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x02, 0x00, 0x10,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 0xc2, 0x00, 0x25, 0x00, 0x25,
-  0x00, 0x02, 0x00, 0x03, 0x00, 0x13, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x24,
-  0x00, 0x3d, 0x00, 0x0a, 0x00, 0x44, 0x00, 0x5d, 0x00, 0x24, 0x00, 0x01,
-  0x00, 0x13, 0x00, 0x4b, 0x00, 0x01, 0x00, 0x02, 0x00, 0x03, 0x00, 0x04,
-  0x00, 0x05, 0x00, 0x06, 0x00, 0x07, 0x00, 0x08, 0x00, 0x09, 0x00, 0x0a,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x0b, 0x00, 0x0c, 0x00, 0x0d, 0x00, 0x0e, 0x00, 0x0f,
-  0x00, 0x10, 0x00, 0x11, 0x00, 0x12, 0x00, 0x13, 0x00, 0x14, 0x00, 0x15,
-  0x00, 0x16, 0x00, 0x17, 0x00, 0x18, 0x00, 0x19, 0x00, 0x1a, 0x00, 0x1b,
-  0x00, 0x1c, 0x00, 0x1d, 0x00, 0x1e, 0x00, 0x1f, 0x00, 0x20, 0x00, 0x21,
-  0x00, 0x22, 0x00, 0x23, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x0c, 0x00, 0x0d,
-  0x00, 0x0e, 0x00, 0x0f, 0x00, 0x10, 0x00, 0x11, 0x00, 0x12, 0x00, 0x13,
-  0x00, 0x14, 0x00, 0x15, 0x00, 0x16, 0x00, 0x17, 0x00, 0x18, 0x00, 0x19,
-  0x00, 0x1a, 0x00, 0x1b, 0x00, 0x1c, 0x00, 0x1d, 0x00, 0x1e, 0x00, 0x1f,
-  0x00, 0x20, 0x00, 0x21, 0x00, 0x22, 0x00, 0x23, 0x00, 0x24, 0x00, 0x01,
-  0x00, 0x13, 0x00, 0x4b, 0x00, 0x01, 0x00, 0x02, 0x00, 0x03, 0x00, 0x04,
-  0x00, 0x05, 0x00, 0x06, 0x00, 0x07, 0x00, 0x08, 0x00, 0x09, 0x00, 0x0a,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x0b, 0x00, 0x0c, 0x00, 0x0d, 0x00, 0x0e, 0x00, 0x0f,
-  0x00, 0x10, 0x00, 0x11, 0x00, 0x12, 0x00, 0x13, 0x00, 0x14, 0x00, 0x15,
-  0x00, 0x16, 0x00, 0x17, 0x00, 0x18, 0x00, 0x19, 0x00, 0x1a, 0x00, 0x1b,
-  0x00, 0x1c, 0x00, 0x1d, 0x00, 0x1e, 0x00, 0x1f, 0x00, 0x20, 0x00, 0x21,
-  0x00, 0x22, 0x00, 0x23, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x0c, 0x00, 0x0d,
-  0x00, 0x0e, 0x00, 0x0f, 0x00, 0x10, 0x00, 0x11, 0x00, 0x12, 0x00, 0x13,
-  0x00, 0x14, 0x00, 0x15, 0x00, 0x16, 0x00, 0x17, 0x00, 0x18, 0x00, 0x19,
-  0x00, 0x1a, 0x00, 0x1b, 0x00, 0x1c, 0x00, 0x1d, 0x00, 0x1e, 0x00, 0x1f,
-  0x00, 0x20, 0x00, 0x21, 0x00, 0x22, 0x00, 0x23, 0x00, 0x24, 0x00, 0x00,
-  0x00, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x1c, 0x00, 0x1e, 0x00, 0x01,
-  0x6c, 0x61, 0x74, 0x6e, 0x00, 0x08, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x52,
-  0x01, 0x90, 0x00, 0x05, 0x00, 0x00, 0x05, 0x9a, 0x05, 0x33, 0x00, 0x00,
-  0x01, 0x1b, 0x05, 0x9a, 0x05, 0x33, 0x00, 0x00, 0x03, 0xd1, 0x00, 0x66,
-  0x02, 0x12, 0x00, 0x00, 0x02, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x4c, 0x20, 0x20, 0x00, 0x40,
-  0x00, 0x00, 0x22, 0x65, 0x04, 0x00, 0xff, 0xff, 0x00, 0xcd, 0x04, 0x24,
-  0x00, 0x48, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x04, 0x1a,
-  0x03, 0xff, 0x00, 0x00, 0x00, 0x20, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03,
-  0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x01, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xd2, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c,
-  0x00, 0x04, 0x00, 0xb6, 0x00, 0x00, 0x00, 0x28, 0x00, 0x20, 0x00, 0x04,
-  0x00, 0x08, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x7e, 0x00, 0xa0, 0x00, 0xa9,
-  0x00, 0xaf, 0x00, 0xb1, 0x00, 0xb4, 0x00, 0xd7, 0x00, 0xf7, 0x03, 0x7e,
-  0x20, 0x1a, 0x20, 0x1e, 0x20, 0x44, 0x21, 0x22, 0x22, 0x12, 0x22, 0x15,
-  0x22, 0x60, 0x22, 0x65, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d,
-  0x00, 0x20, 0x00, 0xa0, 0x00, 0xa9, 0x00, 0xad, 0x00, 0xb1, 0x00, 0xb4,
-  0x00, 0xd7, 0x00, 0xf7, 0x03, 0x7e, 0x20, 0x18, 0x20, 0x1c, 0x20, 0x44,
-  0x21, 0x22, 0x22, 0x12, 0x22, 0x15, 0x22, 0x60, 0x22, 0x64, 0xff, 0xff,
-  0x00, 0x01, 0xff, 0xe4, 0xff, 0xe3, 0xff, 0x63, 0xff, 0xb9, 0x00, 0x00,
-  0xff, 0xb4, 0xff, 0xb2, 0xff, 0x90, 0xff, 0x71, 0xfc, 0xa0, 0xe0, 0x51,
-  0xe0, 0x50, 0xe0, 0x2b, 0xdf, 0x4e, 0xde, 0x5f, 0xde, 0x5a, 0xde, 0x14,
-  0xde, 0x0e, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x63,
-  0x00, 0x64, 0x00, 0x06, 0x01, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9,
-  0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x04, 0x00, 0x05, 0x00, 0x06,
-  0x00, 0x07, 0x00, 0x08, 0x00, 0x09, 0x00, 0x0a, 0x00, 0x0b, 0x00, 0x0c,
-  0x00, 0x0d, 0x00, 0x0e, 0x00, 0x0f, 0x00, 0x10, 0x00, 0x11, 0x00, 0x12,
-  0x00, 0x13, 0x00, 0x14, 0x00, 0x15, 0x00, 0x16, 0x00, 0x17, 0x00, 0x18,
-  0x00, 0x19, 0x00, 0x1a, 0x00, 0x1b, 0x00, 0x1c, 0x00, 0x1d, 0x00, 0x1e,
-  0x00, 0x1f, 0x00, 0x20, 0x00, 0x21, 0x00, 0x22, 0x00, 0x23, 0x00, 0x24,
-  0x00, 0x25, 0x00, 0x26, 0x00, 0x27, 0x00, 0x28, 0x00, 0x29, 0x00, 0x2a,
-  0x00, 0x2b, 0x00, 0x2c, 0x00, 0x2d, 0x00, 0x2e, 0x00, 0x2f, 0x00, 0x30,
-  0x00, 0x31, 0x00, 0x32, 0x00, 0x33, 0x00, 0x34, 0x00, 0x35, 0x00, 0x36,
-  0x00, 0x37, 0x00, 0x38, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3c,
-  0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x41, 0x00, 0x42,
-  0x00, 0x43, 0x00, 0x44, 0x00, 0x45, 0x00, 0x46, 0x00, 0x47, 0x00, 0x48,
-  0x00, 0x49, 0x00, 0x4a, 0x00, 0x4b, 0x00, 0x4c, 0x00, 0x4d, 0x00, 0x4e,
-  0x00, 0x4f, 0x00, 0x50, 0x00, 0x51, 0x00, 0x52, 0x00, 0x53, 0x00, 0x54,
-  0x00, 0x55, 0x00, 0x56, 0x00, 0x57, 0x00, 0x58, 0x00, 0x59, 0x00, 0x5a,
-  0x00, 0x5b, 0x00, 0x5c, 0x00, 0x5d, 0x00, 0x5e, 0x00, 0x5f, 0x00, 0x60,
-  0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x63, 0x00, 0x62, 0x00, 0x70, 0x00, 0x66, 0x00, 0x00, 0x00, 0x74,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x00, 0x72, 0x00, 0x73,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x6c, 0x00, 0x6d, 0x00, 0x69, 0x00, 0x6a, 0x00, 0x68, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6b, 0x00, 0x6e,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x04, 0x00, 0x46,
-  0x00, 0x67, 0x05, 0x43, 0x03, 0x64, 0x00, 0x28, 0x00, 0x31, 0x00, 0x5a,
-  0x00, 0x63, 0x01, 0x48, 0x4b, 0xb0, 0x0c, 0x50, 0x58, 0x40, 0x54, 0x15,
-  0x01, 0x07, 0x09, 0x01, 0x06, 0x07, 0x72, 0x10, 0x01, 0x02, 0x06, 0x05,
-  0x08, 0x02, 0x72, 0x19, 0x01, 0x0b, 0x16, 0x01, 0x08, 0x09, 0x0b, 0x08,
-  0x67, 0x17, 0x01, 0x09, 0x07, 0x00, 0x09, 0x57, 0x18, 0x0e, 0x0a, 0x03,
-  0x00, 0x0f, 0x01, 0x01, 0x06, 0x00, 0x01, 0x67, 0x14, 0x01, 0x06, 0x11,
-  0x01, 0x03, 0x04, 0x06, 0x03, 0x68, 0x13, 0x01, 0x05, 0x12, 0x01, 0x04,
-  0x0c, 0x05, 0x04, 0x67, 0x1a, 0x01, 0x0c, 0x0d, 0x0d, 0x0c, 0x57, 0x1a,
-  0x01, 0x0c, 0x0c, 0x0d, 0x5f, 0x1b, 0x01, 0x0d, 0x0c, 0x0d, 0x4f, 0x1b,
-  0x4b, 0xb0, 0x22, 0x50, 0x58, 0x40, 0x55, 0x15, 0x01, 0x07, 0x09, 0x01,
-  0x06, 0x07, 0x72, 0x10, 0x01, 0x02, 0x06, 0x05, 0x06, 0x02, 0x05, 0x80,
-  0x19, 0x01, 0x0b, 0x16, 0x01, 0x08, 0x09, 0x0b, 0x08, 0x67, 0x17, 0x01,
-  0x09, 0x07, 0x00, 0x09, 0x57, 0x18, 0x0e, 0x0a, 0x03, 0x00, 0x0f, 0x01,
-  0x01, 0x06, 0x00, 0x01, 0x67, 0x14, 0x01, 0x06, 0x11, 0x01, 0x03, 0x04,
-  0x06, 0x03, 0x68, 0x13, 0x01, 0x05, 0x12, 0x01, 0x04, 0x0c, 0x05, 0x04,
-  0x67, 0x1a, 0x01, 0x0c, 0x0d, 0x0d, 0x0c, 0x57, 0x1a, 0x01, 0x0c, 0x0c,
-  0x0d, 0x5f, 0x1b, 0x01, 0x0d, 0x0c, 0x0d, 0x4f, 0x1b, 0x40, 0x56, 0x15,
-  0x01, 0x07, 0x09, 0x01, 0x09, 0x07, 0x01, 0x80, 0x10, 0x01, 0x02, 0x06,
-  0x05, 0x06, 0x02, 0x05, 0x80, 0x19, 0x01, 0x0b, 0x16, 0x01, 0x08, 0x09,
-  0x0b, 0x08, 0x67, 0x17, 0x01, 0x09, 0x07, 0x00, 0x09, 0x57, 0x18, 0x0e,
-  0x0a, 0x03, 0x00, 0x0f, 0x01, 0x01, 0x06, 0x00, 0x01, 0x67, 0x14, 0x01,
-  0x06, 0x11, 0x01, 0x03, 0x04, 0x06, 0x03, 0x68, 0x13, 0x01, 0x05, 0x12,
-  0x01, 0x04, 0x0c, 0x05, 0x04, 0x67, 0x1a, 0x01, 0x0c, 0x0d, 0x0d, 0x0c,
-  0x57, 0x1a, 0x01, 0x0c, 0x0c, 0x0d, 0x5f, 0x1b, 0x01, 0x0d, 0x0c, 0x0d,
-  0x4f, 0x59, 0x59, 0x40, 0x32, 0x62, 0x60, 0x5e, 0x5b, 0x5a, 0x54, 0x53,
-  0x52, 0x50, 0x4e, 0x4d, 0x49, 0x48, 0x47, 0x46, 0x45, 0x44, 0x42, 0x40,
-  0x3e, 0x3d, 0x3b, 0x3a, 0x39, 0x38, 0x37, 0x34, 0x32, 0x30, 0x2e, 0x2c,
-  0x29, 0x28, 0x22, 0x21, 0x20, 0x1e, 0x1c, 0x41, 0x11, 0x11, 0x22, 0x21,
-  0x21, 0x11, 0x13, 0x20, 0x1c, 0x06, 0x1f, 0x2b, 0x01, 0x31, 0x33, 0x1d,
-  0x02, 0x23, 0x15, 0x23, 0x15, 0x2b, 0x01, 0x15, 0x2b, 0x01, 0x3d, 0x01,
-  0x3b, 0x01, 0x35, 0x33, 0x35, 0x33, 0x35, 0x2b, 0x03, 0x15, 0x2b, 0x01,
-  0x3d, 0x01, 0x33, 0x35, 0x3b, 0x05, 0x01, 0x31, 0x3b, 0x01, 0x1d, 0x01,
-  0x2b, 0x01, 0x35, 0x01, 0x31, 0x33, 0x1d, 0x02, 0x23, 0x15, 0x23, 0x15,
-  0x2b, 0x01, 0x15, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x35, 0x33, 0x35,
-  0x33, 0x35, 0x2b, 0x03, 0x15, 0x2b, 0x01, 0x3d, 0x01, 0x33, 0x35, 0x3b,
-  0x05, 0x01, 0x31, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x35, 0x02, 0x5d,
-  0x4c, 0x4c, 0x4d, 0x4c, 0x4c, 0x4d, 0x4c, 0x4c, 0x4d, 0x4c, 0x4c, 0x4c,
-  0x4c, 0x4d, 0x4c, 0x4d, 0x4c, 0x4c, 0x4d, 0x4c, 0x4d, 0x4c, 0x4c, 0x4d,
-  0xfe, 0x82, 0x4c, 0x4d, 0x4d, 0x4c, 0x04, 0x18, 0x4c, 0x4c, 0x4c, 0x4d,
-  0x4c, 0x4d, 0x4c, 0x4c, 0x4d, 0x4c, 0x4d, 0x4d, 0x4c, 0x4d, 0x4c, 0x4d,
-  0x4c, 0x4c, 0x4d, 0x4c, 0x4d, 0x4c, 0x4d, 0x4c, 0xfe, 0x82, 0x4c, 0x4d,
-  0x4d, 0x4c, 0x03, 0x17, 0x4c, 0x4d, 0x4c, 0x4d, 0x4c, 0x4d, 0x4d, 0x4c,
-  0x4d, 0x4c, 0x4d, 0x4d, 0x4d, 0x4c, 0x4d, 0xfd, 0x9c, 0x4d, 0x4c, 0x4c,
-  0x02, 0x64, 0x4c, 0x4d, 0x4c, 0x4d, 0x4c, 0x4d, 0x4d, 0x4c, 0x4d, 0x4c,
-  0x4d, 0x4d, 0x4d, 0x4c, 0x4d, 0xfd, 0x9c, 0x4d, 0x4c, 0x4c, 0x00, 0x00,
-  0x00, 0x02, 0x00, 0x46, 0x00, 0x00, 0x01, 0x13, 0x03, 0xff, 0x00, 0x12,
-  0x00, 0x1b, 0x00, 0x28, 0x40, 0x25, 0x00, 0x01, 0x01, 0x00, 0x5f, 0x04,
-  0x01, 0x00, 0x00, 0x12, 0x4d, 0x00, 0x02, 0x02, 0x03, 0x5f, 0x00, 0x03,
-  0x03, 0x13, 0x03, 0x4e, 0x02, 0x00, 0x1a, 0x18, 0x16, 0x13, 0x0b, 0x09,
-  0x00, 0x12, 0x02, 0x12, 0x05, 0x07, 0x16, 0x2b, 0x13, 0x31, 0x33, 0x1d,
-  0x06, 0x2b, 0x01, 0x3d, 0x06, 0x11, 0x31, 0x3b, 0x01, 0x1d, 0x01, 0x2b,
-  0x01, 0x35, 0xad, 0x66, 0x66, 0x67, 0x67, 0x66, 0x66, 0x67, 0x03, 0xff,
-  0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x66, 0x66, 0x67, 0x66, 0x66,
-  0x67, 0x66, 0xfc, 0xcd, 0x66, 0x66, 0x66, 0x00, 0x00, 0x04, 0x00, 0x46,
-  0x03, 0x32, 0x02, 0x46, 0x04, 0xcc, 0x00, 0x08, 0x00, 0x11, 0x00, 0x1a,
-  0x00, 0x23, 0x00, 0x41, 0x40, 0x3e, 0x0a, 0x04, 0x08, 0x03, 0x00, 0x05,
-  0x01, 0x01, 0x02, 0x00, 0x01, 0x67, 0x07, 0x01, 0x03, 0x03, 0x02, 0x5f,
-  0x0b, 0x06, 0x09, 0x03, 0x02, 0x02, 0x12, 0x03, 0x4e, 0x1d, 0x1b, 0x14,
-  0x12, 0x0b, 0x09, 0x02, 0x00, 0x21, 0x1f, 0x1b, 0x23, 0x1d, 0x23, 0x18,
-  0x16, 0x12, 0x1a, 0x14, 0x1a, 0x0f, 0x0d, 0x09, 0x11, 0x0b, 0x11, 0x06,
-  0x04, 0x00, 0x08, 0x02, 0x08, 0x0c, 0x07, 0x16, 0x2b, 0x13, 0x31, 0x33,
-  0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x17, 0x31, 0x33, 0x1d, 0x01, 0x2b,
-  0x01, 0x3d, 0x01, 0x25, 0x31, 0x33, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01,
-  0x17, 0x31, 0x33, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0xac, 0x67, 0x67,
-  0x66, 0x67, 0x66, 0x66, 0x66, 0x01, 0x96, 0x66, 0x66, 0x66, 0x68, 0x67,
-  0x67, 0x66, 0x04, 0xcc, 0x67, 0x66, 0x66, 0x67, 0xcd, 0x66, 0x67, 0x67,
-  0x66, 0xcd, 0x67, 0x66, 0x66, 0x67, 0xcd, 0x66, 0x67, 0x67, 0x66, 0x00,
-  0x00, 0x02, 0x00, 0x46, 0x00, 0x00, 0x03, 0x79, 0x03, 0xff, 0x00, 0x30,
-  0x00, 0x3d, 0x00, 0x42, 0x40, 0x3f, 0x0c, 0x0a, 0x02, 0x00, 0x0e, 0x09,
-  0x02, 0x01, 0x02, 0x00, 0x01, 0x67, 0x0f, 0x08, 0x02, 0x02, 0x07, 0x05,
-  0x02, 0x03, 0x04, 0x02, 0x03, 0x67, 0x0d, 0x01, 0x0b, 0x0b, 0x12, 0x4d,
-  0x06, 0x01, 0x04, 0x04, 0x13, 0x04, 0x4e, 0x3d, 0x39, 0x37, 0x33, 0x2f,
-  0x2e, 0x2c, 0x28, 0x26, 0x25, 0x23, 0x22, 0x20, 0x1f, 0x12, 0x12, 0x12,
-  0x42, 0x12, 0x12, 0x12, 0x12, 0x20, 0x10, 0x07, 0x1f, 0x2b, 0x01, 0x31,
-  0x33, 0x1d, 0x01, 0x23, 0x1d, 0x01, 0x33, 0x1d, 0x01, 0x23, 0x1d, 0x01,
-  0x23, 0x3d, 0x01, 0x2b, 0x03, 0x1d, 0x01, 0x23, 0x3d, 0x01, 0x23, 0x3d,
-  0x01, 0x33, 0x3d, 0x01, 0x23, 0x3d, 0x01, 0x33, 0x3d, 0x01, 0x33, 0x1d,
-  0x01, 0x3b, 0x03, 0x3d, 0x01, 0x33, 0x15, 0x03, 0x31, 0x35, 0x2b, 0x03,
-  0x1d, 0x01, 0x3b, 0x03, 0x03, 0x12, 0x67, 0x67, 0x67, 0x67, 0x66, 0x66,
-  0x67, 0x66, 0x67, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x67, 0x66, 0x67,
-  0x66, 0x66, 0x66, 0x66, 0x67, 0x66, 0x67, 0x67, 0x66, 0x67, 0x66, 0x03,
-  0x32, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x66, 0x66, 0x66,
-  0x66, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66,
-  0x67, 0x67, 0x66, 0x66, 0xfe, 0x66, 0x67, 0x67, 0x66, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0x00, 0x46, 0x00, 0x00, 0x03, 0x79, 0x03, 0xff, 0x00, 0x3c,
-  0x00, 0x6a, 0x40, 0x67, 0x00, 0x02, 0x01, 0x11, 0x02, 0x58, 0x10, 0x01,
-  0x00, 0x0f, 0x01, 0x01, 0x03, 0x00, 0x01, 0x67, 0x13, 0x01, 0x11, 0x00,
-  0x0e, 0x04, 0x11, 0x0e, 0x68, 0x00, 0x04, 0x0d, 0x07, 0x04, 0x57, 0x00,
-  0x03, 0x00, 0x0d, 0x05, 0x03, 0x0d, 0x67, 0x0b, 0x01, 0x05, 0x0a, 0x01,
-  0x06, 0x07, 0x05, 0x06, 0x67, 0x00, 0x0c, 0x09, 0x01, 0x07, 0x08, 0x0c,
-  0x07, 0x67, 0x00, 0x12, 0x12, 0x12, 0x4d, 0x00, 0x08, 0x08, 0x13, 0x08,
-  0x4e, 0x3c, 0x3a, 0x39, 0x37, 0x36, 0x34, 0x33, 0x32, 0x30, 0x2f, 0x2e,
-  0x2c, 0x2b, 0x29, 0x28, 0x24, 0x23, 0x22, 0x20, 0x1f, 0x1e, 0x1c, 0x21,
-  0x21, 0x12, 0x11, 0x11, 0x31, 0x41, 0x12, 0x20, 0x14, 0x07, 0x1f, 0x2b,
-  0x01, 0x31, 0x33, 0x1d, 0x01, 0x23, 0x35, 0x2b, 0x03, 0x15, 0x3b, 0x02,
-  0x15, 0x33, 0x15, 0x33, 0x1d, 0x01, 0x23, 0x15, 0x2b, 0x01, 0x15, 0x2b,
-  0x01, 0x35, 0x2b, 0x01, 0x35, 0x23, 0x3d, 0x01, 0x33, 0x15, 0x3b, 0x03,
-  0x35, 0x2b, 0x01, 0x35, 0x2b, 0x01, 0x35, 0x23, 0x3d, 0x01, 0x33, 0x35,
-  0x3b, 0x01, 0x35, 0x3b, 0x01, 0x15, 0x3b, 0x01, 0x03, 0x12, 0x67, 0x67,
-  0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x67, 0x66, 0x66,
-  0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x67, 0x66,
-  0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x03, 0x32,
-  0x66, 0x66, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x66, 0x66,
-  0x67, 0x66, 0x66, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x00,
-  0x00, 0x03, 0x00, 0x46, 0x00, 0x00, 0x03, 0x78, 0x03, 0xff, 0x00, 0x24,
-  0x00, 0x2d, 0x00, 0x36, 0x00, 0x72, 0x40, 0x6f, 0x13, 0x01, 0x0f, 0x00,
-  0x02, 0x0c, 0x0f, 0x02, 0x67, 0x00, 0x0e, 0x00, 0x03, 0x0b, 0x0e, 0x03,
-  0x67, 0x00, 0x0d, 0x00, 0x04, 0x0a, 0x0d, 0x04, 0x67, 0x00, 0x0a, 0x05,
-  0x07, 0x0a, 0x57, 0x00, 0x0c, 0x00, 0x05, 0x09, 0x0c, 0x05, 0x67, 0x00,
-  0x0b, 0x00, 0x06, 0x07, 0x0b, 0x06, 0x67, 0x11, 0x01, 0x07, 0x08, 0x09,
-  0x07, 0x57, 0x12, 0x01, 0x01, 0x01, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x12,
-  0x4d, 0x10, 0x01, 0x09, 0x09, 0x08, 0x5f, 0x00, 0x08, 0x08, 0x13, 0x08,
-  0x4e, 0x35, 0x33, 0x31, 0x2e, 0x2c, 0x2a, 0x28, 0x25, 0x24, 0x23, 0x22,
-  0x21, 0x20, 0x1f, 0x1e, 0x1d, 0x1c, 0x1b, 0x1a, 0x19, 0x18, 0x17, 0x11,
-  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x20, 0x14, 0x07, 0x1f, 0x2b,
-  0x01, 0x31, 0x33, 0x1d, 0x02, 0x23, 0x15, 0x23, 0x15, 0x23, 0x15, 0x23,
-  0x15, 0x23, 0x15, 0x23, 0x15, 0x23, 0x15, 0x23, 0x3d, 0x02, 0x33, 0x35,
-  0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x03,
-  0x31, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x35, 0x03, 0x31, 0x2b, 0x01,
-  0x3d, 0x01, 0x3b, 0x01, 0x15, 0x03, 0x12, 0x66, 0x66, 0x66, 0x67, 0x66,
-  0x66, 0x67, 0x66, 0x66, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0xcd,
-  0x67, 0x66, 0x66, 0x67, 0xcc, 0x67, 0x66, 0x66, 0x67, 0x03, 0xff, 0x66,
-  0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x66, 0x66, 0x67,
-  0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0xfd, 0x9a, 0x67, 0x66, 0x66, 0x02,
-  0x00, 0x66, 0x67, 0x67, 0x00, 0x02, 0x00, 0x46, 0x00, 0x00, 0x03, 0x79,
-  0x03, 0xff, 0x00, 0x3a, 0x00, 0x45, 0x00, 0xd1, 0x4b, 0xb0, 0x19, 0x50,
-  0x58, 0x40, 0x4e, 0x00, 0x04, 0x06, 0x05, 0x03, 0x04, 0x72, 0x00, 0x0e,
-  0x10, 0x0b, 0x0e, 0x57, 0x0d, 0x01, 0x0b, 0x00, 0x0a, 0x00, 0x0b, 0x0a,
-  0x67, 0x00, 0x10, 0x14, 0x01, 0x12, 0x09, 0x10, 0x12, 0x67, 0x00, 0x00,
-  0x00, 0x01, 0x02, 0x00, 0x01, 0x67, 0x00, 0x02, 0x03, 0x09, 0x02, 0x57,
-  0x11, 0x01, 0x09, 0x08, 0x01, 0x06, 0x04, 0x09, 0x06, 0x67, 0x00, 0x0f,
-  0x0f, 0x0c, 0x5f, 0x00, 0x0c, 0x0c, 0x12, 0x4d, 0x13, 0x01, 0x03, 0x03,
-  0x05, 0x5f, 0x07, 0x01, 0x05, 0x05, 0x13, 0x05, 0x4e, 0x1b, 0x40, 0x4f,
-  0x00, 0x04, 0x06, 0x05, 0x06, 0x04, 0x05, 0x80, 0x00, 0x0e, 0x10, 0x0b,
-  0x0e, 0x57, 0x0d, 0x01, 0x0b, 0x00, 0x0a, 0x00, 0x0b, 0x0a, 0x67, 0x00,
-  0x10, 0x14, 0x01, 0x12, 0x09, 0x10, 0x12, 0x67, 0x00, 0x00, 0x00, 0x01,
-  0x02, 0x00, 0x01, 0x67, 0x00, 0x02, 0x03, 0x09, 0x02, 0x57, 0x11, 0x01,
-  0x09, 0x08, 0x01, 0x06, 0x04, 0x09, 0x06, 0x67, 0x00, 0x0f, 0x0f, 0x0c,
-  0x5f, 0x00, 0x0c, 0x0c, 0x12, 0x4d, 0x13, 0x01, 0x03, 0x03, 0x05, 0x5f,
-  0x07, 0x01, 0x05, 0x05, 0x13, 0x05, 0x4e, 0x59, 0x40, 0x26, 0x3d, 0x3b,
-  0x42, 0x40, 0x3b, 0x45, 0x3d, 0x45, 0x3a, 0x38, 0x36, 0x33, 0x32, 0x2e,
-  0x2d, 0x2c, 0x2a, 0x29, 0x28, 0x23, 0x22, 0x21, 0x1e, 0x1d, 0x1c, 0x1b,
-  0x11, 0x41, 0x11, 0x21, 0x11, 0x11, 0x11, 0x12, 0x20, 0x15, 0x07, 0x1f,
-  0x2b, 0x01, 0x31, 0x33, 0x1d, 0x01, 0x23, 0x15, 0x23, 0x15, 0x33, 0x15,
-  0x33, 0x15, 0x2b, 0x01, 0x35, 0x23, 0x15, 0x2b, 0x03, 0x35, 0x23, 0x3d,
-  0x03, 0x33, 0x35, 0x23, 0x3d, 0x02, 0x33, 0x35, 0x3b, 0x04, 0x15, 0x33,
-  0x1d, 0x01, 0x23, 0x35, 0x2b, 0x03, 0x15, 0x3b, 0x02, 0x1d, 0x01, 0x3b,
-  0x01, 0x21, 0x31, 0x23, 0x1d, 0x02, 0x3b, 0x01, 0x3d, 0x02, 0x03, 0x12,
-  0x67, 0x67, 0x66, 0x66, 0x67, 0x67, 0x66, 0x66, 0x67, 0x66, 0x67, 0x66,
-  0x66, 0x66, 0x66, 0x66, 0x66, 0x67, 0x66, 0x67, 0x66, 0x66, 0x66, 0x66,
-  0x67, 0x66, 0x67, 0x67, 0x66, 0x67, 0x66, 0x66, 0xfe, 0x67, 0x67, 0x67,
-  0x66, 0x02, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x66, 0x66, 0x66,
-  0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66,
-  0x66, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x67, 0x66, 0x66, 0x00, 0x00,
-  0x00, 0x04, 0x00, 0x46, 0x03, 0x32, 0x01, 0x13, 0x04, 0xcc, 0x00, 0x08,
-  0x00, 0x11, 0x00, 0x1a, 0x00, 0x23, 0x00, 0x41, 0x40, 0x3e, 0x09, 0x02,
-  0x08, 0x03, 0x00, 0x03, 0x01, 0x01, 0x04, 0x00, 0x01, 0x67, 0x07, 0x01,
-  0x05, 0x05, 0x04, 0x5f, 0x0b, 0x06, 0x0a, 0x03, 0x04, 0x04, 0x12, 0x05,
-  0x4e, 0x1d, 0x1b, 0x14, 0x12, 0x0b, 0x09, 0x02, 0x00, 0x21, 0x1f, 0x1b,
-  0x23, 0x1d, 0x23, 0x18, 0x16, 0x12, 0x1a, 0x14, 0x1a, 0x0f, 0x0d, 0x09,
-  0x11, 0x0b, 0x11, 0x06, 0x04, 0x00, 0x08, 0x02, 0x08, 0x0c, 0x07, 0x16,
-  0x2b, 0x13, 0x31, 0x33, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x33, 0x31,
-  0x33, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x17, 0x31, 0x33, 0x1d, 0x01,
-  0x2b, 0x01, 0x3d, 0x01, 0x33, 0x31, 0x33, 0x1d, 0x01, 0x2b, 0x01, 0x3d,
-  0x01, 0xac, 0x67, 0x67, 0x66, 0x66, 0x67, 0x67, 0x66, 0x67, 0x66, 0x66,
-  0x66, 0x66, 0x66, 0x66, 0x66, 0x04, 0xcc, 0x67, 0x66, 0x66, 0x67, 0x67,
-  0x66, 0x66, 0x67, 0xcd, 0x66, 0x67, 0x67, 0x66, 0x66, 0x67, 0x67, 0x66,
-  0x00, 0x01, 0x00, 0x46, 0x00, 0x00, 0x01, 0x79, 0x03, 0xff, 0x00, 0x1c,
-  0x00, 0x34, 0x40, 0x31, 0x00, 0x05, 0x00, 0x04, 0x03, 0x05, 0x04, 0x67,
-  0x00, 0x01, 0x01, 0x00, 0x5f, 0x06, 0x01, 0x00, 0x00, 0x12, 0x4d, 0x00,
-  0x02, 0x02, 0x03, 0x5f, 0x00, 0x03, 0x03, 0x13, 0x03, 0x4e, 0x02, 0x00,
-  0x1b, 0x1a, 0x12, 0x11, 0x10, 0x0e, 0x0c, 0x0b, 0x05, 0x04, 0x00, 0x1c,
-  0x02, 0x1c, 0x07, 0x07, 0x16, 0x2b, 0x01, 0x31, 0x33, 0x1d, 0x01, 0x23,
-  0x1d, 0x05, 0x33, 0x1d, 0x01, 0x2b, 0x01, 0x35, 0x23, 0x3d, 0x07, 0x33,
-  0x35, 0x01, 0x13, 0x66, 0x66, 0x66, 0x66, 0x67, 0x66, 0x66, 0x03, 0xff,
-  0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x66, 0x66,
-  0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x00, 0x01, 0x00, 0x46,
-  0x00, 0x00, 0x01, 0x79, 0x03, 0xff, 0x00, 0x1c, 0x00, 0x34, 0x40, 0x31,
-  0x00, 0x01, 0x00, 0x02, 0x03, 0x01, 0x02, 0x67, 0x00, 0x05, 0x05, 0x00,
-  0x5f, 0x06, 0x01, 0x00, 0x00, 0x12, 0x4d, 0x00, 0x04, 0x04, 0x03, 0x5f,
-  0x00, 0x03, 0x03, 0x13, 0x03, 0x4e, 0x01, 0x00, 0x19, 0x18, 0x12, 0x11,
-  0x0f, 0x0d, 0x0c, 0x0b, 0x03, 0x02, 0x00, 0x1c, 0x01, 0x1b, 0x07, 0x07,
-  0x16, 0x2b, 0x13, 0x33, 0x15, 0x33, 0x1d, 0x07, 0x23, 0x15, 0x2b, 0x01,
-  0x3d, 0x01, 0x33, 0x3d, 0x05, 0x23, 0x3d, 0x01, 0x33, 0xac, 0x67, 0x66,
-  0x66, 0x67, 0x66, 0x66, 0x66, 0x66, 0x03, 0xff, 0x66, 0x67, 0x66, 0x66,
-  0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67,
-  0x66, 0x66, 0x67, 0x66, 0x00, 0x07, 0x00, 0x46, 0x00, 0x66, 0x03, 0x13,
-  0x03, 0x32, 0x00, 0x04, 0x00, 0x09, 0x00, 0x0e, 0x00, 0x27, 0x00, 0x2c,
-  0x00, 0x31, 0x00, 0x36, 0x00, 0x7e, 0x40, 0x7b, 0x00, 0x0c, 0x03, 0x0c,
-  0x85, 0x12, 0x14, 0x02, 0x03, 0x13, 0x01, 0x02, 0x0b, 0x03, 0x02, 0x67,
-  0x0d, 0x01, 0x0b, 0x0a, 0x15, 0x02, 0x06, 0x07, 0x0b, 0x06, 0x67, 0x09,
-  0x01, 0x07, 0x00, 0x08, 0x05, 0x07, 0x08, 0x68, 0x0e, 0x01, 0x05, 0x16,
-  0x0f, 0x02, 0x04, 0x01, 0x05, 0x04, 0x67, 0x10, 0x01, 0x01, 0x00, 0x00,
-  0x01, 0x57, 0x10, 0x01, 0x01, 0x01, 0x00, 0x5f, 0x17, 0x11, 0x02, 0x00,
-  0x01, 0x00, 0x4f, 0x2d, 0x2d, 0x28, 0x28, 0x11, 0x0f, 0x05, 0x05, 0x36,
-  0x35, 0x34, 0x32, 0x2d, 0x31, 0x2d, 0x31, 0x30, 0x2f, 0x28, 0x2c, 0x28,
-  0x2c, 0x2b, 0x2a, 0x26, 0x24, 0x22, 0x21, 0x1f, 0x1d, 0x1c, 0x1a, 0x19,
-  0x18, 0x17, 0x14, 0x13, 0x12, 0x0f, 0x27, 0x11, 0x27, 0x0e, 0x0d, 0x0c,
-  0x0a, 0x05, 0x09, 0x05, 0x09, 0x13, 0x11, 0x20, 0x18, 0x07, 0x19, 0x2b,
-  0x25, 0x31, 0x23, 0x35, 0x33, 0x11, 0x31, 0x15, 0x23, 0x35, 0x11, 0x31,
-  0x23, 0x35, 0x33, 0x27, 0x31, 0x23, 0x15, 0x33, 0x15, 0x2b, 0x02, 0x35,
-  0x33, 0x35, 0x2b, 0x01, 0x35, 0x3b, 0x01, 0x3d, 0x01, 0x33, 0x1d, 0x01,
-  0x3b, 0x01, 0x15, 0x01, 0x31, 0x35, 0x33, 0x15, 0x07, 0x31, 0x35, 0x33,
-  0x15, 0x03, 0x31, 0x33, 0x15, 0x23, 0x03, 0x13, 0x67, 0x67, 0x67, 0x66,
-  0x66, 0x66, 0x66, 0x66, 0x66, 0x67, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
-  0x67, 0x66, 0x66, 0xfe, 0x01, 0x66, 0xcd, 0x67, 0x67, 0x67, 0x67, 0x66,
-  0x66, 0x02, 0x00, 0x66, 0x66, 0xfe, 0x00, 0x67, 0xcc, 0x66, 0x66, 0x66,
-  0x66, 0x67, 0x66, 0x66, 0x66, 0x66, 0x67, 0xfe, 0xcd, 0x67, 0x67, 0x66,
-  0x66, 0x66, 0x02, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x46,
-  0x00, 0x66, 0x03, 0x79, 0x03, 0x99, 0x00, 0x20, 0x00, 0x31, 0x40, 0x2e,
-  0x00, 0x05, 0x00, 0x02, 0x05, 0x57, 0x04, 0x06, 0x02, 0x00, 0x03, 0x01,
-  0x01, 0x02, 0x00, 0x01, 0x67, 0x00, 0x05, 0x05, 0x02, 0x5f, 0x00, 0x02,
-  0x05, 0x02, 0x4f, 0x02, 0x00, 0x1c, 0x1a, 0x17, 0x14, 0x12, 0x0f, 0x0c,
-  0x0a, 0x07, 0x04, 0x00, 0x20, 0x02, 0x1f, 0x07, 0x07, 0x16, 0x2b, 0x01,
-  0x31, 0x33, 0x1d, 0x01, 0x2b, 0x02, 0x1d, 0x02, 0x2b, 0x01, 0x3d, 0x02,
-  0x2b, 0x02, 0x3d, 0x01, 0x3b, 0x02, 0x3d, 0x02, 0x3b, 0x01, 0x1d, 0x02,
-  0x33, 0x03, 0x13, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67,
-  0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x02, 0x66, 0x67, 0x66, 0x66, 0x67,
-  0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x67, 0x66, 0x66,
-  0x00, 0x01, 0x00, 0x46, 0xff, 0x9a, 0x01, 0x13, 0x00, 0xcd, 0x00, 0x0a,
-  0x00, 0x3e, 0x4b, 0xb0, 0x19, 0x50, 0x58, 0x40, 0x12, 0x00, 0x01, 0x02,
-  0x02, 0x01, 0x71, 0x03, 0x01, 0x00, 0x00, 0x02, 0x5f, 0x00, 0x02, 0x02,
-  0x13, 0x02, 0x4e, 0x1b, 0x40, 0x11, 0x00, 0x01, 0x02, 0x01, 0x86, 0x03,
-  0x01, 0x00, 0x00, 0x02, 0x5f, 0x00, 0x02, 0x02, 0x13, 0x02, 0x4e, 0x59,
-  0x40, 0x0d, 0x02, 0x00, 0x08, 0x07, 0x06, 0x05, 0x00, 0x0a, 0x02, 0x0a,
-  0x04, 0x07, 0x16, 0x2b, 0x37, 0x31, 0x33, 0x1d, 0x02, 0x23, 0x35, 0x23,
-  0x3d, 0x01, 0xad, 0x66, 0x66, 0x67, 0xcd, 0x66, 0x66, 0x67, 0x67, 0x66,
-  0x66, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x46, 0x01, 0x99, 0x03, 0x79,
-  0x02, 0x66, 0x00, 0x14, 0x00, 0x20, 0x40, 0x1d, 0x02, 0x01, 0x00, 0x01,
-  0x01, 0x00, 0x57, 0x02, 0x01, 0x00, 0x00, 0x01, 0x5f, 0x00, 0x01, 0x00,
-  0x01, 0x4f, 0x02, 0x00, 0x0c, 0x04, 0x00, 0x14, 0x02, 0x0e, 0x03, 0x07,
-  0x16, 0x2b, 0x01, 0x31, 0x33, 0x1d, 0x01, 0x2b, 0x07, 0x3d, 0x01, 0x3b,
-  0x05, 0x03, 0x13, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67,
-  0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x02, 0x66, 0x67, 0x66, 0x66, 0x67,
-  0x00, 0x01, 0x00, 0x46, 0x00, 0x00, 0x01, 0x13, 0x00, 0xcc, 0x00, 0x08,
-  0x00, 0x13, 0x40, 0x10, 0x00, 0x00, 0x00, 0x01, 0x5f, 0x00, 0x01, 0x01,
-  0x13, 0x01, 0x4e, 0x22, 0x30, 0x02, 0x07, 0x18, 0x2b, 0x37, 0x31, 0x3b,
-  0x01, 0x1d, 0x01, 0x2b, 0x01, 0x35, 0x46, 0x67, 0x66, 0x66, 0x67, 0xcc,
-  0x66, 0x66, 0x66, 0x00, 0x00, 0x01, 0x00, 0x46, 0x00, 0x00, 0x03, 0x79,
-  0x03, 0xff, 0x00, 0x24, 0x00, 0x58, 0x40, 0x55, 0x00, 0x0b, 0x00, 0x02,
-  0x08, 0x0b, 0x02, 0x67, 0x00, 0x0a, 0x00, 0x03, 0x07, 0x0a, 0x03, 0x67,
-  0x00, 0x09, 0x00, 0x04, 0x05, 0x09, 0x04, 0x67, 0x00, 0x08, 0x00, 0x05,
-  0x06, 0x08, 0x05, 0x67, 0x00, 0x01, 0x01, 0x00, 0x5f, 0x0c, 0x01, 0x00,
-  0x00, 0x12, 0x4d, 0x00, 0x07, 0x07, 0x06, 0x5f, 0x00, 0x06, 0x06, 0x13,
-  0x06, 0x4e, 0x02, 0x00, 0x22, 0x21, 0x20, 0x1f, 0x1e, 0x1d, 0x1c, 0x1b,
-  0x1a, 0x18, 0x14, 0x12, 0x10, 0x0f, 0x0e, 0x0d, 0x0c, 0x0b, 0x0a, 0x09,
-  0x08, 0x06, 0x00, 0x24, 0x02, 0x24, 0x0d, 0x07, 0x16, 0x2b, 0x01, 0x31,
-  0x33, 0x1d, 0x03, 0x2b, 0x01, 0x15, 0x23, 0x15, 0x23, 0x15, 0x23, 0x15,
-  0x23, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x03, 0x3b, 0x01, 0x35, 0x33, 0x35,
-  0x33, 0x35, 0x33, 0x35, 0x33, 0x3d, 0x01, 0x03, 0x13, 0x66, 0x66, 0x66,
-  0x67, 0x66, 0x67, 0x66, 0x66, 0x67, 0x67, 0x66, 0x66, 0x67, 0x66, 0x67,
-  0x03, 0xff, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66,
-  0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x00, 0x00,
-  0x00, 0x02, 0x00, 0x46, 0x00, 0x00, 0x03, 0x79, 0x04, 0x00, 0x00, 0x24,
-  0x00, 0x39, 0x00, 0x57, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40, 0x1f, 0x04,
-  0x01, 0x00, 0x03, 0x01, 0x01, 0x02, 0x00, 0x01, 0x67, 0x00, 0x06, 0x06,
-  0x05, 0x5f, 0x00, 0x05, 0x05, 0x12, 0x4d, 0x00, 0x07, 0x07, 0x02, 0x5f,
-  0x00, 0x02, 0x02, 0x13, 0x02, 0x4e, 0x1b, 0x40, 0x1f, 0x04, 0x01, 0x00,
-  0x03, 0x01, 0x01, 0x02, 0x00, 0x01, 0x67, 0x00, 0x06, 0x06, 0x05, 0x5f,
-  0x00, 0x05, 0x05, 0x14, 0x4d, 0x00, 0x07, 0x07, 0x02, 0x5f, 0x00, 0x02,
-  0x02, 0x13, 0x02, 0x4e, 0x59, 0x40, 0x0b, 0x46, 0x43, 0x61, 0x18, 0x11,
-  0x61, 0x18, 0x20, 0x08, 0x07, 0x1e, 0x2b, 0x01, 0x31, 0x33, 0x1d, 0x07,
-  0x23, 0x15, 0x2b, 0x05, 0x35, 0x23, 0x3d, 0x07, 0x33, 0x35, 0x3b, 0x05,
-  0x03, 0x31, 0x35, 0x2b, 0x03, 0x1d, 0x05, 0x3b, 0x03, 0x3d, 0x03, 0x03,
-  0x12, 0x67, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67,
-  0x66, 0x66, 0x67, 0x66, 0x66, 0x66, 0x66, 0x67, 0x66, 0x66, 0x66, 0x66,
-  0x67, 0x66, 0x03, 0x99, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x67,
-  0x66, 0x66, 0x67, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0xfe,
-  0xcd, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66,
-  0x00, 0x01, 0x00, 0x46, 0x00, 0x00, 0x03, 0x79, 0x04, 0x00, 0x00, 0x2c,
-  0x00, 0x90, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40, 0x21, 0x00, 0x04, 0x03,
-  0x00, 0x03, 0x04, 0x72, 0x00, 0x05, 0x00, 0x03, 0x04, 0x05, 0x03, 0x68,
-  0x00, 0x06, 0x06, 0x12, 0x4d, 0x02, 0x07, 0x02, 0x00, 0x00, 0x01, 0x5f,
-  0x00, 0x01, 0x01, 0x13, 0x01, 0x4e, 0x1b, 0x4b, 0xb0, 0x19, 0x50, 0x58,
-  0x40, 0x21, 0x00, 0x04, 0x03, 0x00, 0x03, 0x04, 0x72, 0x00, 0x05, 0x00,
-  0x03, 0x04, 0x05, 0x03, 0x68, 0x00, 0x06, 0x06, 0x14, 0x4d, 0x02, 0x07,
-  0x02, 0x00, 0x00, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x13, 0x01, 0x4e, 0x1b,
-  0x40, 0x22, 0x00, 0x04, 0x03, 0x00, 0x03, 0x04, 0x00, 0x80, 0x00, 0x05,
-  0x00, 0x03, 0x04, 0x05, 0x03, 0x68, 0x00, 0x06, 0x06, 0x14, 0x4d, 0x02,
-  0x07, 0x02, 0x00, 0x00, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x13, 0x01, 0x4e,
-  0x59, 0x59, 0x40, 0x15, 0x02, 0x00, 0x23, 0x20, 0x1f, 0x1d, 0x1a, 0x19,
-  0x18, 0x16, 0x11, 0x0e, 0x0c, 0x04, 0x00, 0x2c, 0x02, 0x2b, 0x08, 0x07,
-  0x16, 0x2b, 0x25, 0x31, 0x33, 0x1d, 0x01, 0x2b, 0x07, 0x3d, 0x01, 0x3b,
-  0x02, 0x3d, 0x04, 0x2b, 0x01, 0x15, 0x23, 0x3d, 0x02, 0x3b, 0x01, 0x35,
-  0x3b, 0x02, 0x1d, 0x07, 0x33, 0x03, 0x12, 0x67, 0x67, 0x66, 0x66, 0x67,
-  0x66, 0x67, 0x66, 0x66, 0x66, 0x66, 0x67, 0x67, 0x66, 0x66, 0x66, 0x66,
-  0x67, 0x66, 0x67, 0x66, 0xcd, 0x67, 0x66, 0x66, 0x67, 0x66, 0x67, 0x66,
-  0x66, 0x67, 0x67, 0x67, 0x66, 0x66, 0x67, 0x67, 0x66, 0x66, 0x67, 0x66,
-  0x66, 0x67, 0x66, 0x00, 0x00, 0x01, 0x00, 0x46, 0x00, 0x00, 0x03, 0x78,
-  0x04, 0x00, 0x00, 0x3c, 0x01, 0xdc, 0x4b, 0xb0, 0x09, 0x50, 0x58, 0x40,
-  0x50, 0x00, 0x0b, 0x0d, 0x01, 0x0a, 0x0b, 0x72, 0x00, 0x02, 0x0a, 0x09,
-  0x0c, 0x02, 0x72, 0x00, 0x08, 0x03, 0x04, 0x05, 0x08, 0x72, 0x00, 0x07,
-  0x04, 0x05, 0x05, 0x07, 0x72, 0x00, 0x0d, 0x0b, 0x00, 0x0d, 0x57, 0x0e,
-  0x01, 0x00, 0x00, 0x01, 0x0a, 0x00, 0x01, 0x67, 0x00, 0x0a, 0x00, 0x03,
-  0x08, 0x0a, 0x03, 0x68, 0x00, 0x09, 0x00, 0x04, 0x07, 0x09, 0x04, 0x67,
-  0x00, 0x0c, 0x0c, 0x0f, 0x5f, 0x00, 0x0f, 0x0f, 0x12, 0x4d, 0x00, 0x05,
-  0x05, 0x06, 0x60, 0x00, 0x06, 0x06, 0x13, 0x06, 0x4e, 0x1b, 0x4b, 0xb0,
-  0x0d, 0x50, 0x58, 0x40, 0x51, 0x00, 0x0b, 0x0d, 0x01, 0x0a, 0x0b, 0x72,
-  0x00, 0x02, 0x0a, 0x09, 0x0a, 0x02, 0x09, 0x80, 0x00, 0x08, 0x03, 0x04,
-  0x05, 0x08, 0x72, 0x00, 0x07, 0x04, 0x05, 0x05, 0x07, 0x72, 0x00, 0x0d,
-  0x0b, 0x00, 0x0d, 0x57, 0x0e, 0x01, 0x00, 0x00, 0x01, 0x0a, 0x00, 0x01,
-  0x67, 0x00, 0x0a, 0x00, 0x03, 0x08, 0x0a, 0x03, 0x68, 0x00, 0x09, 0x00,
-  0x04, 0x07, 0x09, 0x04, 0x67, 0x00, 0x0c, 0x0c, 0x0f, 0x5f, 0x00, 0x0f,
-  0x0f, 0x12, 0x4d, 0x00, 0x05, 0x05, 0x06, 0x60, 0x00, 0x06, 0x06, 0x13,
-  0x06, 0x4e, 0x1b, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40, 0x52, 0x00, 0x0b,
-  0x0d, 0x01, 0x0a, 0x0b, 0x72, 0x00, 0x02, 0x0a, 0x09, 0x0a, 0x02, 0x09,
-  0x80, 0x00, 0x08, 0x03, 0x04, 0x03, 0x08, 0x04, 0x80, 0x00, 0x07, 0x04,
-  0x05, 0x05, 0x07, 0x72, 0x00, 0x0d, 0x0b, 0x00, 0x0d, 0x57, 0x0e, 0x01,
-  0x00, 0x00, 0x01, 0x0a, 0x00, 0x01, 0x67, 0x00, 0x0a, 0x00, 0x03, 0x08,
-  0x0a, 0x03, 0x68, 0x00, 0x09, 0x00, 0x04, 0x07, 0x09, 0x04, 0x67, 0x00,
-  0x0c, 0x0c, 0x0f, 0x5f, 0x00, 0x0f, 0x0f, 0x12, 0x4d, 0x00, 0x05, 0x05,
-  0x06, 0x60, 0x00, 0x06, 0x06, 0x13, 0x06, 0x4e, 0x1b, 0x4b, 0xb0, 0x19,
-  0x50, 0x58, 0x40, 0x52, 0x00, 0x0b, 0x0d, 0x01, 0x0a, 0x0b, 0x72, 0x00,
-  0x02, 0x0a, 0x09, 0x0a, 0x02, 0x09, 0x80, 0x00, 0x08, 0x03, 0x04, 0x03,
-  0x08, 0x04, 0x80, 0x00, 0x07, 0x04, 0x05, 0x05, 0x07, 0x72, 0x00, 0x0d,
-  0x0b, 0x00, 0x0d, 0x57, 0x0e, 0x01, 0x00, 0x00, 0x01, 0x0a, 0x00, 0x01,
-  0x67, 0x00, 0x0a, 0x00, 0x03, 0x08, 0x0a, 0x03, 0x68, 0x00, 0x09, 0x00,
-  0x04, 0x07, 0x09, 0x04, 0x67, 0x00, 0x0c, 0x0c, 0x0f, 0x5f, 0x00, 0x0f,
-  0x0f, 0x14, 0x4d, 0x00, 0x05, 0x05, 0x06, 0x60, 0x00, 0x06, 0x06, 0x13,
-  0x06, 0x4e, 0x1b, 0x40, 0x54, 0x00, 0x0b, 0x0d, 0x01, 0x0d, 0x0b, 0x01,
-  0x80, 0x00, 0x02, 0x0a, 0x09, 0x0a, 0x02, 0x09, 0x80, 0x00, 0x08, 0x03,
-  0x04, 0x03, 0x08, 0x04, 0x80, 0x00, 0x07, 0x04, 0x05, 0x04, 0x07, 0x05,
-  0x80, 0x00, 0x0d, 0x0b, 0x00, 0x0d, 0x57, 0x0e, 0x01, 0x00, 0x00, 0x01,
-  0x0a, 0x00, 0x01, 0x67, 0x00, 0x0a, 0x00, 0x03, 0x08, 0x0a, 0x03, 0x68,
-  0x00, 0x09, 0x00, 0x04, 0x07, 0x09, 0x04, 0x67, 0x00, 0x0c, 0x0c, 0x0f,
-  0x5f, 0x00, 0x0f, 0x0f, 0x14, 0x4d, 0x00, 0x05, 0x05, 0x06, 0x60, 0x00,
-  0x06, 0x06, 0x13, 0x06, 0x4e, 0x59, 0x59, 0x59, 0x59, 0x40, 0x1a, 0x3c,
-  0x36, 0x35, 0x34, 0x32, 0x30, 0x2f, 0x2b, 0x2a, 0x29, 0x28, 0x27, 0x26,
-  0x24, 0x11, 0x13, 0x82, 0x51, 0x11, 0x21, 0x11, 0x13, 0x20, 0x10, 0x07,
-  0x1f, 0x2b, 0x01, 0x31, 0x33, 0x1d, 0x02, 0x23, 0x15, 0x23, 0x15, 0x2b,
-  0x01, 0x15, 0x23, 0x15, 0x3b, 0x04, 0x1d, 0x01, 0x2b, 0x07, 0x3d, 0x02,
-  0x33, 0x35, 0x33, 0x35, 0x3b, 0x01, 0x35, 0x33, 0x35, 0x33, 0x35, 0x2b,
-  0x03, 0x15, 0x2b, 0x01, 0x3d, 0x01, 0x33, 0x35, 0x3b, 0x05, 0x03, 0x12,
-  0x66, 0x66, 0x66, 0x67, 0x66, 0x66, 0x66, 0x66, 0x67, 0x66, 0x66, 0x66,
-  0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x66, 0x66, 0x67, 0x66, 0x66,
-  0x67, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x66, 0x66, 0x67, 0x66, 0x66,
-  0x67, 0x66, 0x03, 0x99, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x67,
-  0x66, 0x66, 0x67, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x66, 0x66,
-  0x67, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x46, 0x00, 0x00, 0x03, 0x78,
-  0x04, 0x00, 0x00, 0x3e, 0x00, 0x9a, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40,
-  0x3b, 0x00, 0x0b, 0x01, 0x00, 0x0b, 0x57, 0x0c, 0x01, 0x00, 0x00, 0x01,
-  0x09, 0x00, 0x01, 0x67, 0x00, 0x09, 0x00, 0x08, 0x02, 0x09, 0x08, 0x67,
-  0x00, 0x02, 0x06, 0x03, 0x02, 0x57, 0x00, 0x06, 0x05, 0x01, 0x03, 0x04,
-  0x06, 0x03, 0x67, 0x00, 0x0a, 0x0a, 0x0d, 0x5f, 0x00, 0x0d, 0x0d, 0x12,
-  0x4d, 0x00, 0x07, 0x07, 0x04, 0x5f, 0x00, 0x04, 0x04, 0x13, 0x04, 0x4e,
-  0x1b, 0x40, 0x3b, 0x00, 0x0b, 0x01, 0x00, 0x0b, 0x57, 0x0c, 0x01, 0x00,
-  0x00, 0x01, 0x09, 0x00, 0x01, 0x67, 0x00, 0x09, 0x00, 0x08, 0x02, 0x09,
-  0x08, 0x67, 0x00, 0x02, 0x06, 0x03, 0x02, 0x57, 0x00, 0x06, 0x05, 0x01,
-  0x03, 0x04, 0x06, 0x03, 0x67, 0x00, 0x0a, 0x0a, 0x0d, 0x5f, 0x00, 0x0d,
-  0x0d, 0x14, 0x4d, 0x00, 0x07, 0x07, 0x04, 0x5f, 0x00, 0x04, 0x04, 0x13,
-  0x04, 0x4e, 0x59, 0x40, 0x16, 0x3e, 0x38, 0x37, 0x36, 0x34, 0x32, 0x31,
-  0x2d, 0x2b, 0x27, 0x42, 0x41, 0x22, 0x11, 0x61, 0x13, 0x12, 0x13, 0x20,
-  0x0e, 0x07, 0x1f, 0x2b, 0x01, 0x31, 0x33, 0x1d, 0x02, 0x23, 0x1d, 0x01,
-  0x33, 0x1d, 0x02, 0x23, 0x15, 0x2b, 0x05, 0x35, 0x23, 0x3d, 0x01, 0x3b,
-  0x01, 0x15, 0x3b, 0x03, 0x3d, 0x01, 0x2b, 0x03, 0x3d, 0x01, 0x3b, 0x03,
-  0x3d, 0x01, 0x2b, 0x03, 0x15, 0x2b, 0x01, 0x3d, 0x01, 0x33, 0x35, 0x3b,
-  0x05, 0x03, 0x12, 0x66, 0x66, 0x66, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67,
-  0x66, 0x66, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x67, 0x66, 0x66, 0x67,
-  0x67, 0x66, 0x66, 0x67, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x66, 0x66,
-  0x67, 0x66, 0x66, 0x67, 0x66, 0x03, 0x99, 0x66, 0x66, 0x67, 0x66, 0x66,
-  0x67, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x66, 0x67, 0x66, 0x66,
-  0x67, 0x66, 0x66, 0x66, 0x66, 0x67, 0x00, 0x00, 0x00, 0x02, 0x00, 0x46,
-  0x00, 0x00, 0x03, 0x79, 0x04, 0x00, 0x00, 0x24, 0x00, 0x31, 0x01, 0x76,
-  0x4b, 0xb0, 0x09, 0x50, 0x58, 0x40, 0x3b, 0x00, 0x05, 0x07, 0x08, 0x0a,
-  0x05, 0x72, 0x00, 0x08, 0x04, 0x07, 0x08, 0x70, 0x00, 0x04, 0x09, 0x0a,
-  0x04, 0x70, 0x00, 0x03, 0x09, 0x0a, 0x0a, 0x03, 0x72, 0x00, 0x06, 0x00,
-  0x09, 0x03, 0x06, 0x09, 0x67, 0x00, 0x0a, 0x00, 0x02, 0x01, 0x0a, 0x02,
-  0x68, 0x00, 0x07, 0x07, 0x00, 0x5f, 0x0b, 0x01, 0x00, 0x00, 0x12, 0x4d,
-  0x00, 0x01, 0x01, 0x13, 0x01, 0x4e, 0x1b, 0x4b, 0xb0, 0x0d, 0x50, 0x58,
-  0x40, 0x3c, 0x00, 0x05, 0x07, 0x08, 0x07, 0x05, 0x08, 0x80, 0x00, 0x08,
-  0x04, 0x07, 0x08, 0x70, 0x00, 0x04, 0x09, 0x0a, 0x04, 0x70, 0x00, 0x03,
-  0x09, 0x0a, 0x0a, 0x03, 0x72, 0x00, 0x06, 0x00, 0x09, 0x03, 0x06, 0x09,
-  0x67, 0x00, 0x0a, 0x00, 0x02, 0x01, 0x0a, 0x02, 0x68, 0x00, 0x07, 0x07,
-  0x00, 0x5f, 0x0b, 0x01, 0x00, 0x00, 0x12, 0x4d, 0x00, 0x01, 0x01, 0x13,
-  0x01, 0x4e, 0x1b, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40, 0x3d, 0x00, 0x05,
-  0x07, 0x08, 0x07, 0x05, 0x08, 0x80, 0x00, 0x08, 0x04, 0x07, 0x08, 0x70,
-  0x00, 0x04, 0x09, 0x07, 0x04, 0x09, 0x7e, 0x00, 0x03, 0x09, 0x0a, 0x0a,
-  0x03, 0x72, 0x00, 0x06, 0x00, 0x09, 0x03, 0x06, 0x09, 0x67, 0x00, 0x0a,
-  0x00, 0x02, 0x01, 0x0a, 0x02, 0x68, 0x00, 0x07, 0x07, 0x00, 0x5f, 0x0b,
-  0x01, 0x00, 0x00, 0x12, 0x4d, 0x00, 0x01, 0x01, 0x13, 0x01, 0x4e, 0x1b,
-  0x4b, 0xb0, 0x19, 0x50, 0x58, 0x40, 0x3d, 0x00, 0x05, 0x07, 0x08, 0x07,
-  0x05, 0x08, 0x80, 0x00, 0x08, 0x04, 0x07, 0x08, 0x70, 0x00, 0x04, 0x09,
-  0x07, 0x04, 0x09, 0x7e, 0x00, 0x03, 0x09, 0x0a, 0x0a, 0x03, 0x72, 0x00,
-  0x06, 0x00, 0x09, 0x03, 0x06, 0x09, 0x67, 0x00, 0x0a, 0x00, 0x02, 0x01,
-  0x0a, 0x02, 0x68, 0x00, 0x07, 0x07, 0x00, 0x5f, 0x0b, 0x01, 0x00, 0x00,
-  0x14, 0x4d, 0x00, 0x01, 0x01, 0x13, 0x01, 0x4e, 0x1b, 0x40, 0x3f, 0x00,
-  0x05, 0x07, 0x08, 0x07, 0x05, 0x08, 0x80, 0x00, 0x08, 0x04, 0x07, 0x08,
-  0x04, 0x7e, 0x00, 0x04, 0x09, 0x07, 0x04, 0x09, 0x7e, 0x00, 0x03, 0x09,
-  0x0a, 0x09, 0x03, 0x0a, 0x80, 0x00, 0x06, 0x00, 0x09, 0x03, 0x06, 0x09,
-  0x67, 0x00, 0x0a, 0x00, 0x02, 0x01, 0x0a, 0x02, 0x68, 0x00, 0x07, 0x07,
-  0x00, 0x5f, 0x0b, 0x01, 0x00, 0x00, 0x14, 0x4d, 0x00, 0x01, 0x01, 0x13,
-  0x01, 0x4e, 0x59, 0x59, 0x59, 0x59, 0x40, 0x1d, 0x02, 0x00, 0x30, 0x2d,
-  0x2c, 0x2b, 0x2a, 0x29, 0x28, 0x27, 0x21, 0x20, 0x1f, 0x1e, 0x1d, 0x1c,
-  0x1b, 0x1a, 0x17, 0x11, 0x0e, 0x0c, 0x00, 0x24, 0x02, 0x22, 0x0c, 0x07,
-  0x16, 0x2b, 0x01, 0x31, 0x33, 0x1d, 0x09, 0x2b, 0x01, 0x3d, 0x02, 0x2b,
-  0x05, 0x3d, 0x02, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x3b,
-  0x01, 0x11, 0x31, 0x35, 0x23, 0x15, 0x23, 0x15, 0x23, 0x15, 0x3b, 0x02,
-  0x35, 0x03, 0x13, 0x66, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x67,
-  0x67, 0x66, 0x67, 0x66, 0x66, 0x67, 0x67, 0x66, 0x66, 0x66, 0x66, 0x67,
-  0x04, 0x00, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x67, 0x66,
-  0x66, 0x67, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0xfe, 0xcd,
-  0x66, 0x66, 0x67, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x46,
-  0x00, 0x00, 0x03, 0x79, 0x04, 0x00, 0x00, 0x3e, 0x00, 0xd2, 0x4b, 0xb0,
-  0x0d, 0x50, 0x58, 0x40, 0x34, 0x00, 0x0a, 0x02, 0x03, 0x01, 0x0a, 0x72,
-  0x00, 0x03, 0x09, 0x04, 0x03, 0x57, 0x00, 0x02, 0x00, 0x09, 0x07, 0x02,
-  0x09, 0x67, 0x00, 0x07, 0x06, 0x01, 0x04, 0x05, 0x07, 0x04, 0x67, 0x00,
-  0x01, 0x01, 0x00, 0x5f, 0x0b, 0x01, 0x00, 0x00, 0x12, 0x4d, 0x00, 0x08,
-  0x08, 0x05, 0x5f, 0x00, 0x05, 0x05, 0x13, 0x05, 0x4e, 0x1b, 0x4b, 0xb0,
-  0x0f, 0x50, 0x58, 0x40, 0x35, 0x00, 0x0a, 0x02, 0x03, 0x02, 0x0a, 0x03,
-  0x80, 0x00, 0x03, 0x09, 0x04, 0x03, 0x57, 0x00, 0x02, 0x00, 0x09, 0x07,
-  0x02, 0x09, 0x67, 0x00, 0x07, 0x06, 0x01, 0x04, 0x05, 0x07, 0x04, 0x67,
-  0x00, 0x01, 0x01, 0x00, 0x5f, 0x0b, 0x01, 0x00, 0x00, 0x12, 0x4d, 0x00,
-  0x08, 0x08, 0x05, 0x5f, 0x00, 0x05, 0x05, 0x13, 0x05, 0x4e, 0x1b, 0x40,
-  0x35, 0x00, 0x0a, 0x02, 0x03, 0x02, 0x0a, 0x03, 0x80, 0x00, 0x03, 0x09,
-  0x04, 0x03, 0x57, 0x00, 0x02, 0x00, 0x09, 0x07, 0x02, 0x09, 0x67, 0x00,
-  0x07, 0x06, 0x01, 0x04, 0x05, 0x07, 0x04, 0x67, 0x00, 0x01, 0x01, 0x00,
-  0x5f, 0x0b, 0x01, 0x00, 0x00, 0x14, 0x4d, 0x00, 0x08, 0x08, 0x05, 0x5f,
-  0x00, 0x05, 0x05, 0x13, 0x05, 0x4e, 0x59, 0x59, 0x40, 0x1d, 0x02, 0x00,
-  0x34, 0x33, 0x32, 0x2d, 0x2a, 0x26, 0x25, 0x23, 0x21, 0x20, 0x1f, 0x19,
-  0x18, 0x17, 0x12, 0x11, 0x10, 0x0b, 0x0a, 0x04, 0x00, 0x3e, 0x02, 0x38,
-  0x0c, 0x07, 0x16, 0x2b, 0x01, 0x31, 0x33, 0x1d, 0x01, 0x2b, 0x05, 0x15,
-  0x3b, 0x04, 0x15, 0x33, 0x1d, 0x04, 0x23, 0x15, 0x2b, 0x05, 0x35, 0x23,
-  0x3d, 0x01, 0x3b, 0x01, 0x15, 0x3b, 0x03, 0x3d, 0x02, 0x2b, 0x04, 0x35,
-  0x23, 0x3d, 0x03, 0x3b, 0x05, 0x03, 0x13, 0x66, 0x66, 0x66, 0x67, 0x66,
-  0x67, 0x66, 0x66, 0x67, 0x66, 0x67, 0x66, 0x66, 0x66, 0x66, 0x67, 0x66,
-  0x67, 0x66, 0x66, 0x67, 0x67, 0x66, 0x66, 0x67, 0x66, 0x67, 0x67, 0x66,
-  0x67, 0x66, 0x66, 0x67, 0x67, 0x66, 0x66, 0x67, 0x66, 0x67, 0x04, 0x00,
-  0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x67, 0x66, 0x66, 0x67,
-  0x66, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x00, 0x00,
-  0x00, 0x02, 0x00, 0x46, 0x00, 0x00, 0x03, 0x79, 0x04, 0x00, 0x00, 0x32,
-  0x00, 0x3f, 0x00, 0x7e, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40, 0x2f, 0x08,
-  0x01, 0x00, 0x00, 0x01, 0x03, 0x00, 0x01, 0x67, 0x00, 0x03, 0x00, 0x0a,
-  0x0b, 0x03, 0x0a, 0x67, 0x00, 0x04, 0x07, 0x01, 0x05, 0x06, 0x04, 0x05,
-  0x67, 0x00, 0x02, 0x02, 0x09, 0x5f, 0x00, 0x09, 0x09, 0x12, 0x4d, 0x00,
-  0x0b, 0x0b, 0x06, 0x5f, 0x00, 0x06, 0x06, 0x13, 0x06, 0x4e, 0x1b, 0x40,
-  0x2f, 0x08, 0x01, 0x00, 0x00, 0x01, 0x03, 0x00, 0x01, 0x67, 0x00, 0x03,
-  0x00, 0x0a, 0x0b, 0x03, 0x0a, 0x67, 0x00, 0x04, 0x07, 0x01, 0x05, 0x06,
-  0x04, 0x05, 0x67, 0x00, 0x02, 0x02, 0x09, 0x5f, 0x00, 0x09, 0x09, 0x14,
-  0x4d, 0x00, 0x0b, 0x0b, 0x06, 0x5f, 0x00, 0x06, 0x06, 0x13, 0x06, 0x4e,
-  0x59, 0x40, 0x12, 0x3f, 0x3b, 0x39, 0x35, 0x32, 0x2c, 0x18, 0x11, 0x61,
-  0x14, 0x11, 0x52, 0x41, 0x22, 0x20, 0x0c, 0x07, 0x1f, 0x2b, 0x01, 0x31,
-  0x33, 0x1d, 0x01, 0x2b, 0x01, 0x35, 0x2b, 0x03, 0x1d, 0x01, 0x3b, 0x04,
-  0x15, 0x33, 0x1d, 0x03, 0x23, 0x15, 0x2b, 0x05, 0x35, 0x23, 0x3d, 0x07,
-  0x33, 0x35, 0x3b, 0x05, 0x03, 0x31, 0x35, 0x2b, 0x03, 0x1d, 0x01, 0x3b,
-  0x03, 0x03, 0x13, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67,
-  0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67,
-  0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x67, 0x66, 0x66, 0x67, 0x66,
-  0x66, 0x67, 0x66, 0x66, 0x03, 0x99, 0x66, 0x66, 0x66, 0x66, 0x67, 0x66,
-  0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x67,
-  0x66, 0x66, 0x67, 0xfd, 0x33, 0x66, 0x66, 0x66, 0x00, 0x01, 0x00, 0x46,
-  0x00, 0x00, 0x03, 0x79, 0x04, 0x00, 0x00, 0x2e, 0x01, 0xc7, 0x4b, 0xb0,
-  0x09, 0x50, 0x58, 0x40, 0x4a, 0x00, 0x01, 0x0d, 0x0c, 0x0d, 0x01, 0x72,
-  0x00, 0x02, 0x0c, 0x0b, 0x0d, 0x02, 0x72, 0x00, 0x03, 0x0b, 0x0a, 0x0d,
-  0x03, 0x72, 0x00, 0x09, 0x04, 0x05, 0x08, 0x09, 0x72, 0x00, 0x0c, 0x00,
-  0x04, 0x09, 0x0c, 0x04, 0x67, 0x00, 0x0b, 0x00, 0x05, 0x08, 0x0b, 0x05,
-  0x67, 0x00, 0x0a, 0x00, 0x06, 0x07, 0x0a, 0x06, 0x67, 0x00, 0x0d, 0x0d,
-  0x00, 0x5f, 0x0e, 0x01, 0x00, 0x00, 0x12, 0x4d, 0x00, 0x08, 0x08, 0x07,
-  0x60, 0x00, 0x07, 0x07, 0x13, 0x07, 0x4e, 0x1b, 0x4b, 0xb0, 0x0d, 0x50,
-  0x58, 0x40, 0x4b, 0x00, 0x01, 0x0d, 0x0c, 0x0d, 0x01, 0x72, 0x00, 0x02,
-  0x0c, 0x0b, 0x0d, 0x02, 0x72, 0x00, 0x03, 0x0b, 0x0a, 0x0b, 0x03, 0x0a,
-  0x80, 0x00, 0x09, 0x04, 0x05, 0x08, 0x09, 0x72, 0x00, 0x0c, 0x00, 0x04,
-  0x09, 0x0c, 0x04, 0x67, 0x00, 0x0b, 0x00, 0x05, 0x08, 0x0b, 0x05, 0x67,
-  0x00, 0x0a, 0x00, 0x06, 0x07, 0x0a, 0x06, 0x67, 0x00, 0x0d, 0x0d, 0x00,
-  0x5f, 0x0e, 0x01, 0x00, 0x00, 0x12, 0x4d, 0x00, 0x08, 0x08, 0x07, 0x60,
-  0x00, 0x07, 0x07, 0x13, 0x07, 0x4e, 0x1b, 0x4b, 0xb0, 0x0f, 0x50, 0x58,
-  0x40, 0x4c, 0x00, 0x01, 0x0d, 0x0c, 0x0d, 0x01, 0x72, 0x00, 0x02, 0x0c,
-  0x0b, 0x0c, 0x02, 0x0b, 0x80, 0x00, 0x03, 0x0b, 0x0a, 0x0b, 0x03, 0x0a,
-  0x80, 0x00, 0x09, 0x04, 0x05, 0x08, 0x09, 0x72, 0x00, 0x0c, 0x00, 0x04,
-  0x09, 0x0c, 0x04, 0x67, 0x00, 0x0b, 0x00, 0x05, 0x08, 0x0b, 0x05, 0x67,
-  0x00, 0x0a, 0x00, 0x06, 0x07, 0x0a, 0x06, 0x67, 0x00, 0x0d, 0x0d, 0x00,
-  0x5f, 0x0e, 0x01, 0x00, 0x00, 0x12, 0x4d, 0x00, 0x08, 0x08, 0x07, 0x60,
-  0x00, 0x07, 0x07, 0x13, 0x07, 0x4e, 0x1b, 0x4b, 0xb0, 0x19, 0x50, 0x58,
-  0x40, 0x4c, 0x00, 0x01, 0x0d, 0x0c, 0x0d, 0x01, 0x72, 0x00, 0x02, 0x0c,
-  0x0b, 0x0c, 0x02, 0x0b, 0x80, 0x00, 0x03, 0x0b, 0x0a, 0x0b, 0x03, 0x0a,
-  0x80, 0x00, 0x09, 0x04, 0x05, 0x08, 0x09, 0x72, 0x00, 0x0c, 0x00, 0x04,
-  0x09, 0x0c, 0x04, 0x67, 0x00, 0x0b, 0x00, 0x05, 0x08, 0x0b, 0x05, 0x67,
-  0x00, 0x0a, 0x00, 0x06, 0x07, 0x0a, 0x06, 0x67, 0x00, 0x0d, 0x0d, 0x00,
-  0x5f, 0x0e, 0x01, 0x00, 0x00, 0x14, 0x4d, 0x00, 0x08, 0x08, 0x07, 0x60,
-  0x00, 0x07, 0x07, 0x13, 0x07, 0x4e, 0x1b, 0x40, 0x4e, 0x00, 0x01, 0x0d,
-  0x0c, 0x0d, 0x01, 0x0c, 0x80, 0x00, 0x02, 0x0c, 0x0b, 0x0c, 0x02, 0x0b,
-  0x80, 0x00, 0x03, 0x0b, 0x0a, 0x0b, 0x03, 0x0a, 0x80, 0x00, 0x09, 0x04,
-  0x05, 0x04, 0x09, 0x05, 0x80, 0x00, 0x0c, 0x00, 0x04, 0x09, 0x0c, 0x04,
-  0x67, 0x00, 0x0b, 0x00, 0x05, 0x08, 0x0b, 0x05, 0x67, 0x00, 0x0a, 0x00,
-  0x06, 0x07, 0x0a, 0x06, 0x67, 0x00, 0x0d, 0x0d, 0x00, 0x5f, 0x0e, 0x01,
-  0x00, 0x00, 0x14, 0x4d, 0x00, 0x08, 0x08, 0x07, 0x60, 0x00, 0x07, 0x07,
-  0x13, 0x07, 0x4e, 0x59, 0x59, 0x59, 0x59, 0x40, 0x23, 0x02, 0x00, 0x26,
-  0x21, 0x20, 0x1f, 0x1e, 0x1d, 0x1c, 0x1b, 0x1a, 0x19, 0x18, 0x17, 0x14,
-  0x12, 0x10, 0x0f, 0x0e, 0x0d, 0x0c, 0x0b, 0x0a, 0x09, 0x08, 0x07, 0x06,
-  0x05, 0x00, 0x2e, 0x02, 0x28, 0x0f, 0x07, 0x16, 0x2b, 0x01, 0x31, 0x33,
-  0x1d, 0x02, 0x23, 0x15, 0x23, 0x15, 0x23, 0x15, 0x23, 0x15, 0x23, 0x15,
-  0x23, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x02, 0x33, 0x35, 0x33, 0x35, 0x33,
-  0x35, 0x33, 0x35, 0x33, 0x35, 0x2b, 0x04, 0x3d, 0x01, 0x3b, 0x05, 0x03,
-  0x13, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x67, 0x66,
-  0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x67, 0x66, 0x66, 0x67,
-  0x66, 0x66, 0x04, 0x00, 0x67, 0x66, 0x66, 0x67, 0x66, 0x67, 0x66, 0x66,
-  0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x67, 0x66, 0x66, 0x67,
-  0x00, 0x03, 0x00, 0x46, 0x00, 0x00, 0x03, 0x79, 0x04, 0x00, 0x00, 0x28,
-  0x00, 0x33, 0x00, 0x42, 0x00, 0x8c, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40,
-  0x32, 0x08, 0x01, 0x00, 0x07, 0x01, 0x01, 0x0c, 0x00, 0x01, 0x67, 0x0e,
-  0x01, 0x0b, 0x00, 0x0c, 0x02, 0x0b, 0x0c, 0x67, 0x06, 0x01, 0x02, 0x05,
-  0x01, 0x03, 0x04, 0x02, 0x03, 0x67, 0x00, 0x0a, 0x0a, 0x09, 0x5f, 0x00,
-  0x09, 0x09, 0x12, 0x4d, 0x00, 0x0d, 0x0d, 0x04, 0x5f, 0x00, 0x04, 0x04,
-  0x13, 0x04, 0x4e, 0x1b, 0x40, 0x32, 0x08, 0x01, 0x00, 0x07, 0x01, 0x01,
-  0x0c, 0x00, 0x01, 0x67, 0x0e, 0x01, 0x0b, 0x00, 0x0c, 0x02, 0x0b, 0x0c,
-  0x67, 0x06, 0x01, 0x02, 0x05, 0x01, 0x03, 0x04, 0x02, 0x03, 0x67, 0x00,
-  0x0a, 0x0a, 0x09, 0x5f, 0x00, 0x09, 0x09, 0x14, 0x4d, 0x00, 0x0d, 0x0d,
-  0x04, 0x5f, 0x00, 0x04, 0x04, 0x13, 0x04, 0x4e, 0x59, 0x40, 0x1a, 0x29,
-  0x29, 0x41, 0x3d, 0x3a, 0x36, 0x29, 0x33, 0x29, 0x30, 0x2f, 0x2b, 0x28,
-  0x22, 0x13, 0x11, 0x14, 0x11, 0x61, 0x14, 0x11, 0x13, 0x20, 0x0f, 0x07,
-  0x1f, 0x2b, 0x01, 0x31, 0x33, 0x1d, 0x02, 0x23, 0x15, 0x33, 0x1d, 0x03,
-  0x23, 0x15, 0x2b, 0x05, 0x35, 0x23, 0x3d, 0x03, 0x33, 0x35, 0x23, 0x3d,
-  0x02, 0x33, 0x35, 0x3b, 0x05, 0x03, 0x31, 0x35, 0x2b, 0x03, 0x15, 0x3b,
-  0x02, 0x13, 0x31, 0x35, 0x2b, 0x03, 0x1d, 0x02, 0x3b, 0x03, 0x35, 0x03,
-  0x13, 0x66, 0x66, 0x66, 0x66, 0x67, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66,
-  0x66, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x67, 0x67, 0x66, 0x67,
-  0x66, 0x66, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x66, 0x66,
-  0x67, 0x66, 0x03, 0x99, 0x66, 0x66, 0x67, 0x66, 0x67, 0x66, 0x66, 0x67,
-  0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x67, 0x66, 0x66, 0x67, 0xfe,
-  0xcd, 0x66, 0x66, 0xfe, 0xcc, 0x67, 0x67, 0x66, 0x66, 0x66, 0x00, 0x00,
-  0x00, 0x02, 0x00, 0x46, 0x00, 0x00, 0x03, 0x79, 0x04, 0x00, 0x00, 0x32,
-  0x00, 0x3f, 0x00, 0x7e, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40, 0x2f, 0x08,
-  0x01, 0x00, 0x00, 0x07, 0x06, 0x00, 0x07, 0x67, 0x00, 0x0b, 0x00, 0x06,
-  0x04, 0x0b, 0x06, 0x67, 0x00, 0x04, 0x03, 0x01, 0x01, 0x02, 0x04, 0x01,
-  0x67, 0x00, 0x0a, 0x0a, 0x09, 0x5f, 0x00, 0x09, 0x09, 0x12, 0x4d, 0x00,
-  0x05, 0x05, 0x02, 0x5f, 0x00, 0x02, 0x02, 0x13, 0x02, 0x4e, 0x1b, 0x40,
-  0x2f, 0x08, 0x01, 0x00, 0x00, 0x07, 0x06, 0x00, 0x07, 0x67, 0x00, 0x0b,
-  0x00, 0x06, 0x04, 0x0b, 0x06, 0x67, 0x00, 0x04, 0x03, 0x01, 0x01, 0x02,
-  0x04, 0x01, 0x67, 0x00, 0x0a, 0x0a, 0x09, 0x5f, 0x00, 0x09, 0x09, 0x14,
-  0x4d, 0x00, 0x05, 0x05, 0x02, 0x5f, 0x00, 0x02, 0x02, 0x13, 0x02, 0x4e,
-  0x59, 0x40, 0x12, 0x3f, 0x3b, 0x39, 0x35, 0x32, 0x2c, 0x14, 0x11, 0x52,
-  0x41, 0x22, 0x11, 0x61, 0x18, 0x20, 0x0c, 0x07, 0x1f, 0x2b, 0x01, 0x31,
-  0x33, 0x1d, 0x07, 0x23, 0x15, 0x2b, 0x05, 0x35, 0x23, 0x3d, 0x01, 0x3b,
-  0x01, 0x15, 0x3b, 0x03, 0x3d, 0x01, 0x2b, 0x04, 0x35, 0x23, 0x3d, 0x03,
-  0x33, 0x35, 0x3b, 0x05, 0x03, 0x31, 0x35, 0x2b, 0x03, 0x1d, 0x01, 0x3b,
-  0x03, 0x03, 0x12, 0x67, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66,
-  0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66,
-  0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x66, 0x66, 0x67, 0x66, 0x66,
-  0x66, 0x66, 0x67, 0x66, 0x03, 0x99, 0x66, 0x66, 0x67, 0x66, 0x67, 0x66,
-  0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x66, 0x66, 0x67, 0x66, 0x67,
-  0x66, 0x66, 0x67, 0xfe, 0xcd, 0x66, 0x66, 0x67, 0x00, 0x02, 0x00, 0x46,
-  0x00, 0x00, 0x01, 0x13, 0x03, 0x99, 0x00, 0x08, 0x00, 0x11, 0x00, 0x26,
-  0x40, 0x23, 0x04, 0x01, 0x00, 0x00, 0x01, 0x02, 0x00, 0x01, 0x67, 0x00,
-  0x02, 0x02, 0x03, 0x5f, 0x00, 0x03, 0x03, 0x13, 0x03, 0x4e, 0x02, 0x00,
-  0x10, 0x0e, 0x0c, 0x09, 0x06, 0x04, 0x00, 0x08, 0x02, 0x08, 0x05, 0x07,
-  0x16, 0x2b, 0x13, 0x31, 0x33, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x11,
-  0x31, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x35, 0xac, 0x67, 0x67, 0x66,
-  0x66, 0x67, 0x67, 0x66, 0x03, 0x99, 0x67, 0x66, 0x66, 0x67, 0xfd, 0x34,
-  0x67, 0x66, 0x66, 0x00, 0x00, 0x02, 0x00, 0x46, 0xff, 0x9a, 0x01, 0x12,
-  0x03, 0x99, 0x00, 0x08, 0x00, 0x13, 0x00, 0x5c, 0x4b, 0xb0, 0x19, 0x50,
-  0x58, 0x40, 0x1f, 0x00, 0x03, 0x04, 0x04, 0x03, 0x71, 0x05, 0x01, 0x00,
-  0x00, 0x01, 0x02, 0x00, 0x01, 0x67, 0x00, 0x02, 0x04, 0x04, 0x02, 0x57,
-  0x00, 0x02, 0x02, 0x04, 0x5f, 0x00, 0x04, 0x02, 0x04, 0x4f, 0x1b, 0x40,
-  0x1e, 0x00, 0x03, 0x04, 0x03, 0x86, 0x05, 0x01, 0x00, 0x00, 0x01, 0x02,
-  0x00, 0x01, 0x67, 0x00, 0x02, 0x04, 0x04, 0x02, 0x57, 0x00, 0x02, 0x02,
-  0x04, 0x5f, 0x00, 0x04, 0x02, 0x04, 0x4f, 0x59, 0x40, 0x11, 0x02, 0x00,
-  0x12, 0x11, 0x10, 0x0f, 0x0c, 0x09, 0x06, 0x04, 0x00, 0x08, 0x02, 0x08,
-  0x06, 0x06, 0x16, 0x2b, 0x13, 0x31, 0x33, 0x1d, 0x01, 0x2b, 0x01, 0x3d,
-  0x01, 0x11, 0x31, 0x3b, 0x01, 0x1d, 0x02, 0x23, 0x35, 0x23, 0x35, 0xac,
-  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x03, 0x99, 0x67, 0x66, 0x66,
-  0x67, 0xfd, 0x34, 0x66, 0x67, 0x66, 0x66, 0x67, 0x00, 0x01, 0x00, 0x46,
-  0x00, 0x00, 0x03, 0x78, 0x03, 0xff, 0x00, 0x30, 0x00, 0xc0, 0x4b, 0xb0,
-  0x19, 0x50, 0x58, 0x40, 0x4b, 0x00, 0x0f, 0x00, 0x01, 0x00, 0x0f, 0x72,
-  0x00, 0x0a, 0x04, 0x05, 0x09, 0x0a, 0x72, 0x00, 0x0e, 0x00, 0x02, 0x0d,
-  0x0e, 0x02, 0x67, 0x00, 0x0d, 0x00, 0x03, 0x0c, 0x0d, 0x03, 0x67, 0x00,
-  0x0c, 0x00, 0x0b, 0x04, 0x0c, 0x0b, 0x67, 0x00, 0x04, 0x00, 0x09, 0x06,
-  0x04, 0x09, 0x67, 0x00, 0x05, 0x00, 0x08, 0x07, 0x05, 0x08, 0x67, 0x00,
-  0x01, 0x01, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x12, 0x4d, 0x00, 0x06, 0x06,
-  0x07, 0x5f, 0x00, 0x07, 0x07, 0x13, 0x07, 0x4e, 0x1b, 0x40, 0x4d, 0x00,
-  0x0f, 0x00, 0x01, 0x00, 0x0f, 0x01, 0x80, 0x00, 0x0a, 0x04, 0x05, 0x04,
-  0x0a, 0x05, 0x80, 0x00, 0x0e, 0x00, 0x02, 0x0d, 0x0e, 0x02, 0x67, 0x00,
-  0x0d, 0x00, 0x03, 0x0c, 0x0d, 0x03, 0x67, 0x00, 0x0c, 0x00, 0x0b, 0x04,
-  0x0c, 0x0b, 0x67, 0x00, 0x04, 0x00, 0x09, 0x06, 0x04, 0x09, 0x67, 0x00,
-  0x05, 0x00, 0x08, 0x07, 0x05, 0x08, 0x67, 0x00, 0x01, 0x01, 0x00, 0x5f,
-  0x00, 0x00, 0x00, 0x12, 0x4d, 0x00, 0x06, 0x06, 0x07, 0x5f, 0x00, 0x07,
-  0x07, 0x13, 0x07, 0x4e, 0x59, 0x40, 0x1a, 0x30, 0x2e, 0x2d, 0x2b, 0x2a,
-  0x28, 0x27, 0x26, 0x24, 0x23, 0x22, 0x20, 0x1f, 0x1d, 0x21, 0x12, 0x21,
-  0x21, 0x22, 0x21, 0x21, 0x22, 0x20, 0x10, 0x07, 0x1f, 0x2b, 0x01, 0x31,
-  0x33, 0x1d, 0x01, 0x2b, 0x01, 0x15, 0x2b, 0x01, 0x15, 0x2b, 0x01, 0x1d,
-  0x01, 0x3b, 0x01, 0x15, 0x3b, 0x01, 0x15, 0x3b, 0x01, 0x1d, 0x01, 0x23,
-  0x35, 0x2b, 0x01, 0x35, 0x2b, 0x01, 0x35, 0x2b, 0x01, 0x35, 0x23, 0x3d,
-  0x01, 0x33, 0x35, 0x3b, 0x01, 0x35, 0x3b, 0x01, 0x35, 0x3b, 0x01, 0x03,
-  0x12, 0x66, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x67, 0x66, 0x66, 0x67,
-  0x66, 0x66, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x66, 0x66,
-  0x67, 0x66, 0x66, 0x67, 0x66, 0x03, 0xff, 0x66, 0x67, 0x66, 0x66, 0x67,
-  0x66, 0x66, 0x67, 0x66, 0x66, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66,
-  0x66, 0x67, 0x00, 0x00, 0x00, 0x02, 0x00, 0x46, 0x00, 0xcc, 0x03, 0x79,
-  0x03, 0x32, 0x00, 0x14, 0x00, 0x29, 0x00, 0x31, 0x40, 0x2e, 0x04, 0x01,
-  0x00, 0x00, 0x01, 0x02, 0x00, 0x01, 0x67, 0x05, 0x01, 0x02, 0x03, 0x03,
-  0x02, 0x57, 0x05, 0x01, 0x02, 0x02, 0x03, 0x5f, 0x00, 0x03, 0x02, 0x03,
-  0x4f, 0x18, 0x15, 0x02, 0x00, 0x22, 0x1a, 0x15, 0x29, 0x18, 0x24, 0x0c,
-  0x04, 0x00, 0x14, 0x02, 0x0e, 0x06, 0x07, 0x16, 0x2b, 0x01, 0x31, 0x33,
-  0x1d, 0x01, 0x2b, 0x07, 0x3d, 0x01, 0x3b, 0x05, 0x11, 0x31, 0x3b, 0x01,
-  0x1d, 0x01, 0x2b, 0x07, 0x3d, 0x01, 0x3b, 0x04, 0x03, 0x13, 0x66, 0x66,
-  0x66, 0x67, 0x66, 0x67, 0x66, 0x66, 0x67, 0x67, 0x66, 0x66, 0x67, 0x66,
-  0x67, 0x66, 0x66, 0x66, 0x66, 0x67, 0x66, 0x67, 0x66, 0x66, 0x67, 0x67,
-  0x66, 0x66, 0x67, 0x66, 0x03, 0x32, 0x66, 0x66, 0x66, 0x66, 0xfe, 0x67,
-  0x66, 0x67, 0x67, 0x66, 0x00, 0x01, 0x00, 0x46, 0x00, 0x00, 0x03, 0x78,
-  0x03, 0xff, 0x00, 0x30, 0x00, 0xc0, 0x4b, 0xb0, 0x19, 0x50, 0x58, 0x40,
-  0x4b, 0x00, 0x0a, 0x05, 0x04, 0x09, 0x0a, 0x72, 0x00, 0x0f, 0x01, 0x00,
-  0x00, 0x0f, 0x72, 0x00, 0x08, 0x00, 0x05, 0x0a, 0x08, 0x05, 0x67, 0x00,
-  0x09, 0x00, 0x04, 0x0b, 0x09, 0x04, 0x67, 0x00, 0x0b, 0x00, 0x0c, 0x03,
-  0x0b, 0x0c, 0x67, 0x00, 0x03, 0x00, 0x0d, 0x02, 0x03, 0x0d, 0x67, 0x00,
-  0x02, 0x00, 0x0e, 0x01, 0x02, 0x0e, 0x67, 0x00, 0x06, 0x06, 0x07, 0x5f,
-  0x00, 0x07, 0x07, 0x12, 0x4d, 0x00, 0x01, 0x01, 0x00, 0x5f, 0x00, 0x00,
-  0x00, 0x13, 0x00, 0x4e, 0x1b, 0x40, 0x4d, 0x00, 0x0a, 0x05, 0x04, 0x05,
-  0x0a, 0x04, 0x80, 0x00, 0x0f, 0x01, 0x00, 0x01, 0x0f, 0x00, 0x80, 0x00,
-  0x08, 0x00, 0x05, 0x0a, 0x08, 0x05, 0x67, 0x00, 0x09, 0x00, 0x04, 0x0b,
-  0x09, 0x04, 0x67, 0x00, 0x0b, 0x00, 0x0c, 0x03, 0x0b, 0x0c, 0x67, 0x00,
-  0x03, 0x00, 0x0d, 0x02, 0x03, 0x0d, 0x67, 0x00, 0x02, 0x00, 0x0e, 0x01,
-  0x02, 0x0e, 0x67, 0x00, 0x06, 0x06, 0x07, 0x5f, 0x00, 0x07, 0x07, 0x12,
-  0x4d, 0x00, 0x01, 0x01, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x13, 0x00, 0x4e,
-  0x59, 0x40, 0x1a, 0x30, 0x2e, 0x2d, 0x2b, 0x2a, 0x28, 0x27, 0x26, 0x24,
-  0x23, 0x22, 0x20, 0x1f, 0x1d, 0x21, 0x12, 0x21, 0x21, 0x22, 0x21, 0x21,
-  0x22, 0x20, 0x10, 0x07, 0x1f, 0x2b, 0x33, 0x31, 0x23, 0x3d, 0x01, 0x3b,
-  0x01, 0x35, 0x3b, 0x01, 0x35, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x35,
-  0x2b, 0x01, 0x35, 0x2b, 0x01, 0x3d, 0x01, 0x33, 0x15, 0x3b, 0x01, 0x15,
-  0x3b, 0x01, 0x15, 0x3b, 0x01, 0x15, 0x33, 0x1d, 0x01, 0x23, 0x15, 0x2b,
-  0x01, 0x15, 0x2b, 0x01, 0x15, 0x2b, 0x01, 0xac, 0x66, 0x66, 0x66, 0x67,
-  0x66, 0x66, 0x67, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x66, 0x66, 0x67,
-  0x66, 0x66, 0x67, 0x66, 0x66, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66,
-  0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67,
-  0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x00, 0x00, 0x02, 0x00, 0x46,
-  0x00, 0x00, 0x03, 0x78, 0x03, 0xff, 0x00, 0x28, 0x00, 0x31, 0x00, 0xf6,
-  0x4b, 0xb0, 0x09, 0x50, 0x58, 0x40, 0x42, 0x00, 0x07, 0x09, 0x01, 0x06,
-  0x07, 0x72, 0x00, 0x02, 0x06, 0x05, 0x08, 0x02, 0x72, 0x00, 0x09, 0x07,
-  0x00, 0x09, 0x57, 0x0a, 0x01, 0x00, 0x00, 0x01, 0x06, 0x00, 0x01, 0x67,
-  0x00, 0x06, 0x00, 0x03, 0x04, 0x06, 0x03, 0x68, 0x00, 0x05, 0x00, 0x04,
-  0x0c, 0x05, 0x04, 0x67, 0x00, 0x08, 0x08, 0x0b, 0x5f, 0x00, 0x0b, 0x0b,
-  0x12, 0x4d, 0x00, 0x0c, 0x0c, 0x0d, 0x5f, 0x00, 0x0d, 0x0d, 0x13, 0x0d,
-  0x4e, 0x1b, 0x4b, 0xb0, 0x19, 0x50, 0x58, 0x40, 0x43, 0x00, 0x07, 0x09,
-  0x01, 0x06, 0x07, 0x72, 0x00, 0x02, 0x06, 0x05, 0x06, 0x02, 0x05, 0x80,
-  0x00, 0x09, 0x07, 0x00, 0x09, 0x57, 0x0a, 0x01, 0x00, 0x00, 0x01, 0x06,
-  0x00, 0x01, 0x67, 0x00, 0x06, 0x00, 0x03, 0x04, 0x06, 0x03, 0x68, 0x00,
-  0x05, 0x00, 0x04, 0x0c, 0x05, 0x04, 0x67, 0x00, 0x08, 0x08, 0x0b, 0x5f,
-  0x00, 0x0b, 0x0b, 0x12, 0x4d, 0x00, 0x0c, 0x0c, 0x0d, 0x5f, 0x00, 0x0d,
-  0x0d, 0x13, 0x0d, 0x4e, 0x1b, 0x40, 0x44, 0x00, 0x07, 0x09, 0x01, 0x09,
-  0x07, 0x01, 0x80, 0x00, 0x02, 0x06, 0x05, 0x06, 0x02, 0x05, 0x80, 0x00,
-  0x09, 0x07, 0x00, 0x09, 0x57, 0x0a, 0x01, 0x00, 0x00, 0x01, 0x06, 0x00,
-  0x01, 0x67, 0x00, 0x06, 0x00, 0x03, 0x04, 0x06, 0x03, 0x68, 0x00, 0x05,
-  0x00, 0x04, 0x0c, 0x05, 0x04, 0x67, 0x00, 0x08, 0x08, 0x0b, 0x5f, 0x00,
-  0x0b, 0x0b, 0x12, 0x4d, 0x00, 0x0c, 0x0c, 0x0d, 0x5f, 0x00, 0x0d, 0x0d,
-  0x13, 0x0d, 0x4e, 0x59, 0x59, 0x40, 0x16, 0x30, 0x2e, 0x2c, 0x29, 0x28,
-  0x22, 0x21, 0x20, 0x1e, 0x1c, 0x41, 0x11, 0x11, 0x22, 0x21, 0x21, 0x11,
-  0x13, 0x20, 0x0e, 0x07, 0x1f, 0x2b, 0x01, 0x31, 0x33, 0x1d, 0x02, 0x23,
-  0x15, 0x23, 0x15, 0x2b, 0x01, 0x15, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01,
-  0x35, 0x33, 0x35, 0x33, 0x35, 0x2b, 0x03, 0x15, 0x2b, 0x01, 0x3d, 0x01,
-  0x33, 0x35, 0x3b, 0x05, 0x01, 0x31, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01,
-  0x35, 0x03, 0x12, 0x66, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x67, 0x66,
-  0x66, 0x67, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x66, 0x66, 0x67, 0x66,
-  0x66, 0x67, 0x66, 0xfe, 0x00, 0x67, 0x66, 0x66, 0x67, 0x03, 0x99, 0x67,
-  0x66, 0x66, 0x67, 0x66, 0x66, 0x66, 0x66, 0x67, 0x66, 0x66, 0x66, 0x66,
-  0x67, 0x66, 0xfc, 0xcd, 0x66, 0x66, 0x66, 0x00, 0x00, 0x02, 0x00, 0x46,
-  0x00, 0x00, 0x03, 0x79, 0x03, 0xff, 0x00, 0x52, 0x00, 0x5b, 0x00, 0xb8,
-  0x4b, 0xb0, 0x19, 0x50, 0x58, 0x40, 0x46, 0x08, 0x01, 0x06, 0x00, 0x04,
-  0x07, 0x06, 0x72, 0x00, 0x09, 0x01, 0x0c, 0x0a, 0x09, 0x72, 0x00, 0x04,
-  0x00, 0x03, 0x10, 0x04, 0x03, 0x67, 0x00, 0x10, 0x00, 0x0f, 0x02, 0x10,
-  0x0f, 0x67, 0x05, 0x01, 0x02, 0x00, 0x01, 0x09, 0x02, 0x01, 0x68, 0x0d,
-  0x01, 0x00, 0x00, 0x0c, 0x0a, 0x00, 0x0c, 0x67, 0x00, 0x07, 0x07, 0x0e,
-  0x5f, 0x00, 0x0e, 0x0e, 0x12, 0x4d, 0x00, 0x0a, 0x0a, 0x0b, 0x60, 0x00,
-  0x0b, 0x0b, 0x13, 0x0b, 0x4e, 0x1b, 0x40, 0x48, 0x08, 0x01, 0x06, 0x00,
-  0x04, 0x00, 0x06, 0x04, 0x80, 0x00, 0x09, 0x01, 0x0c, 0x01, 0x09, 0x0c,
-  0x80, 0x00, 0x04, 0x00, 0x03, 0x10, 0x04, 0x03, 0x67, 0x00, 0x10, 0x00,
-  0x0f, 0x02, 0x10, 0x0f, 0x67, 0x05, 0x01, 0x02, 0x00, 0x01, 0x09, 0x02,
-  0x01, 0x68, 0x0d, 0x01, 0x00, 0x00, 0x0c, 0x0a, 0x00, 0x0c, 0x67, 0x00,
-  0x07, 0x07, 0x0e, 0x5f, 0x00, 0x0e, 0x0e, 0x12, 0x4d, 0x00, 0x0a, 0x0a,
-  0x0b, 0x60, 0x00, 0x0b, 0x0b, 0x13, 0x0b, 0x4e, 0x59, 0x40, 0x1c, 0x5b,
-  0x5a, 0x57, 0x56, 0x52, 0x4c, 0x4b, 0x4a, 0x42, 0x41, 0x40, 0x3a, 0x39,
-  0x34, 0x33, 0x32, 0x11, 0x41, 0x15, 0x14, 0x31, 0x23, 0x21, 0x57, 0x20,
-  0x11, 0x07, 0x1f, 0x2b, 0x01, 0x31, 0x33, 0x1d, 0x06, 0x2b, 0x04, 0x35,
-  0x3b, 0x01, 0x3d, 0x02, 0x2b, 0x01, 0x35, 0x3b, 0x02, 0x1d, 0x03, 0x33,
-  0x3d, 0x04, 0x23, 0x35, 0x2b, 0x03, 0x15, 0x23, 0x1d, 0x05, 0x33, 0x15,
-  0x3b, 0x04, 0x15, 0x2b, 0x05, 0x35, 0x23, 0x3d, 0x07, 0x33, 0x35, 0x3b,
-  0x05, 0x01, 0x31, 0x1d, 0x01, 0x23, 0x3d, 0x02, 0x33, 0x03, 0x13, 0x66,
-  0x66, 0x67, 0x66, 0x67, 0x66, 0x66, 0x67, 0x67, 0x66, 0x66, 0x67, 0x66,
-  0x67, 0x67, 0x66, 0x67, 0x66, 0x66, 0x67, 0x67, 0x66, 0x66, 0x67, 0x66,
-  0x67, 0x67, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66,
-  0x67, 0x66, 0x67, 0xfe, 0x66, 0x66, 0x66, 0x03, 0x99, 0x67, 0x66, 0x66,
-  0x67, 0x66, 0x66, 0x67, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66,
-  0x66, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x67, 0x66, 0x66, 0x67, 0x66,
-  0x66, 0x67, 0x66, 0x66, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66,
-  0x67, 0x66, 0xfe, 0x00, 0x66, 0x66, 0x66, 0x66, 0x67, 0x00, 0x00, 0x00,
-  0x00, 0x02, 0x00, 0x46, 0xff, 0xff, 0x03, 0x79, 0x03, 0xff, 0x00, 0x2a,
-  0x00, 0x39, 0x00, 0x80, 0x4b, 0xb0, 0x19, 0x50, 0x58, 0x40, 0x2f, 0x07,
-  0x01, 0x05, 0x06, 0x09, 0x00, 0x05, 0x72, 0x0a, 0x01, 0x08, 0x00, 0x0b,
-  0x09, 0x08, 0x72, 0x00, 0x0b, 0x00, 0x02, 0x01, 0x0b, 0x02, 0x67, 0x00,
-  0x09, 0x09, 0x06, 0x5f, 0x00, 0x06, 0x06, 0x12, 0x4d, 0x04, 0x01, 0x00,
-  0x00, 0x01, 0x60, 0x03, 0x01, 0x01, 0x01, 0x13, 0x01, 0x4e, 0x1b, 0x40,
-  0x31, 0x07, 0x01, 0x05, 0x06, 0x09, 0x06, 0x05, 0x09, 0x80, 0x0a, 0x01,
-  0x08, 0x00, 0x0b, 0x00, 0x08, 0x0b, 0x80, 0x00, 0x0b, 0x00, 0x02, 0x01,
-  0x0b, 0x02, 0x67, 0x00, 0x09, 0x09, 0x06, 0x5f, 0x00, 0x06, 0x06, 0x12,
-  0x4d, 0x04, 0x01, 0x00, 0x00, 0x01, 0x60, 0x03, 0x01, 0x01, 0x01, 0x13,
-  0x01, 0x4e, 0x59, 0x40, 0x12, 0x39, 0x35, 0x33, 0x32, 0x31, 0x2f, 0x13,
-  0x11, 0x41, 0x11, 0x18, 0x23, 0x43, 0x28, 0x20, 0x0c, 0x07, 0x1f, 0x2b,
-  0x01, 0x31, 0x33, 0x1d, 0x07, 0x2b, 0x01, 0x3d, 0x02, 0x2b, 0x03, 0x1d,
-  0x02, 0x2b, 0x01, 0x3d, 0x07, 0x33, 0x35, 0x33, 0x35, 0x3b, 0x03, 0x15,
-  0x33, 0x03, 0x31, 0x35, 0x23, 0x35, 0x2b, 0x01, 0x15, 0x23, 0x1d, 0x01,
-  0x3b, 0x03, 0x03, 0x13, 0x66, 0x66, 0x66, 0x67, 0x66, 0x67, 0x66, 0x66,
-  0x67, 0x67, 0x66, 0x66, 0x67, 0x66, 0x67, 0x66, 0x65, 0x67, 0x66, 0x67,
-  0x66, 0x66, 0x67, 0x66, 0x67, 0x03, 0x32, 0x67, 0x66, 0x66, 0x67, 0x66,
-  0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66,
-  0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x67, 0x67, 0xfe, 0xce, 0x66, 0x67,
-  0x67, 0x66, 0x66, 0x00, 0x00, 0x03, 0x00, 0x46, 0x00, 0x00, 0x03, 0x79,
-  0x04, 0x00, 0x00, 0x26, 0x00, 0x33, 0x00, 0x40, 0x00, 0x7d, 0x4b, 0xb0,
-  0x0f, 0x50, 0x58, 0x40, 0x2e, 0x00, 0x00, 0x00, 0x01, 0x08, 0x00, 0x01,
-  0x67, 0x0a, 0x01, 0x08, 0x00, 0x06, 0x07, 0x08, 0x06, 0x67, 0x00, 0x02,
-  0x00, 0x03, 0x04, 0x02, 0x03, 0x67, 0x00, 0x09, 0x09, 0x05, 0x5f, 0x00,
-  0x05, 0x05, 0x12, 0x4d, 0x00, 0x07, 0x07, 0x04, 0x5f, 0x00, 0x04, 0x04,
-  0x13, 0x04, 0x4e, 0x1b, 0x40, 0x2e, 0x00, 0x00, 0x00, 0x01, 0x08, 0x00,
-  0x01, 0x67, 0x0a, 0x01, 0x08, 0x00, 0x06, 0x07, 0x08, 0x06, 0x67, 0x00,
-  0x02, 0x00, 0x03, 0x04, 0x02, 0x03, 0x67, 0x00, 0x09, 0x09, 0x05, 0x5f,
-  0x00, 0x05, 0x05, 0x14, 0x4d, 0x00, 0x07, 0x07, 0x04, 0x5f, 0x00, 0x04,
-  0x04, 0x13, 0x04, 0x4e, 0x59, 0x40, 0x13, 0x36, 0x34, 0x3c, 0x38, 0x34,
-  0x40, 0x36, 0x3e, 0x42, 0x43, 0x7a, 0x71, 0x14, 0x11, 0x13, 0x20, 0x0b,
-  0x07, 0x1e, 0x2b, 0x01, 0x31, 0x33, 0x1d, 0x02, 0x23, 0x15, 0x33, 0x1d,
-  0x03, 0x23, 0x15, 0x2b, 0x06, 0x3d, 0x09, 0x3b, 0x06, 0x03, 0x31, 0x35,
-  0x2b, 0x03, 0x1d, 0x01, 0x3b, 0x03, 0x03, 0x31, 0x33, 0x3d, 0x01, 0x2b,
-  0x03, 0x1d, 0x01, 0x3b, 0x01, 0x03, 0x13, 0x66, 0x66, 0x66, 0x66, 0x66,
-  0x67, 0x66, 0x67, 0x66, 0x66, 0x67, 0x67, 0x66, 0x66, 0x67, 0x66, 0x67,
-  0x66, 0x66, 0x67, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x67, 0x67, 0x67,
-  0x67, 0x66, 0x67, 0x66, 0x66, 0x67, 0x03, 0x99, 0x66, 0x67, 0x66, 0x66,
-  0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66,
-  0x67, 0x66, 0x67, 0xfd, 0x33, 0x66, 0x66, 0x66, 0x01, 0x99, 0x66, 0x67,
-  0x67, 0x66, 0x00, 0x00, 0x00, 0x01, 0x00, 0x46, 0x00, 0x00, 0x03, 0x79,
-  0x04, 0x00, 0x00, 0x34, 0x00, 0x6a, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40,
-  0x27, 0x08, 0x01, 0x00, 0x00, 0x01, 0x04, 0x00, 0x01, 0x67, 0x00, 0x04,
-  0x07, 0x01, 0x05, 0x06, 0x04, 0x05, 0x67, 0x00, 0x02, 0x02, 0x09, 0x5f,
-  0x00, 0x09, 0x09, 0x12, 0x4d, 0x00, 0x03, 0x03, 0x06, 0x5f, 0x00, 0x06,
-  0x06, 0x13, 0x06, 0x4e, 0x1b, 0x40, 0x27, 0x08, 0x01, 0x00, 0x00, 0x01,
-  0x04, 0x00, 0x01, 0x67, 0x00, 0x04, 0x07, 0x01, 0x05, 0x06, 0x04, 0x05,
-  0x67, 0x00, 0x02, 0x02, 0x09, 0x5f, 0x00, 0x09, 0x09, 0x14, 0x4d, 0x00,
-  0x03, 0x03, 0x06, 0x5f, 0x00, 0x06, 0x06, 0x13, 0x06, 0x4e, 0x59, 0x40,
-  0x0e, 0x34, 0x2e, 0x18, 0x11, 0x61, 0x12, 0x21, 0x46, 0x41, 0x22, 0x20,
-  0x0a, 0x07, 0x1f, 0x2b, 0x01, 0x31, 0x33, 0x1d, 0x01, 0x2b, 0x01, 0x35,
-  0x2b, 0x03, 0x1d, 0x05, 0x3b, 0x03, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x23,
-  0x15, 0x2b, 0x05, 0x35, 0x23, 0x3d, 0x07, 0x33, 0x35, 0x3b, 0x05, 0x03,
-  0x13, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66,
-  0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x67, 0x66,
-  0x66, 0x67, 0x66, 0x66, 0x67, 0x03, 0x99, 0x66, 0x67, 0x67, 0x67, 0x66,
-  0x66, 0x67, 0x66, 0x66, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66,
-  0x67, 0x66, 0x66, 0x67, 0x66, 0x67, 0x00, 0x00, 0x00, 0x02, 0x00, 0x46,
-  0x00, 0x00, 0x03, 0x79, 0x04, 0x00, 0x00, 0x24, 0x00, 0x39, 0x00, 0x63,
-  0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40, 0x25, 0x00, 0x00, 0x00, 0x01, 0x07,
-  0x00, 0x01, 0x67, 0x00, 0x05, 0x00, 0x02, 0x03, 0x05, 0x02, 0x67, 0x00,
-  0x06, 0x06, 0x04, 0x5f, 0x00, 0x04, 0x04, 0x12, 0x4d, 0x00, 0x07, 0x07,
-  0x03, 0x5f, 0x00, 0x03, 0x03, 0x13, 0x03, 0x4e, 0x1b, 0x40, 0x25, 0x00,
-  0x00, 0x00, 0x01, 0x07, 0x00, 0x01, 0x67, 0x00, 0x05, 0x00, 0x02, 0x03,
-  0x05, 0x02, 0x67, 0x00, 0x06, 0x06, 0x04, 0x5f, 0x00, 0x04, 0x04, 0x14,
-  0x4d, 0x00, 0x07, 0x07, 0x03, 0x5f, 0x00, 0x03, 0x03, 0x13, 0x03, 0x4e,
-  0x59, 0x40, 0x0b, 0x46, 0x43, 0x11, 0x6a, 0x61, 0x11, 0x16, 0x20, 0x08,
-  0x07, 0x1e, 0x2b, 0x01, 0x31, 0x33, 0x1d, 0x05, 0x23, 0x15, 0x23, 0x15,
-  0x2b, 0x05, 0x3d, 0x09, 0x3b, 0x05, 0x15, 0x33, 0x07, 0x31, 0x35, 0x2b,
-  0x03, 0x1d, 0x05, 0x3b, 0x03, 0x3d, 0x03, 0x03, 0x13, 0x66, 0x66, 0x67,
-  0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66,
-  0x67, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x03, 0x33,
-  0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66,
-  0x67, 0x66, 0x66, 0x67, 0x66, 0x67, 0x67, 0xcd, 0x67, 0x67, 0x66, 0x66,
-  0x67, 0x66, 0x66, 0x66, 0x66, 0x67, 0x66, 0x00, 0x00, 0x01, 0x00, 0x46,
-  0x00, 0x00, 0x03, 0x79, 0x04, 0x00, 0x00, 0x3a, 0x00, 0x9c, 0x4b, 0xb0,
-  0x0f, 0x50, 0x58, 0x40, 0x25, 0x00, 0x03, 0x02, 0x04, 0x04, 0x03, 0x72,
-  0x00, 0x02, 0x00, 0x04, 0x05, 0x02, 0x04, 0x67, 0x00, 0x01, 0x01, 0x00,
-  0x5f, 0x07, 0x01, 0x00, 0x00, 0x12, 0x4d, 0x00, 0x05, 0x05, 0x06, 0x5f,
-  0x00, 0x06, 0x06, 0x13, 0x06, 0x4e, 0x1b, 0x4b, 0xb0, 0x19, 0x50, 0x58,
-  0x40, 0x25, 0x00, 0x03, 0x02, 0x04, 0x04, 0x03, 0x72, 0x00, 0x02, 0x00,
-  0x04, 0x05, 0x02, 0x04, 0x67, 0x00, 0x01, 0x01, 0x00, 0x5f, 0x07, 0x01,
-  0x00, 0x00, 0x14, 0x4d, 0x00, 0x05, 0x05, 0x06, 0x5f, 0x00, 0x06, 0x06,
-  0x13, 0x06, 0x4e, 0x1b, 0x40, 0x26, 0x00, 0x03, 0x02, 0x04, 0x02, 0x03,
-  0x04, 0x80, 0x00, 0x02, 0x00, 0x04, 0x05, 0x02, 0x04, 0x67, 0x00, 0x01,
-  0x01, 0x00, 0x5f, 0x07, 0x01, 0x00, 0x00, 0x14, 0x4d, 0x00, 0x05, 0x05,
-  0x06, 0x5f, 0x00, 0x06, 0x06, 0x13, 0x06, 0x4e, 0x59, 0x59, 0x40, 0x15,
-  0x02, 0x00, 0x2a, 0x22, 0x20, 0x1a, 0x18, 0x14, 0x13, 0x12, 0x11, 0x0c,
-  0x0a, 0x04, 0x00, 0x3a, 0x02, 0x34, 0x08, 0x07, 0x16, 0x2b, 0x01, 0x31,
-  0x33, 0x1d, 0x01, 0x2b, 0x05, 0x1d, 0x01, 0x3b, 0x04, 0x15, 0x23, 0x15,
-  0x2b, 0x03, 0x1d, 0x01, 0x3b, 0x05, 0x1d, 0x01, 0x2b, 0x07, 0x3d, 0x09,
-  0x3b, 0x05, 0x03, 0x13, 0x66, 0x66, 0x67, 0x66, 0x67, 0x66, 0x66, 0x66,
-  0x66, 0x67, 0x66, 0x67, 0x67, 0x66, 0x67, 0x66, 0x66, 0x66, 0x66, 0x67,
-  0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66,
-  0x67, 0x66, 0x66, 0x67, 0x66, 0x04, 0x00, 0x67, 0x66, 0x67, 0x66, 0x66,
-  0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66,
-  0x67, 0x66, 0x67, 0x00, 0x00, 0x01, 0x00, 0x46, 0x00, 0x00, 0x03, 0x79,
-  0x04, 0x00, 0x00, 0x2e, 0x00, 0x8b, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40,
-  0x20, 0x00, 0x03, 0x02, 0x04, 0x04, 0x03, 0x72, 0x00, 0x02, 0x00, 0x04,
-  0x05, 0x02, 0x04, 0x67, 0x00, 0x01, 0x01, 0x00, 0x5f, 0x06, 0x01, 0x00,
-  0x00, 0x12, 0x4d, 0x00, 0x05, 0x05, 0x13, 0x05, 0x4e, 0x1b, 0x4b, 0xb0,
-  0x19, 0x50, 0x58, 0x40, 0x20, 0x00, 0x03, 0x02, 0x04, 0x04, 0x03, 0x72,
-  0x00, 0x02, 0x00, 0x04, 0x05, 0x02, 0x04, 0x67, 0x00, 0x01, 0x01, 0x00,
-  0x5f, 0x06, 0x01, 0x00, 0x00, 0x14, 0x4d, 0x00, 0x05, 0x05, 0x13, 0x05,
-  0x4e, 0x1b, 0x40, 0x21, 0x00, 0x03, 0x02, 0x04, 0x02, 0x03, 0x04, 0x80,
-  0x00, 0x02, 0x00, 0x04, 0x05, 0x02, 0x04, 0x67, 0x00, 0x01, 0x01, 0x00,
-  0x5f, 0x06, 0x01, 0x00, 0x00, 0x14, 0x4d, 0x00, 0x05, 0x05, 0x13, 0x05,
-  0x4e, 0x59, 0x59, 0x40, 0x13, 0x02, 0x00, 0x1e, 0x1c, 0x18, 0x14, 0x13,
-  0x12, 0x11, 0x0c, 0x0a, 0x04, 0x00, 0x2e, 0x02, 0x28, 0x07, 0x07, 0x16,
-  0x2b, 0x01, 0x31, 0x33, 0x1d, 0x01, 0x2b, 0x05, 0x1d, 0x01, 0x3b, 0x04,
-  0x15, 0x23, 0x15, 0x2b, 0x03, 0x1d, 0x03, 0x2b, 0x01, 0x3d, 0x09, 0x3b,
-  0x05, 0x03, 0x12, 0x67, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x66, 0x66,
-  0x67, 0x66, 0x66, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67,
-  0x66, 0x66, 0x67, 0x66, 0x04, 0x00, 0x67, 0x66, 0x67, 0x66, 0x66, 0x67,
-  0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67,
-  0x66, 0x67, 0x00, 0x00, 0x00, 0x01, 0x00, 0x46, 0x00, 0x00, 0x03, 0x79,
-  0x04, 0x00, 0x00, 0x40, 0x00, 0x7e, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40,
-  0x2f, 0x0a, 0x01, 0x00, 0x00, 0x01, 0x05, 0x00, 0x01, 0x67, 0x00, 0x05,
-  0x00, 0x04, 0x03, 0x05, 0x04, 0x67, 0x00, 0x06, 0x09, 0x01, 0x07, 0x08,
-  0x06, 0x07, 0x67, 0x00, 0x02, 0x02, 0x0b, 0x5f, 0x00, 0x0b, 0x0b, 0x12,
-  0x4d, 0x00, 0x03, 0x03, 0x08, 0x5f, 0x00, 0x08, 0x08, 0x13, 0x08, 0x4e,
-  0x1b, 0x40, 0x2f, 0x0a, 0x01, 0x00, 0x00, 0x01, 0x05, 0x00, 0x01, 0x67,
-  0x00, 0x05, 0x00, 0x04, 0x03, 0x05, 0x04, 0x67, 0x00, 0x06, 0x09, 0x01,
-  0x07, 0x08, 0x06, 0x07, 0x67, 0x00, 0x02, 0x02, 0x0b, 0x5f, 0x00, 0x0b,
-  0x0b, 0x14, 0x4d, 0x00, 0x03, 0x03, 0x08, 0x5f, 0x00, 0x08, 0x08, 0x13,
-  0x08, 0x4e, 0x59, 0x40, 0x12, 0x40, 0x3a, 0x39, 0x38, 0x30, 0x2f, 0x61,
-  0x14, 0x11, 0x42, 0x32, 0x46, 0x41, 0x22, 0x20, 0x0c, 0x07, 0x1f, 0x2b,
-  0x01, 0x31, 0x33, 0x1d, 0x01, 0x2b, 0x01, 0x35, 0x2b, 0x03, 0x1d, 0x05,
-  0x3b, 0x03, 0x3d, 0x01, 0x2b, 0x02, 0x3d, 0x01, 0x3b, 0x03, 0x15, 0x33,
-  0x1d, 0x03, 0x23, 0x15, 0x2b, 0x05, 0x35, 0x23, 0x3d, 0x07, 0x33, 0x35,
-  0x3b, 0x05, 0x03, 0x12, 0x67, 0x67, 0x66, 0x66, 0x67, 0x66, 0x67, 0x67,
-  0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x67,
-  0x66, 0x66, 0x67, 0x66, 0x67, 0x66, 0x66, 0x66, 0x66, 0x67, 0x66, 0x67,
-  0x66, 0x66, 0x03, 0x99, 0x66, 0x67, 0x67, 0x67, 0x66, 0x66, 0x67, 0x66,
-  0x66, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66,
-  0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x67, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0x00, 0x46, 0x00, 0x00, 0x03, 0x78, 0x04, 0x00, 0x00, 0x34,
-  0x00, 0x4d, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40, 0x16, 0x00, 0x05, 0x00,
-  0x02, 0x01, 0x05, 0x02, 0x67, 0x04, 0x06, 0x02, 0x00, 0x00, 0x12, 0x4d,
-  0x03, 0x01, 0x01, 0x01, 0x13, 0x01, 0x4e, 0x1b, 0x40, 0x16, 0x00, 0x05,
-  0x00, 0x02, 0x01, 0x05, 0x02, 0x67, 0x04, 0x06, 0x02, 0x00, 0x00, 0x14,
-  0x4d, 0x03, 0x01, 0x01, 0x01, 0x13, 0x01, 0x4e, 0x59, 0x40, 0x13, 0x02,
-  0x00, 0x30, 0x2c, 0x28, 0x26, 0x1c, 0x1a, 0x16, 0x12, 0x0e, 0x0c, 0x00,
-  0x34, 0x02, 0x34, 0x07, 0x07, 0x16, 0x2b, 0x01, 0x31, 0x33, 0x1d, 0x09,
-  0x2b, 0x01, 0x3d, 0x03, 0x2b, 0x03, 0x1d, 0x03, 0x2b, 0x01, 0x3d, 0x09,
-  0x3b, 0x01, 0x1d, 0x03, 0x3b, 0x03, 0x3d, 0x03, 0x03, 0x12, 0x66, 0x66,
-  0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x66, 0x66, 0x67, 0x66, 0x66,
-  0x67, 0x04, 0x00, 0x67, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67,
-  0x66, 0x66, 0x67, 0x66, 0x66, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66,
-  0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x67, 0x67, 0x66, 0x67, 0x66, 0x66,
-  0x67, 0x66, 0x67, 0x00, 0x00, 0x03, 0x00, 0x46, 0x00, 0x00, 0x03, 0x79,
-  0x04, 0x00, 0x00, 0x25, 0x00, 0x3a, 0x00, 0x4f, 0x00, 0x68, 0x4b, 0xb0,
-  0x0f, 0x50, 0x58, 0x40, 0x1e, 0x07, 0x04, 0x02, 0x00, 0x00, 0x05, 0x5f,
-  0x0b, 0x06, 0x0a, 0x03, 0x05, 0x05, 0x12, 0x4d, 0x0c, 0x08, 0x03, 0x03,
-  0x01, 0x01, 0x02, 0x5f, 0x09, 0x01, 0x02, 0x02, 0x13, 0x02, 0x4e, 0x1b,
-  0x40, 0x1e, 0x07, 0x04, 0x02, 0x00, 0x00, 0x05, 0x5f, 0x0b, 0x06, 0x0a,
-  0x03, 0x05, 0x05, 0x14, 0x4d, 0x0c, 0x08, 0x03, 0x03, 0x01, 0x01, 0x02,
-  0x5f, 0x09, 0x01, 0x02, 0x02, 0x13, 0x02, 0x4e, 0x59, 0x40, 0x1e, 0x3d,
-  0x3b, 0x28, 0x26, 0x00, 0x00, 0x47, 0x3f, 0x3b, 0x4f, 0x3d, 0x49, 0x32,
-  0x2a, 0x26, 0x3a, 0x28, 0x34, 0x00, 0x25, 0x00, 0x20, 0x26, 0x21, 0x61,
-  0x26, 0x23, 0x0d, 0x07, 0x1b, 0x2b, 0x01, 0x31, 0x1d, 0x01, 0x2b, 0x01,
-  0x1d, 0x05, 0x3b, 0x01, 0x15, 0x2b, 0x05, 0x35, 0x3b, 0x01, 0x3d, 0x05,
-  0x2b, 0x01, 0x35, 0x3b, 0x05, 0x31, 0x33, 0x1d, 0x01, 0x2b, 0x07, 0x3d,
-  0x01, 0x3b, 0x05, 0x13, 0x31, 0x33, 0x1d, 0x01, 0x2b, 0x07, 0x3d, 0x01,
-  0x3b, 0x05, 0x03, 0x13, 0x67, 0x66, 0x66, 0x67, 0x67, 0x66, 0x66, 0x67,
-  0x66, 0x67, 0x67, 0x66, 0x66, 0x67, 0x67, 0x66, 0x67, 0x66, 0x66, 0x67,
-  0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x67, 0x66, 0x66,
-  0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66,
-  0x67, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x04, 0x00, 0x79, 0x54, 0x67,
-  0x66, 0x66, 0x67, 0x66, 0x66, 0xcd, 0xcd, 0x66, 0x66, 0x67, 0x66, 0x66,
-  0x67, 0xcd, 0x67, 0x66, 0x66, 0x67, 0xfc, 0xcc, 0x66, 0x66, 0x66, 0x66,
-  0x00, 0x01, 0x00, 0x46, 0x00, 0x00, 0x03, 0x79, 0x04, 0x00, 0x00, 0x2a,
-  0x00, 0x61, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40, 0x1f, 0x00, 0x04, 0x03,
-  0x01, 0x01, 0x02, 0x04, 0x01, 0x67, 0x00, 0x06, 0x06, 0x00, 0x5f, 0x07,
-  0x01, 0x00, 0x00, 0x12, 0x4d, 0x00, 0x05, 0x05, 0x02, 0x5f, 0x00, 0x02,
-  0x02, 0x13, 0x02, 0x4e, 0x1b, 0x40, 0x1f, 0x00, 0x04, 0x03, 0x01, 0x01,
-  0x02, 0x04, 0x01, 0x67, 0x00, 0x06, 0x06, 0x00, 0x5f, 0x07, 0x01, 0x00,
-  0x00, 0x14, 0x4d, 0x00, 0x05, 0x05, 0x02, 0x5f, 0x00, 0x02, 0x02, 0x13,
-  0x02, 0x4e, 0x59, 0x40, 0x15, 0x02, 0x00, 0x27, 0x25, 0x1e, 0x1a, 0x19,
-  0x17, 0x15, 0x14, 0x13, 0x0d, 0x0c, 0x0b, 0x00, 0x2a, 0x02, 0x28, 0x08,
-  0x07, 0x16, 0x2b, 0x01, 0x31, 0x33, 0x1d, 0x08, 0x23, 0x15, 0x2b, 0x05,
-  0x35, 0x23, 0x3d, 0x01, 0x3b, 0x01, 0x15, 0x3b, 0x03, 0x3d, 0x06, 0x2b,
-  0x01, 0x35, 0x3b, 0x01, 0x03, 0x13, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67,
-  0x66, 0x66, 0x67, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x66, 0x66, 0x66,
-  0x66, 0x04, 0x00, 0x67, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67,
-  0x66, 0x66, 0x67, 0x66, 0x66, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66,
-  0x67, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x46, 0xff, 0xff, 0x03, 0x79,
-  0x03, 0xff, 0x00, 0x38, 0x01, 0x3a, 0x4b, 0xb0, 0x0d, 0x50, 0x58, 0x40,
-  0x54, 0x00, 0x0f, 0x0c, 0x0b, 0x0e, 0x0f, 0x72, 0x00, 0x10, 0x0b, 0x0a,
-  0x0e, 0x10, 0x72, 0x00, 0x01, 0x07, 0x06, 0x02, 0x01, 0x72, 0x00, 0x03,
-  0x05, 0x04, 0x02, 0x03, 0x72, 0x00, 0x0c, 0x12, 0x01, 0x11, 0x00, 0x0c,
-  0x11, 0x67, 0x00, 0x0a, 0x00, 0x07, 0x01, 0x0a, 0x07, 0x67, 0x00, 0x0b,
-  0x00, 0x06, 0x02, 0x0b, 0x06, 0x67, 0x00, 0x00, 0x00, 0x05, 0x03, 0x00,
-  0x05, 0x67, 0x00, 0x0e, 0x0e, 0x09, 0x5f, 0x0d, 0x01, 0x09, 0x09, 0x12,
-  0x4d, 0x00, 0x02, 0x02, 0x04, 0x60, 0x08, 0x01, 0x04, 0x04, 0x13, 0x04,
-  0x4e, 0x1b, 0x4b, 0xb0, 0x19, 0x50, 0x58, 0x40, 0x55, 0x00, 0x0f, 0x0c,
-  0x0b, 0x0e, 0x0f, 0x72, 0x00, 0x10, 0x0b, 0x0a, 0x0b, 0x10, 0x0a, 0x80,
-  0x00, 0x01, 0x07, 0x06, 0x02, 0x01, 0x72, 0x00, 0x03, 0x05, 0x04, 0x02,
-  0x03, 0x72, 0x00, 0x0c, 0x12, 0x01, 0x11, 0x00, 0x0c, 0x11, 0x67, 0x00,
-  0x0a, 0x00, 0x07, 0x01, 0x0a, 0x07, 0x67, 0x00, 0x0b, 0x00, 0x06, 0x02,
-  0x0b, 0x06, 0x67, 0x00, 0x00, 0x00, 0x05, 0x03, 0x00, 0x05, 0x67, 0x00,
-  0x0e, 0x0e, 0x09, 0x5f, 0x0d, 0x01, 0x09, 0x09, 0x12, 0x4d, 0x00, 0x02,
-  0x02, 0x04, 0x60, 0x08, 0x01, 0x04, 0x04, 0x13, 0x04, 0x4e, 0x1b, 0x40,
-  0x58, 0x00, 0x0f, 0x0c, 0x0b, 0x0c, 0x0f, 0x0b, 0x80, 0x00, 0x10, 0x0b,
-  0x0a, 0x0b, 0x10, 0x0a, 0x80, 0x00, 0x01, 0x07, 0x06, 0x07, 0x01, 0x06,
-  0x80, 0x00, 0x03, 0x05, 0x04, 0x05, 0x03, 0x04, 0x80, 0x00, 0x0c, 0x12,
-  0x01, 0x11, 0x00, 0x0c, 0x11, 0x67, 0x00, 0x0a, 0x00, 0x07, 0x01, 0x0a,
-  0x07, 0x67, 0x00, 0x0b, 0x00, 0x06, 0x02, 0x0b, 0x06, 0x67, 0x00, 0x00,
-  0x00, 0x05, 0x03, 0x00, 0x05, 0x67, 0x00, 0x0e, 0x0e, 0x09, 0x5f, 0x0d,
-  0x01, 0x09, 0x09, 0x12, 0x4d, 0x00, 0x02, 0x02, 0x04, 0x60, 0x08, 0x01,
-  0x04, 0x04, 0x13, 0x04, 0x4e, 0x59, 0x59, 0x40, 0x22, 0x00, 0x00, 0x00,
-  0x38, 0x00, 0x38, 0x37, 0x36, 0x35, 0x34, 0x33, 0x32, 0x31, 0x2e, 0x2d,
-  0x2c, 0x2b, 0x2a, 0x29, 0x28, 0x25, 0x23, 0x23, 0x11, 0x11, 0x11, 0x31,
-  0x11, 0x11, 0x11, 0x13, 0x13, 0x07, 0x1f, 0x2b, 0x01, 0x31, 0x1d, 0x01,
-  0x33, 0x15, 0x33, 0x15, 0x33, 0x15, 0x33, 0x15, 0x2b, 0x02, 0x35, 0x23,
-  0x35, 0x23, 0x35, 0x23, 0x1d, 0x02, 0x2b, 0x01, 0x3d, 0x09, 0x3b, 0x01,
-  0x1d, 0x02, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x3b, 0x02, 0x15, 0x23,
-  0x15, 0x23, 0x15, 0x23, 0x15, 0x01, 0xdf, 0x67, 0x66, 0x66, 0x67, 0x67,
-  0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67,
-  0x66, 0x66, 0x67, 0x67, 0x66, 0x66, 0x02, 0x65, 0x66, 0x66, 0x67, 0x66,
-  0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x67,
-  0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x67, 0x66, 0x66, 0x66, 0x66, 0x67,
-  0x67, 0x66, 0x66, 0x67, 0x00, 0x01, 0x00, 0x46, 0xff, 0xff, 0x03, 0x79,
-  0x03, 0xff, 0x00, 0x26, 0x00, 0x4e, 0x4b, 0xb0, 0x19, 0x50, 0x58, 0x40,
-  0x18, 0x04, 0x01, 0x00, 0x02, 0x03, 0x03, 0x00, 0x72, 0x00, 0x02, 0x02,
-  0x12, 0x4d, 0x00, 0x03, 0x03, 0x01, 0x60, 0x00, 0x01, 0x01, 0x13, 0x01,
-  0x4e, 0x1b, 0x40, 0x19, 0x04, 0x01, 0x00, 0x02, 0x03, 0x02, 0x00, 0x03,
-  0x80, 0x00, 0x02, 0x02, 0x12, 0x4d, 0x00, 0x03, 0x03, 0x01, 0x60, 0x00,
-  0x01, 0x01, 0x13, 0x01, 0x4e, 0x59, 0x40, 0x0f, 0x02, 0x00, 0x25, 0x21,
-  0x19, 0x17, 0x0d, 0x05, 0x00, 0x26, 0x02, 0x26, 0x05, 0x07, 0x16, 0x2b,
-  0x01, 0x31, 0x33, 0x1d, 0x02, 0x2b, 0x07, 0x3d, 0x09, 0x3b, 0x01, 0x1d,
-  0x07, 0x3b, 0x03, 0x35, 0x03, 0x12, 0x67, 0x67, 0x66, 0x67, 0x66, 0x66,
-  0x67, 0x66, 0x66, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x01, 0x32, 0x66,
-  0x67, 0x66, 0x66, 0x67, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67,
-  0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0x00, 0x46, 0xff, 0xff, 0x03, 0x78, 0x03, 0xff, 0x00, 0x42,
-  0x00, 0x3e, 0x40, 0x3b, 0x09, 0x01, 0x07, 0x04, 0x01, 0x02, 0x03, 0x07,
-  0x02, 0x67, 0x00, 0x08, 0x00, 0x03, 0x01, 0x08, 0x03, 0x67, 0x06, 0x0a,
-  0x02, 0x00, 0x00, 0x12, 0x4d, 0x05, 0x01, 0x01, 0x01, 0x13, 0x01, 0x4e,
-  0x02, 0x00, 0x41, 0x40, 0x3f, 0x3d, 0x3c, 0x3b, 0x3a, 0x38, 0x2e, 0x2c,
-  0x25, 0x24, 0x1e, 0x1c, 0x16, 0x15, 0x0e, 0x0c, 0x00, 0x42, 0x02, 0x42,
-  0x0b, 0x07, 0x16, 0x2b, 0x01, 0x31, 0x33, 0x1d, 0x09, 0x2b, 0x01, 0x3d,
-  0x06, 0x23, 0x1d, 0x05, 0x2b, 0x01, 0x3d, 0x05, 0x23, 0x1d, 0x06, 0x2b,
-  0x01, 0x3d, 0x09, 0x3b, 0x01, 0x15, 0x33, 0x15, 0x3b, 0x01, 0x35, 0x33,
-  0x35, 0x03, 0x12, 0x66, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66,
-  0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x03, 0xff, 0x67, 0x66, 0x66, 0x67,
-  0x66, 0x66, 0x67, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x67, 0x66, 0x66,
-  0x67, 0x67, 0x66, 0x66, 0x67, 0x66, 0x67, 0x67, 0x66, 0x67, 0x66, 0x66,
-  0x67, 0x67, 0x66, 0x66, 0x67, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x67,
-  0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x67, 0x66, 0x66, 0x67, 0x00, 0x00,
-  0x00, 0x01, 0x00, 0x46, 0x00, 0x00, 0x03, 0x78, 0x04, 0x00, 0x00, 0x48,
-  0x00, 0x73, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40, 0x27, 0x00, 0x06, 0x03,
-  0x02, 0x03, 0x06, 0x02, 0x80, 0x00, 0x02, 0x07, 0x03, 0x02, 0x07, 0x7e,
-  0x00, 0x03, 0x03, 0x00, 0x5f, 0x05, 0x08, 0x02, 0x00, 0x00, 0x12, 0x4d,
-  0x00, 0x07, 0x07, 0x01, 0x60, 0x04, 0x01, 0x01, 0x01, 0x13, 0x01, 0x4e,
-  0x1b, 0x40, 0x27, 0x00, 0x06, 0x03, 0x02, 0x03, 0x06, 0x02, 0x80, 0x00,
-  0x02, 0x07, 0x03, 0x02, 0x07, 0x7e, 0x00, 0x03, 0x03, 0x00, 0x5f, 0x05,
-  0x08, 0x02, 0x00, 0x00, 0x14, 0x4d, 0x00, 0x07, 0x07, 0x01, 0x60, 0x04,
-  0x01, 0x01, 0x01, 0x13, 0x01, 0x4e, 0x59, 0x40, 0x17, 0x02, 0x00, 0x3f,
-  0x3e, 0x36, 0x35, 0x34, 0x30, 0x26, 0x24, 0x1b, 0x1a, 0x12, 0x11, 0x10,
-  0x0c, 0x00, 0x48, 0x02, 0x48, 0x09, 0x07, 0x16, 0x2b, 0x01, 0x31, 0x33,
-  0x1d, 0x09, 0x2b, 0x03, 0x35, 0x23, 0x3d, 0x07, 0x23, 0x1d, 0x08, 0x2b,
-  0x01, 0x3d, 0x09, 0x3b, 0x03, 0x15, 0x33, 0x1d, 0x07, 0x33, 0x3d, 0x08,
-  0x03, 0x12, 0x66, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x66,
-  0x66, 0x67, 0x66, 0x66, 0x67, 0x04, 0x00, 0x67, 0x66, 0x67, 0x66, 0x66,
-  0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66,
-  0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66,
-  0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x67, 0x67, 0x66, 0x67,
-  0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66,
-  0x67, 0x66, 0x67, 0x00, 0x00, 0x02, 0x00, 0x46, 0xff, 0xff, 0x03, 0x79,
-  0x03, 0xff, 0x00, 0x24, 0x00, 0x39, 0x00, 0x2d, 0x40, 0x2a, 0x04, 0x01,
-  0x00, 0x03, 0x01, 0x01, 0x02, 0x00, 0x01, 0x67, 0x00, 0x06, 0x06, 0x05,
-  0x5f, 0x00, 0x05, 0x05, 0x12, 0x4d, 0x00, 0x07, 0x07, 0x02, 0x5f, 0x00,
-  0x02, 0x02, 0x13, 0x02, 0x4e, 0x46, 0x43, 0x61, 0x18, 0x11, 0x61, 0x18,
-  0x20, 0x08, 0x07, 0x1e, 0x2b, 0x01, 0x31, 0x33, 0x1d, 0x07, 0x23, 0x15,
-  0x2b, 0x05, 0x35, 0x23, 0x3d, 0x07, 0x33, 0x35, 0x3b, 0x05, 0x03, 0x31,
-  0x35, 0x2b, 0x03, 0x1d, 0x05, 0x3b, 0x03, 0x3d, 0x03, 0x03, 0x13, 0x66,
-  0x66, 0x66, 0x67, 0x66, 0x67, 0x66, 0x66, 0x67, 0x67, 0x66, 0x66, 0x67,
-  0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x67,
-  0x03, 0x98, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x67, 0x66, 0x66,
-  0x67, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0xfe, 0xcd, 0x66,
-  0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x00, 0x00,
-  0x00, 0x02, 0x00, 0x46, 0xff, 0xff, 0x03, 0x79, 0x03, 0xff, 0x00, 0x24,
-  0x00, 0x33, 0x00, 0x3d, 0x40, 0x3a, 0x00, 0x02, 0x06, 0x03, 0x06, 0x02,
-  0x03, 0x80, 0x00, 0x00, 0x00, 0x01, 0x06, 0x00, 0x01, 0x67, 0x08, 0x01,
-  0x06, 0x00, 0x03, 0x04, 0x06, 0x03, 0x67, 0x00, 0x07, 0x07, 0x05, 0x5f,
-  0x00, 0x05, 0x05, 0x12, 0x4d, 0x00, 0x04, 0x04, 0x13, 0x04, 0x4e, 0x27,
-  0x25, 0x2e, 0x2a, 0x25, 0x33, 0x27, 0x31, 0x7a, 0x23, 0x41, 0x11, 0x14,
-  0x20, 0x09, 0x07, 0x1c, 0x2b, 0x01, 0x31, 0x33, 0x1d, 0x03, 0x23, 0x15,
-  0x23, 0x15, 0x2b, 0x03, 0x1d, 0x02, 0x2b, 0x01, 0x3d, 0x09, 0x3b, 0x06,
-  0x03, 0x31, 0x33, 0x3d, 0x02, 0x2b, 0x03, 0x1d, 0x02, 0x3b, 0x01, 0x03,
-  0x13, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x67, 0x66,
-  0x66, 0x67, 0x66, 0x66, 0x67, 0xcd, 0x66, 0x66, 0x66, 0x67, 0x66, 0x66,
-  0x67, 0x03, 0x98, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x67, 0x66,
-  0x66, 0x67, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0xfe, 0x00,
-  0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x00, 0x00, 0x00, 0x02, 0x00, 0x46,
-  0xff, 0xff, 0x03, 0xdf, 0x03, 0xff, 0x00, 0x28, 0x00, 0x3d, 0x00, 0x45,
-  0x40, 0x42, 0x07, 0x01, 0x05, 0x04, 0x01, 0x02, 0x01, 0x05, 0x02, 0x67,
-  0x0b, 0x01, 0x08, 0x08, 0x06, 0x5f, 0x00, 0x06, 0x06, 0x12, 0x4d, 0x0a,
-  0x01, 0x00, 0x00, 0x01, 0x5f, 0x03, 0x01, 0x01, 0x01, 0x13, 0x4d, 0x00,
-  0x09, 0x09, 0x01, 0x60, 0x03, 0x01, 0x01, 0x01, 0x13, 0x01, 0x4e, 0x2b,
-  0x29, 0x36, 0x35, 0x34, 0x31, 0x29, 0x3d, 0x2b, 0x3b, 0x11, 0x51, 0x28,
-  0x11, 0x61, 0x11, 0x13, 0x20, 0x0c, 0x07, 0x1e, 0x2b, 0x01, 0x31, 0x33,
-  0x1d, 0x02, 0x23, 0x35, 0x23, 0x15, 0x2b, 0x05, 0x35, 0x23, 0x3d, 0x07,
-  0x3b, 0x01, 0x35, 0x3b, 0x04, 0x15, 0x33, 0x1d, 0x04, 0x01, 0x31, 0x23,
-  0x1d, 0x05, 0x3b, 0x02, 0x35, 0x33, 0x3d, 0x04, 0x2b, 0x01, 0x03, 0x79,
-  0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67,
-  0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0xfe, 0x00, 0x66, 0x66, 0x66, 0x67,
-  0x66, 0x66, 0x67, 0x01, 0x32, 0x66, 0x66, 0x67, 0x67, 0x67, 0x67, 0x66,
-  0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x67, 0x66, 0x66, 0x67,
-  0x66, 0x66, 0x01, 0x99, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67,
-  0x66, 0x66, 0x67, 0x66, 0x00, 0x02, 0x00, 0x46, 0xff, 0xff, 0x03, 0x79,
-  0x03, 0xff, 0x00, 0x2e, 0x00, 0x3d, 0x00, 0xfc, 0x4b, 0xb0, 0x0d, 0x50,
-  0x58, 0x40, 0x43, 0x00, 0x02, 0x0b, 0x08, 0x0b, 0x02, 0x08, 0x80, 0x00,
-  0x03, 0x08, 0x07, 0x04, 0x03, 0x72, 0x00, 0x07, 0x04, 0x08, 0x07, 0x70,
-  0x00, 0x06, 0x04, 0x05, 0x08, 0x06, 0x72, 0x00, 0x00, 0x00, 0x01, 0x0b,
-  0x00, 0x01, 0x67, 0x0d, 0x01, 0x0b, 0x00, 0x08, 0x03, 0x0b, 0x08, 0x67,
-  0x00, 0x0c, 0x0c, 0x0a, 0x5f, 0x00, 0x0a, 0x0a, 0x12, 0x4d, 0x00, 0x04,
-  0x04, 0x05, 0x60, 0x09, 0x01, 0x05, 0x05, 0x13, 0x05, 0x4e, 0x1b, 0x4b,
-  0xb0, 0x19, 0x50, 0x58, 0x40, 0x44, 0x00, 0x02, 0x0b, 0x08, 0x0b, 0x02,
-  0x08, 0x80, 0x00, 0x03, 0x08, 0x07, 0x04, 0x03, 0x72, 0x00, 0x07, 0x04,
-  0x08, 0x07, 0x70, 0x00, 0x06, 0x04, 0x05, 0x04, 0x06, 0x05, 0x80, 0x00,
-  0x00, 0x00, 0x01, 0x0b, 0x00, 0x01, 0x67, 0x0d, 0x01, 0x0b, 0x00, 0x08,
-  0x03, 0x0b, 0x08, 0x67, 0x00, 0x0c, 0x0c, 0x0a, 0x5f, 0x00, 0x0a, 0x0a,
-  0x12, 0x4d, 0x00, 0x04, 0x04, 0x05, 0x60, 0x09, 0x01, 0x05, 0x05, 0x13,
-  0x05, 0x4e, 0x1b, 0x40, 0x46, 0x00, 0x02, 0x0b, 0x08, 0x0b, 0x02, 0x08,
-  0x80, 0x00, 0x03, 0x08, 0x07, 0x08, 0x03, 0x07, 0x80, 0x00, 0x07, 0x04,
-  0x08, 0x07, 0x04, 0x7e, 0x00, 0x06, 0x04, 0x05, 0x04, 0x06, 0x05, 0x80,
-  0x00, 0x00, 0x00, 0x01, 0x0b, 0x00, 0x01, 0x67, 0x0d, 0x01, 0x0b, 0x00,
-  0x08, 0x03, 0x0b, 0x08, 0x67, 0x00, 0x0c, 0x0c, 0x0a, 0x5f, 0x00, 0x0a,
-  0x0a, 0x12, 0x4d, 0x00, 0x04, 0x04, 0x05, 0x60, 0x09, 0x01, 0x05, 0x05,
-  0x13, 0x05, 0x4e, 0x59, 0x59, 0x40, 0x18, 0x31, 0x2f, 0x38, 0x34, 0x2f,
-  0x3d, 0x31, 0x3b, 0x2e, 0x27, 0x1d, 0x1b, 0x21, 0x11, 0x11, 0x22, 0x11,
-  0x11, 0x11, 0x14, 0x20, 0x0e, 0x07, 0x1f, 0x2b, 0x01, 0x31, 0x33, 0x1d,
-  0x03, 0x23, 0x15, 0x23, 0x15, 0x33, 0x15, 0x33, 0x1d, 0x01, 0x2b, 0x01,
-  0x35, 0x23, 0x35, 0x23, 0x35, 0x2b, 0x01, 0x1d, 0x02, 0x2b, 0x01, 0x3d,
-  0x09, 0x3b, 0x06, 0x03, 0x31, 0x33, 0x3d, 0x02, 0x2b, 0x03, 0x1d, 0x02,
-  0x3b, 0x01, 0x03, 0x13, 0x66, 0x66, 0x67, 0x67, 0x66, 0x66, 0x67, 0x66,
-  0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x67,
-  0xcd, 0x66, 0x66, 0x67, 0x66, 0x66, 0x66, 0x66, 0x03, 0x98, 0x66, 0x66,
-  0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x67, 0x66, 0x66, 0x66, 0x66,
-  0x67, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0xfe,
-  0x00, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x00, 0x00, 0x01, 0x00, 0x46,
-  0xff, 0xff, 0x03, 0x79, 0x03, 0xff, 0x00, 0x40, 0x00, 0xab, 0x4b, 0xb0,
-  0x09, 0x50, 0x58, 0x40, 0x42, 0x00, 0x0b, 0x03, 0x04, 0x02, 0x0b, 0x72,
-  0x00, 0x01, 0x0c, 0x00, 0x01, 0x57, 0x0d, 0x01, 0x00, 0x00, 0x0c, 0x03,
-  0x00, 0x0c, 0x67, 0x00, 0x04, 0x0a, 0x05, 0x04, 0x57, 0x00, 0x03, 0x00,
-  0x0a, 0x08, 0x03, 0x0a, 0x67, 0x00, 0x08, 0x07, 0x01, 0x05, 0x06, 0x08,
-  0x05, 0x67, 0x00, 0x02, 0x02, 0x0e, 0x5f, 0x00, 0x0e, 0x0e, 0x12, 0x4d,
-  0x00, 0x09, 0x09, 0x06, 0x5f, 0x00, 0x06, 0x06, 0x13, 0x06, 0x4e, 0x1b,
-  0x40, 0x43, 0x00, 0x0b, 0x03, 0x04, 0x03, 0x0b, 0x04, 0x80, 0x00, 0x01,
-  0x0c, 0x00, 0x01, 0x57, 0x0d, 0x01, 0x00, 0x00, 0x0c, 0x03, 0x00, 0x0c,
-  0x67, 0x00, 0x04, 0x0a, 0x05, 0x04, 0x57, 0x00, 0x03, 0x00, 0x0a, 0x08,
-  0x03, 0x0a, 0x67, 0x00, 0x08, 0x07, 0x01, 0x05, 0x06, 0x08, 0x05, 0x67,
-  0x00, 0x02, 0x02, 0x0e, 0x5f, 0x00, 0x0e, 0x0e, 0x12, 0x4d, 0x00, 0x09,
-  0x09, 0x06, 0x5f, 0x00, 0x06, 0x06, 0x13, 0x06, 0x4e, 0x59, 0x40, 0x18,
-  0x40, 0x3a, 0x39, 0x38, 0x35, 0x34, 0x33, 0x32, 0x31, 0x2d, 0x2b, 0x27,
-  0x22, 0x11, 0x61, 0x14, 0x11, 0x52, 0x41, 0x22, 0x20, 0x0f, 0x07, 0x1f,
-  0x2b, 0x01, 0x31, 0x33, 0x1d, 0x01, 0x2b, 0x01, 0x35, 0x2b, 0x03, 0x1d,
-  0x01, 0x3b, 0x04, 0x15, 0x33, 0x1d, 0x03, 0x23, 0x15, 0x2b, 0x05, 0x35,
-  0x23, 0x3d, 0x01, 0x3b, 0x01, 0x15, 0x3b, 0x03, 0x3d, 0x01, 0x2b, 0x03,
-  0x35, 0x23, 0x35, 0x23, 0x3d, 0x02, 0x33, 0x35, 0x3b, 0x05, 0x03, 0x12,
-  0x67, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x66, 0x66, 0x67, 0x66, 0x66,
-  0x67, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66,
-  0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66,
-  0x66, 0x67, 0x66, 0x66, 0x03, 0x98, 0x66, 0x66, 0x66, 0x66, 0x67, 0x66,
-  0x66, 0x67, 0x66, 0x66, 0x67, 0x67, 0x66, 0x66, 0x66, 0x66, 0x67, 0x66,
-  0x66, 0x67, 0x66, 0x66, 0x67, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x46,
-  0xff, 0xff, 0x03, 0x79, 0x03, 0xff, 0x00, 0x28, 0x00, 0x56, 0x4b, 0xb0,
-  0x19, 0x50, 0x58, 0x40, 0x1a, 0x05, 0x01, 0x01, 0x02, 0x03, 0x02, 0x01,
-  0x72, 0x04, 0x01, 0x02, 0x02, 0x00, 0x5f, 0x06, 0x01, 0x00, 0x00, 0x12,
-  0x4d, 0x00, 0x03, 0x03, 0x13, 0x03, 0x4e, 0x1b, 0x40, 0x1b, 0x05, 0x01,
-  0x01, 0x02, 0x03, 0x02, 0x01, 0x03, 0x80, 0x04, 0x01, 0x02, 0x02, 0x00,
-  0x5f, 0x06, 0x01, 0x00, 0x00, 0x12, 0x4d, 0x00, 0x03, 0x03, 0x13, 0x03,
-  0x4e, 0x59, 0x40, 0x13, 0x02, 0x00, 0x1f, 0x1e, 0x1d, 0x1b, 0x13, 0x11,
-  0x09, 0x07, 0x06, 0x05, 0x00, 0x28, 0x02, 0x22, 0x07, 0x07, 0x16, 0x2b,
-  0x01, 0x31, 0x33, 0x1d, 0x02, 0x23, 0x35, 0x2b, 0x01, 0x1d, 0x07, 0x2b,
-  0x01, 0x3d, 0x07, 0x2b, 0x01, 0x15, 0x23, 0x3d, 0x02, 0x3b, 0x05, 0x03,
-  0x12, 0x67, 0x67, 0x66, 0x66, 0x67, 0x66, 0x67, 0x66, 0x66, 0x66, 0x66,
-  0x67, 0x66, 0x67, 0x66, 0x03, 0xff, 0x67, 0x66, 0x66, 0x66, 0x66, 0x67,
-  0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66,
-  0x67, 0x66, 0x66, 0x66, 0x66, 0x67, 0x00, 0x00, 0x00, 0x01, 0x00, 0x46,
-  0xff, 0xff, 0x03, 0x79, 0x03, 0xff, 0x00, 0x34, 0x00, 0x2e, 0x40, 0x2b,
-  0x03, 0x01, 0x01, 0x01, 0x00, 0x5f, 0x04, 0x06, 0x02, 0x00, 0x00, 0x12,
-  0x4d, 0x00, 0x05, 0x05, 0x02, 0x5f, 0x00, 0x02, 0x02, 0x13, 0x02, 0x4e,
-  0x02, 0x00, 0x2c, 0x28, 0x20, 0x1e, 0x15, 0x14, 0x13, 0x0d, 0x0c, 0x0b,
-  0x00, 0x34, 0x02, 0x34, 0x07, 0x07, 0x16, 0x2b, 0x01, 0x31, 0x33, 0x1d,
-  0x08, 0x23, 0x15, 0x2b, 0x05, 0x35, 0x23, 0x3d, 0x08, 0x3b, 0x01, 0x1d,
-  0x07, 0x3b, 0x03, 0x3d, 0x07, 0x03, 0x12, 0x67, 0x67, 0x66, 0x67, 0x66,
-  0x66, 0x67, 0x66, 0x66, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x03, 0xff,
-  0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x67, 0x66, 0x66, 0x67,
-  0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x67, 0x66, 0x66, 0x67,
-  0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67,
-  0x00, 0x01, 0x00, 0x46, 0xff, 0xff, 0x03, 0x78, 0x03, 0xff, 0x00, 0x34,
-  0x00, 0x40, 0x40, 0x3d, 0x09, 0x01, 0x07, 0x04, 0x01, 0x02, 0x03, 0x07,
-  0x02, 0x67, 0x05, 0x01, 0x01, 0x01, 0x00, 0x5f, 0x06, 0x0a, 0x02, 0x00,
-  0x00, 0x12, 0x4d, 0x00, 0x08, 0x08, 0x03, 0x5f, 0x00, 0x03, 0x03, 0x13,
-  0x03, 0x4e, 0x02, 0x00, 0x2d, 0x2c, 0x2b, 0x29, 0x28, 0x27, 0x20, 0x1e,
-  0x16, 0x15, 0x14, 0x12, 0x11, 0x0f, 0x0e, 0x0c, 0x0b, 0x0a, 0x00, 0x34,
-  0x02, 0x34, 0x0b, 0x07, 0x16, 0x2b, 0x01, 0x31, 0x33, 0x1d, 0x07, 0x23,
-  0x15, 0x2b, 0x01, 0x15, 0x2b, 0x01, 0x35, 0x2b, 0x01, 0x35, 0x23, 0x3d,
-  0x07, 0x3b, 0x01, 0x1d, 0x06, 0x33, 0x15, 0x3b, 0x01, 0x35, 0x33, 0x3d,
-  0x06, 0x03, 0x12, 0x66, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66,
-  0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x03, 0xff, 0x67, 0x66, 0x66, 0x67,
-  0x66, 0x66, 0x67, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x67, 0x66, 0x66,
-  0x67, 0x66, 0x66, 0x67, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66,
-  0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x00, 0x01, 0x00, 0x46,
-  0xff, 0xff, 0x03, 0x78, 0x03, 0xff, 0x00, 0x42, 0x00, 0x3e, 0x40, 0x3b,
-  0x00, 0x08, 0x00, 0x03, 0x02, 0x08, 0x03, 0x67, 0x09, 0x01, 0x07, 0x04,
-  0x01, 0x02, 0x01, 0x07, 0x02, 0x67, 0x06, 0x0a, 0x02, 0x00, 0x00, 0x12,
-  0x4d, 0x05, 0x01, 0x01, 0x01, 0x13, 0x01, 0x4e, 0x02, 0x00, 0x3b, 0x3a,
-  0x34, 0x32, 0x2c, 0x2b, 0x24, 0x22, 0x18, 0x16, 0x15, 0x14, 0x13, 0x11,
-  0x10, 0x0f, 0x0e, 0x0c, 0x00, 0x42, 0x02, 0x42, 0x0b, 0x07, 0x16, 0x2b,
-  0x01, 0x31, 0x33, 0x1d, 0x09, 0x2b, 0x01, 0x35, 0x23, 0x35, 0x2b, 0x01,
-  0x15, 0x23, 0x15, 0x2b, 0x01, 0x3d, 0x09, 0x3b, 0x01, 0x1d, 0x06, 0x33,
-  0x3d, 0x05, 0x3b, 0x01, 0x1d, 0x05, 0x33, 0x3d, 0x06, 0x03, 0x12, 0x66,
-  0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x66, 0x66, 0x67, 0x66,
-  0x66, 0x67, 0x03, 0xff, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66,
-  0x67, 0x66, 0x66, 0x67, 0x67, 0x66, 0x66, 0x67, 0x66, 0x67, 0x66, 0x66,
-  0x67, 0x66, 0x66, 0x67, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x67,
-  0x66, 0x66, 0x67, 0x66, 0x66, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x67,
-  0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x00, 0x00, 0x00, 0x01, 0x00, 0x46,
-  0xff, 0xff, 0x03, 0x79, 0x03, 0xff, 0x00, 0x3a, 0x00, 0xcf, 0x4b, 0xb0,
-  0x19, 0x50, 0x58, 0x40, 0x46, 0x10, 0x01, 0x02, 0x14, 0x03, 0x01, 0x02,
-  0x72, 0x0d, 0x01, 0x05, 0x04, 0x09, 0x06, 0x05, 0x72, 0x15, 0x01, 0x13,
-  0x0f, 0x01, 0x03, 0x04, 0x13, 0x03, 0x67, 0x00, 0x14, 0x00, 0x09, 0x06,
-  0x14, 0x09, 0x67, 0x0e, 0x01, 0x04, 0x0a, 0x01, 0x08, 0x07, 0x04, 0x08,
-  0x67, 0x11, 0x01, 0x01, 0x01, 0x00, 0x5f, 0x12, 0x16, 0x02, 0x00, 0x00,
-  0x12, 0x4d, 0x0c, 0x01, 0x06, 0x06, 0x07, 0x60, 0x0b, 0x01, 0x07, 0x07,
-  0x13, 0x07, 0x4e, 0x1b, 0x40, 0x48, 0x10, 0x01, 0x02, 0x14, 0x03, 0x14,
-  0x02, 0x03, 0x80, 0x0d, 0x01, 0x05, 0x04, 0x09, 0x04, 0x05, 0x09, 0x80,
-  0x15, 0x01, 0x13, 0x0f, 0x01, 0x03, 0x04, 0x13, 0x03, 0x67, 0x00, 0x14,
-  0x00, 0x09, 0x06, 0x14, 0x09, 0x67, 0x0e, 0x01, 0x04, 0x0a, 0x01, 0x08,
-  0x07, 0x04, 0x08, 0x67, 0x11, 0x01, 0x01, 0x01, 0x00, 0x5f, 0x12, 0x16,
-  0x02, 0x00, 0x00, 0x12, 0x4d, 0x0c, 0x01, 0x06, 0x06, 0x07, 0x60, 0x0b,
-  0x01, 0x07, 0x07, 0x13, 0x07, 0x4e, 0x59, 0x40, 0x33, 0x02, 0x00, 0x38,
-  0x37, 0x36, 0x34, 0x33, 0x32, 0x30, 0x2e, 0x2b, 0x2a, 0x29, 0x28, 0x27,
-  0x26, 0x25, 0x24, 0x23, 0x22, 0x21, 0x20, 0x1e, 0x1c, 0x1b, 0x1a, 0x19,
-  0x17, 0x16, 0x15, 0x14, 0x12, 0x10, 0x0f, 0x0e, 0x0d, 0x0c, 0x0b, 0x0a,
-  0x09, 0x08, 0x07, 0x06, 0x05, 0x00, 0x3a, 0x02, 0x3a, 0x17, 0x07, 0x16,
-  0x2b, 0x01, 0x31, 0x33, 0x1d, 0x02, 0x23, 0x15, 0x23, 0x15, 0x23, 0x15,
-  0x33, 0x15, 0x33, 0x15, 0x33, 0x1d, 0x01, 0x2b, 0x01, 0x35, 0x23, 0x35,
-  0x2b, 0x01, 0x15, 0x23, 0x15, 0x2b, 0x01, 0x3d, 0x01, 0x33, 0x35, 0x33,
-  0x35, 0x33, 0x35, 0x23, 0x35, 0x23, 0x35, 0x23, 0x3d, 0x02, 0x3b, 0x01,
-  0x1d, 0x01, 0x33, 0x15, 0x3b, 0x01, 0x35, 0x33, 0x3d, 0x01, 0x03, 0x13,
-  0x66, 0x66, 0x66, 0x67, 0x67, 0x66, 0x66, 0x66, 0x66, 0x67, 0x66, 0x67,
-  0x66, 0x66, 0x67, 0x67, 0x66, 0x66, 0x66, 0x66, 0x67, 0x67, 0x66, 0x66,
-  0x67, 0x66, 0x67, 0x03, 0xff, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67,
-  0x66, 0x67, 0x66, 0x66, 0x67, 0x67, 0x66, 0x66, 0x67, 0x66, 0x67, 0x66,
-  0x66, 0x67, 0x66, 0x66, 0x67, 0x67, 0x66, 0x66, 0x66, 0x66, 0x67, 0x00,
-  0x00, 0x01, 0x00, 0x46, 0xff, 0xff, 0x03, 0x79, 0x03, 0xff, 0x00, 0x2c,
-  0x00, 0x82, 0x4b, 0xb0, 0x19, 0x50, 0x58, 0x40, 0x2a, 0x06, 0x01, 0x02,
-  0x0a, 0x03, 0x01, 0x02, 0x72, 0x0b, 0x01, 0x09, 0x05, 0x01, 0x03, 0x04,
-  0x09, 0x03, 0x67, 0x07, 0x01, 0x01, 0x01, 0x00, 0x5f, 0x08, 0x0c, 0x02,
-  0x00, 0x00, 0x12, 0x4d, 0x00, 0x0a, 0x0a, 0x04, 0x5f, 0x00, 0x04, 0x04,
-  0x13, 0x04, 0x4e, 0x1b, 0x40, 0x2b, 0x06, 0x01, 0x02, 0x0a, 0x03, 0x0a,
-  0x02, 0x03, 0x80, 0x0b, 0x01, 0x09, 0x05, 0x01, 0x03, 0x04, 0x09, 0x03,
-  0x67, 0x07, 0x01, 0x01, 0x01, 0x00, 0x5f, 0x08, 0x0c, 0x02, 0x00, 0x00,
-  0x12, 0x4d, 0x00, 0x0a, 0x0a, 0x04, 0x5f, 0x00, 0x04, 0x04, 0x13, 0x04,
-  0x4e, 0x59, 0x40, 0x1f, 0x02, 0x00, 0x29, 0x28, 0x27, 0x25, 0x24, 0x23,
-  0x20, 0x1e, 0x1a, 0x19, 0x18, 0x17, 0x16, 0x15, 0x11, 0x0f, 0x0b, 0x0a,
-  0x09, 0x08, 0x07, 0x06, 0x00, 0x2c, 0x02, 0x2c, 0x0d, 0x07, 0x16, 0x2b,
-  0x01, 0x31, 0x33, 0x1d, 0x03, 0x23, 0x15, 0x23, 0x15, 0x23, 0x1d, 0x03,
-  0x2b, 0x01, 0x3d, 0x03, 0x23, 0x35, 0x23, 0x35, 0x23, 0x3d, 0x03, 0x3b,
-  0x01, 0x1d, 0x02, 0x33, 0x15, 0x3b, 0x01, 0x35, 0x33, 0x3d, 0x02, 0x03,
-  0x13, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x67, 0x66,
-  0x66, 0x67, 0x66, 0x66, 0x03, 0xff, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66,
-  0x67, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66,
-  0x66, 0x67, 0x67, 0x66, 0x66, 0x67, 0x67, 0x66, 0x66, 0x67, 0x00, 0x00,
-  0x00, 0x01, 0x00, 0x46, 0xff, 0xff, 0x03, 0x79, 0x03, 0xff, 0x00, 0x38,
-  0x01, 0x8b, 0x4b, 0xb0, 0x09, 0x50, 0x58, 0x40, 0x4f, 0x00, 0x01, 0x0d,
-  0x0c, 0x0d, 0x01, 0x72, 0x00, 0x02, 0x0c, 0x0b, 0x0d, 0x02, 0x72, 0x00,
-  0x03, 0x0b, 0x0a, 0x0d, 0x03, 0x72, 0x00, 0x0a, 0x04, 0x06, 0x0a, 0x70,
-  0x00, 0x09, 0x04, 0x05, 0x06, 0x09, 0x72, 0x00, 0x08, 0x05, 0x06, 0x06,
-  0x08, 0x72, 0x00, 0x0c, 0x00, 0x04, 0x09, 0x0c, 0x04, 0x67, 0x00, 0x0b,
-  0x00, 0x05, 0x08, 0x0b, 0x05, 0x67, 0x00, 0x0d, 0x0d, 0x00, 0x5f, 0x0e,
-  0x01, 0x00, 0x00, 0x12, 0x4d, 0x00, 0x06, 0x06, 0x07, 0x60, 0x00, 0x07,
-  0x07, 0x13, 0x07, 0x4e, 0x1b, 0x4b, 0xb0, 0x0d, 0x50, 0x58, 0x40, 0x51,
-  0x00, 0x01, 0x0d, 0x0c, 0x0d, 0x01, 0x72, 0x00, 0x02, 0x0c, 0x0b, 0x0d,
-  0x02, 0x72, 0x00, 0x03, 0x0b, 0x0a, 0x0b, 0x03, 0x0a, 0x80, 0x00, 0x0a,
-  0x04, 0x0b, 0x0a, 0x04, 0x7e, 0x00, 0x09, 0x04, 0x05, 0x06, 0x09, 0x72,
-  0x00, 0x08, 0x05, 0x06, 0x06, 0x08, 0x72, 0x00, 0x0c, 0x00, 0x04, 0x09,
-  0x0c, 0x04, 0x67, 0x00, 0x0b, 0x00, 0x05, 0x08, 0x0b, 0x05, 0x67, 0x00,
-  0x0d, 0x0d, 0x00, 0x5f, 0x0e, 0x01, 0x00, 0x00, 0x12, 0x4d, 0x00, 0x06,
-  0x06, 0x07, 0x60, 0x00, 0x07, 0x07, 0x13, 0x07, 0x4e, 0x1b, 0x4b, 0xb0,
-  0x19, 0x50, 0x58, 0x40, 0x53, 0x00, 0x01, 0x0d, 0x0c, 0x0d, 0x01, 0x72,
-  0x00, 0x02, 0x0c, 0x0b, 0x0c, 0x02, 0x0b, 0x80, 0x00, 0x03, 0x0b, 0x0a,
-  0x0b, 0x03, 0x0a, 0x80, 0x00, 0x0a, 0x04, 0x0b, 0x0a, 0x04, 0x7e, 0x00,
-  0x09, 0x04, 0x05, 0x04, 0x09, 0x05, 0x80, 0x00, 0x08, 0x05, 0x06, 0x06,
-  0x08, 0x72, 0x00, 0x0c, 0x00, 0x04, 0x09, 0x0c, 0x04, 0x67, 0x00, 0x0b,
-  0x00, 0x05, 0x08, 0x0b, 0x05, 0x67, 0x00, 0x0d, 0x0d, 0x00, 0x5f, 0x0e,
-  0x01, 0x00, 0x00, 0x12, 0x4d, 0x00, 0x06, 0x06, 0x07, 0x60, 0x00, 0x07,
-  0x07, 0x13, 0x07, 0x4e, 0x1b, 0x40, 0x55, 0x00, 0x01, 0x0d, 0x0c, 0x0d,
-  0x01, 0x0c, 0x80, 0x00, 0x02, 0x0c, 0x0b, 0x0c, 0x02, 0x0b, 0x80, 0x00,
-  0x03, 0x0b, 0x0a, 0x0b, 0x03, 0x0a, 0x80, 0x00, 0x0a, 0x04, 0x0b, 0x0a,
-  0x04, 0x7e, 0x00, 0x09, 0x04, 0x05, 0x04, 0x09, 0x05, 0x80, 0x00, 0x08,
-  0x05, 0x06, 0x05, 0x08, 0x06, 0x80, 0x00, 0x0c, 0x00, 0x04, 0x09, 0x0c,
-  0x04, 0x67, 0x00, 0x0b, 0x00, 0x05, 0x08, 0x0b, 0x05, 0x67, 0x00, 0x0d,
-  0x0d, 0x00, 0x5f, 0x0e, 0x01, 0x00, 0x00, 0x12, 0x4d, 0x00, 0x06, 0x06,
-  0x07, 0x60, 0x00, 0x07, 0x07, 0x13, 0x07, 0x4e, 0x59, 0x59, 0x59, 0x40,
-  0x23, 0x02, 0x00, 0x30, 0x2b, 0x2a, 0x29, 0x28, 0x27, 0x26, 0x25, 0x24,
-  0x23, 0x22, 0x21, 0x1e, 0x16, 0x14, 0x0f, 0x0e, 0x0d, 0x0c, 0x0b, 0x0a,
-  0x09, 0x08, 0x07, 0x06, 0x05, 0x00, 0x38, 0x02, 0x32, 0x0f, 0x07, 0x16,
-  0x2b, 0x01, 0x31, 0x33, 0x1d, 0x02, 0x23, 0x15, 0x23, 0x15, 0x23, 0x15,
-  0x23, 0x15, 0x23, 0x15, 0x3b, 0x04, 0x1d, 0x01, 0x2b, 0x07, 0x3d, 0x02,
-  0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x2b, 0x04,
-  0x3d, 0x01, 0x3b, 0x05, 0x03, 0x13, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67,
-  0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66,
-  0x67, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x67,
-  0x66, 0x66, 0x67, 0x66, 0x66, 0x03, 0xff, 0x67, 0x66, 0x66, 0x67, 0x66,
-  0x66, 0x67, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x67, 0x66, 0x66, 0x67,
-  0x66, 0x66, 0x67, 0x00, 0x00, 0x01, 0x00, 0x46, 0x00, 0x00, 0x01, 0x79,
-  0x03, 0xff, 0x00, 0x1c, 0x00, 0x28, 0x40, 0x25, 0x00, 0x01, 0x01, 0x00,
-  0x5f, 0x04, 0x01, 0x00, 0x00, 0x12, 0x4d, 0x00, 0x02, 0x02, 0x03, 0x5f,
-  0x00, 0x03, 0x03, 0x13, 0x03, 0x4e, 0x02, 0x00, 0x11, 0x0e, 0x0c, 0x0b,
-  0x05, 0x04, 0x00, 0x1c, 0x02, 0x1b, 0x05, 0x07, 0x16, 0x2b, 0x01, 0x31,
-  0x33, 0x1d, 0x01, 0x23, 0x1d, 0x05, 0x33, 0x1d, 0x01, 0x2b, 0x02, 0x3d,
-  0x09, 0x33, 0x01, 0x13, 0x66, 0x66, 0x66, 0x66, 0x66, 0x67, 0x67, 0x03,
-  0xff, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x66,
-  0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0x00, 0x46, 0x00, 0x00, 0x03, 0x79, 0x03, 0xff, 0x00, 0x24,
-  0x00, 0x58, 0x40, 0x55, 0x00, 0x07, 0x00, 0x04, 0x0a, 0x07, 0x04, 0x67,
-  0x00, 0x08, 0x00, 0x03, 0x0b, 0x08, 0x03, 0x67, 0x00, 0x09, 0x00, 0x02,
-  0x01, 0x09, 0x02, 0x67, 0x00, 0x0a, 0x00, 0x01, 0x00, 0x0a, 0x01, 0x67,
-  0x00, 0x05, 0x05, 0x06, 0x5f, 0x00, 0x06, 0x06, 0x12, 0x4d, 0x00, 0x0b,
-  0x0b, 0x00, 0x5f, 0x0c, 0x01, 0x00, 0x00, 0x13, 0x00, 0x4e, 0x01, 0x00,
-  0x1f, 0x1d, 0x1c, 0x1b, 0x1a, 0x19, 0x18, 0x17, 0x16, 0x15, 0x13, 0x11,
-  0x0d, 0x0b, 0x0a, 0x09, 0x08, 0x07, 0x06, 0x05, 0x04, 0x03, 0x00, 0x24,
-  0x01, 0x23, 0x0d, 0x07, 0x16, 0x2b, 0x21, 0x23, 0x3d, 0x01, 0x23, 0x35,
-  0x23, 0x35, 0x23, 0x35, 0x23, 0x35, 0x2b, 0x01, 0x3d, 0x03, 0x3b, 0x01,
-  0x1d, 0x01, 0x33, 0x15, 0x33, 0x15, 0x33, 0x15, 0x33, 0x15, 0x3b, 0x01,
-  0x1d, 0x03, 0x23, 0x03, 0x13, 0x66, 0x67, 0x66, 0x67, 0x66, 0x66, 0x67,
-  0x67, 0x66, 0x66, 0x67, 0x66, 0x67, 0x66, 0x66, 0x66, 0x66, 0x66, 0x67,
-  0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67,
-  0x66, 0x66, 0x67, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x46,
-  0x00, 0x00, 0x01, 0x79, 0x03, 0xff, 0x00, 0x1c, 0x00, 0x28, 0x40, 0x25,
-  0x00, 0x03, 0x03, 0x00, 0x5f, 0x04, 0x01, 0x00, 0x00, 0x12, 0x4d, 0x00,
-  0x02, 0x02, 0x01, 0x5f, 0x00, 0x01, 0x01, 0x13, 0x01, 0x4e, 0x02, 0x00,
-  0x19, 0x18, 0x12, 0x11, 0x0f, 0x0c, 0x00, 0x1c, 0x02, 0x1b, 0x05, 0x07,
-  0x16, 0x2b, 0x01, 0x31, 0x33, 0x1d, 0x09, 0x2b, 0x02, 0x3d, 0x01, 0x33,
-  0x3d, 0x05, 0x23, 0x3d, 0x01, 0x33, 0x01, 0x12, 0x67, 0x67, 0x66, 0x66,
-  0x66, 0x66, 0x66, 0x03, 0xff, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66,
-  0x67, 0x66, 0x66, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67,
-  0x66, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x46, 0x01, 0xf4, 0x04, 0x45,
-  0x05, 0x27, 0x00, 0x30, 0x00, 0xa7, 0xb1, 0x06, 0x64, 0x44, 0x4b, 0xb0,
-  0x0d, 0x50, 0x58, 0x40, 0x39, 0x0e, 0x01, 0x08, 0x02, 0x01, 0x07, 0x08,
-  0x72, 0x00, 0x0b, 0x00, 0x03, 0x09, 0x0b, 0x03, 0x67, 0x0c, 0x01, 0x0a,
-  0x04, 0x01, 0x02, 0x08, 0x0a, 0x02, 0x67, 0x0d, 0x01, 0x09, 0x05, 0x01,
-  0x01, 0x07, 0x09, 0x01, 0x67, 0x10, 0x0f, 0x02, 0x07, 0x00, 0x00, 0x07,
-  0x57, 0x10, 0x0f, 0x02, 0x07, 0x07, 0x00, 0x60, 0x06, 0x01, 0x00, 0x07,
-  0x00, 0x50, 0x1b, 0x40, 0x3a, 0x0e, 0x01, 0x08, 0x02, 0x01, 0x02, 0x08,
-  0x01, 0x80, 0x00, 0x0b, 0x00, 0x03, 0x09, 0x0b, 0x03, 0x67, 0x0c, 0x01,
-  0x0a, 0x04, 0x01, 0x02, 0x08, 0x0a, 0x02, 0x67, 0x0d, 0x01, 0x09, 0x05,
-  0x01, 0x01, 0x07, 0x09, 0x01, 0x67, 0x10, 0x0f, 0x02, 0x07, 0x00, 0x00,
-  0x07, 0x57, 0x10, 0x0f, 0x02, 0x07, 0x07, 0x00, 0x60, 0x06, 0x01, 0x00,
-  0x07, 0x00, 0x50, 0x59, 0x40, 0x1e, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30,
-  0x2e, 0x2d, 0x2b, 0x2a, 0x28, 0x27, 0x26, 0x24, 0x23, 0x22, 0x20, 0x1f,
-  0x12, 0x11, 0x22, 0x12, 0x12, 0x22, 0x12, 0x12, 0x22, 0x11, 0x07, 0x1f,
-  0x2b, 0xb1, 0x06, 0x00, 0x44, 0x01, 0x31, 0x15, 0x2b, 0x01, 0x3d, 0x01,
-  0x23, 0x3d, 0x01, 0x23, 0x3d, 0x01, 0x2b, 0x01, 0x1d, 0x01, 0x23, 0x1d,
-  0x01, 0x23, 0x1d, 0x01, 0x2b, 0x01, 0x35, 0x33, 0x3d, 0x01, 0x33, 0x3d,
-  0x01, 0x33, 0x3d, 0x01, 0x33, 0x35, 0x3b, 0x01, 0x15, 0x33, 0x1d, 0x01,
-  0x33, 0x1d, 0x01, 0x33, 0x1d, 0x01, 0x04, 0x45, 0x66, 0x67, 0x66, 0x66,
-  0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67,
-  0x66, 0x66, 0x67, 0x02, 0x5a, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66,
-  0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66,
-  0x66, 0x67, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0x00, 0x46, 0xff, 0x99, 0x03, 0x79, 0x00, 0x66, 0x00, 0x14,
-  0x00, 0x28, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x1d, 0x02, 0x01, 0x00, 0x01,
-  0x01, 0x00, 0x57, 0x02, 0x01, 0x00, 0x00, 0x01, 0x5f, 0x00, 0x01, 0x00,
-  0x01, 0x4f, 0x02, 0x00, 0x0c, 0x04, 0x00, 0x14, 0x02, 0x0e, 0x03, 0x07,
-  0x16, 0x2b, 0xb1, 0x06, 0x00, 0x44, 0x25, 0x31, 0x33, 0x1d, 0x01, 0x2b,
-  0x07, 0x3d, 0x01, 0x3b, 0x05, 0x03, 0x13, 0x66, 0x66, 0x67, 0x66, 0x66,
-  0x67, 0x66, 0x66, 0x67, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x66, 0x66,
-  0x67, 0x67, 0x66, 0x00, 0x00, 0x01, 0x00, 0x46, 0x03, 0x99, 0x01, 0x79,
-  0x04, 0xcc, 0x00, 0x0c, 0x00, 0x2a, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x1f,
-  0x00, 0x00, 0x02, 0x01, 0x00, 0x57, 0x00, 0x03, 0x00, 0x02, 0x01, 0x03,
-  0x02, 0x67, 0x00, 0x00, 0x00, 0x01, 0x5f, 0x00, 0x01, 0x00, 0x01, 0x4f,
-  0x22, 0x11, 0x22, 0x20, 0x04, 0x07, 0x1a, 0x2b, 0xb1, 0x06, 0x00, 0x44,
-  0x01, 0x31, 0x33, 0x1d, 0x01, 0x2b, 0x01, 0x35, 0x23, 0x3d, 0x01, 0x3b,
-  0x01, 0x01, 0x13, 0x66, 0x66, 0x66, 0x67, 0x67, 0x66, 0x04, 0x66, 0x67,
-  0x66, 0x66, 0x67, 0x66, 0x00, 0x02, 0x00, 0x46, 0xff, 0xff, 0x03, 0x79,
-  0x03, 0xff, 0x00, 0x2a, 0x00, 0x39, 0x00, 0x80, 0x4b, 0xb0, 0x19, 0x50,
-  0x58, 0x40, 0x2f, 0x07, 0x01, 0x05, 0x06, 0x09, 0x00, 0x05, 0x72, 0x0a,
-  0x01, 0x08, 0x00, 0x0b, 0x09, 0x08, 0x72, 0x00, 0x0b, 0x00, 0x02, 0x01,
-  0x0b, 0x02, 0x67, 0x00, 0x09, 0x09, 0x06, 0x5f, 0x00, 0x06, 0x06, 0x12,
-  0x4d, 0x04, 0x01, 0x00, 0x00, 0x01, 0x60, 0x03, 0x01, 0x01, 0x01, 0x13,
-  0x01, 0x4e, 0x1b, 0x40, 0x31, 0x07, 0x01, 0x05, 0x06, 0x09, 0x06, 0x05,
-  0x09, 0x80, 0x0a, 0x01, 0x08, 0x00, 0x0b, 0x00, 0x08, 0x0b, 0x80, 0x00,
-  0x0b, 0x00, 0x02, 0x01, 0x0b, 0x02, 0x67, 0x00, 0x09, 0x09, 0x06, 0x5f,
-  0x00, 0x06, 0x06, 0x12, 0x4d, 0x04, 0x01, 0x00, 0x00, 0x01, 0x60, 0x03,
-  0x01, 0x01, 0x01, 0x13, 0x01, 0x4e, 0x59, 0x40, 0x12, 0x39, 0x35, 0x33,
-  0x32, 0x31, 0x2f, 0x13, 0x11, 0x41, 0x11, 0x18, 0x23, 0x43, 0x28, 0x20,
-  0x0c, 0x07, 0x1f, 0x2b, 0x01, 0x31, 0x33, 0x1d, 0x07, 0x2b, 0x01, 0x3d,
-  0x02, 0x2b, 0x03, 0x1d, 0x02, 0x2b, 0x01, 0x3d, 0x07, 0x33, 0x35, 0x33,
-  0x35, 0x3b, 0x03, 0x15, 0x33, 0x03, 0x31, 0x35, 0x23, 0x35, 0x2b, 0x01,
-  0x15, 0x23, 0x1d, 0x01, 0x3b, 0x03, 0x03, 0x13, 0x66, 0x66, 0x66, 0x67,
-  0x66, 0x67, 0x66, 0x66, 0x67, 0x67, 0x66, 0x66, 0x67, 0x66, 0x67, 0x66,
-  0x65, 0x67, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x67, 0x03, 0x32, 0x67,
-  0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67,
-  0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x67, 0x67,
-  0xfe, 0xce, 0x66, 0x67, 0x67, 0x66, 0x66, 0x00, 0x00, 0x03, 0x00, 0x46,
-  0x00, 0x00, 0x03, 0x79, 0x04, 0x00, 0x00, 0x26, 0x00, 0x33, 0x00, 0x40,
-  0x00, 0x7d, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40, 0x2e, 0x00, 0x00, 0x00,
-  0x01, 0x08, 0x00, 0x01, 0x67, 0x0a, 0x01, 0x08, 0x00, 0x06, 0x07, 0x08,
-  0x06, 0x67, 0x00, 0x02, 0x00, 0x03, 0x04, 0x02, 0x03, 0x67, 0x00, 0x09,
-  0x09, 0x05, 0x5f, 0x00, 0x05, 0x05, 0x12, 0x4d, 0x00, 0x07, 0x07, 0x04,
-  0x5f, 0x00, 0x04, 0x04, 0x13, 0x04, 0x4e, 0x1b, 0x40, 0x2e, 0x00, 0x00,
-  0x00, 0x01, 0x08, 0x00, 0x01, 0x67, 0x0a, 0x01, 0x08, 0x00, 0x06, 0x07,
-  0x08, 0x06, 0x67, 0x00, 0x02, 0x00, 0x03, 0x04, 0x02, 0x03, 0x67, 0x00,
-  0x09, 0x09, 0x05, 0x5f, 0x00, 0x05, 0x05, 0x14, 0x4d, 0x00, 0x07, 0x07,
-  0x04, 0x5f, 0x00, 0x04, 0x04, 0x13, 0x04, 0x4e, 0x59, 0x40, 0x13, 0x36,
-  0x34, 0x3c, 0x38, 0x34, 0x40, 0x36, 0x3e, 0x42, 0x43, 0x7a, 0x71, 0x14,
-  0x11, 0x13, 0x20, 0x0b, 0x07, 0x1e, 0x2b, 0x01, 0x31, 0x33, 0x1d, 0x02,
-  0x23, 0x15, 0x33, 0x1d, 0x03, 0x23, 0x15, 0x2b, 0x06, 0x3d, 0x09, 0x3b,
-  0x06, 0x03, 0x31, 0x35, 0x2b, 0x03, 0x1d, 0x01, 0x3b, 0x03, 0x03, 0x31,
-  0x33, 0x3d, 0x01, 0x2b, 0x03, 0x1d, 0x01, 0x3b, 0x01, 0x03, 0x13, 0x66,
-  0x66, 0x66, 0x66, 0x66, 0x67, 0x66, 0x67, 0x66, 0x66, 0x67, 0x67, 0x66,
-  0x66, 0x67, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x67, 0x66, 0x66, 0x67,
-  0x66, 0x67, 0x67, 0x67, 0x67, 0x66, 0x67, 0x66, 0x66, 0x67, 0x03, 0x99,
-  0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66,
-  0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x67, 0xfd, 0x33, 0x66, 0x66, 0x66,
-  0x01, 0x99, 0x66, 0x67, 0x67, 0x66, 0x00, 0x00, 0x00, 0x01, 0x00, 0x46,
-  0x00, 0x00, 0x03, 0x79, 0x04, 0x00, 0x00, 0x34, 0x00, 0x6a, 0x4b, 0xb0,
-  0x0f, 0x50, 0x58, 0x40, 0x27, 0x08, 0x01, 0x00, 0x00, 0x01, 0x04, 0x00,
-  0x01, 0x67, 0x00, 0x04, 0x07, 0x01, 0x05, 0x06, 0x04, 0x05, 0x67, 0x00,
-  0x02, 0x02, 0x09, 0x5f, 0x00, 0x09, 0x09, 0x12, 0x4d, 0x00, 0x03, 0x03,
-  0x06, 0x5f, 0x00, 0x06, 0x06, 0x13, 0x06, 0x4e, 0x1b, 0x40, 0x27, 0x08,
-  0x01, 0x00, 0x00, 0x01, 0x04, 0x00, 0x01, 0x67, 0x00, 0x04, 0x07, 0x01,
-  0x05, 0x06, 0x04, 0x05, 0x67, 0x00, 0x02, 0x02, 0x09, 0x5f, 0x00, 0x09,
-  0x09, 0x14, 0x4d, 0x00, 0x03, 0x03, 0x06, 0x5f, 0x00, 0x06, 0x06, 0x13,
-  0x06, 0x4e, 0x59, 0x40, 0x0e, 0x34, 0x2e, 0x18, 0x11, 0x61, 0x12, 0x21,
-  0x46, 0x41, 0x22, 0x20, 0x0a, 0x07, 0x1f, 0x2b, 0x01, 0x31, 0x33, 0x1d,
-  0x01, 0x2b, 0x01, 0x35, 0x2b, 0x03, 0x1d, 0x05, 0x3b, 0x03, 0x35, 0x3b,
-  0x01, 0x1d, 0x01, 0x23, 0x15, 0x2b, 0x05, 0x35, 0x23, 0x3d, 0x07, 0x33,
-  0x35, 0x3b, 0x05, 0x03, 0x13, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66,
-  0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66,
-  0x66, 0x67, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x03, 0x99, 0x66,
-  0x67, 0x67, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x66, 0x66, 0x67, 0x66,
-  0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x67, 0x00, 0x00,
-  0x00, 0x02, 0x00, 0x46, 0x00, 0x00, 0x03, 0x79, 0x04, 0x00, 0x00, 0x24,
-  0x00, 0x39, 0x00, 0x63, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40, 0x25, 0x00,
-  0x00, 0x00, 0x01, 0x07, 0x00, 0x01, 0x67, 0x00, 0x05, 0x00, 0x02, 0x03,
-  0x05, 0x02, 0x67, 0x00, 0x06, 0x06, 0x04, 0x5f, 0x00, 0x04, 0x04, 0x12,
-  0x4d, 0x00, 0x07, 0x07, 0x03, 0x5f, 0x00, 0x03, 0x03, 0x13, 0x03, 0x4e,
-  0x1b, 0x40, 0x25, 0x00, 0x00, 0x00, 0x01, 0x07, 0x00, 0x01, 0x67, 0x00,
-  0x05, 0x00, 0x02, 0x03, 0x05, 0x02, 0x67, 0x00, 0x06, 0x06, 0x04, 0x5f,
-  0x00, 0x04, 0x04, 0x14, 0x4d, 0x00, 0x07, 0x07, 0x03, 0x5f, 0x00, 0x03,
-  0x03, 0x13, 0x03, 0x4e, 0x59, 0x40, 0x0b, 0x46, 0x43, 0x11, 0x6a, 0x61,
-  0x11, 0x16, 0x20, 0x08, 0x07, 0x1e, 0x2b, 0x01, 0x31, 0x33, 0x1d, 0x05,
-  0x23, 0x15, 0x23, 0x15, 0x2b, 0x05, 0x3d, 0x09, 0x3b, 0x05, 0x15, 0x33,
-  0x07, 0x31, 0x35, 0x2b, 0x03, 0x1d, 0x05, 0x3b, 0x03, 0x3d, 0x03, 0x03,
-  0x13, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x67, 0x66,
-  0x66, 0x67, 0x66, 0x66, 0x67, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67,
-  0x66, 0x66, 0x03, 0x33, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66,
-  0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x67, 0x67, 0xcd,
-  0x67, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x66, 0x66, 0x67, 0x66, 0x00,
-  0x00, 0x01, 0x00, 0x46, 0x00, 0x00, 0x03, 0x79, 0x04, 0x00, 0x00, 0x3a,
-  0x00, 0x9c, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40, 0x25, 0x00, 0x03, 0x02,
-  0x04, 0x04, 0x03, 0x72, 0x00, 0x02, 0x00, 0x04, 0x05, 0x02, 0x04, 0x67,
-  0x00, 0x01, 0x01, 0x00, 0x5f, 0x07, 0x01, 0x00, 0x00, 0x12, 0x4d, 0x00,
-  0x05, 0x05, 0x06, 0x5f, 0x00, 0x06, 0x06, 0x13, 0x06, 0x4e, 0x1b, 0x4b,
-  0xb0, 0x19, 0x50, 0x58, 0x40, 0x25, 0x00, 0x03, 0x02, 0x04, 0x04, 0x03,
-  0x72, 0x00, 0x02, 0x00, 0x04, 0x05, 0x02, 0x04, 0x67, 0x00, 0x01, 0x01,
-  0x00, 0x5f, 0x07, 0x01, 0x00, 0x00, 0x14, 0x4d, 0x00, 0x05, 0x05, 0x06,
-  0x5f, 0x00, 0x06, 0x06, 0x13, 0x06, 0x4e, 0x1b, 0x40, 0x26, 0x00, 0x03,
-  0x02, 0x04, 0x02, 0x03, 0x04, 0x80, 0x00, 0x02, 0x00, 0x04, 0x05, 0x02,
-  0x04, 0x67, 0x00, 0x01, 0x01, 0x00, 0x5f, 0x07, 0x01, 0x00, 0x00, 0x14,
-  0x4d, 0x00, 0x05, 0x05, 0x06, 0x5f, 0x00, 0x06, 0x06, 0x13, 0x06, 0x4e,
-  0x59, 0x59, 0x40, 0x15, 0x02, 0x00, 0x2a, 0x22, 0x20, 0x1a, 0x18, 0x14,
-  0x13, 0x12, 0x11, 0x0c, 0x0a, 0x04, 0x00, 0x3a, 0x02, 0x34, 0x08, 0x07,
-  0x16, 0x2b, 0x01, 0x31, 0x33, 0x1d, 0x01, 0x2b, 0x05, 0x1d, 0x01, 0x3b,
-  0x04, 0x15, 0x23, 0x15, 0x2b, 0x03, 0x1d, 0x01, 0x3b, 0x05, 0x1d, 0x01,
-  0x2b, 0x07, 0x3d, 0x09, 0x3b, 0x05, 0x03, 0x13, 0x66, 0x66, 0x67, 0x66,
-  0x67, 0x66, 0x66, 0x66, 0x66, 0x67, 0x66, 0x67, 0x67, 0x66, 0x67, 0x66,
-  0x66, 0x66, 0x66, 0x67, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x67, 0x66,
-  0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x04, 0x00, 0x67,
-  0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66,
-  0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x67, 0x00, 0x00, 0x01, 0x00, 0x46,
-  0x00, 0x00, 0x03, 0x79, 0x04, 0x00, 0x00, 0x2e, 0x00, 0x8b, 0x4b, 0xb0,
-  0x0f, 0x50, 0x58, 0x40, 0x20, 0x00, 0x03, 0x02, 0x04, 0x04, 0x03, 0x72,
-  0x00, 0x02, 0x00, 0x04, 0x05, 0x02, 0x04, 0x67, 0x00, 0x01, 0x01, 0x00,
-  0x5f, 0x06, 0x01, 0x00, 0x00, 0x12, 0x4d, 0x00, 0x05, 0x05, 0x13, 0x05,
-  0x4e, 0x1b, 0x4b, 0xb0, 0x19, 0x50, 0x58, 0x40, 0x20, 0x00, 0x03, 0x02,
-  0x04, 0x04, 0x03, 0x72, 0x00, 0x02, 0x00, 0x04, 0x05, 0x02, 0x04, 0x67,
-  0x00, 0x01, 0x01, 0x00, 0x5f, 0x06, 0x01, 0x00, 0x00, 0x14, 0x4d, 0x00,
-  0x05, 0x05, 0x13, 0x05, 0x4e, 0x1b, 0x40, 0x21, 0x00, 0x03, 0x02, 0x04,
-  0x02, 0x03, 0x04, 0x80, 0x00, 0x02, 0x00, 0x04, 0x05, 0x02, 0x04, 0x67,
-  0x00, 0x01, 0x01, 0x00, 0x5f, 0x06, 0x01, 0x00, 0x00, 0x14, 0x4d, 0x00,
-  0x05, 0x05, 0x13, 0x05, 0x4e, 0x59, 0x59, 0x40, 0x13, 0x02, 0x00, 0x1e,
-  0x1c, 0x18, 0x14, 0x13, 0x12, 0x11, 0x0c, 0x0a, 0x04, 0x00, 0x2e, 0x02,
-  0x28, 0x07, 0x07, 0x16, 0x2b, 0x01, 0x31, 0x33, 0x1d, 0x01, 0x2b, 0x05,
-  0x1d, 0x01, 0x3b, 0x04, 0x15, 0x23, 0x15, 0x2b, 0x03, 0x1d, 0x03, 0x2b,
-  0x01, 0x3d, 0x09, 0x3b, 0x05, 0x03, 0x12, 0x67, 0x67, 0x66, 0x66, 0x67,
-  0x66, 0x66, 0x66, 0x66, 0x67, 0x66, 0x66, 0x66, 0x66, 0x67, 0x66, 0x66,
-  0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x04, 0x00, 0x67, 0x66,
-  0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66,
-  0x67, 0x66, 0x66, 0x67, 0x66, 0x67, 0x00, 0x00, 0x00, 0x01, 0x00, 0x46,
-  0x00, 0x00, 0x03, 0x79, 0x04, 0x00, 0x00, 0x40, 0x00, 0x7e, 0x4b, 0xb0,
-  0x0f, 0x50, 0x58, 0x40, 0x2f, 0x0a, 0x01, 0x00, 0x00, 0x01, 0x05, 0x00,
-  0x01, 0x67, 0x00, 0x05, 0x00, 0x04, 0x03, 0x05, 0x04, 0x67, 0x00, 0x06,
-  0x09, 0x01, 0x07, 0x08, 0x06, 0x07, 0x67, 0x00, 0x02, 0x02, 0x0b, 0x5f,
-  0x00, 0x0b, 0x0b, 0x12, 0x4d, 0x00, 0x03, 0x03, 0x08, 0x5f, 0x00, 0x08,
-  0x08, 0x13, 0x08, 0x4e, 0x1b, 0x40, 0x2f, 0x0a, 0x01, 0x00, 0x00, 0x01,
-  0x05, 0x00, 0x01, 0x67, 0x00, 0x05, 0x00, 0x04, 0x03, 0x05, 0x04, 0x67,
-  0x00, 0x06, 0x09, 0x01, 0x07, 0x08, 0x06, 0x07, 0x67, 0x00, 0x02, 0x02,
-  0x0b, 0x5f, 0x00, 0x0b, 0x0b, 0x14, 0x4d, 0x00, 0x03, 0x03, 0x08, 0x5f,
-  0x00, 0x08, 0x08, 0x13, 0x08, 0x4e, 0x59, 0x40, 0x12, 0x40, 0x3a, 0x39,
-  0x38, 0x30, 0x2f, 0x61, 0x14, 0x11, 0x42, 0x32, 0x46, 0x41, 0x22, 0x20,
-  0x0c, 0x07, 0x1f, 0x2b, 0x01, 0x31, 0x33, 0x1d, 0x01, 0x2b, 0x01, 0x35,
-  0x2b, 0x03, 0x1d, 0x05, 0x3b, 0x03, 0x3d, 0x01, 0x2b, 0x02, 0x3d, 0x01,
-  0x3b, 0x03, 0x15, 0x33, 0x1d, 0x03, 0x23, 0x15, 0x2b, 0x05, 0x35, 0x23,
-  0x3d, 0x07, 0x33, 0x35, 0x3b, 0x05, 0x03, 0x12, 0x67, 0x67, 0x66, 0x66,
-  0x67, 0x66, 0x67, 0x67, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67,
-  0x66, 0x66, 0x67, 0x67, 0x66, 0x66, 0x67, 0x66, 0x67, 0x66, 0x66, 0x66,
-  0x66, 0x67, 0x66, 0x67, 0x66, 0x66, 0x03, 0x99, 0x66, 0x67, 0x67, 0x67,
-  0x66, 0x66, 0x67, 0x66, 0x66, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66,
-  0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66,
-  0x67, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x46, 0x00, 0x00, 0x03, 0x78,
-  0x04, 0x00, 0x00, 0x34, 0x00, 0x4d, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40,
-  0x16, 0x00, 0x05, 0x00, 0x02, 0x01, 0x05, 0x02, 0x67, 0x04, 0x06, 0x02,
-  0x00, 0x00, 0x12, 0x4d, 0x03, 0x01, 0x01, 0x01, 0x13, 0x01, 0x4e, 0x1b,
-  0x40, 0x16, 0x00, 0x05, 0x00, 0x02, 0x01, 0x05, 0x02, 0x67, 0x04, 0x06,
-  0x02, 0x00, 0x00, 0x14, 0x4d, 0x03, 0x01, 0x01, 0x01, 0x13, 0x01, 0x4e,
-  0x59, 0x40, 0x13, 0x02, 0x00, 0x30, 0x2c, 0x28, 0x26, 0x1c, 0x1a, 0x16,
-  0x12, 0x0e, 0x0c, 0x00, 0x34, 0x02, 0x34, 0x07, 0x07, 0x16, 0x2b, 0x01,
-  0x31, 0x33, 0x1d, 0x09, 0x2b, 0x01, 0x3d, 0x03, 0x2b, 0x03, 0x1d, 0x03,
-  0x2b, 0x01, 0x3d, 0x09, 0x3b, 0x01, 0x1d, 0x03, 0x3b, 0x03, 0x3d, 0x03,
-  0x03, 0x12, 0x66, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x66,
-  0x66, 0x67, 0x66, 0x66, 0x67, 0x04, 0x00, 0x67, 0x66, 0x67, 0x66, 0x66,
-  0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x66, 0x66, 0x67,
-  0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x67, 0x67,
-  0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x67, 0x00, 0x00, 0x03, 0x00, 0x46,
-  0x00, 0x00, 0x03, 0x79, 0x04, 0x00, 0x00, 0x25, 0x00, 0x3a, 0x00, 0x4f,
-  0x00, 0x68, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40, 0x1e, 0x07, 0x04, 0x02,
-  0x00, 0x00, 0x05, 0x5f, 0x0b, 0x06, 0x0a, 0x03, 0x05, 0x05, 0x12, 0x4d,
-  0x0c, 0x08, 0x03, 0x03, 0x01, 0x01, 0x02, 0x5f, 0x09, 0x01, 0x02, 0x02,
-  0x13, 0x02, 0x4e, 0x1b, 0x40, 0x1e, 0x07, 0x04, 0x02, 0x00, 0x00, 0x05,
-  0x5f, 0x0b, 0x06, 0x0a, 0x03, 0x05, 0x05, 0x14, 0x4d, 0x0c, 0x08, 0x03,
-  0x03, 0x01, 0x01, 0x02, 0x5f, 0x09, 0x01, 0x02, 0x02, 0x13, 0x02, 0x4e,
-  0x59, 0x40, 0x1e, 0x3d, 0x3b, 0x28, 0x26, 0x00, 0x00, 0x47, 0x3f, 0x3b,
-  0x4f, 0x3d, 0x49, 0x32, 0x2a, 0x26, 0x3a, 0x28, 0x34, 0x00, 0x25, 0x00,
-  0x20, 0x26, 0x21, 0x61, 0x26, 0x23, 0x0d, 0x07, 0x1b, 0x2b, 0x01, 0x31,
-  0x1d, 0x01, 0x2b, 0x01, 0x1d, 0x05, 0x3b, 0x01, 0x15, 0x2b, 0x05, 0x35,
-  0x3b, 0x01, 0x3d, 0x05, 0x2b, 0x01, 0x35, 0x3b, 0x05, 0x31, 0x33, 0x1d,
-  0x01, 0x2b, 0x07, 0x3d, 0x01, 0x3b, 0x05, 0x13, 0x31, 0x33, 0x1d, 0x01,
-  0x2b, 0x07, 0x3d, 0x01, 0x3b, 0x05, 0x03, 0x13, 0x67, 0x66, 0x66, 0x67,
-  0x67, 0x66, 0x66, 0x67, 0x66, 0x67, 0x67, 0x66, 0x66, 0x67, 0x67, 0x66,
-  0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66,
-  0x67, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66,
-  0x66, 0x67, 0x66, 0x66, 0x67, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x04,
-  0x00, 0x79, 0x54, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0xcd, 0xcd, 0x66,
-  0x66, 0x67, 0x66, 0x66, 0x67, 0xcd, 0x67, 0x66, 0x66, 0x67, 0xfc, 0xcc,
-  0x66, 0x66, 0x66, 0x66, 0x00, 0x01, 0x00, 0x46, 0x00, 0x00, 0x03, 0x79,
-  0x04, 0x00, 0x00, 0x2a, 0x00, 0x61, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40,
-  0x1f, 0x00, 0x04, 0x03, 0x01, 0x01, 0x02, 0x04, 0x01, 0x67, 0x00, 0x06,
-  0x06, 0x00, 0x5f, 0x07, 0x01, 0x00, 0x00, 0x12, 0x4d, 0x00, 0x05, 0x05,
-  0x02, 0x5f, 0x00, 0x02, 0x02, 0x13, 0x02, 0x4e, 0x1b, 0x40, 0x1f, 0x00,
-  0x04, 0x03, 0x01, 0x01, 0x02, 0x04, 0x01, 0x67, 0x00, 0x06, 0x06, 0x00,
-  0x5f, 0x07, 0x01, 0x00, 0x00, 0x14, 0x4d, 0x00, 0x05, 0x05, 0x02, 0x5f,
-  0x00, 0x02, 0x02, 0x13, 0x02, 0x4e, 0x59, 0x40, 0x15, 0x02, 0x00, 0x27,
-  0x25, 0x1e, 0x1a, 0x19, 0x17, 0x15, 0x14, 0x13, 0x0d, 0x0c, 0x0b, 0x00,
-  0x2a, 0x02, 0x28, 0x08, 0x07, 0x16, 0x2b, 0x01, 0x31, 0x33, 0x1d, 0x08,
-  0x23, 0x15, 0x2b, 0x05, 0x35, 0x23, 0x3d, 0x01, 0x3b, 0x01, 0x15, 0x3b,
-  0x03, 0x3d, 0x06, 0x2b, 0x01, 0x35, 0x3b, 0x01, 0x03, 0x13, 0x66, 0x66,
-  0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x67, 0x66, 0x66, 0x67, 0x66,
-  0x66, 0x66, 0x66, 0x66, 0x66, 0x04, 0x00, 0x67, 0x66, 0x67, 0x66, 0x66,
-  0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x66, 0x66, 0x67,
-  0x66, 0x66, 0x67, 0x66, 0x67, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x46,
-  0xff, 0xff, 0x03, 0x79, 0x03, 0xff, 0x00, 0x38, 0x01, 0x3a, 0x4b, 0xb0,
-  0x0d, 0x50, 0x58, 0x40, 0x54, 0x00, 0x0f, 0x0c, 0x0b, 0x0e, 0x0f, 0x72,
-  0x00, 0x10, 0x0b, 0x0a, 0x0e, 0x10, 0x72, 0x00, 0x01, 0x07, 0x06, 0x02,
-  0x01, 0x72, 0x00, 0x03, 0x05, 0x04, 0x02, 0x03, 0x72, 0x00, 0x0c, 0x12,
-  0x01, 0x11, 0x00, 0x0c, 0x11, 0x67, 0x00, 0x0a, 0x00, 0x07, 0x01, 0x0a,
-  0x07, 0x67, 0x00, 0x0b, 0x00, 0x06, 0x02, 0x0b, 0x06, 0x67, 0x00, 0x00,
-  0x00, 0x05, 0x03, 0x00, 0x05, 0x67, 0x00, 0x0e, 0x0e, 0x09, 0x5f, 0x0d,
-  0x01, 0x09, 0x09, 0x12, 0x4d, 0x00, 0x02, 0x02, 0x04, 0x60, 0x08, 0x01,
-  0x04, 0x04, 0x13, 0x04, 0x4e, 0x1b, 0x4b, 0xb0, 0x19, 0x50, 0x58, 0x40,
-  0x55, 0x00, 0x0f, 0x0c, 0x0b, 0x0e, 0x0f, 0x72, 0x00, 0x10, 0x0b, 0x0a,
-  0x0b, 0x10, 0x0a, 0x80, 0x00, 0x01, 0x07, 0x06, 0x02, 0x01, 0x72, 0x00,
-  0x03, 0x05, 0x04, 0x02, 0x03, 0x72, 0x00, 0x0c, 0x12, 0x01, 0x11, 0x00,
-  0x0c, 0x11, 0x67, 0x00, 0x0a, 0x00, 0x07, 0x01, 0x0a, 0x07, 0x67, 0x00,
-  0x0b, 0x00, 0x06, 0x02, 0x0b, 0x06, 0x67, 0x00, 0x00, 0x00, 0x05, 0x03,
-  0x00, 0x05, 0x67, 0x00, 0x0e, 0x0e, 0x09, 0x5f, 0x0d, 0x01, 0x09, 0x09,
-  0x12, 0x4d, 0x00, 0x02, 0x02, 0x04, 0x60, 0x08, 0x01, 0x04, 0x04, 0x13,
-  0x04, 0x4e, 0x1b, 0x40, 0x58, 0x00, 0x0f, 0x0c, 0x0b, 0x0c, 0x0f, 0x0b,
-  0x80, 0x00, 0x10, 0x0b, 0x0a, 0x0b, 0x10, 0x0a, 0x80, 0x00, 0x01, 0x07,
-  0x06, 0x07, 0x01, 0x06, 0x80, 0x00, 0x03, 0x05, 0x04, 0x05, 0x03, 0x04,
-  0x80, 0x00, 0x0c, 0x12, 0x01, 0x11, 0x00, 0x0c, 0x11, 0x67, 0x00, 0x0a,
-  0x00, 0x07, 0x01, 0x0a, 0x07, 0x67, 0x00, 0x0b, 0x00, 0x06, 0x02, 0x0b,
-  0x06, 0x67, 0x00, 0x00, 0x00, 0x05, 0x03, 0x00, 0x05, 0x67, 0x00, 0x0e,
-  0x0e, 0x09, 0x5f, 0x0d, 0x01, 0x09, 0x09, 0x12, 0x4d, 0x00, 0x02, 0x02,
-  0x04, 0x60, 0x08, 0x01, 0x04, 0x04, 0x13, 0x04, 0x4e, 0x59, 0x59, 0x40,
-  0x22, 0x00, 0x00, 0x00, 0x38, 0x00, 0x38, 0x37, 0x36, 0x35, 0x34, 0x33,
-  0x32, 0x31, 0x2e, 0x2d, 0x2c, 0x2b, 0x2a, 0x29, 0x28, 0x25, 0x23, 0x23,
-  0x11, 0x11, 0x11, 0x31, 0x11, 0x11, 0x11, 0x13, 0x13, 0x07, 0x1f, 0x2b,
-  0x01, 0x31, 0x1d, 0x01, 0x33, 0x15, 0x33, 0x15, 0x33, 0x15, 0x33, 0x15,
-  0x2b, 0x02, 0x35, 0x23, 0x35, 0x23, 0x35, 0x23, 0x1d, 0x02, 0x2b, 0x01,
-  0x3d, 0x09, 0x3b, 0x01, 0x1d, 0x02, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35,
-  0x3b, 0x02, 0x15, 0x23, 0x15, 0x23, 0x15, 0x23, 0x15, 0x01, 0xdf, 0x67,
-  0x66, 0x66, 0x67, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66,
-  0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x67, 0x66, 0x66, 0x02, 0x65,
-  0x66, 0x66, 0x67, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66,
-  0x66, 0x67, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x67, 0x66,
-  0x66, 0x66, 0x66, 0x67, 0x67, 0x66, 0x66, 0x67, 0x00, 0x01, 0x00, 0x46,
-  0xff, 0xff, 0x03, 0x79, 0x03, 0xff, 0x00, 0x26, 0x00, 0x4e, 0x4b, 0xb0,
-  0x19, 0x50, 0x58, 0x40, 0x18, 0x04, 0x01, 0x00, 0x02, 0x03, 0x03, 0x00,
-  0x72, 0x00, 0x02, 0x02, 0x12, 0x4d, 0x00, 0x03, 0x03, 0x01, 0x60, 0x00,
-  0x01, 0x01, 0x13, 0x01, 0x4e, 0x1b, 0x40, 0x19, 0x04, 0x01, 0x00, 0x02,
-  0x03, 0x02, 0x00, 0x03, 0x80, 0x00, 0x02, 0x02, 0x12, 0x4d, 0x00, 0x03,
-  0x03, 0x01, 0x60, 0x00, 0x01, 0x01, 0x13, 0x01, 0x4e, 0x59, 0x40, 0x0f,
-  0x02, 0x00, 0x25, 0x21, 0x19, 0x17, 0x0d, 0x05, 0x00, 0x26, 0x02, 0x26,
-  0x05, 0x07, 0x16, 0x2b, 0x01, 0x31, 0x33, 0x1d, 0x02, 0x2b, 0x07, 0x3d,
-  0x09, 0x3b, 0x01, 0x1d, 0x07, 0x3b, 0x03, 0x35, 0x03, 0x12, 0x67, 0x67,
-  0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x66, 0x66, 0x67, 0x66, 0x66,
-  0x67, 0x01, 0x32, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x67, 0x66, 0x66,
-  0x67, 0x66, 0x66, 0x67, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66,
-  0x66, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x46, 0xff, 0xff, 0x03, 0x78,
-  0x03, 0xff, 0x00, 0x42, 0x00, 0x3e, 0x40, 0x3b, 0x09, 0x01, 0x07, 0x04,
-  0x01, 0x02, 0x03, 0x07, 0x02, 0x67, 0x00, 0x08, 0x00, 0x03, 0x01, 0x08,
-  0x03, 0x67, 0x06, 0x0a, 0x02, 0x00, 0x00, 0x12, 0x4d, 0x05, 0x01, 0x01,
-  0x01, 0x13, 0x01, 0x4e, 0x02, 0x00, 0x41, 0x40, 0x3f, 0x3d, 0x3c, 0x3b,
-  0x3a, 0x38, 0x2e, 0x2c, 0x25, 0x24, 0x1e, 0x1c, 0x16, 0x15, 0x0e, 0x0c,
-  0x00, 0x42, 0x02, 0x42, 0x0b, 0x07, 0x16, 0x2b, 0x01, 0x31, 0x33, 0x1d,
-  0x09, 0x2b, 0x01, 0x3d, 0x06, 0x23, 0x1d, 0x05, 0x2b, 0x01, 0x3d, 0x05,
-  0x23, 0x1d, 0x06, 0x2b, 0x01, 0x3d, 0x09, 0x3b, 0x01, 0x15, 0x33, 0x15,
-  0x3b, 0x01, 0x35, 0x33, 0x35, 0x03, 0x12, 0x66, 0x66, 0x66, 0x67, 0x66,
-  0x66, 0x67, 0x66, 0x66, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x03, 0xff,
-  0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x67, 0x66, 0x66, 0x67,
-  0x66, 0x67, 0x66, 0x66, 0x67, 0x67, 0x66, 0x66, 0x67, 0x66, 0x67, 0x67,
-  0x66, 0x67, 0x66, 0x66, 0x67, 0x67, 0x66, 0x66, 0x67, 0x66, 0x67, 0x66,
-  0x66, 0x67, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x67, 0x66,
-  0x66, 0x67, 0x00, 0x00, 0x00, 0x01, 0x00, 0x46, 0x00, 0x00, 0x03, 0x78,
-  0x04, 0x00, 0x00, 0x48, 0x00, 0x73, 0x4b, 0xb0, 0x0f, 0x50, 0x58, 0x40,
-  0x27, 0x00, 0x06, 0x03, 0x02, 0x03, 0x06, 0x02, 0x80, 0x00, 0x02, 0x07,
-  0x03, 0x02, 0x07, 0x7e, 0x00, 0x03, 0x03, 0x00, 0x5f, 0x05, 0x08, 0x02,
-  0x00, 0x00, 0x12, 0x4d, 0x00, 0x07, 0x07, 0x01, 0x60, 0x04, 0x01, 0x01,
-  0x01, 0x13, 0x01, 0x4e, 0x1b, 0x40, 0x27, 0x00, 0x06, 0x03, 0x02, 0x03,
-  0x06, 0x02, 0x80, 0x00, 0x02, 0x07, 0x03, 0x02, 0x07, 0x7e, 0x00, 0x03,
-  0x03, 0x00, 0x5f, 0x05, 0x08, 0x02, 0x00, 0x00, 0x14, 0x4d, 0x00, 0x07,
-  0x07, 0x01, 0x60, 0x04, 0x01, 0x01, 0x01, 0x13, 0x01, 0x4e, 0x59, 0x40,
-  0x17, 0x02, 0x00, 0x3f, 0x3e, 0x36, 0x35, 0x34, 0x30, 0x26, 0x24, 0x1b,
-  0x1a, 0x12, 0x11, 0x10, 0x0c, 0x00, 0x48, 0x02, 0x48, 0x09, 0x07, 0x16,
-  0x2b, 0x01, 0x31, 0x33, 0x1d, 0x09, 0x2b, 0x03, 0x35, 0x23, 0x3d, 0x07,
-  0x23, 0x1d, 0x08, 0x2b, 0x01, 0x3d, 0x09, 0x3b, 0x03, 0x15, 0x33, 0x1d,
-  0x07, 0x33, 0x3d, 0x08, 0x03, 0x12, 0x66, 0x66, 0x66, 0x67, 0x66, 0x66,
-  0x67, 0x66, 0x66, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x04, 0x00, 0x67,
-  0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66,
-  0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66,
-  0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66,
-  0x67, 0x67, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x67, 0x66,
-  0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x67, 0x00, 0x00, 0x02, 0x00, 0x46,
-  0xff, 0xff, 0x03, 0x79, 0x03, 0xff, 0x00, 0x24, 0x00, 0x39, 0x00, 0x2d,
-  0x40, 0x2a, 0x04, 0x01, 0x00, 0x03, 0x01, 0x01, 0x02, 0x00, 0x01, 0x67,
-  0x00, 0x06, 0x06, 0x05, 0x5f, 0x00, 0x05, 0x05, 0x12, 0x4d, 0x00, 0x07,
-  0x07, 0x02, 0x5f, 0x00, 0x02, 0x02, 0x13, 0x02, 0x4e, 0x46, 0x43, 0x61,
-  0x18, 0x11, 0x61, 0x18, 0x20, 0x08, 0x07, 0x1e, 0x2b, 0x01, 0x31, 0x33,
-  0x1d, 0x07, 0x23, 0x15, 0x2b, 0x05, 0x35, 0x23, 0x3d, 0x07, 0x33, 0x35,
-  0x3b, 0x05, 0x03, 0x31, 0x35, 0x2b, 0x03, 0x1d, 0x05, 0x3b, 0x03, 0x3d,
-  0x03, 0x03, 0x13, 0x66, 0x66, 0x66, 0x67, 0x66, 0x67, 0x66, 0x66, 0x67,
-  0x67, 0x66, 0x66, 0x67, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x67, 0x66,
-  0x66, 0x67, 0x66, 0x67, 0x03, 0x98, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67,
-  0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66,
-  0x67, 0xfe, 0xcd, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67,
-  0x66, 0x66, 0x00, 0x00, 0x00, 0x02, 0x00, 0x46, 0xff, 0xff, 0x03, 0x79,
-  0x03, 0xff, 0x00, 0x24, 0x00, 0x33, 0x00, 0x3d, 0x40, 0x3a, 0x00, 0x02,
-  0x06, 0x03, 0x06, 0x02, 0x03, 0x80, 0x00, 0x00, 0x00, 0x01, 0x06, 0x00,
-  0x01, 0x67, 0x08, 0x01, 0x06, 0x00, 0x03, 0x04, 0x06, 0x03, 0x67, 0x00,
-  0x07, 0x07, 0x05, 0x5f, 0x00, 0x05, 0x05, 0x12, 0x4d, 0x00, 0x04, 0x04,
-  0x13, 0x04, 0x4e, 0x27, 0x25, 0x2e, 0x2a, 0x25, 0x33, 0x27, 0x31, 0x7a,
-  0x23, 0x41, 0x11, 0x14, 0x20, 0x09, 0x07, 0x1c, 0x2b, 0x01, 0x31, 0x33,
-  0x1d, 0x03, 0x23, 0x15, 0x23, 0x15, 0x2b, 0x03, 0x1d, 0x02, 0x2b, 0x01,
-  0x3d, 0x09, 0x3b, 0x06, 0x03, 0x31, 0x33, 0x3d, 0x02, 0x2b, 0x03, 0x1d,
-  0x02, 0x3b, 0x01, 0x03, 0x13, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66,
-  0x66, 0x67, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0xcd, 0x66, 0x66,
-  0x66, 0x67, 0x66, 0x66, 0x67, 0x03, 0x98, 0x66, 0x66, 0x67, 0x66, 0x66,
-  0x67, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66,
-  0x66, 0x67, 0xfe, 0x00, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x00, 0x00,
-  0x00, 0x02, 0x00, 0x46, 0xff, 0xff, 0x03, 0xdf, 0x03, 0xff, 0x00, 0x28,
-  0x00, 0x3d, 0x00, 0x45, 0x40, 0x42, 0x07, 0x01, 0x05, 0x04, 0x01, 0x02,
-  0x01, 0x05, 0x02, 0x67, 0x0b, 0x01, 0x08, 0x08, 0x06, 0x5f, 0x00, 0x06,
-  0x06, 0x12, 0x4d, 0x0a, 0x01, 0x00, 0x00, 0x01, 0x5f, 0x03, 0x01, 0x01,
-  0x01, 0x13, 0x4d, 0x00, 0x09, 0x09, 0x01, 0x60, 0x03, 0x01, 0x01, 0x01,
-  0x13, 0x01, 0x4e, 0x2b, 0x29, 0x36, 0x35, 0x34, 0x31, 0x29, 0x3d, 0x2b,
-  0x3b, 0x11, 0x51, 0x28, 0x11, 0x61, 0x11, 0x13, 0x20, 0x0c, 0x07, 0x1e,
-  0x2b, 0x01, 0x31, 0x33, 0x1d, 0x02, 0x23, 0x35, 0x23, 0x15, 0x2b, 0x05,
-  0x35, 0x23, 0x3d, 0x07, 0x3b, 0x01, 0x35, 0x3b, 0x04, 0x15, 0x33, 0x1d,
-  0x04, 0x01, 0x31, 0x23, 0x1d, 0x05, 0x3b, 0x02, 0x35, 0x33, 0x3d, 0x04,
-  0x2b, 0x01, 0x03, 0x79, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66,
-  0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0xfe, 0x00,
-  0x66, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x01, 0x32, 0x66, 0x66, 0x67,
-  0x67, 0x67, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67,
-  0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x01, 0x99, 0x66, 0x67, 0x66, 0x66,
-  0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x00, 0x02, 0x00, 0x46,
-  0xff, 0xff, 0x03, 0x79, 0x03, 0xff, 0x00, 0x2e, 0x00, 0x3d, 0x00, 0xfc,
-  0x4b, 0xb0, 0x0d, 0x50, 0x58, 0x40, 0x43, 0x00, 0x02, 0x0b, 0x08, 0x0b,
-  0x02, 0x08, 0x80, 0x00, 0x03, 0x08, 0x07, 0x04, 0x03, 0x72, 0x00, 0x07,
-  0x04, 0x08, 0x07, 0x70, 0x00, 0x06, 0x04, 0x05, 0x08, 0x06, 0x72, 0x00,
-  0x00, 0x00, 0x01, 0x0b, 0x00, 0x01, 0x67, 0x0d, 0x01, 0x0b, 0x00, 0x08,
-  0x03, 0x0b, 0x08, 0x67, 0x00, 0x0c, 0x0c, 0x0a, 0x5f, 0x00, 0x0a, 0x0a,
-  0x12, 0x4d, 0x00, 0x04, 0x04, 0x05, 0x60, 0x09, 0x01, 0x05, 0x05, 0x13,
-  0x05, 0x4e, 0x1b, 0x4b, 0xb0, 0x19, 0x50, 0x58, 0x40, 0x44, 0x00, 0x02,
-  0x0b, 0x08, 0x0b, 0x02, 0x08, 0x80, 0x00, 0x03, 0x08, 0x07, 0x04, 0x03,
-  0x72, 0x00, 0x07, 0x04, 0x08, 0x07, 0x70, 0x00, 0x06, 0x04, 0x05, 0x04,
-  0x06, 0x05, 0x80, 0x00, 0x00, 0x00, 0x01, 0x0b, 0x00, 0x01, 0x67, 0x0d,
-  0x01, 0x0b, 0x00, 0x08, 0x03, 0x0b, 0x08, 0x67, 0x00, 0x0c, 0x0c, 0x0a,
-  0x5f, 0x00, 0x0a, 0x0a, 0x12, 0x4d, 0x00, 0x04, 0x04, 0x05, 0x60, 0x09,
-  0x01, 0x05, 0x05, 0x13, 0x05, 0x4e, 0x1b, 0x40, 0x46, 0x00, 0x02, 0x0b,
-  0x08, 0x0b, 0x02, 0x08, 0x80, 0x00, 0x03, 0x08, 0x07, 0x08, 0x03, 0x07,
-  0x80, 0x00, 0x07, 0x04, 0x08, 0x07, 0x04, 0x7e, 0x00, 0x06, 0x04, 0x05,
-  0x04, 0x06, 0x05, 0x80, 0x00, 0x00, 0x00, 0x01, 0x0b, 0x00, 0x01, 0x67,
-  0x0d, 0x01, 0x0b, 0x00, 0x08, 0x03, 0x0b, 0x08, 0x67, 0x00, 0x0c, 0x0c,
-  0x0a, 0x5f, 0x00, 0x0a, 0x0a, 0x12, 0x4d, 0x00, 0x04, 0x04, 0x05, 0x60,
-  0x09, 0x01, 0x05, 0x05, 0x13, 0x05, 0x4e, 0x59, 0x59, 0x40, 0x18, 0x31,
-  0x2f, 0x38, 0x34, 0x2f, 0x3d, 0x31, 0x3b, 0x2e, 0x27, 0x1d, 0x1b, 0x21,
-  0x11, 0x11, 0x22, 0x11, 0x11, 0x11, 0x14, 0x20, 0x0e, 0x07, 0x1f, 0x2b,
-  0x01, 0x31, 0x33, 0x1d, 0x03, 0x23, 0x15, 0x23, 0x15, 0x33, 0x15, 0x33,
-  0x1d, 0x01, 0x2b, 0x01, 0x35, 0x23, 0x35, 0x23, 0x35, 0x2b, 0x01, 0x1d,
-  0x02, 0x2b, 0x01, 0x3d, 0x09, 0x3b, 0x06, 0x03, 0x31, 0x33, 0x3d, 0x02,
-  0x2b, 0x03, 0x1d, 0x02, 0x3b, 0x01, 0x03, 0x13, 0x66, 0x66, 0x67, 0x67,
-  0x66, 0x66, 0x67, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66,
-  0x66, 0x67, 0x66, 0x67, 0xcd, 0x66, 0x66, 0x67, 0x66, 0x66, 0x66, 0x66,
-  0x03, 0x98, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x67,
-  0x66, 0x66, 0x66, 0x66, 0x67, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67,
-  0x66, 0x66, 0x67, 0xfe, 0x00, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x00,
-  0x00, 0x01, 0x00, 0x46, 0xff, 0xff, 0x03, 0x79, 0x03, 0xff, 0x00, 0x40,
-  0x00, 0xab, 0x4b, 0xb0, 0x09, 0x50, 0x58, 0x40, 0x42, 0x00, 0x0b, 0x03,
-  0x04, 0x02, 0x0b, 0x72, 0x00, 0x01, 0x0c, 0x00, 0x01, 0x57, 0x0d, 0x01,
-  0x00, 0x00, 0x0c, 0x03, 0x00, 0x0c, 0x67, 0x00, 0x04, 0x0a, 0x05, 0x04,
-  0x57, 0x00, 0x03, 0x00, 0x0a, 0x08, 0x03, 0x0a, 0x67, 0x00, 0x08, 0x07,
-  0x01, 0x05, 0x06, 0x08, 0x05, 0x67, 0x00, 0x02, 0x02, 0x0e, 0x5f, 0x00,
-  0x0e, 0x0e, 0x12, 0x4d, 0x00, 0x09, 0x09, 0x06, 0x5f, 0x00, 0x06, 0x06,
-  0x13, 0x06, 0x4e, 0x1b, 0x40, 0x43, 0x00, 0x0b, 0x03, 0x04, 0x03, 0x0b,
-  0x04, 0x80, 0x00, 0x01, 0x0c, 0x00, 0x01, 0x57, 0x0d, 0x01, 0x00, 0x00,
-  0x0c, 0x03, 0x00, 0x0c, 0x67, 0x00, 0x04, 0x0a, 0x05, 0x04, 0x57, 0x00,
-  0x03, 0x00, 0x0a, 0x08, 0x03, 0x0a, 0x67, 0x00, 0x08, 0x07, 0x01, 0x05,
-  0x06, 0x08, 0x05, 0x67, 0x00, 0x02, 0x02, 0x0e, 0x5f, 0x00, 0x0e, 0x0e,
-  0x12, 0x4d, 0x00, 0x09, 0x09, 0x06, 0x5f, 0x00, 0x06, 0x06, 0x13, 0x06,
-  0x4e, 0x59, 0x40, 0x18, 0x40, 0x3a, 0x39, 0x38, 0x35, 0x34, 0x33, 0x32,
-  0x31, 0x2d, 0x2b, 0x27, 0x22, 0x11, 0x61, 0x14, 0x11, 0x52, 0x41, 0x22,
-  0x20, 0x0f, 0x07, 0x1f, 0x2b, 0x01, 0x31, 0x33, 0x1d, 0x01, 0x2b, 0x01,
-  0x35, 0x2b, 0x03, 0x1d, 0x01, 0x3b, 0x04, 0x15, 0x33, 0x1d, 0x03, 0x23,
-  0x15, 0x2b, 0x05, 0x35, 0x23, 0x3d, 0x01, 0x3b, 0x01, 0x15, 0x3b, 0x03,
-  0x3d, 0x01, 0x2b, 0x03, 0x35, 0x23, 0x35, 0x23, 0x3d, 0x02, 0x33, 0x35,
-  0x3b, 0x05, 0x03, 0x12, 0x67, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x66,
-  0x66, 0x67, 0x66, 0x66, 0x67, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67,
-  0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67,
-  0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x03, 0x98, 0x66, 0x66,
-  0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x67, 0x66, 0x66,
-  0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0x00, 0x46, 0xff, 0xff, 0x03, 0x79, 0x03, 0xff, 0x00, 0x28,
-  0x00, 0x56, 0x4b, 0xb0, 0x19, 0x50, 0x58, 0x40, 0x1a, 0x05, 0x01, 0x01,
-  0x02, 0x03, 0x02, 0x01, 0x72, 0x04, 0x01, 0x02, 0x02, 0x00, 0x5f, 0x06,
-  0x01, 0x00, 0x00, 0x12, 0x4d, 0x00, 0x03, 0x03, 0x13, 0x03, 0x4e, 0x1b,
-  0x40, 0x1b, 0x05, 0x01, 0x01, 0x02, 0x03, 0x02, 0x01, 0x03, 0x80, 0x04,
-  0x01, 0x02, 0x02, 0x00, 0x5f, 0x06, 0x01, 0x00, 0x00, 0x12, 0x4d, 0x00,
-  0x03, 0x03, 0x13, 0x03, 0x4e, 0x59, 0x40, 0x13, 0x02, 0x00, 0x1f, 0x1e,
-  0x1d, 0x1b, 0x13, 0x11, 0x09, 0x07, 0x06, 0x05, 0x00, 0x28, 0x02, 0x22,
-  0x07, 0x07, 0x16, 0x2b, 0x01, 0x31, 0x33, 0x1d, 0x02, 0x23, 0x35, 0x2b,
-  0x01, 0x1d, 0x07, 0x2b, 0x01, 0x3d, 0x07, 0x2b, 0x01, 0x15, 0x23, 0x3d,
-  0x02, 0x3b, 0x05, 0x03, 0x12, 0x67, 0x67, 0x66, 0x66, 0x67, 0x66, 0x67,
-  0x66, 0x66, 0x66, 0x66, 0x67, 0x66, 0x67, 0x66, 0x03, 0xff, 0x67, 0x66,
-  0x66, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x67, 0x66,
-  0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x66, 0x66, 0x67, 0x00, 0x00,
-  0x00, 0x01, 0x00, 0x46, 0xff, 0xff, 0x03, 0x79, 0x03, 0xff, 0x00, 0x34,
-  0x00, 0x2e, 0x40, 0x2b, 0x03, 0x01, 0x01, 0x01, 0x00, 0x5f, 0x04, 0x06,
-  0x02, 0x00, 0x00, 0x12, 0x4d, 0x00, 0x05, 0x05, 0x02, 0x5f, 0x00, 0x02,
-  0x02, 0x13, 0x02, 0x4e, 0x02, 0x00, 0x2c, 0x28, 0x20, 0x1e, 0x15, 0x14,
-  0x13, 0x0d, 0x0c, 0x0b, 0x00, 0x34, 0x02, 0x34, 0x07, 0x07, 0x16, 0x2b,
-  0x01, 0x31, 0x33, 0x1d, 0x08, 0x23, 0x15, 0x2b, 0x05, 0x35, 0x23, 0x3d,
-  0x08, 0x3b, 0x01, 0x1d, 0x07, 0x3b, 0x03, 0x3d, 0x07, 0x03, 0x12, 0x67,
-  0x67, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x66, 0x66, 0x67, 0x66,
-  0x66, 0x67, 0x03, 0xff, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66,
-  0x67, 0x66, 0x66, 0x67, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67,
-  0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66,
-  0x67, 0x66, 0x66, 0x67, 0x00, 0x01, 0x00, 0x46, 0xff, 0xff, 0x03, 0x78,
-  0x03, 0xff, 0x00, 0x34, 0x00, 0x40, 0x40, 0x3d, 0x09, 0x01, 0x07, 0x04,
-  0x01, 0x02, 0x03, 0x07, 0x02, 0x67, 0x05, 0x01, 0x01, 0x01, 0x00, 0x5f,
-  0x06, 0x0a, 0x02, 0x00, 0x00, 0x12, 0x4d, 0x00, 0x08, 0x08, 0x03, 0x5f,
-  0x00, 0x03, 0x03, 0x13, 0x03, 0x4e, 0x02, 0x00, 0x2d, 0x2c, 0x2b, 0x29,
-  0x28, 0x27, 0x20, 0x1e, 0x16, 0x15, 0x14, 0x12, 0x11, 0x0f, 0x0e, 0x0c,
-  0x0b, 0x0a, 0x00, 0x34, 0x02, 0x34, 0x0b, 0x07, 0x16, 0x2b, 0x01, 0x31,
-  0x33, 0x1d, 0x07, 0x23, 0x15, 0x2b, 0x01, 0x15, 0x2b, 0x01, 0x35, 0x2b,
-  0x01, 0x35, 0x23, 0x3d, 0x07, 0x3b, 0x01, 0x1d, 0x06, 0x33, 0x15, 0x3b,
-  0x01, 0x35, 0x33, 0x3d, 0x06, 0x03, 0x12, 0x66, 0x66, 0x66, 0x67, 0x66,
-  0x66, 0x67, 0x66, 0x66, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x03, 0xff,
-  0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x67, 0x66, 0x66, 0x67,
-  0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x67, 0x66, 0x66, 0x67,
-  0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67,
-  0x00, 0x01, 0x00, 0x46, 0xff, 0xff, 0x03, 0x78, 0x03, 0xff, 0x00, 0x42,
-  0x00, 0x3e, 0x40, 0x3b, 0x00, 0x08, 0x00, 0x03, 0x02, 0x08, 0x03, 0x67,
-  0x09, 0x01, 0x07, 0x04, 0x01, 0x02, 0x01, 0x07, 0x02, 0x67, 0x06, 0x0a,
-  0x02, 0x00, 0x00, 0x12, 0x4d, 0x05, 0x01, 0x01, 0x01, 0x13, 0x01, 0x4e,
-  0x02, 0x00, 0x3b, 0x3a, 0x34, 0x32, 0x2c, 0x2b, 0x24, 0x22, 0x18, 0x16,
-  0x15, 0x14, 0x13, 0x11, 0x10, 0x0f, 0x0e, 0x0c, 0x00, 0x42, 0x02, 0x42,
-  0x0b, 0x07, 0x16, 0x2b, 0x01, 0x31, 0x33, 0x1d, 0x09, 0x2b, 0x01, 0x35,
-  0x23, 0x35, 0x2b, 0x01, 0x15, 0x23, 0x15, 0x2b, 0x01, 0x3d, 0x09, 0x3b,
-  0x01, 0x1d, 0x06, 0x33, 0x3d, 0x05, 0x3b, 0x01, 0x1d, 0x05, 0x33, 0x3d,
-  0x06, 0x03, 0x12, 0x66, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66,
-  0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x03, 0xff, 0x67, 0x66, 0x66, 0x67,
-  0x66, 0x66, 0x67, 0x66, 0x67, 0x66, 0x66, 0x67, 0x67, 0x66, 0x66, 0x67,
-  0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x67, 0x66, 0x66, 0x67,
-  0x66, 0x66, 0x67, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x66, 0x66, 0x67,
-  0x66, 0x66, 0x67, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x00, 0x00,
-  0x00, 0x01, 0x00, 0x46, 0xff, 0xff, 0x03, 0x79, 0x03, 0xff, 0x00, 0x3a,
-  0x00, 0xcf, 0x4b, 0xb0, 0x19, 0x50, 0x58, 0x40, 0x46, 0x10, 0x01, 0x02,
-  0x14, 0x03, 0x01, 0x02, 0x72, 0x0d, 0x01, 0x05, 0x04, 0x09, 0x06, 0x05,
-  0x72, 0x15, 0x01, 0x13, 0x0f, 0x01, 0x03, 0x04, 0x13, 0x03, 0x67, 0x00,
-  0x14, 0x00, 0x09, 0x06, 0x14, 0x09, 0x67, 0x0e, 0x01, 0x04, 0x0a, 0x01,
-  0x08, 0x07, 0x04, 0x08, 0x67, 0x11, 0x01, 0x01, 0x01, 0x00, 0x5f, 0x12,
-  0x16, 0x02, 0x00, 0x00, 0x12, 0x4d, 0x0c, 0x01, 0x06, 0x06, 0x07, 0x60,
-  0x0b, 0x01, 0x07, 0x07, 0x13, 0x07, 0x4e, 0x1b, 0x40, 0x48, 0x10, 0x01,
-  0x02, 0x14, 0x03, 0x14, 0x02, 0x03, 0x80, 0x0d, 0x01, 0x05, 0x04, 0x09,
-  0x04, 0x05, 0x09, 0x80, 0x15, 0x01, 0x13, 0x0f, 0x01, 0x03, 0x04, 0x13,
-  0x03, 0x67, 0x00, 0x14, 0x00, 0x09, 0x06, 0x14, 0x09, 0x67, 0x0e, 0x01,
-  0x04, 0x0a, 0x01, 0x08, 0x07, 0x04, 0x08, 0x67, 0x11, 0x01, 0x01, 0x01,
-  0x00, 0x5f, 0x12, 0x16, 0x02, 0x00, 0x00, 0x12, 0x4d, 0x0c, 0x01, 0x06,
-  0x06, 0x07, 0x60, 0x0b, 0x01, 0x07, 0x07, 0x13, 0x07, 0x4e, 0x59, 0x40,
-  0x33, 0x02, 0x00, 0x38, 0x37, 0x36, 0x34, 0x33, 0x32, 0x30, 0x2e, 0x2b,
-  0x2a, 0x29, 0x28, 0x27, 0x26, 0x25, 0x24, 0x23, 0x22, 0x21, 0x20, 0x1e,
-  0x1c, 0x1b, 0x1a, 0x19, 0x17, 0x16, 0x15, 0x14, 0x12, 0x10, 0x0f, 0x0e,
-  0x0d, 0x0c, 0x0b, 0x0a, 0x09, 0x08, 0x07, 0x06, 0x05, 0x00, 0x3a, 0x02,
-  0x3a, 0x17, 0x07, 0x16, 0x2b, 0x01, 0x31, 0x33, 0x1d, 0x02, 0x23, 0x15,
-  0x23, 0x15, 0x23, 0x15, 0x33, 0x15, 0x33, 0x15, 0x33, 0x1d, 0x01, 0x2b,
-  0x01, 0x35, 0x23, 0x35, 0x2b, 0x01, 0x15, 0x23, 0x15, 0x2b, 0x01, 0x3d,
-  0x01, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x23, 0x35, 0x23, 0x35, 0x23,
-  0x3d, 0x02, 0x3b, 0x01, 0x1d, 0x01, 0x33, 0x15, 0x3b, 0x01, 0x35, 0x33,
-  0x3d, 0x01, 0x03, 0x13, 0x66, 0x66, 0x66, 0x67, 0x67, 0x66, 0x66, 0x66,
-  0x66, 0x67, 0x66, 0x67, 0x66, 0x66, 0x67, 0x67, 0x66, 0x66, 0x66, 0x66,
-  0x67, 0x67, 0x66, 0x66, 0x67, 0x66, 0x67, 0x03, 0xff, 0x67, 0x66, 0x66,
-  0x67, 0x66, 0x66, 0x67, 0x66, 0x67, 0x66, 0x66, 0x67, 0x67, 0x66, 0x66,
-  0x67, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x67, 0x66, 0x66,
-  0x66, 0x66, 0x67, 0x00, 0x00, 0x01, 0x00, 0x46, 0xff, 0xff, 0x03, 0x79,
-  0x03, 0xff, 0x00, 0x2c, 0x00, 0x82, 0x4b, 0xb0, 0x19, 0x50, 0x58, 0x40,
-  0x2a, 0x06, 0x01, 0x02, 0x0a, 0x03, 0x01, 0x02, 0x72, 0x0b, 0x01, 0x09,
-  0x05, 0x01, 0x03, 0x04, 0x09, 0x03, 0x67, 0x07, 0x01, 0x01, 0x01, 0x00,
-  0x5f, 0x08, 0x0c, 0x02, 0x00, 0x00, 0x12, 0x4d, 0x00, 0x0a, 0x0a, 0x04,
-  0x5f, 0x00, 0x04, 0x04, 0x13, 0x04, 0x4e, 0x1b, 0x40, 0x2b, 0x06, 0x01,
-  0x02, 0x0a, 0x03, 0x0a, 0x02, 0x03, 0x80, 0x0b, 0x01, 0x09, 0x05, 0x01,
-  0x03, 0x04, 0x09, 0x03, 0x67, 0x07, 0x01, 0x01, 0x01, 0x00, 0x5f, 0x08,
-  0x0c, 0x02, 0x00, 0x00, 0x12, 0x4d, 0x00, 0x0a, 0x0a, 0x04, 0x5f, 0x00,
-  0x04, 0x04, 0x13, 0x04, 0x4e, 0x59, 0x40, 0x1f, 0x02, 0x00, 0x29, 0x28,
-  0x27, 0x25, 0x24, 0x23, 0x20, 0x1e, 0x1a, 0x19, 0x18, 0x17, 0x16, 0x15,
-  0x11, 0x0f, 0x0b, 0x0a, 0x09, 0x08, 0x07, 0x06, 0x00, 0x2c, 0x02, 0x2c,
-  0x0d, 0x07, 0x16, 0x2b, 0x01, 0x31, 0x33, 0x1d, 0x03, 0x23, 0x15, 0x23,
-  0x15, 0x23, 0x1d, 0x03, 0x2b, 0x01, 0x3d, 0x03, 0x23, 0x35, 0x23, 0x35,
-  0x23, 0x3d, 0x03, 0x3b, 0x01, 0x1d, 0x02, 0x33, 0x15, 0x3b, 0x01, 0x35,
-  0x33, 0x3d, 0x02, 0x03, 0x13, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66,
-  0x66, 0x67, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x03, 0xff, 0x67, 0x66,
-  0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x67,
-  0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x67, 0x66, 0x66, 0x67, 0x67, 0x66,
-  0x66, 0x67, 0x00, 0x00, 0x00, 0x01, 0x00, 0x46, 0xff, 0xff, 0x03, 0x79,
-  0x03, 0xff, 0x00, 0x38, 0x01, 0x8b, 0x4b, 0xb0, 0x09, 0x50, 0x58, 0x40,
-  0x4f, 0x00, 0x01, 0x0d, 0x0c, 0x0d, 0x01, 0x72, 0x00, 0x02, 0x0c, 0x0b,
-  0x0d, 0x02, 0x72, 0x00, 0x03, 0x0b, 0x0a, 0x0d, 0x03, 0x72, 0x00, 0x0a,
-  0x04, 0x06, 0x0a, 0x70, 0x00, 0x09, 0x04, 0x05, 0x06, 0x09, 0x72, 0x00,
-  0x08, 0x05, 0x06, 0x06, 0x08, 0x72, 0x00, 0x0c, 0x00, 0x04, 0x09, 0x0c,
-  0x04, 0x67, 0x00, 0x0b, 0x00, 0x05, 0x08, 0x0b, 0x05, 0x67, 0x00, 0x0d,
-  0x0d, 0x00, 0x5f, 0x0e, 0x01, 0x00, 0x00, 0x12, 0x4d, 0x00, 0x06, 0x06,
-  0x07, 0x60, 0x00, 0x07, 0x07, 0x13, 0x07, 0x4e, 0x1b, 0x4b, 0xb0, 0x0d,
-  0x50, 0x58, 0x40, 0x51, 0x00, 0x01, 0x0d, 0x0c, 0x0d, 0x01, 0x72, 0x00,
-  0x02, 0x0c, 0x0b, 0x0d, 0x02, 0x72, 0x00, 0x03, 0x0b, 0x0a, 0x0b, 0x03,
-  0x0a, 0x80, 0x00, 0x0a, 0x04, 0x0b, 0x0a, 0x04, 0x7e, 0x00, 0x09, 0x04,
-  0x05, 0x06, 0x09, 0x72, 0x00, 0x08, 0x05, 0x06, 0x06, 0x08, 0x72, 0x00,
-  0x0c, 0x00, 0x04, 0x09, 0x0c, 0x04, 0x67, 0x00, 0x0b, 0x00, 0x05, 0x08,
-  0x0b, 0x05, 0x67, 0x00, 0x0d, 0x0d, 0x00, 0x5f, 0x0e, 0x01, 0x00, 0x00,
-  0x12, 0x4d, 0x00, 0x06, 0x06, 0x07, 0x60, 0x00, 0x07, 0x07, 0x13, 0x07,
-  0x4e, 0x1b, 0x4b, 0xb0, 0x19, 0x50, 0x58, 0x40, 0x53, 0x00, 0x01, 0x0d,
-  0x0c, 0x0d, 0x01, 0x72, 0x00, 0x02, 0x0c, 0x0b, 0x0c, 0x02, 0x0b, 0x80,
-  0x00, 0x03, 0x0b, 0x0a, 0x0b, 0x03, 0x0a, 0x80, 0x00, 0x0a, 0x04, 0x0b,
-  0x0a, 0x04, 0x7e, 0x00, 0x09, 0x04, 0x05, 0x04, 0x09, 0x05, 0x80, 0x00,
-  0x08, 0x05, 0x06, 0x06, 0x08, 0x72, 0x00, 0x0c, 0x00, 0x04, 0x09, 0x0c,
-  0x04, 0x67, 0x00, 0x0b, 0x00, 0x05, 0x08, 0x0b, 0x05, 0x67, 0x00, 0x0d,
-  0x0d, 0x00, 0x5f, 0x0e, 0x01, 0x00, 0x00, 0x12, 0x4d, 0x00, 0x06, 0x06,
-  0x07, 0x60, 0x00, 0x07, 0x07, 0x13, 0x07, 0x4e, 0x1b, 0x40, 0x55, 0x00,
-  0x01, 0x0d, 0x0c, 0x0d, 0x01, 0x0c, 0x80, 0x00, 0x02, 0x0c, 0x0b, 0x0c,
-  0x02, 0x0b, 0x80, 0x00, 0x03, 0x0b, 0x0a, 0x0b, 0x03, 0x0a, 0x80, 0x00,
-  0x0a, 0x04, 0x0b, 0x0a, 0x04, 0x7e, 0x00, 0x09, 0x04, 0x05, 0x04, 0x09,
-  0x05, 0x80, 0x00, 0x08, 0x05, 0x06, 0x05, 0x08, 0x06, 0x80, 0x00, 0x0c,
-  0x00, 0x04, 0x09, 0x0c, 0x04, 0x67, 0x00, 0x0b, 0x00, 0x05, 0x08, 0x0b,
-  0x05, 0x67, 0x00, 0x0d, 0x0d, 0x00, 0x5f, 0x0e, 0x01, 0x00, 0x00, 0x12,
-  0x4d, 0x00, 0x06, 0x06, 0x07, 0x60, 0x00, 0x07, 0x07, 0x13, 0x07, 0x4e,
-  0x59, 0x59, 0x59, 0x40, 0x23, 0x02, 0x00, 0x30, 0x2b, 0x2a, 0x29, 0x28,
-  0x27, 0x26, 0x25, 0x24, 0x23, 0x22, 0x21, 0x1e, 0x16, 0x14, 0x0f, 0x0e,
-  0x0d, 0x0c, 0x0b, 0x0a, 0x09, 0x08, 0x07, 0x06, 0x05, 0x00, 0x38, 0x02,
-  0x32, 0x0f, 0x07, 0x16, 0x2b, 0x01, 0x31, 0x33, 0x1d, 0x02, 0x23, 0x15,
-  0x23, 0x15, 0x23, 0x15, 0x23, 0x15, 0x23, 0x15, 0x3b, 0x04, 0x1d, 0x01,
-  0x2b, 0x07, 0x3d, 0x02, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35, 0x33, 0x35,
-  0x33, 0x35, 0x2b, 0x04, 0x3d, 0x01, 0x3b, 0x05, 0x03, 0x13, 0x66, 0x66,
-  0x67, 0x66, 0x66, 0x67, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66,
-  0x66, 0x67, 0x66, 0x66, 0x67, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67,
-  0x66, 0x66, 0x67, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x03, 0xff, 0x67,
-  0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66,
-  0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x00, 0x00, 0x03, 0x00, 0x46,
-  0x00, 0x00, 0x02, 0x46, 0x03, 0xff, 0x00, 0x0e, 0x00, 0x1d, 0x00, 0x26,
-  0x00, 0x4c, 0x40, 0x49, 0x00, 0x03, 0x00, 0x02, 0x08, 0x03, 0x02, 0x67,
-  0x00, 0x08, 0x00, 0x09, 0x04, 0x08, 0x09, 0x67, 0x00, 0x04, 0x00, 0x07,
-  0x06, 0x04, 0x07, 0x67, 0x00, 0x01, 0x01, 0x00, 0x5f, 0x0a, 0x01, 0x00,
-  0x00, 0x12, 0x4d, 0x00, 0x05, 0x05, 0x06, 0x5f, 0x00, 0x06, 0x06, 0x13,
-  0x06, 0x4e, 0x02, 0x00, 0x25, 0x23, 0x21, 0x1e, 0x1d, 0x1c, 0x1b, 0x19,
-  0x17, 0x16, 0x14, 0x12, 0x0d, 0x0c, 0x09, 0x07, 0x05, 0x04, 0x00, 0x0e,
-  0x02, 0x0e, 0x0b, 0x07, 0x16, 0x2b, 0x01, 0x31, 0x33, 0x1d, 0x01, 0x23,
-  0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x02, 0x33, 0x35, 0x03, 0x31, 0x3d, 0x01,
-  0x3b, 0x01, 0x1d, 0x01, 0x33, 0x1d, 0x01, 0x2b, 0x01, 0x35, 0x23, 0x03,
-  0x31, 0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x01, 0x35, 0x01, 0xdf, 0x67, 0x67,
-  0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x67, 0x67, 0x66, 0x66, 0xcd, 0x66,
-  0x67, 0x67, 0x66, 0x03, 0xff, 0x66, 0x67, 0x66, 0x66, 0x66, 0x66, 0x67,
-  0x66, 0xfc, 0xcd, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x66, 0x02, 0x00,
-  0x67, 0x66, 0x66, 0x00, 0x00, 0x01, 0x00, 0x46, 0x00, 0x06, 0x01, 0x13,
-  0x04, 0x06, 0x00, 0x18, 0x00, 0xaf, 0x4b, 0xb0, 0x0b, 0x50, 0x58, 0x40,
-  0x0c, 0x02, 0x01, 0x00, 0x00, 0x12, 0x4d, 0x00, 0x01, 0x01, 0x13, 0x01,
-  0x4e, 0x1b, 0x4b, 0xb0, 0x0d, 0x50, 0x58, 0x40, 0x0c, 0x02, 0x01, 0x00,
-  0x00, 0x14, 0x4d, 0x00, 0x01, 0x01, 0x13, 0x01, 0x4e, 0x1b, 0x4b, 0xb0,
-  0x0f, 0x50, 0x58, 0x40, 0x0c, 0x02, 0x01, 0x00, 0x00, 0x12, 0x4d, 0x00,
-  0x01, 0x01, 0x13, 0x01, 0x4e, 0x1b, 0x4b, 0xb0, 0x13, 0x50, 0x58, 0x40,
-  0x0c, 0x02, 0x01, 0x00, 0x00, 0x14, 0x4d, 0x00, 0x01, 0x01, 0x13, 0x01,
-  0x4e, 0x1b, 0x4b, 0xb0, 0x15, 0x50, 0x58, 0x40, 0x0c, 0x02, 0x01, 0x00,
-  0x00, 0x12, 0x4d, 0x00, 0x01, 0x01, 0x13, 0x01, 0x4e, 0x1b, 0x4b, 0xb0,
-  0x17, 0x50, 0x58, 0x40, 0x0c, 0x02, 0x01, 0x00, 0x00, 0x14, 0x4d, 0x00,
-  0x01, 0x01, 0x13, 0x01, 0x4e, 0x1b, 0x4b, 0xb0, 0x19, 0x50, 0x58, 0x40,
-  0x0c, 0x02, 0x01, 0x00, 0x00, 0x12, 0x4d, 0x00, 0x01, 0x01, 0x13, 0x01,
-  0x4e, 0x1b, 0x40, 0x0c, 0x02, 0x01, 0x00, 0x00, 0x14, 0x4d, 0x00, 0x01,
-  0x01, 0x13, 0x01, 0x4e, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x40,
-  0x0b, 0x02, 0x00, 0x0e, 0x0c, 0x00, 0x18, 0x02, 0x18, 0x03, 0x07, 0x16,
-  0x2b, 0x13, 0x31, 0x33, 0x1d, 0x09, 0x2b, 0x01, 0x3d, 0x09, 0xad, 0x66,
-  0x66, 0x67, 0x04, 0x06, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66,
-  0x66, 0x67, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67,
-  0x00, 0x03, 0x00, 0x46, 0x00, 0x00, 0x02, 0x46, 0x03, 0xff, 0x00, 0x08,
-  0x00, 0x17, 0x00, 0x26, 0x00, 0x4c, 0x40, 0x49, 0x00, 0x05, 0x00, 0x02,
-  0x00, 0x05, 0x02, 0x67, 0x0a, 0x01, 0x00, 0x00, 0x01, 0x06, 0x00, 0x01,
-  0x67, 0x00, 0x06, 0x00, 0x07, 0x09, 0x06, 0x07, 0x67, 0x00, 0x03, 0x03,
-  0x04, 0x5f, 0x00, 0x04, 0x04, 0x12, 0x4d, 0x00, 0x09, 0x09, 0x08, 0x5f,
-  0x00, 0x08, 0x08, 0x13, 0x08, 0x4e, 0x02, 0x00, 0x25, 0x24, 0x22, 0x20,
-  0x1e, 0x1d, 0x1b, 0x18, 0x17, 0x16, 0x15, 0x13, 0x11, 0x10, 0x0e, 0x0c,
-  0x06, 0x04, 0x00, 0x08, 0x02, 0x08, 0x0b, 0x07, 0x16, 0x2b, 0x01, 0x31,
-  0x33, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x02, 0x31, 0x1d, 0x01, 0x2b, 0x01,
-  0x3d, 0x01, 0x23, 0x3d, 0x01, 0x3b, 0x01, 0x15, 0x33, 0x03, 0x31, 0x3b,
-  0x01, 0x1d, 0x01, 0x23, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x01, 0x33, 0x35,
-  0x01, 0xdf, 0x67, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0xcd,
-  0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x02, 0x66, 0x67, 0x66, 0x66, 0x67,
-  0xcc, 0x66, 0x66, 0x66, 0x66, 0x67, 0x66, 0x66, 0xfe, 0x00, 0x66, 0x67,
-  0x66, 0x66, 0x66, 0x66, 0x67, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x46,
-  0x01, 0x33, 0x03, 0x79, 0x02, 0xcd, 0x00, 0x10, 0x00, 0x21, 0x00, 0x4e,
-  0xb1, 0x06, 0x64, 0x44, 0x40, 0x43, 0x0d, 0x01, 0x00, 0x06, 0x01, 0x00,
-  0x57, 0x08, 0x01, 0x01, 0x05, 0x06, 0x01, 0x58, 0x0b, 0x01, 0x05, 0x02,
-  0x03, 0x05, 0x58, 0x0c, 0x07, 0x02, 0x06, 0x09, 0x04, 0x02, 0x02, 0x03,
-  0x06, 0x02, 0x68, 0x0b, 0x01, 0x05, 0x05, 0x03, 0x5f, 0x0a, 0x01, 0x03,
-  0x05, 0x03, 0x4f, 0x21, 0x20, 0x1f, 0x1e, 0x1d, 0x1c, 0x1a, 0x19, 0x18,
-  0x17, 0x21, 0x21, 0x11, 0x21, 0x11, 0x11, 0x11, 0x12, 0x20, 0x0e, 0x07,
-  0x1f, 0x2b, 0xb1, 0x06, 0x00, 0x44, 0x01, 0x31, 0x33, 0x1d, 0x01, 0x23,
-  0x15, 0x23, 0x15, 0x23, 0x35, 0x23, 0x35, 0x3b, 0x01, 0x35, 0x33, 0x21,
-  0x31, 0x33, 0x15, 0x2b, 0x01, 0x15, 0x23, 0x15, 0x23, 0x3d, 0x01, 0x33,
-  0x35, 0x33, 0x35, 0x33, 0x03, 0x12, 0x67, 0x67, 0x66, 0x66, 0x67, 0x67,
-  0x66, 0x66, 0xfe, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x66, 0x66, 0x67,
-  0x02, 0xcd, 0x67, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66,
-  0x66, 0x67, 0x66, 0x67, 0x00, 0x09, 0x00, 0x46, 0x00, 0x06, 0x03, 0x78,
-  0x04, 0x06, 0x00, 0x12, 0x00, 0x21, 0x00, 0x26, 0x00, 0x2b, 0x00, 0x32,
-  0x00, 0x39, 0x00, 0x44, 0x00, 0x53, 0x00, 0x66, 0x00, 0x93, 0xb1, 0x06,
-  0x64, 0x44, 0x40, 0x88, 0x00, 0x0f, 0x17, 0x01, 0x0e, 0x00, 0x0f, 0x0e,
-  0x67, 0x15, 0x01, 0x08, 0x00, 0x09, 0x06, 0x08, 0x09, 0x67, 0x0c, 0x01,
-  0x06, 0x14, 0x01, 0x07, 0x05, 0x06, 0x07, 0x67, 0x13, 0x01, 0x05, 0x0d,
-  0x01, 0x04, 0x0b, 0x05, 0x04, 0x67, 0x00, 0x0b, 0x16, 0x01, 0x0a, 0x01,
-  0x0b, 0x0a, 0x67, 0x11, 0x01, 0x00, 0x10, 0x01, 0x01, 0x02, 0x00, 0x01,
-  0x67, 0x12, 0x01, 0x02, 0x03, 0x03, 0x02, 0x57, 0x12, 0x01, 0x02, 0x02,
-  0x03, 0x5f, 0x00, 0x03, 0x02, 0x03, 0x4f, 0x48, 0x45, 0x35, 0x33, 0x2e,
-  0x2c, 0x27, 0x27, 0x22, 0x22, 0x16, 0x13, 0x61, 0x60, 0x58, 0x57, 0x4f,
-  0x49, 0x45, 0x53, 0x48, 0x50, 0x42, 0x41, 0x3d, 0x3c, 0x38, 0x36, 0x33,
-  0x39, 0x35, 0x39, 0x31, 0x2f, 0x2c, 0x32, 0x2e, 0x32, 0x27, 0x2b, 0x27,
-  0x2b, 0x2a, 0x29, 0x22, 0x26, 0x22, 0x26, 0x25, 0x24, 0x1d, 0x17, 0x13,
-  0x21, 0x16, 0x1e, 0x18, 0x20, 0x18, 0x07, 0x18, 0x2b, 0xb1, 0x06, 0x00,
-  0x44, 0x01, 0x31, 0x33, 0x1d, 0x07, 0x23, 0x3d, 0x06, 0x03, 0x31, 0x3b,
-  0x01, 0x15, 0x2b, 0x05, 0x35, 0x3b, 0x02, 0x13, 0x31, 0x15, 0x23, 0x3d,
-  0x01, 0x31, 0x35, 0x33, 0x15, 0x27, 0x31, 0x33, 0x15, 0x2b, 0x01, 0x35,
-  0x13, 0x31, 0x23, 0x35, 0x3b, 0x01, 0x15, 0x01, 0x31, 0x35, 0x33, 0x1d,
-  0x03, 0x23, 0x3d, 0x01, 0x13, 0x31, 0x2b, 0x01, 0x35, 0x3b, 0x05, 0x15,
-  0x2b, 0x02, 0x01, 0x31, 0x1d, 0x01, 0x23, 0x3d, 0x07, 0x33, 0x1d, 0x04,
-  0x03, 0x12, 0x66, 0x66, 0xcd, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67,
-  0x66, 0x66, 0x67, 0x66, 0xcd, 0x67, 0x67, 0xcd, 0x66, 0x66, 0x66, 0x66,
-  0x66, 0x66, 0x66, 0xfe, 0xcd, 0x67, 0x67, 0x67, 0x67, 0x66, 0x66, 0x67,
-  0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0xfe, 0xcd, 0x66, 0x66, 0x03,
-  0x9f, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x66, 0x66, 0x67,
-  0x66, 0x66, 0x67, 0x66, 0xfd, 0x34, 0x67, 0x67, 0x01, 0x33, 0x67, 0x67,
-  0xcc, 0x67, 0x67, 0xcd, 0x66, 0x66, 0xfd, 0x9a, 0x66, 0x66, 0x01, 0x99,
-  0x67, 0x67, 0x66, 0x66, 0x67, 0x67, 0x66, 0x01, 0x99, 0x67, 0x67, 0xfd,
-  0x9a, 0x66, 0x66, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x66,
-  0x66, 0x67, 0x66, 0x66, 0x00, 0x07, 0x00, 0x46, 0x00, 0xd3, 0x03, 0x13,
-  0x04, 0x06, 0x00, 0x0e, 0x00, 0x1b, 0x00, 0x20, 0x00, 0x25, 0x00, 0x34,
-  0x00, 0x41, 0x00, 0x50, 0x00, 0x86, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x7b,
-  0x00, 0x0e, 0x14, 0x01, 0x0d, 0x00, 0x0e, 0x0d, 0x67, 0x00, 0x0b, 0x13,
-  0x01, 0x0c, 0x06, 0x0b, 0x0c, 0x67, 0x00, 0x06, 0x12, 0x01, 0x07, 0x08,
-  0x06, 0x07, 0x67, 0x00, 0x08, 0x00, 0x09, 0x05, 0x08, 0x09, 0x67, 0x00,
-  0x05, 0x0a, 0x01, 0x04, 0x01, 0x05, 0x04, 0x67, 0x10, 0x01, 0x00, 0x0f,
-  0x01, 0x01, 0x02, 0x00, 0x01, 0x67, 0x11, 0x01, 0x02, 0x03, 0x03, 0x02,
-  0x57, 0x11, 0x01, 0x02, 0x02, 0x03, 0x5f, 0x00, 0x03, 0x02, 0x03, 0x4f,
-  0x38, 0x35, 0x26, 0x26, 0x21, 0x21, 0x12, 0x0f, 0x4d, 0x4c, 0x46, 0x45,
-  0x3e, 0x39, 0x35, 0x41, 0x38, 0x3f, 0x26, 0x34, 0x26, 0x34, 0x33, 0x31,
-  0x2d, 0x2c, 0x2b, 0x2a, 0x29, 0x28, 0x21, 0x25, 0x21, 0x25, 0x24, 0x23,
-  0x20, 0x1f, 0x1e, 0x1c, 0x18, 0x13, 0x0f, 0x1b, 0x12, 0x19, 0x16, 0x20,
-  0x15, 0x07, 0x18, 0x2b, 0xb1, 0x06, 0x00, 0x44, 0x01, 0x31, 0x33, 0x1d,
-  0x05, 0x23, 0x3d, 0x04, 0x03, 0x31, 0x3b, 0x01, 0x15, 0x2b, 0x04, 0x35,
-  0x3b, 0x01, 0x37, 0x31, 0x23, 0x35, 0x33, 0x27, 0x31, 0x35, 0x33, 0x15,
-  0x27, 0x31, 0x15, 0x33, 0x15, 0x23, 0x15, 0x23, 0x3d, 0x03, 0x3b, 0x01,
-  0x15, 0x27, 0x31, 0x2b, 0x01, 0x35, 0x3b, 0x04, 0x15, 0x2b, 0x01, 0x01,
-  0x31, 0x1d, 0x01, 0x23, 0x3d, 0x05, 0x33, 0x1d, 0x02, 0x02, 0xad, 0x66,
-  0x66, 0xcd, 0x66, 0x67, 0x67, 0x66, 0x67, 0x66, 0x66, 0x66, 0x66, 0xcd,
-  0x66, 0x66, 0x66, 0x66, 0xcd, 0x67, 0x67, 0x66, 0x66, 0x67, 0x67, 0x66,
-  0x66, 0x66, 0x66, 0x67, 0x66, 0x67, 0x67, 0x66, 0xfe, 0xcd, 0x67, 0x67,
-  0x03, 0x9f, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x67, 0x66, 0x66, 0x67,
-  0x66, 0xfe, 0x00, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x67, 0x67, 0x67,
-  0x66, 0x66, 0x66, 0x66, 0x67, 0x66, 0x66, 0xcc, 0x67, 0x67, 0xfe, 0x67,
-  0x66, 0x67, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x66, 0x66, 0x67, 0x00,
-  0x00, 0x01, 0x00, 0x46, 0x03, 0x99, 0x03, 0x79, 0x04, 0x66, 0x00, 0x14,
-  0x00, 0x28, 0xb1, 0x06, 0x64, 0x44, 0x40, 0x1d, 0x02, 0x01, 0x00, 0x01,
-  0x01, 0x00, 0x57, 0x02, 0x01, 0x00, 0x00, 0x01, 0x5f, 0x00, 0x01, 0x00,
-  0x01, 0x4f, 0x02, 0x00, 0x0c, 0x04, 0x00, 0x14, 0x02, 0x0e, 0x03, 0x07,
-  0x16, 0x2b, 0xb1, 0x06, 0x00, 0x44, 0x01, 0x31, 0x33, 0x1d, 0x01, 0x2b,
-  0x07, 0x3d, 0x01, 0x3b, 0x05, 0x03, 0x12, 0x67, 0x67, 0x66, 0x66, 0x67,
-  0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x04, 0x66,
-  0x67, 0x66, 0x66, 0x67, 0x00, 0x02, 0x00, 0x46, 0xff, 0x99, 0x03, 0x79,
-  0x03, 0xff, 0x00, 0x20, 0x00, 0x35, 0x00, 0x3c, 0x40, 0x39, 0x04, 0x08,
-  0x02, 0x00, 0x03, 0x01, 0x01, 0x02, 0x00, 0x01, 0x67, 0x09, 0x01, 0x06,
-  0x00, 0x07, 0x06, 0x07, 0x63, 0x00, 0x02, 0x02, 0x05, 0x5f, 0x00, 0x05,
-  0x05, 0x12, 0x02, 0x4e, 0x24, 0x21, 0x02, 0x00, 0x2e, 0x26, 0x21, 0x35,
-  0x24, 0x30, 0x1c, 0x1a, 0x17, 0x14, 0x12, 0x0f, 0x0c, 0x0a, 0x07, 0x04,
-  0x00, 0x20, 0x02, 0x1f, 0x0a, 0x07, 0x16, 0x2b, 0x01, 0x31, 0x33, 0x1d,
-  0x01, 0x2b, 0x02, 0x1d, 0x02, 0x2b, 0x01, 0x3d, 0x02, 0x2b, 0x02, 0x3d,
-  0x01, 0x3b, 0x02, 0x3d, 0x02, 0x3b, 0x01, 0x1d, 0x02, 0x33, 0x11, 0x31,
-  0x3b, 0x01, 0x1d, 0x01, 0x2b, 0x07, 0x3d, 0x01, 0x3b, 0x04, 0x03, 0x12,
-  0x67, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66,
-  0x66, 0x67, 0x66, 0x66, 0x67, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67,
-  0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x02, 0xcc, 0x66, 0x67, 0x66, 0x66,
-  0x67, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66,
-  0xfd, 0x9a, 0x66, 0x67, 0x67, 0x66, 0x00, 0x00, 0x00, 0x01, 0x00, 0x46,
-  0x02, 0xcc, 0x01, 0x79, 0x03, 0xff, 0x00, 0x0c, 0x00, 0x30, 0xb1, 0x06,
-  0x64, 0x44, 0x40, 0x25, 0x00, 0x01, 0x03, 0x00, 0x01, 0x57, 0x00, 0x02,
-  0x04, 0x01, 0x03, 0x00, 0x02, 0x03, 0x67, 0x00, 0x01, 0x01, 0x00, 0x5f,
-  0x00, 0x00, 0x01, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x0c, 0x21,
-  0x12, 0x22, 0x05, 0x07, 0x19, 0x2b, 0xb1, 0x06, 0x00, 0x44, 0x01, 0x31,
-  0x15, 0x2b, 0x01, 0x3d, 0x01, 0x33, 0x35, 0x3b, 0x01, 0x1d, 0x01, 0x01,
-  0x13, 0x66, 0x67, 0x67, 0x66, 0x66, 0x03, 0x33, 0x67, 0x67, 0x66, 0x66,
-  0x66, 0x66, 0x00, 0x00, 0x00, 0x05, 0x00, 0x46, 0x00, 0x66, 0x03, 0x79,
-  0x03, 0xff, 0x00, 0x0e, 0x00, 0x1d, 0x00, 0x24, 0x00, 0x33, 0x00, 0x42,
-  0x00, 0x86, 0x40, 0x83, 0x18, 0x01, 0x05, 0x15, 0x01, 0x02, 0x03, 0x05,
-  0x02, 0x67, 0x1c, 0x19, 0x02, 0x04, 0x14, 0x01, 0x03, 0x0c, 0x04, 0x03,
-  0x67, 0x00, 0x0c, 0x00, 0x0d, 0x06, 0x0c, 0x0d, 0x67, 0x0e, 0x01, 0x06,
-  0x0f, 0x1a, 0x02, 0x0b, 0x08, 0x06, 0x0b, 0x67, 0x1b, 0x13, 0x02, 0x07,
-  0x10, 0x01, 0x0a, 0x09, 0x07, 0x0a, 0x67, 0x12, 0x01, 0x08, 0x11, 0x01,
-  0x09, 0x08, 0x09, 0x63, 0x16, 0x01, 0x01, 0x01, 0x00, 0x5f, 0x17, 0x01,
-  0x00, 0x00, 0x12, 0x01, 0x4e, 0x34, 0x34, 0x25, 0x25, 0x0f, 0x0f, 0x34,
-  0x42, 0x34, 0x42, 0x41, 0x40, 0x3f, 0x3e, 0x3c, 0x3b, 0x3a, 0x39, 0x38,
-  0x37, 0x25, 0x33, 0x25, 0x33, 0x32, 0x31, 0x2f, 0x2e, 0x2d, 0x2c, 0x2b,
-  0x2a, 0x28, 0x27, 0x24, 0x22, 0x21, 0x1e, 0x0f, 0x1d, 0x0f, 0x1d, 0x1c,
-  0x1b, 0x1a, 0x19, 0x11, 0x11, 0x14, 0x11, 0x12, 0x11, 0x11, 0x12, 0x20,
-  0x1d, 0x07, 0x1f, 0x2b, 0x01, 0x31, 0x33, 0x1d, 0x01, 0x23, 0x15, 0x23,
-  0x15, 0x23, 0x3d, 0x01, 0x33, 0x35, 0x33, 0x03, 0x31, 0x3d, 0x01, 0x33,
-  0x15, 0x33, 0x15, 0x33, 0x1d, 0x01, 0x23, 0x35, 0x23, 0x35, 0x01, 0x31,
-  0x3b, 0x01, 0x15, 0x2b, 0x01, 0x07, 0x31, 0x35, 0x33, 0x1d, 0x01, 0x23,
-  0x15, 0x23, 0x15, 0x23, 0x3d, 0x01, 0x33, 0x35, 0x13, 0x31, 0x1d, 0x01,
-  0x23, 0x35, 0x23, 0x35, 0x23, 0x3d, 0x01, 0x33, 0x15, 0x33, 0x15, 0x03,
-  0x12, 0x67, 0x67, 0x66, 0x66, 0x66, 0x66, 0xcc, 0x66, 0x66, 0x67, 0x67,
-  0x66, 0xfe, 0xcd, 0x66, 0x67, 0x67, 0x66, 0x66, 0x66, 0x66, 0x67, 0x66,
-  0x66, 0xcd, 0x66, 0x67, 0x66, 0x66, 0x67, 0x03, 0xff, 0x66, 0x67, 0x66,
-  0x66, 0x66, 0x66, 0x67, 0xfd, 0x9a, 0x66, 0x66, 0x66, 0x66, 0x67, 0x66,
-  0x66, 0x67, 0x01, 0x33, 0x67, 0x66, 0x66, 0x66, 0x66, 0x67, 0x66, 0x66,
-  0x67, 0x66, 0x01, 0x99, 0x66, 0x66, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67,
-  0x00, 0x03, 0x00, 0x46, 0x00, 0x66, 0x03, 0x79, 0x03, 0x99, 0x00, 0x14,
-  0x00, 0x1d, 0x00, 0x26, 0x00, 0x37, 0x40, 0x34, 0x00, 0x03, 0x00, 0x02,
-  0x00, 0x03, 0x02, 0x67, 0x06, 0x01, 0x00, 0x00, 0x01, 0x04, 0x00, 0x01,
-  0x67, 0x00, 0x04, 0x05, 0x05, 0x04, 0x57, 0x00, 0x04, 0x04, 0x05, 0x5f,
-  0x00, 0x05, 0x04, 0x05, 0x4f, 0x02, 0x00, 0x25, 0x23, 0x21, 0x1e, 0x1c,
-  0x1a, 0x18, 0x15, 0x0c, 0x04, 0x00, 0x14, 0x02, 0x0e, 0x07, 0x07, 0x16,
-  0x2b, 0x01, 0x31, 0x33, 0x1d, 0x01, 0x2b, 0x07, 0x3d, 0x01, 0x3b, 0x05,
-  0x27, 0x31, 0x2b, 0x01, 0x3d, 0x01, 0x3b, 0x01, 0x15, 0x03, 0x31, 0x3b,
-  0x01, 0x1d, 0x01, 0x2b, 0x01, 0x35, 0x03, 0x12, 0x67, 0x67, 0x66, 0x66,
-  0x67, 0x66, 0x67, 0x66, 0x66, 0x66, 0x66, 0x67, 0x66, 0x67, 0x66, 0x66,
-  0x67, 0x66, 0x66, 0x67, 0xcd, 0x66, 0x67, 0x67, 0x66, 0x02, 0x66, 0x67,
-  0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x67, 0xfe, 0x01, 0x67, 0x66, 0x66,
-  0x00, 0x01, 0x00, 0x46, 0x03, 0x32, 0x01, 0x13, 0x04, 0xcc, 0x00, 0x0a,
-  0x00, 0x3e, 0x4b, 0xb0, 0x0d, 0x50, 0x58, 0x40, 0x12, 0x00, 0x01, 0x02,
-  0x02, 0x01, 0x70, 0x03, 0x01, 0x00, 0x00, 0x02, 0x5f, 0x00, 0x02, 0x02,
-  0x12, 0x00, 0x4e, 0x1b, 0x40, 0x11, 0x00, 0x01, 0x02, 0x01, 0x85, 0x03,
-  0x01, 0x00, 0x00, 0x02, 0x5f, 0x00, 0x02, 0x02, 0x12, 0x00, 0x4e, 0x59,
-  0x40, 0x0d, 0x02, 0x00, 0x08, 0x07, 0x06, 0x05, 0x00, 0x0a, 0x02, 0x0a,
-  0x04, 0x07, 0x16, 0x2b, 0x13, 0x31, 0x23, 0x3d, 0x02, 0x33, 0x15, 0x33,
-  0x1d, 0x01, 0xad, 0x67, 0x67, 0x66, 0x03, 0x32, 0x67, 0x66, 0xcd, 0xcd,
-  0x66, 0x67, 0x00, 0x00, 0x00, 0x01, 0x00, 0x46, 0x03, 0x32, 0x01, 0x13,
-  0x04, 0xcc, 0x00, 0x0a, 0x00, 0x4a, 0x4b, 0xb0, 0x0d, 0x50, 0x58, 0x40,
-  0x18, 0x00, 0x01, 0x02, 0x02, 0x01, 0x71, 0x03, 0x01, 0x00, 0x02, 0x02,
-  0x00, 0x57, 0x03, 0x01, 0x00, 0x00, 0x02, 0x5f, 0x00, 0x02, 0x00, 0x02,
-  0x4f, 0x1b, 0x40, 0x17, 0x00, 0x01, 0x02, 0x01, 0x86, 0x03, 0x01, 0x00,
-  0x02, 0x02, 0x00, 0x57, 0x03, 0x01, 0x00, 0x00, 0x02, 0x5f, 0x00, 0x02,
-  0x00, 0x02, 0x4f, 0x59, 0x40, 0x0d, 0x02, 0x00, 0x08, 0x07, 0x06, 0x05,
-  0x00, 0x0a, 0x02, 0x0a, 0x04, 0x07, 0x16, 0x2b, 0x13, 0x31, 0x33, 0x1d,
-  0x02, 0x23, 0x35, 0x23, 0x3d, 0x01, 0xad, 0x66, 0x66, 0x67, 0x04, 0xcc,
-  0x66, 0x66, 0xce, 0xce, 0x66, 0x66, 0x00, 0x00, 0x00, 0x01, 0x00, 0x46,
-  0xff, 0x32, 0x01, 0x13, 0x00, 0xcc, 0x00, 0x0a, 0x00, 0x3e, 0x4b, 0xb0,
-  0x0d, 0x50, 0x58, 0x40, 0x12, 0x00, 0x01, 0x02, 0x02, 0x01, 0x71, 0x03,
-  0x01, 0x00, 0x00, 0x02, 0x5f, 0x00, 0x02, 0x02, 0x13, 0x02, 0x4e, 0x1b,
-  0x40, 0x11, 0x00, 0x01, 0x02, 0x01, 0x86, 0x03, 0x01, 0x00, 0x00, 0x02,
-  0x5f, 0x00, 0x02, 0x02, 0x13, 0x02, 0x4e, 0x59, 0x40, 0x0d, 0x02, 0x00,
-  0x08, 0x07, 0x06, 0x05, 0x00, 0x0a, 0x02, 0x0a, 0x04, 0x07, 0x16, 0x2b,
-  0x37, 0x31, 0x33, 0x1d, 0x02, 0x23, 0x35, 0x23, 0x3d, 0x01, 0xac, 0x67,
-  0x67, 0x66, 0xcc, 0x66, 0x66, 0xce, 0xce, 0x66, 0x66, 0x00, 0x00, 0x00,
-  0x00, 0x02, 0x00, 0x46, 0x03, 0x32, 0x02, 0x46, 0x04, 0xcc, 0x00, 0x0a,
-  0x00, 0x15, 0x00, 0x50, 0x4b, 0xb0, 0x0d, 0x50, 0x58, 0x40, 0x16, 0x04,
-  0x01, 0x01, 0x02, 0x02, 0x01, 0x70, 0x07, 0x03, 0x06, 0x03, 0x00, 0x00,
-  0x02, 0x5f, 0x05, 0x01, 0x02, 0x02, 0x12, 0x00, 0x4e, 0x1b, 0x40, 0x15,
-  0x04, 0x01, 0x01, 0x02, 0x01, 0x85, 0x07, 0x03, 0x06, 0x03, 0x00, 0x00,
-  0x02, 0x5f, 0x05, 0x01, 0x02, 0x02, 0x12, 0x00, 0x4e, 0x59, 0x40, 0x17,
-  0x0d, 0x0b, 0x02, 0x00, 0x13, 0x12, 0x11, 0x10, 0x0b, 0x15, 0x0d, 0x15,
-  0x08, 0x07, 0x06, 0x05, 0x00, 0x0a, 0x02, 0x0a, 0x08, 0x07, 0x16, 0x2b,
-  0x13, 0x31, 0x23, 0x3d, 0x02, 0x33, 0x15, 0x33, 0x1d, 0x01, 0x33, 0x31,
-  0x23, 0x3d, 0x02, 0x33, 0x15, 0x33, 0x1d, 0x01, 0xad, 0x67, 0x67, 0x66,
-  0xcc, 0x66, 0x66, 0x67, 0x03, 0x32, 0x67, 0x66, 0xcd, 0xcd, 0x66, 0x67,
-  0x67, 0x66, 0xcd, 0xcd, 0x66, 0x67, 0x00, 0x00, 0x00, 0x02, 0x00, 0x46,
-  0x03, 0x32, 0x02, 0x46, 0x04, 0xcc, 0x00, 0x0a, 0x00, 0x15, 0x00, 0x60,
-  0x4b, 0xb0, 0x0d, 0x50, 0x58, 0x40, 0x1e, 0x04, 0x01, 0x01, 0x02, 0x02,
-  0x01, 0x71, 0x07, 0x03, 0x06, 0x03, 0x00, 0x02, 0x02, 0x00, 0x57, 0x07,
-  0x03, 0x06, 0x03, 0x00, 0x00, 0x02, 0x5f, 0x05, 0x01, 0x02, 0x00, 0x02,
-  0x4f, 0x1b, 0x40, 0x1d, 0x04, 0x01, 0x01, 0x02, 0x01, 0x86, 0x07, 0x03,
-  0x06, 0x03, 0x00, 0x02, 0x02, 0x00, 0x57, 0x07, 0x03, 0x06, 0x03, 0x00,
-  0x00, 0x02, 0x5f, 0x05, 0x01, 0x02, 0x00, 0x02, 0x4f, 0x59, 0x40, 0x17,
-  0x0d, 0x0b, 0x02, 0x00, 0x13, 0x12, 0x11, 0x10, 0x0b, 0x15, 0x0d, 0x15,
-  0x08, 0x07, 0x06, 0x05, 0x00, 0x0a, 0x02, 0x0a, 0x08, 0x07, 0x16, 0x2b,
-  0x01, 0x31, 0x33, 0x1d, 0x02, 0x23, 0x35, 0x23, 0x3d, 0x01, 0x23, 0x31,
-  0x33, 0x1d, 0x02, 0x23, 0x35, 0x23, 0x3d, 0x01, 0x01, 0xdf, 0x67, 0x67,
-  0x66, 0xcc, 0x66, 0x66, 0x67, 0x04, 0xcc, 0x66, 0x66, 0xce, 0xce, 0x66,
-  0x66, 0x66, 0x66, 0xce, 0xce, 0x66, 0x66, 0x00, 0x00, 0x02, 0x00, 0x46,
-  0xff, 0x33, 0x02, 0x46, 0x00, 0xcd, 0x00, 0x0a, 0x00, 0x15, 0x00, 0x50,
-  0x4b, 0xb0, 0x0d, 0x50, 0x58, 0x40, 0x16, 0x04, 0x01, 0x01, 0x02, 0x02,
-  0x01, 0x71, 0x07, 0x03, 0x06, 0x03, 0x00, 0x00, 0x02, 0x5f, 0x05, 0x01,
-  0x02, 0x02, 0x13, 0x02, 0x4e, 0x1b, 0x40, 0x15, 0x04, 0x01, 0x01, 0x02,
-  0x01, 0x86, 0x07, 0x03, 0x06, 0x03, 0x00, 0x00, 0x02, 0x5f, 0x05, 0x01,
-  0x02, 0x02, 0x13, 0x02, 0x4e, 0x59, 0x40, 0x17, 0x0d, 0x0b, 0x02, 0x00,
-  0x13, 0x12, 0x11, 0x10, 0x0b, 0x15, 0x0d, 0x15, 0x08, 0x07, 0x06, 0x05,
-  0x00, 0x0a, 0x02, 0x0a, 0x08, 0x07, 0x16, 0x2b, 0x25, 0x31, 0x33, 0x1d,
-  0x02, 0x23, 0x35, 0x23, 0x3d, 0x01, 0x23, 0x31, 0x33, 0x1d, 0x02, 0x23,
-  0x35, 0x23, 0x3d, 0x01, 0x01, 0xdf, 0x67, 0x67, 0x66, 0xcc, 0x66, 0x66,
-  0x67, 0xcd, 0x67, 0x66, 0xcd, 0xcd, 0x66, 0x67, 0x67, 0x66, 0xcd, 0xcd,
-  0x66, 0x67, 0x00, 0x00, 0x00, 0x01, 0x00, 0x46, 0x00, 0x00, 0x03, 0x79,
-  0x03, 0xff, 0x00, 0x24, 0x00, 0x58, 0x40, 0x55, 0x00, 0x0b, 0x00, 0x02,
-  0x08, 0x0b, 0x02, 0x67, 0x00, 0x0a, 0x00, 0x03, 0x07, 0x0a, 0x03, 0x67,
-  0x00, 0x09, 0x00, 0x04, 0x05, 0x09, 0x04, 0x67, 0x00, 0x08, 0x00, 0x05,
-  0x06, 0x08, 0x05, 0x67, 0x00, 0x01, 0x01, 0x00, 0x5f, 0x0c, 0x01, 0x00,
-  0x00, 0x12, 0x4d, 0x00, 0x07, 0x07, 0x06, 0x5f, 0x00, 0x06, 0x06, 0x13,
-  0x06, 0x4e, 0x02, 0x00, 0x22, 0x21, 0x20, 0x1f, 0x1e, 0x1d, 0x1c, 0x1b,
-  0x1a, 0x18, 0x14, 0x12, 0x10, 0x0f, 0x0e, 0x0d, 0x0c, 0x0b, 0x0a, 0x09,
-  0x08, 0x06, 0x00, 0x24, 0x02, 0x24, 0x0d, 0x07, 0x16, 0x2b, 0x01, 0x31,
-  0x33, 0x1d, 0x03, 0x2b, 0x01, 0x15, 0x23, 0x15, 0x23, 0x15, 0x23, 0x15,
-  0x23, 0x1d, 0x01, 0x2b, 0x01, 0x3d, 0x03, 0x3b, 0x01, 0x35, 0x33, 0x35,
-  0x33, 0x35, 0x33, 0x35, 0x33, 0x3d, 0x01, 0x03, 0x13, 0x66, 0x66, 0x66,
-  0x67, 0x66, 0x67, 0x66, 0x66, 0x67, 0x67, 0x66, 0x66, 0x67, 0x66, 0x67,
-  0x03, 0xff, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66,
-  0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x00, 0x00,
-  0x00, 0x04, 0x00, 0x46, 0x02, 0xd3, 0x03, 0x79, 0x04, 0x06, 0x00, 0x04,
-  0x00, 0x13, 0x00, 0x18, 0x00, 0x25, 0x00, 0x57, 0x40, 0x54, 0x0c, 0x01,
-  0x0a, 0x06, 0x05, 0x0a, 0x57, 0x00, 0x06, 0x02, 0x01, 0x06, 0x57, 0x10,
-  0x0d, 0x0e, 0x07, 0x04, 0x05, 0x04, 0x01, 0x02, 0x00, 0x05, 0x02, 0x67,
-  0x08, 0x01, 0x00, 0x01, 0x01, 0x00, 0x57, 0x08, 0x01, 0x00, 0x00, 0x01,
-  0x5f, 0x0b, 0x0f, 0x09, 0x03, 0x04, 0x01, 0x00, 0x01, 0x4f, 0x19, 0x19,
-  0x14, 0x14, 0x05, 0x05, 0x19, 0x25, 0x19, 0x23, 0x22, 0x21, 0x1f, 0x1e,
-  0x1c, 0x1b, 0x14, 0x18, 0x14, 0x18, 0x17, 0x16, 0x05, 0x13, 0x05, 0x13,
-  0x11, 0x12, 0x11, 0x11, 0x14, 0x11, 0x20, 0x11, 0x06, 0x1d, 0x2b, 0x01,
-  0x31, 0x33, 0x15, 0x23, 0x11, 0x31, 0x1d, 0x01, 0x23, 0x15, 0x23, 0x35,
-  0x23, 0x3d, 0x01, 0x33, 0x15, 0x33, 0x35, 0x01, 0x31, 0x35, 0x33, 0x15,
-  0x03, 0x31, 0x15, 0x23, 0x1d, 0x01, 0x23, 0x3d, 0x01, 0x23, 0x35, 0x3b,
-  0x01, 0x03, 0x13, 0x66, 0x66, 0x67, 0x66, 0x66, 0x66, 0x66, 0xfe, 0xcd,
-  0x67, 0x67, 0x66, 0x66, 0x67, 0x67, 0x66, 0x03, 0x39, 0x66, 0x01, 0x33,
-  0x67, 0x66, 0x66, 0x66, 0x66, 0x67, 0x67, 0x67, 0xfe, 0xcd, 0x66, 0x66,
-  0x01, 0x33, 0x67, 0x66, 0x66, 0x66, 0x66, 0x67, 0x00, 0x01, 0x00, 0x46,
-  0x01, 0x99, 0x03, 0x79, 0x02, 0x66, 0x00, 0x14, 0x00, 0x20, 0x40, 0x1d,
-  0x02, 0x01, 0x00, 0x01, 0x01, 0x00, 0x57, 0x02, 0x01, 0x00, 0x00, 0x01,
-  0x5f, 0x00, 0x01, 0x00, 0x01, 0x4f, 0x02, 0x00, 0x0c, 0x04, 0x00, 0x14,
-  0x02, 0x0e, 0x03, 0x06, 0x16, 0x2b, 0x01, 0x31, 0x33, 0x1d, 0x01, 0x2b,
-  0x07, 0x3d, 0x01, 0x3b, 0x05, 0x03, 0x13, 0x66, 0x66, 0x67, 0x66, 0x66,
-  0x67, 0x66, 0x66, 0x67, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x02, 0x66,
-  0x67, 0x66, 0x66, 0x67, 0x00, 0x02, 0x00, 0x46, 0xfe, 0xce, 0x03, 0x79,
-  0x03, 0xff, 0x00, 0x30, 0x00, 0x45, 0x01, 0x3f, 0x4b, 0xb0, 0x19, 0x50,
-  0x58, 0x40, 0x57, 0x00, 0x00, 0x0f, 0x0f, 0x00, 0x70, 0x00, 0x07, 0x08,
-  0x10, 0x08, 0x07, 0x72, 0x00, 0x0f, 0x00, 0x01, 0x0e, 0x0f, 0x01, 0x68,
-  0x00, 0x0e, 0x00, 0x02, 0x0d, 0x0e, 0x02, 0x67, 0x00, 0x0d, 0x00, 0x03,
-  0x0c, 0x0d, 0x03, 0x67, 0x00, 0x0c, 0x00, 0x0b, 0x04, 0x0c, 0x0b, 0x67,
-  0x00, 0x04, 0x00, 0x0a, 0x05, 0x04, 0x0a, 0x67, 0x00, 0x05, 0x00, 0x09,
-  0x06, 0x05, 0x09, 0x67, 0x00, 0x06, 0x00, 0x08, 0x07, 0x06, 0x08, 0x67,
-  0x12, 0x01, 0x10, 0x11, 0x11, 0x10, 0x57, 0x12, 0x01, 0x10, 0x10, 0x11,
-  0x5f, 0x00, 0x11, 0x10, 0x11, 0x4f, 0x1b, 0x4b, 0xb0, 0x1a, 0x50, 0x58,
-  0x40, 0x58, 0x00, 0x00, 0x0f, 0x0f, 0x00, 0x70, 0x00, 0x07, 0x08, 0x10,
-  0x08, 0x07, 0x10, 0x80, 0x00, 0x0f, 0x00, 0x01, 0x0e, 0x0f, 0x01, 0x68,
-  0x00, 0x0e, 0x00, 0x02, 0x0d, 0x0e, 0x02, 0x67, 0x00, 0x0d, 0x00, 0x03,
-  0x0c, 0x0d, 0x03, 0x67, 0x00, 0x0c, 0x00, 0x0b, 0x04, 0x0c, 0x0b, 0x67,
-  0x00, 0x04, 0x00, 0x0a, 0x05, 0x04, 0x0a, 0x67, 0x00, 0x05, 0x00, 0x09,
-  0x06, 0x05, 0x09, 0x67, 0x00, 0x06, 0x00, 0x08, 0x07, 0x06, 0x08, 0x67,
-  0x12, 0x01, 0x10, 0x11, 0x11, 0x10, 0x57, 0x12, 0x01, 0x10, 0x10, 0x11,
-  0x5f, 0x00, 0x11, 0x10, 0x11, 0x4f, 0x1b, 0x40, 0x57, 0x00, 0x00, 0x0f,
-  0x00, 0x85, 0x00, 0x07, 0x08, 0x10, 0x08, 0x07, 0x10, 0x80, 0x00, 0x0f,
-  0x00, 0x01, 0x0e, 0x0f, 0x01, 0x68, 0x00, 0x0e, 0x00, 0x02, 0x0d, 0x0e,
-  0x02, 0x67, 0x00, 0x0d, 0x00, 0x03, 0x0c, 0x0d, 0x03, 0x67, 0x00, 0x0c,
-  0x00, 0x0b, 0x04, 0x0c, 0x0b, 0x67, 0x00, 0x04, 0x00, 0x0a, 0x05, 0x04,
-  0x0a, 0x67, 0x00, 0x05, 0x00, 0x09, 0x06, 0x05, 0x09, 0x67, 0x00, 0x06,
-  0x00, 0x08, 0x07, 0x06, 0x08, 0x67, 0x12, 0x01, 0x10, 0x11, 0x11, 0x10,
-  0x57, 0x12, 0x01, 0x10, 0x10, 0x11, 0x5f, 0x00, 0x11, 0x10, 0x11, 0x4f,
-  0x59, 0x59, 0x40, 0x22, 0x33, 0x31, 0x3d, 0x35, 0x31, 0x45, 0x33, 0x3f,
-  0x30, 0x2e, 0x2d, 0x2b, 0x2a, 0x28, 0x27, 0x26, 0x24, 0x23, 0x22, 0x20,
-  0x1f, 0x1d, 0x21, 0x12, 0x21, 0x21, 0x22, 0x21, 0x21, 0x22, 0x20, 0x13,
-  0x06, 0x1f, 0x2b, 0x01, 0x31, 0x33, 0x1d, 0x01, 0x2b, 0x01, 0x15, 0x2b,
-  0x01, 0x15, 0x2b, 0x01, 0x1d, 0x01, 0x3b, 0x01, 0x15, 0x3b, 0x01, 0x15,
-  0x3b, 0x01, 0x1d, 0x01, 0x23, 0x35, 0x2b, 0x01, 0x35, 0x2b, 0x01, 0x35,
-  0x2b, 0x01, 0x35, 0x23, 0x3d, 0x01, 0x33, 0x35, 0x3b, 0x01, 0x35, 0x3b,
-  0x01, 0x35, 0x3b, 0x01, 0x11, 0x31, 0x33, 0x1d, 0x01, 0x2b, 0x07, 0x3d,
-  0x01, 0x3b, 0x05, 0x03, 0x12, 0x66, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67,
-  0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67,
-  0x66, 0x66, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x67, 0x67, 0x66,
-  0x66, 0x67, 0x66, 0x67, 0x66, 0x66, 0x66, 0x66, 0x67, 0x66, 0x67, 0x66,
-  0x03, 0xff, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66,
-  0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0xfc, 0x01, 0x66,
-  0x66, 0x66, 0x66, 0x00, 0x00, 0x02, 0x00, 0x46, 0xfe, 0xce, 0x03, 0x79,
-  0x03, 0xff, 0x00, 0x30, 0x00, 0x45, 0x01, 0x3f, 0x4b, 0xb0, 0x19, 0x50,
-  0x58, 0x40, 0x57, 0x00, 0x0f, 0x00, 0x00, 0x0f, 0x70, 0x00, 0x08, 0x07,
-  0x10, 0x07, 0x08, 0x72, 0x00, 0x00, 0x00, 0x0e, 0x01, 0x00, 0x0e, 0x68,
-  0x00, 0x01, 0x00, 0x0d, 0x02, 0x01, 0x0d, 0x67, 0x00, 0x02, 0x00, 0x0c,
-  0x03, 0x02, 0x0c, 0x67, 0x00, 0x03, 0x00, 0x04, 0x0b, 0x03, 0x04, 0x67,
-  0x00, 0x0b, 0x00, 0x05, 0x0a, 0x0b, 0x05, 0x67, 0x00, 0x0a, 0x00, 0x06,
-  0x09, 0x0a, 0x06, 0x67, 0x00, 0x09, 0x00, 0x07, 0x08, 0x09, 0x07, 0x67,
-  0x12, 0x01, 0x10, 0x11, 0x11, 0x10, 0x57, 0x12, 0x01, 0x10, 0x10, 0x11,
-  0x5f, 0x00, 0x11, 0x10, 0x11, 0x4f, 0x1b, 0x4b, 0xb0, 0x1a, 0x50, 0x58,
-  0x40, 0x58, 0x00, 0x0f, 0x00, 0x00, 0x0f, 0x70, 0x00, 0x08, 0x07, 0x10,
-  0x07, 0x08, 0x10, 0x80, 0x00, 0x00, 0x00, 0x0e, 0x01, 0x00, 0x0e, 0x68,
-  0x00, 0x01, 0x00, 0x0d, 0x02, 0x01, 0x0d, 0x67, 0x00, 0x02, 0x00, 0x0c,
-  0x03, 0x02, 0x0c, 0x67, 0x00, 0x03, 0x00, 0x04, 0x0b, 0x03, 0x04, 0x67,
-  0x00, 0x0b, 0x00, 0x05, 0x0a, 0x0b, 0x05, 0x67, 0x00, 0x0a, 0x00, 0x06,
-  0x09, 0x0a, 0x06, 0x67, 0x00, 0x09, 0x00, 0x07, 0x08, 0x09, 0x07, 0x67,
-  0x12, 0x01, 0x10, 0x11, 0x11, 0x10, 0x57, 0x12, 0x01, 0x10, 0x10, 0x11,
-  0x5f, 0x00, 0x11, 0x10, 0x11, 0x4f, 0x1b, 0x40, 0x57, 0x00, 0x0f, 0x00,
-  0x0f, 0x85, 0x00, 0x08, 0x07, 0x10, 0x07, 0x08, 0x10, 0x80, 0x00, 0x00,
-  0x00, 0x0e, 0x01, 0x00, 0x0e, 0x68, 0x00, 0x01, 0x00, 0x0d, 0x02, 0x01,
-  0x0d, 0x67, 0x00, 0x02, 0x00, 0x0c, 0x03, 0x02, 0x0c, 0x67, 0x00, 0x03,
-  0x00, 0x04, 0x0b, 0x03, 0x04, 0x67, 0x00, 0x0b, 0x00, 0x05, 0x0a, 0x0b,
-  0x05, 0x67, 0x00, 0x0a, 0x00, 0x06, 0x09, 0x0a, 0x06, 0x67, 0x00, 0x09,
-  0x00, 0x07, 0x08, 0x09, 0x07, 0x67, 0x12, 0x01, 0x10, 0x11, 0x11, 0x10,
-  0x57, 0x12, 0x01, 0x10, 0x10, 0x11, 0x5f, 0x00, 0x11, 0x10, 0x11, 0x4f,
-  0x59, 0x59, 0x40, 0x22, 0x38, 0x31, 0x42, 0x3a, 0x31, 0x45, 0x38, 0x44,
-  0x30, 0x2f, 0x2d, 0x2b, 0x2a, 0x28, 0x27, 0x25, 0x23, 0x21, 0x20, 0x1e,
-  0x1d, 0x1b, 0x11, 0x21, 0x21, 0x21, 0x12, 0x11, 0x21, 0x21, 0x21, 0x13,
-  0x06, 0x1f, 0x2b, 0x13, 0x15, 0x3b, 0x01, 0x15, 0x3b, 0x01, 0x15, 0x3b,
-  0x01, 0x15, 0x33, 0x1d, 0x01, 0x23, 0x15, 0x2b, 0x01, 0x15, 0x2b, 0x01,
-  0x15, 0x2b, 0x01, 0x15, 0x23, 0x3d, 0x01, 0x3b, 0x01, 0x35, 0x3b, 0x01,
-  0x35, 0x3b, 0x01, 0x3d, 0x01, 0x2b, 0x01, 0x35, 0x2b, 0x01, 0x35, 0x2b,
-  0x01, 0x3d, 0x01, 0x33, 0x11, 0x3b, 0x06, 0x1d, 0x01, 0x2b, 0x07, 0x3d,
-  0x01, 0x33, 0xac, 0x66, 0x67, 0x66, 0x67, 0x66, 0x66, 0x67, 0x67, 0x66,
-  0x66, 0x67, 0x66, 0x67, 0x66, 0x66, 0x66, 0x66, 0x67, 0x66, 0x67, 0x66,
-  0x66, 0x67, 0x66, 0x67, 0x66, 0x66, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67,
-  0x66, 0x66, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x66, 0x03,
-  0xff, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x66,
-  0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0xfb, 0x9b, 0x66,
-  0x66, 0x66, 0x66, 0x00, 0x00, 0x04, 0x00, 0x46, 0x00, 0x00, 0x03, 0x78,
-  0x03, 0xff, 0x00, 0x18, 0x00, 0x1d, 0x00, 0x36, 0x00, 0x3b, 0x01, 0x31,
-  0x4b, 0xb0, 0x19, 0x50, 0x58, 0x40, 0x4b, 0x00, 0x05, 0x06, 0x00, 0x00,
-  0x05, 0x72, 0x00, 0x02, 0x01, 0x08, 0x01, 0x02, 0x72, 0x00, 0x08, 0x09,
-  0x09, 0x08, 0x70, 0x00, 0x0b, 0x0a, 0x0e, 0x0a, 0x0b, 0x72, 0x11, 0x01,
-  0x07, 0x00, 0x06, 0x05, 0x07, 0x06, 0x67, 0x04, 0x10, 0x02, 0x00, 0x03,
-  0x01, 0x01, 0x02, 0x00, 0x01, 0x68, 0x12, 0x0d, 0x02, 0x09, 0x0c, 0x01,
-  0x0a, 0x0b, 0x09, 0x0a, 0x68, 0x00, 0x0e, 0x0f, 0x0f, 0x0e, 0x57, 0x00,
-  0x0e, 0x0e, 0x0f, 0x5f, 0x13, 0x01, 0x0f, 0x0e, 0x0f, 0x4f, 0x1b, 0x4b,
-  0xb0, 0x1a, 0x50, 0x58, 0x40, 0x4d, 0x00, 0x05, 0x06, 0x00, 0x06, 0x05,
-  0x00, 0x80, 0x00, 0x02, 0x01, 0x08, 0x01, 0x02, 0x08, 0x80, 0x00, 0x08,
-  0x09, 0x09, 0x08, 0x70, 0x00, 0x0b, 0x0a, 0x0e, 0x0a, 0x0b, 0x72, 0x11,
-  0x01, 0x07, 0x00, 0x06, 0x05, 0x07, 0x06, 0x67, 0x04, 0x10, 0x02, 0x00,
-  0x03, 0x01, 0x01, 0x02, 0x00, 0x01, 0x68, 0x12, 0x0d, 0x02, 0x09, 0x0c,
-  0x01, 0x0a, 0x0b, 0x09, 0x0a, 0x68, 0x00, 0x0e, 0x0f, 0x0f, 0x0e, 0x57,
-  0x00, 0x0e, 0x0e, 0x0f, 0x5f, 0x13, 0x01, 0x0f, 0x0e, 0x0f, 0x4f, 0x1b,
-  0x40, 0x4f, 0x00, 0x05, 0x06, 0x00, 0x06, 0x05, 0x00, 0x80, 0x00, 0x02,
-  0x01, 0x08, 0x01, 0x02, 0x08, 0x80, 0x00, 0x08, 0x09, 0x01, 0x08, 0x09,
-  0x7e, 0x00, 0x0b, 0x0a, 0x0e, 0x0a, 0x0b, 0x0e, 0x80, 0x11, 0x01, 0x07,
-  0x00, 0x06, 0x05, 0x07, 0x06, 0x67, 0x04, 0x10, 0x02, 0x00, 0x03, 0x01,
-  0x01, 0x02, 0x00, 0x01, 0x68, 0x12, 0x0d, 0x02, 0x09, 0x0c, 0x01, 0x0a,
-  0x0b, 0x09, 0x0a, 0x68, 0x00, 0x0e, 0x0f, 0x0f, 0x0e, 0x57, 0x00, 0x0e,
-  0x0e, 0x0f, 0x5f, 0x13, 0x01, 0x0f, 0x0e, 0x0f, 0x4f, 0x59, 0x59, 0x40,
-  0x33, 0x37, 0x37, 0x1e, 0x1e, 0x19, 0x19, 0x02, 0x00, 0x37, 0x3b, 0x37,
-  0x3b, 0x3a, 0x39, 0x1e, 0x36, 0x1e, 0x34, 0x32, 0x30, 0x2f, 0x2e, 0x2d,
-  0x28, 0x26, 0x22, 0x21, 0x20, 0x19, 0x1d, 0x19, 0x1d, 0x1c, 0x1b, 0x17,
-  0x16, 0x15, 0x10, 0x0e, 0x0a, 0x09, 0x08, 0x07, 0x04, 0x00, 0x18, 0x02,
-  0x18, 0x14, 0x06, 0x16, 0x2b, 0x01, 0x31, 0x33, 0x1d, 0x01, 0x2b, 0x02,
-  0x15, 0x23, 0x35, 0x2b, 0x03, 0x3d, 0x01, 0x3b, 0x04, 0x35, 0x33, 0x15,
-  0x37, 0x31, 0x15, 0x23, 0x35, 0x01, 0x31, 0x35, 0x33, 0x15, 0x3b, 0x03,
-  0x1d, 0x01, 0x2b, 0x04, 0x15, 0x23, 0x35, 0x2b, 0x01, 0x3d, 0x01, 0x3b,
-  0x01, 0x03, 0x31, 0x35, 0x33, 0x15, 0x03, 0x12, 0x66, 0x66, 0x66, 0x67,
-  0x66, 0x66, 0x67, 0x66, 0x66, 0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66,
-  0x66, 0xfe, 0xcd, 0x66, 0x66, 0x67, 0x66, 0x66, 0x66, 0x66, 0x67, 0x66,
-  0x66, 0x67, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x03, 0x32, 0x66, 0x66,
-  0x67, 0x67, 0x66, 0x66, 0x67, 0x67, 0xcd, 0x66, 0x66, 0xfd, 0x9a, 0x66,
-  0x66, 0x66, 0x67, 0x66, 0x66, 0x67, 0x66, 0xfe, 0x67, 0x66, 0x66, 0x00,
-  0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x57, 0x0c, 0x43, 0x06,
-  0x5f, 0x0f, 0x3c, 0xf5, 0x00, 0x0d, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xda, 0x2f, 0xa2, 0xa1, 0x00, 0x00, 0x00, 0x00, 0xda, 0x2f, 0x40, 0x7c,
-  0x00, 0x46, 0xfe, 0xce, 0x05, 0x43, 0x05, 0x27, 0x00, 0x00, 0x00, 0x06,
-  0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
-  0x04, 0x24, 0xff, 0x99, 0x03, 0xa6, 0x05, 0x89, 0x00, 0x46, 0x00, 0x45,
-  0x05, 0x44, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0x05, 0x89, 0x00, 0x46,
-  0x00, 0x8c, 0x00, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x01, 0x56, 0xff, 0xff,
-  0x01, 0x59, 0x00, 0x46, 0x02, 0x8c, 0x00, 0x46, 0x03, 0xbf, 0x00, 0x46,
-  0x03, 0xbf, 0x00, 0x46, 0x03, 0xbe, 0x00, 0x46, 0x03, 0xbf, 0x00, 0x46,
-  0x01, 0x59, 0x00, 0x46, 0x01, 0xbf, 0x00, 0x46, 0x01, 0xbf, 0x00, 0x46,
-  0x03, 0x59, 0x00, 0x46, 0x03, 0xbf, 0x00, 0x46, 0x01, 0x59, 0x00, 0x46,
-  0x03, 0xbf, 0x00, 0x46, 0x01, 0x59, 0x00, 0x46, 0x03, 0xbf, 0x00, 0x46,
-  0x03, 0xbf, 0x00, 0x46, 0x03, 0xbf, 0x00, 0x46, 0x03, 0xbe, 0x00, 0x46,
-  0x03, 0xbe, 0x00, 0x46, 0x03, 0xbf, 0x00, 0x46, 0x03, 0xbf, 0x00, 0x46,
-  0x03, 0xbf, 0x00, 0x46, 0x03, 0xbf, 0x00, 0x46, 0x03, 0xbf, 0x00, 0x46,
-  0x03, 0xbf, 0x00, 0x46, 0x01, 0x59, 0x00, 0x46, 0x01, 0x58, 0x00, 0x46,
-  0x03, 0xbe, 0x00, 0x46, 0x03, 0xbf, 0x00, 0x46, 0x03, 0xbe, 0x00, 0x46,
-  0x03, 0xbe, 0x00, 0x46, 0x03, 0xbf, 0x00, 0x46, 0x03, 0xbf, 0x00, 0x46,
-  0x03, 0xbf, 0x00, 0x46, 0x03, 0xbf, 0x00, 0x46, 0x03, 0xbf, 0x00, 0x46,
-  0x03, 0xbf, 0x00, 0x46, 0x03, 0xbf, 0x00, 0x46, 0x03, 0xbf, 0x00, 0x46,
-  0x03, 0xbe, 0x00, 0x46, 0x03, 0xbf, 0x00, 0x46, 0x03, 0xbf, 0x00, 0x46,
-  0x03, 0xbf, 0x00, 0x46, 0x03, 0xbf, 0x00, 0x46, 0x03, 0xbe, 0x00, 0x46,
-  0x03, 0xbe, 0x00, 0x46, 0x03, 0xbf, 0x00, 0x46, 0x03, 0xbf, 0x00, 0x46,
-  0x04, 0x25, 0x00, 0x46, 0x03, 0xbf, 0x00, 0x46, 0x03, 0xbf, 0x00, 0x46,
-  0x03, 0xbf, 0x00, 0x46, 0x03, 0xbf, 0x00, 0x46, 0x03, 0xbe, 0x00, 0x46,
-  0x03, 0xbe, 0x00, 0x46, 0x03, 0xbf, 0x00, 0x46, 0x03, 0xbf, 0x00, 0x46,
-  0x03, 0xbf, 0x00, 0x46, 0x01, 0xbf, 0x00, 0x46, 0x03, 0xbf, 0x00, 0x46,
-  0x01, 0xbf, 0x00, 0x46, 0x04, 0x8b, 0x00, 0x46, 0x03, 0xbf, 0x00, 0x46,
-  0x01, 0xbf, 0x00, 0x46, 0x03, 0xbf, 0x00, 0x46, 0x03, 0xbf, 0x00, 0x46,
-  0x03, 0xbf, 0x00, 0x46, 0x03, 0xbf, 0x00, 0x46, 0x03, 0xbf, 0x00, 0x46,
-  0x03, 0xbf, 0x00, 0x46, 0x03, 0xbf, 0x00, 0x46, 0x03, 0xbe, 0x00, 0x46,
-  0x03, 0xbf, 0x00, 0x46, 0x03, 0xbf, 0x00, 0x46, 0x03, 0xbf, 0x00, 0x46,
-  0x03, 0xbf, 0x00, 0x46, 0x03, 0xbe, 0x00, 0x46, 0x03, 0xbe, 0x00, 0x46,
-  0x03, 0xbf, 0x00, 0x46, 0x03, 0xbf, 0x00, 0x46, 0x04, 0x25, 0x00, 0x46,
-  0x03, 0xbf, 0x00, 0x46, 0x03, 0xbf, 0x00, 0x46, 0x03, 0xbf, 0x00, 0x46,
-  0x03, 0xbf, 0x00, 0x46, 0x03, 0xbe, 0x00, 0x46, 0x03, 0xbe, 0x00, 0x46,
-  0x03, 0xbf, 0x00, 0x46, 0x03, 0xbf, 0x00, 0x46, 0x03, 0xbf, 0x00, 0x46,
-  0x02, 0x8c, 0x00, 0x46, 0x01, 0x59, 0x00, 0x46, 0x02, 0x8c, 0x00, 0x46,
-  0x03, 0xbf, 0x00, 0x46, 0x03, 0xbe, 0x00, 0x46, 0x03, 0x59, 0x00, 0x46,
-  0x03, 0xbf, 0x00, 0x46, 0x03, 0xbf, 0x00, 0x46, 0x01, 0xbf, 0x00, 0x46,
-  0x03, 0xbf, 0x00, 0x46, 0x03, 0xbf, 0x00, 0x46, 0x01, 0x59, 0x00, 0x46,
-  0x01, 0x59, 0x00, 0x46, 0x01, 0x59, 0x00, 0x46, 0x02, 0x8c, 0x00, 0x46,
-  0x02, 0x8c, 0x00, 0x46, 0x02, 0x8c, 0x00, 0x46, 0x03, 0xbf, 0x00, 0x46,
-  0x03, 0xbf, 0x00, 0x46, 0x03, 0xbf, 0x00, 0x46, 0x03, 0xbf, 0x00, 0x46,
-  0x03, 0xbf, 0x00, 0x46, 0x03, 0xbe, 0x00, 0x46, 0x00, 0x00, 0x01, 0x10,
-  0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x01, 0x44, 0x01, 0x94, 0x01, 0xfa,
-  0x02, 0x72, 0x02, 0xec, 0x03, 0x9e, 0x03, 0xec, 0x04, 0x26, 0x04, 0x60,
-  0x04, 0xe6, 0x05, 0x24, 0x05, 0x56, 0x05, 0x7e, 0x05, 0x98, 0x05, 0xf0,
-  0x06, 0x50, 0x06, 0xc4, 0x07, 0xf0, 0x08, 0x7c, 0x09, 0x6c, 0x0a, 0x10,
-  0x0a, 0x8c, 0x0b, 0xa2, 0x0c, 0x2c, 0x0c, 0xa8, 0x0c, 0xd6, 0x0d, 0x20,
-  0x0d, 0xba, 0x0d, 0xfc, 0x0e, 0x94, 0x0f, 0x48, 0x0f, 0xf8, 0x10, 0x72,
-  0x10, 0xf0, 0x11, 0x58, 0x11, 0xbe, 0x12, 0x40, 0x12, 0xb2, 0x13, 0x2e,
-  0x13, 0x84, 0x14, 0x00, 0x14, 0x5c, 0x15, 0x34, 0x15, 0x80, 0x15, 0xda,
-  0x16, 0x4e, 0x16, 0x9a, 0x16, 0xec, 0x17, 0x4a, 0x18, 0x06, 0x18, 0x9c,
-  0x18, 0xf0, 0x19, 0x34, 0x19, 0x86, 0x19, 0xe0, 0x1a, 0x8a, 0x1a, 0xfc,
-  0x1b, 0xfa, 0x1c, 0x2e, 0x1c, 0x86, 0x1c, 0xba, 0x1d, 0x48, 0x1d, 0x74,
-  0x1d, 0x9e, 0x1e, 0x18, 0x1e, 0x96, 0x1e, 0xfe, 0x1f, 0x64, 0x1f, 0xe6,
-  0x20, 0x58, 0x20, 0xd4, 0x21, 0x2a, 0x21, 0xa6, 0x22, 0x02, 0x22, 0xda,
-  0x23, 0x26, 0x23, 0x80, 0x23, 0xf4, 0x24, 0x40, 0x24, 0x92, 0x24, 0xf0,
-  0x25, 0xac, 0x26, 0x42, 0x26, 0x96, 0x26, 0xda, 0x27, 0x2c, 0x27, 0x86,
-  0x28, 0x30, 0x28, 0xa2, 0x29, 0xa0, 0x29, 0xf8, 0x2a, 0x68, 0x2a, 0xc0,
-  0x2b, 0x12, 0x2b, 0xc6, 0x2c, 0x60, 0x2c, 0x8c, 0x2c, 0xe2, 0x2d, 0x10,
-  0x2d, 0xa4, 0x2d, 0xec, 0x2e, 0x1e, 0x2e, 0x56, 0x2e, 0x88, 0x2e, 0xce,
-  0x2f, 0x1c, 0x2f, 0x62, 0x2f, 0xba, 0x30, 0x18, 0x30, 0x40, 0x31, 0x2a,
-  0x32, 0x14, 0x32, 0xf0, 0x00, 0x01, 0x00, 0x00, 0x00, 0x75, 0x00, 0x67,
-  0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x3a, 0x00, 0x6f,
-  0x00, 0x8d, 0x00, 0x00, 0x00, 0x9c, 0x0e, 0x15, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x0b, 0x00, 0x8a, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-  0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-  0x00, 0x01, 0x00, 0x0e, 0x00, 0x74, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-  0x00, 0x02, 0x00, 0x0e, 0x00, 0x82, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-  0x00, 0x03, 0x00, 0x28, 0x00, 0x90, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-  0x00, 0x04, 0x00, 0x0e, 0x00, 0xb8, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-  0x00, 0x05, 0x00, 0x7a, 0x00, 0xc6, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-  0x00, 0x06, 0x00, 0x0e, 0x01, 0x40, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-  0x00, 0x07, 0x00, 0x18, 0x01, 0x4e, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-  0x00, 0x09, 0x00, 0x18, 0x01, 0x66, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-  0x00, 0x0a, 0x00, 0x80, 0x01, 0x7e, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09,
-  0x00, 0x0c, 0x00, 0x48, 0x01, 0xfe, 0x00, 0x50, 0x00, 0x69, 0x00, 0x78,
-  0x00, 0x65, 0x00, 0x62, 0x00, 0x6f, 0x00, 0x79, 0x00, 0x20, 0x00, 0x54,
-  0x00, 0x79, 0x00, 0x70, 0x00, 0x65, 0x00, 0x66, 0x00, 0x61, 0x00, 0x63,
-  0x00, 0x65, 0x00, 0x20, 0x00, 0xa9, 0x00, 0x20, 0x00, 0x41, 0x00, 0x62,
-  0x00, 0x61, 0x00, 0x73, 0x00, 0x43, 0x00, 0x72, 0x00, 0x65, 0x00, 0x61,
-  0x00, 0x74, 0x00, 0x69, 0x00, 0x76, 0x00, 0x65, 0x00, 0x2e, 0x00, 0x20,
-  0x00, 0x32, 0x00, 0x30, 0x00, 0x31, 0x00, 0x39, 0x00, 0x2e, 0x00, 0x20,
-  0x00, 0x41, 0x00, 0x6c, 0x00, 0x6c, 0x00, 0x20, 0x00, 0x52, 0x00, 0x69,
-  0x00, 0x67, 0x00, 0x68, 0x00, 0x74, 0x00, 0x73, 0x00, 0x20, 0x00, 0x52,
-  0x00, 0x65, 0x00, 0x73, 0x00, 0x65, 0x00, 0x72, 0x00, 0x76, 0x00, 0x65,
-  0x00, 0x64, 0x00, 0x50, 0x00, 0x69, 0x00, 0x78, 0x00, 0x65, 0x00, 0x62,
-  0x00, 0x6f, 0x00, 0x79, 0x00, 0x52, 0x00, 0x65, 0x00, 0x67, 0x00, 0x75,
-  0x00, 0x6c, 0x00, 0x61, 0x00, 0x72, 0x00, 0x50, 0x00, 0x69, 0x00, 0x78,
-  0x00, 0x65, 0x00, 0x62, 0x00, 0x6f, 0x00, 0x79, 0x00, 0x3a, 0x00, 0x56,
-  0x00, 0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x69, 0x00, 0x6f, 0x00, 0x6e,
-  0x00, 0x20, 0x00, 0x31, 0x00, 0x2e, 0x00, 0x30, 0x00, 0x30, 0x00, 0x50,
-  0x00, 0x69, 0x00, 0x78, 0x00, 0x65, 0x00, 0x62, 0x00, 0x6f, 0x00, 0x79,
-  0x00, 0x56, 0x00, 0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x69, 0x00, 0x6f,
-  0x00, 0x6e, 0x00, 0x20, 0x00, 0x31, 0x00, 0x2e, 0x00, 0x30, 0x00, 0x30,
-  0x00, 0x3b, 0x00, 0x44, 0x00, 0x65, 0x00, 0x63, 0x00, 0x65, 0x00, 0x6d,
-  0x00, 0x62, 0x00, 0x65, 0x00, 0x72, 0x00, 0x20, 0x00, 0x33, 0x00, 0x30,
-  0x00, 0x2c, 0x00, 0x20, 0x00, 0x32, 0x00, 0x30, 0x00, 0x31, 0x00, 0x39,
-  0x00, 0x3b, 0x00, 0x46, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x43,
-  0x00, 0x72, 0x00, 0x65, 0x00, 0x61, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x72,
-  0x00, 0x20, 0x00, 0x31, 0x00, 0x31, 0x00, 0x2e, 0x00, 0x35, 0x00, 0x2e,
-  0x00, 0x30, 0x00, 0x2e, 0x00, 0x32, 0x00, 0x34, 0x00, 0x32, 0x00, 0x32,
-  0x00, 0x20, 0x00, 0x36, 0x00, 0x34, 0x00, 0x2d, 0x00, 0x62, 0x00, 0x69,
-  0x00, 0x74, 0x00, 0x50, 0x00, 0x69, 0x00, 0x78, 0x00, 0x65, 0x00, 0x62,
-  0x00, 0x6f, 0x00, 0x79, 0x00, 0x41, 0x00, 0x62, 0x00, 0x61, 0x00, 0x73,
-  0x00, 0x43, 0x00, 0x72, 0x00, 0x65, 0x00, 0x61, 0x00, 0x74, 0x00, 0x69,
-  0x00, 0x76, 0x00, 0x65, 0x00, 0x41, 0x00, 0x62, 0x00, 0x61, 0x00, 0x73,
-  0x00, 0x43, 0x00, 0x72, 0x00, 0x65, 0x00, 0x61, 0x00, 0x74, 0x00, 0x69,
-  0x00, 0x76, 0x00, 0x65, 0x00, 0x54, 0x00, 0x68, 0x00, 0x69, 0x00, 0x73,
-  0x00, 0x20, 0x00, 0x66, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x20,
-  0x00, 0x77, 0x00, 0x61, 0x00, 0x73, 0x00, 0x20, 0x00, 0x63, 0x00, 0x72,
-  0x00, 0x65, 0x00, 0x61, 0x00, 0x74, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20,
-  0x00, 0x75, 0x00, 0x73, 0x00, 0x69, 0x00, 0x6e, 0x00, 0x67, 0x00, 0x20,
-  0x00, 0x46, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x43, 0x00, 0x72,
-  0x00, 0x65, 0x00, 0x61, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x72, 0x00, 0x20,
-  0x00, 0x31, 0x00, 0x31, 0x00, 0x2e, 0x00, 0x35, 0x00, 0x20, 0x00, 0x66,
-  0x00, 0x72, 0x00, 0x6f, 0x00, 0x6d, 0x00, 0x20, 0x00, 0x48, 0x00, 0x69,
-  0x00, 0x67, 0x00, 0x68, 0x00, 0x2d, 0x00, 0x4c, 0x00, 0x6f, 0x00, 0x67,
-  0x00, 0x69, 0x00, 0x63, 0x00, 0x2e, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x6d,
-  0x00, 0x68, 0x00, 0x74, 0x00, 0x74, 0x00, 0x70, 0x00, 0x73, 0x00, 0x3a,
-  0x00, 0x2f, 0x00, 0x2f, 0x00, 0x77, 0x00, 0x77, 0x00, 0x77, 0x00, 0x2e,
-  0x00, 0x62, 0x00, 0x65, 0x00, 0x68, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x63,
-  0x00, 0x65, 0x00, 0x2e, 0x00, 0x6e, 0x00, 0x65, 0x00, 0x74, 0x00, 0x2f,
-  0x00, 0x41, 0x00, 0x62, 0x00, 0x61, 0x00, 0x73, 0x00, 0x63, 0x00, 0x72,
-  0x00, 0x65, 0x00, 0x61, 0x00, 0x74, 0x00, 0x69, 0x00, 0x76, 0x00, 0x65,
-  0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x27, 0x00, 0x96,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0x00, 0x00,
-  0x00, 0x01, 0x00, 0x02, 0x00, 0x03, 0x00, 0x04, 0x00, 0x05, 0x00, 0x06,
-  0x00, 0x07, 0x00, 0x08, 0x00, 0x09, 0x00, 0x0a, 0x00, 0x0b, 0x00, 0x0c,
-  0x00, 0x0d, 0x00, 0x0e, 0x00, 0x0f, 0x00, 0x10, 0x00, 0x11, 0x00, 0x12,
-  0x00, 0x13, 0x00, 0x14, 0x00, 0x15, 0x00, 0x16, 0x00, 0x17, 0x00, 0x18,
-  0x00, 0x19, 0x00, 0x1a, 0x00, 0x1b, 0x00, 0x1c, 0x00, 0x1d, 0x00, 0x1e,
-  0x00, 0x1f, 0x00, 0x20, 0x00, 0x21, 0x00, 0x22, 0x00, 0x23, 0x00, 0x24,
-  0x00, 0x25, 0x00, 0x26, 0x00, 0x27, 0x00, 0x28, 0x00, 0x29, 0x00, 0x2a,
-  0x00, 0x2b, 0x00, 0x2c, 0x00, 0x2d, 0x00, 0x2e, 0x00, 0x2f, 0x00, 0x30,
-  0x00, 0x31, 0x00, 0x32, 0x00, 0x33, 0x00, 0x34, 0x00, 0x35, 0x00, 0x36,
-  0x00, 0x37, 0x00, 0x38, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3c,
-  0x00, 0x3d, 0x00, 0x3e, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x41, 0x00, 0x42,
-  0x00, 0x43, 0x00, 0x44, 0x00, 0x45, 0x00, 0x46, 0x00, 0x47, 0x00, 0x48,
-  0x00, 0x49, 0x00, 0x4a, 0x00, 0x4b, 0x00, 0x4c, 0x00, 0x4d, 0x00, 0x4e,
-  0x00, 0x4f, 0x00, 0x50, 0x00, 0x51, 0x00, 0x52, 0x00, 0x53, 0x00, 0x54,
-  0x00, 0x55, 0x00, 0x56, 0x00, 0x57, 0x00, 0x58, 0x00, 0x59, 0x00, 0x5a,
-  0x00, 0x5b, 0x00, 0x5c, 0x00, 0x5d, 0x00, 0x5e, 0x00, 0x5f, 0x00, 0x60,
-  0x00, 0x61, 0x00, 0x8b, 0x00, 0x8a, 0x00, 0xda, 0x00, 0x93, 0x00, 0x8d,
-  0x00, 0xf0, 0x00, 0xb8, 0x00, 0xb6, 0x00, 0xb7, 0x00, 0xc4, 0x00, 0xb4,
-  0x00, 0xb5, 0x00, 0xc5, 0x00, 0xbc, 0x00, 0x8c, 0x00, 0xef, 0x00, 0x94,
-  0x00, 0x95, 0x00, 0x8f, 0x00, 0x01, 0x00, 0x01, 0xff, 0xff, 0x00, 0x0f,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x00, 0xcc,
-  0x02, 0x66, 0x00, 0x99, 0x00, 0xcd, 0x00, 0xcd, 0x03, 0x33, 0x00, 0xcc,
-  0x03, 0xff, 0xff, 0xff, 0x04, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x03, 0xff, 0xff, 0xff, 0x04, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xb0, 0x00, 0x2c, 0x20, 0xb0, 0x00, 0x55, 0x58, 0x45, 0x59, 0x20, 0x20,
-  0x4b, 0xb8, 0x00, 0x0e, 0x51, 0x4b, 0xb0, 0x06, 0x53, 0x5a, 0x58, 0xb0,
-  0x34, 0x1b, 0xb0, 0x28, 0x59, 0x60, 0x66, 0x20, 0x8a, 0x55, 0x58, 0xb0,
-  0x02, 0x25, 0x61, 0xb9, 0x08, 0x00, 0x08, 0x00, 0x63, 0x63, 0x23, 0x62,
-  0x1b, 0x21, 0x21, 0xb0, 0x00, 0x59, 0xb0, 0x00, 0x43, 0x23, 0x44, 0xb2,
-  0x00, 0x01, 0x00, 0x43, 0x60, 0x42, 0x2d, 0xb0, 0x01, 0x2c, 0xb0, 0x20,
-  0x60, 0x66, 0x2d, 0xb0, 0x02, 0x2c, 0x23, 0x21, 0x23, 0x21, 0x2d, 0xb0,
-  0x03, 0x2c, 0x20, 0x64, 0xb3, 0x03, 0x14, 0x15, 0x00, 0x42, 0x43, 0xb0,
-  0x13, 0x43, 0x20, 0x60, 0x60, 0x42, 0xb1, 0x02, 0x14, 0x43, 0x42, 0xb1,
-  0x25, 0x03, 0x43, 0xb0, 0x02, 0x43, 0x54, 0x78, 0x20, 0xb0, 0x0c, 0x23,
-  0xb0, 0x02, 0x43, 0x43, 0x61, 0x64, 0xb0, 0x04, 0x50, 0x78, 0xb2, 0x02,
-  0x02, 0x02, 0x43, 0x60, 0x42, 0xb0, 0x21, 0x65, 0x1c, 0x21, 0xb0, 0x02,
-  0x43, 0x43, 0xb2, 0x0e, 0x15, 0x01, 0x42, 0x1c, 0x20, 0xb0, 0x02, 0x43,
-  0x23, 0x42, 0xb2, 0x13, 0x01, 0x13, 0x43, 0x60, 0x42, 0x23, 0xb0, 0x00,
-  0x50, 0x58, 0x65, 0x59, 0xb2, 0x16, 0x01, 0x02, 0x43, 0x60, 0x42, 0x2d,
-  0xb0, 0x04, 0x2c, 0xb0, 0x03, 0x2b, 0xb0, 0x15, 0x43, 0x58, 0x23, 0x21,
-  0x23, 0x21, 0xb0, 0x16, 0x43, 0x43, 0x23, 0xb0, 0x00, 0x50, 0x58, 0x65,
-  0x59, 0x1b, 0x20, 0x64, 0x20, 0xb0, 0xc0, 0x50, 0xb0, 0x04, 0x26, 0x5a,
-  0xb2, 0x28, 0x01, 0x0d, 0x43, 0x45, 0x63, 0x45, 0xb0, 0x06, 0x45, 0x58,
-  0x21, 0xb0, 0x03, 0x25, 0x59, 0x52, 0x5b, 0x58, 0x21, 0x23, 0x21, 0x1b,
-  0x8a, 0x58, 0x20, 0xb0, 0x50, 0x50, 0x58, 0x21, 0xb0, 0x40, 0x59, 0x1b,
-  0x20, 0xb0, 0x38, 0x50, 0x58, 0x21, 0xb0, 0x38, 0x59, 0x59, 0x20, 0xb1,
-  0x01, 0x0d, 0x43, 0x45, 0x63, 0x45, 0x61, 0x64, 0xb0, 0x28, 0x50, 0x58,
-  0x21, 0xb1, 0x01, 0x0d, 0x43, 0x45, 0x63, 0x45, 0x20, 0xb0, 0x30, 0x50,
-  0x58, 0x21, 0xb0, 0x30, 0x59, 0x1b, 0x20, 0xb0, 0xc0, 0x50, 0x58, 0x20,
-  0x66, 0x20, 0x8a, 0x8a, 0x61, 0x20, 0xb0, 0x0a, 0x50, 0x58, 0x60, 0x1b,
-  0x20, 0xb0, 0x20, 0x50, 0x58, 0x21, 0xb0, 0x0a, 0x60, 0x1b, 0x20, 0xb0,
-  0x36, 0x50, 0x58, 0x21, 0xb0, 0x36, 0x60, 0x1b, 0x60, 0x59, 0x59, 0x59,
-  0x1b, 0xb0, 0x02, 0x25, 0xb0, 0x0c, 0x43, 0x63, 0xb0, 0x00, 0x52, 0x58,
-  0xb0, 0x00, 0x4b, 0xb0, 0x0a, 0x50, 0x58, 0x21, 0xb0, 0x0c, 0x43, 0x1b,
-  0x4b, 0xb0, 0x1e, 0x50, 0x58, 0x21, 0xb0, 0x1e, 0x4b, 0x61, 0xb8, 0x10,
-  0x00, 0x63, 0xb0, 0x0c, 0x43, 0x63, 0xb8, 0x05, 0x00, 0x62, 0x59, 0x59,
-  0x64, 0x61, 0x59, 0xb0, 0x01, 0x2b, 0x59, 0x59, 0x23, 0xb0, 0x00, 0x50,
-  0x58, 0x65, 0x59, 0x59, 0x20, 0x64, 0xb0, 0x16, 0x43, 0x23, 0x42, 0x59,
-  0x2d, 0xb0, 0x05, 0x2c, 0x20, 0x45, 0x20, 0xb0, 0x04, 0x25, 0x61, 0x64,
-  0x20, 0xb0, 0x07, 0x43, 0x50, 0x58, 0xb0, 0x07, 0x23, 0x42, 0xb0, 0x08,
-  0x23, 0x42, 0x1b, 0x21, 0x21, 0x59, 0xb0, 0x01, 0x60, 0x2d, 0xb0, 0x06,
-  0x2c, 0x23, 0x21, 0x23, 0x21, 0xb0, 0x03, 0x2b, 0x20, 0x64, 0xb1, 0x07,
-  0x62, 0x42, 0x20, 0xb0, 0x08, 0x23, 0x42, 0xb0, 0x06, 0x45, 0x58, 0x1b,
-  0xb1, 0x01, 0x0d, 0x43, 0x45, 0x63, 0xb1, 0x01, 0x0d, 0x43, 0xb0, 0x01,
-  0x60, 0x45, 0x63, 0xb0, 0x05, 0x2a, 0x21, 0x20, 0xb0, 0x08, 0x43, 0x20,
-  0x8a, 0x20, 0x8a, 0xb0, 0x01, 0x2b, 0xb1, 0x30, 0x05, 0x25, 0xb0, 0x04,
-  0x26, 0x51, 0x58, 0x60, 0x50, 0x1b, 0x61, 0x52, 0x59, 0x58, 0x23, 0x59,
-  0x21, 0x59, 0x20, 0xb0, 0x40, 0x53, 0x58, 0xb0, 0x01, 0x2b, 0x1b, 0x21,
-  0xb0, 0x40, 0x59, 0x23, 0xb0, 0x00, 0x50, 0x58, 0x65, 0x59, 0x2d, 0xb0,
-  0x07, 0x2c, 0xb0, 0x09, 0x43, 0x2b, 0xb2, 0x00, 0x02, 0x00, 0x43, 0x60,
-  0x42, 0x2d, 0xb0, 0x08, 0x2c, 0xb0, 0x09, 0x23, 0x42, 0x23, 0x20, 0xb0,
-  0x00, 0x23, 0x42, 0x61, 0xb0, 0x02, 0x62, 0x66, 0xb0, 0x01, 0x63, 0xb0,
-  0x01, 0x60, 0xb0, 0x07, 0x2a, 0x2d, 0xb0, 0x09, 0x2c, 0x20, 0x20, 0x45,
-  0x20, 0xb0, 0x0e, 0x43, 0x63, 0xb8, 0x04, 0x00, 0x62, 0x20, 0xb0, 0x00,
-  0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01, 0x63, 0x60, 0x44,
-  0xb0, 0x01, 0x60, 0x2d, 0xb0, 0x0a, 0x2c, 0xb2, 0x09, 0x0e, 0x00, 0x43,
-  0x45, 0x42, 0x2a, 0x21, 0xb2, 0x00, 0x01, 0x00, 0x43, 0x60, 0x42, 0x2d,
-  0xb0, 0x0b, 0x2c, 0xb0, 0x00, 0x43, 0x23, 0x44, 0xb2, 0x00, 0x01, 0x00,
-  0x43, 0x60, 0x42, 0x2d, 0xb0, 0x0c, 0x2c, 0x20, 0x20, 0x45, 0x20, 0xb0,
-  0x01, 0x2b, 0x23, 0xb0, 0x00, 0x43, 0xb0, 0x04, 0x25, 0x60, 0x20, 0x45,
-  0x8a, 0x23, 0x61, 0x20, 0x64, 0x20, 0xb0, 0x20, 0x50, 0x58, 0x21, 0xb0,
-  0x00, 0x1b, 0xb0, 0x30, 0x50, 0x58, 0xb0, 0x20, 0x1b, 0xb0, 0x40, 0x59,
-  0x59, 0x23, 0xb0, 0x00, 0x50, 0x58, 0x65, 0x59, 0xb0, 0x03, 0x25, 0x23,
-  0x61, 0x44, 0x44, 0xb0, 0x01, 0x60, 0x2d, 0xb0, 0x0d, 0x2c, 0x20, 0x20,
-  0x45, 0x20, 0xb0, 0x01, 0x2b, 0x23, 0xb0, 0x00, 0x43, 0xb0, 0x04, 0x25,
-  0x60, 0x20, 0x45, 0x8a, 0x23, 0x61, 0x20, 0x64, 0xb0, 0x24, 0x50, 0x58,
-  0xb0, 0x00, 0x1b, 0xb0, 0x40, 0x59, 0x23, 0xb0, 0x00, 0x50, 0x58, 0x65,
-  0x59, 0xb0, 0x03, 0x25, 0x23, 0x61, 0x44, 0x44, 0xb0, 0x01, 0x60, 0x2d,
-  0xb0, 0x0e, 0x2c, 0x20, 0xb0, 0x00, 0x23, 0x42, 0xb3, 0x0d, 0x0c, 0x00,
-  0x03, 0x45, 0x50, 0x58, 0x21, 0x1b, 0x23, 0x21, 0x59, 0x2a, 0x21, 0x2d,
-  0xb0, 0x0f, 0x2c, 0xb1, 0x02, 0x02, 0x45, 0xb0, 0x64, 0x61, 0x44, 0x2d,
-  0xb0, 0x10, 0x2c, 0xb0, 0x01, 0x60, 0x20, 0x20, 0xb0, 0x0f, 0x43, 0x4a,
-  0xb0, 0x00, 0x50, 0x58, 0x20, 0xb0, 0x0f, 0x23, 0x42, 0x59, 0xb0, 0x10,
-  0x43, 0x4a, 0xb0, 0x00, 0x52, 0x58, 0x20, 0xb0, 0x10, 0x23, 0x42, 0x59,
-  0x2d, 0xb0, 0x11, 0x2c, 0x20, 0xb0, 0x10, 0x62, 0x66, 0xb0, 0x01, 0x63,
-  0x20, 0xb8, 0x04, 0x00, 0x63, 0x8a, 0x23, 0x61, 0xb0, 0x11, 0x43, 0x60,
-  0x20, 0x8a, 0x60, 0x20, 0xb0, 0x11, 0x23, 0x42, 0x23, 0x2d, 0xb0, 0x12,
-  0x2c, 0x4b, 0x54, 0x58, 0xb1, 0x04, 0x64, 0x44, 0x59, 0x24, 0xb0, 0x0d,
-  0x65, 0x23, 0x78, 0x2d, 0xb0, 0x13, 0x2c, 0x4b, 0x51, 0x58, 0x4b, 0x53,
-  0x58, 0xb1, 0x04, 0x64, 0x44, 0x59, 0x1b, 0x21, 0x59, 0x24, 0xb0, 0x13,
-  0x65, 0x23, 0x78, 0x2d, 0xb0, 0x14, 0x2c, 0xb1, 0x00, 0x12, 0x43, 0x55,
-  0x58, 0xb1, 0x12, 0x12, 0x43, 0xb0, 0x01, 0x61, 0x42, 0xb0, 0x11, 0x2b,
-  0x59, 0xb0, 0x00, 0x43, 0xb0, 0x02, 0x25, 0x42, 0xb1, 0x0f, 0x02, 0x25,
-  0x42, 0xb1, 0x10, 0x02, 0x25, 0x42, 0xb0, 0x01, 0x16, 0x23, 0x20, 0xb0,
-  0x03, 0x25, 0x50, 0x58, 0xb1, 0x01, 0x00, 0x43, 0x60, 0xb0, 0x04, 0x25,
-  0x42, 0x8a, 0x8a, 0x20, 0x8a, 0x23, 0x61, 0xb0, 0x10, 0x2a, 0x21, 0x23,
-  0xb0, 0x01, 0x61, 0x20, 0x8a, 0x23, 0x61, 0xb0, 0x10, 0x2a, 0x21, 0x1b,
-  0xb1, 0x01, 0x00, 0x43, 0x60, 0xb0, 0x02, 0x25, 0x42, 0xb0, 0x02, 0x25,
-  0x61, 0xb0, 0x10, 0x2a, 0x21, 0x59, 0xb0, 0x0f, 0x43, 0x47, 0xb0, 0x10,
-  0x43, 0x47, 0x60, 0xb0, 0x02, 0x62, 0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0,
-  0x40, 0x60, 0x59, 0x66, 0xb0, 0x01, 0x63, 0x20, 0xb0, 0x0e, 0x43, 0x63,
-  0xb8, 0x04, 0x00, 0x62, 0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60,
-  0x59, 0x66, 0xb0, 0x01, 0x63, 0x60, 0xb1, 0x00, 0x00, 0x13, 0x23, 0x44,
-  0xb0, 0x01, 0x43, 0xb0, 0x00, 0x3e, 0xb2, 0x01, 0x01, 0x01, 0x43, 0x60,
-  0x42, 0x2d, 0xb0, 0x15, 0x2c, 0x00, 0xb1, 0x00, 0x02, 0x45, 0x54, 0x58,
-  0xb0, 0x12, 0x23, 0x42, 0x20, 0x45, 0xb0, 0x0e, 0x23, 0x42, 0xb0, 0x0d,
-  0x23, 0xb0, 0x01, 0x60, 0x42, 0x20, 0xb0, 0x14, 0x23, 0x42, 0x20, 0x60,
-  0xb0, 0x01, 0x61, 0xb7, 0x18, 0x18, 0x01, 0x00, 0x11, 0x00, 0x13, 0x00,
-  0x42, 0x42, 0x42, 0x8a, 0x60, 0x20, 0xb0, 0x14, 0x43, 0x60, 0xb0, 0x14,
-  0x23, 0x42, 0xb1, 0x14, 0x08, 0x2b, 0xb0, 0x8b, 0x2b, 0x1b, 0x22, 0x59,
-  0x2d, 0xb0, 0x16, 0x2c, 0xb1, 0x00, 0x15, 0x2b, 0x2d, 0xb0, 0x17, 0x2c,
-  0xb1, 0x01, 0x15, 0x2b, 0x2d, 0xb0, 0x18, 0x2c, 0xb1, 0x02, 0x15, 0x2b,
-  0x2d, 0xb0, 0x19, 0x2c, 0xb1, 0x03, 0x15, 0x2b, 0x2d, 0xb0, 0x1a, 0x2c,
-  0xb1, 0x04, 0x15, 0x2b, 0x2d, 0xb0, 0x1b, 0x2c, 0xb1, 0x05, 0x15, 0x2b,
-  0x2d, 0xb0, 0x1c, 0x2c, 0xb1, 0x06, 0x15, 0x2b, 0x2d, 0xb0, 0x1d, 0x2c,
-  0xb1, 0x07, 0x15, 0x2b, 0x2d, 0xb0, 0x1e, 0x2c, 0xb1, 0x08, 0x15, 0x2b,
-  0x2d, 0xb0, 0x1f, 0x2c, 0xb1, 0x09, 0x15, 0x2b, 0x2d, 0xb0, 0x2b, 0x2c,
-  0x23, 0x20, 0xb0, 0x10, 0x62, 0x66, 0xb0, 0x01, 0x63, 0xb0, 0x06, 0x60,
-  0x4b, 0x54, 0x58, 0x23, 0x20, 0x2e, 0xb0, 0x01, 0x5d, 0x1b, 0x21, 0x21,
-  0x59, 0x2d, 0xb0, 0x2c, 0x2c, 0x23, 0x20, 0xb0, 0x10, 0x62, 0x66, 0xb0,
-  0x01, 0x63, 0xb0, 0x16, 0x60, 0x4b, 0x54, 0x58, 0x23, 0x20, 0x2e, 0xb0,
-  0x01, 0x71, 0x1b, 0x21, 0x21, 0x59, 0x2d, 0xb0, 0x2d, 0x2c, 0x23, 0x20,
-  0xb0, 0x10, 0x62, 0x66, 0xb0, 0x01, 0x63, 0xb0, 0x26, 0x60, 0x4b, 0x54,
-  0x58, 0x23, 0x20, 0x2e, 0xb0, 0x01, 0x72, 0x1b, 0x21, 0x21, 0x59, 0x2d,
-  0xb0, 0x20, 0x2c, 0x00, 0xb0, 0x0f, 0x2b, 0xb1, 0x00, 0x02, 0x45, 0x54,
-  0x58, 0xb0, 0x12, 0x23, 0x42, 0x20, 0x45, 0xb0, 0x0e, 0x23, 0x42, 0xb0,
-  0x0d, 0x23, 0xb0, 0x01, 0x60, 0x42, 0x20, 0x60, 0xb0, 0x01, 0x61, 0xb5,
-  0x18, 0x18, 0x01, 0x00, 0x11, 0x00, 0x42, 0x42, 0x8a, 0x60, 0xb1, 0x14,
-  0x08, 0x2b, 0xb0, 0x8b, 0x2b, 0x1b, 0x22, 0x59, 0x2d, 0xb0, 0x21, 0x2c,
-  0xb1, 0x00, 0x20, 0x2b, 0x2d, 0xb0, 0x22, 0x2c, 0xb1, 0x01, 0x20, 0x2b,
-  0x2d, 0xb0, 0x23, 0x2c, 0xb1, 0x02, 0x20, 0x2b, 0x2d, 0xb0, 0x24, 0x2c,
-  0xb1, 0x03, 0x20, 0x2b, 0x2d, 0xb0, 0x25, 0x2c, 0xb1, 0x04, 0x20, 0x2b,
-  0x2d, 0xb0, 0x26, 0x2c, 0xb1, 0x05, 0x20, 0x2b, 0x2d, 0xb0, 0x27, 0x2c,
-  0xb1, 0x06, 0x20, 0x2b, 0x2d, 0xb0, 0x28, 0x2c, 0xb1, 0x07, 0x20, 0x2b,
-  0x2d, 0xb0, 0x29, 0x2c, 0xb1, 0x08, 0x20, 0x2b, 0x2d, 0xb0, 0x2a, 0x2c,
-  0xb1, 0x09, 0x20, 0x2b, 0x2d, 0xb0, 0x2e, 0x2c, 0x20, 0x3c, 0xb0, 0x01,
-  0x60, 0x2d, 0xb0, 0x2f, 0x2c, 0x20, 0x60, 0xb0, 0x18, 0x60, 0x20, 0x43,
-  0x23, 0xb0, 0x01, 0x60, 0x43, 0xb0, 0x02, 0x25, 0x61, 0xb0, 0x01, 0x60,
-  0xb0, 0x2e, 0x2a, 0x21, 0x2d, 0xb0, 0x30, 0x2c, 0xb0, 0x2f, 0x2b, 0xb0,
-  0x2f, 0x2a, 0x2d, 0xb0, 0x31, 0x2c, 0x20, 0x20, 0x47, 0x20, 0x20, 0xb0,
-  0x0e, 0x43, 0x63, 0xb8, 0x04, 0x00, 0x62, 0x20, 0xb0, 0x00, 0x50, 0x58,
-  0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01, 0x63, 0x60, 0x23, 0x61, 0x38,
-  0x23, 0x20, 0x8a, 0x55, 0x58, 0x20, 0x47, 0x20, 0x20, 0xb0, 0x0e, 0x43,
-  0x63, 0xb8, 0x04, 0x00, 0x62, 0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40,
-  0x60, 0x59, 0x66, 0xb0, 0x01, 0x63, 0x60, 0x23, 0x61, 0x38, 0x1b, 0x21,
-  0x59, 0x2d, 0xb0, 0x32, 0x2c, 0x00, 0xb1, 0x00, 0x02, 0x45, 0x54, 0x58,
-  0xb1, 0x0e, 0x06, 0x45, 0x42, 0xb0, 0x01, 0x16, 0xb0, 0x31, 0x2a, 0xb1,
-  0x05, 0x01, 0x15, 0x45, 0x58, 0x30, 0x59, 0x1b, 0x22, 0x59, 0x2d, 0xb0,
-  0x33, 0x2c, 0x00, 0xb0, 0x0f, 0x2b, 0xb1, 0x00, 0x02, 0x45, 0x54, 0x58,
-  0xb1, 0x0e, 0x06, 0x45, 0x42, 0xb0, 0x01, 0x16, 0xb0, 0x31, 0x2a, 0xb1,
-  0x05, 0x01, 0x15, 0x45, 0x58, 0x30, 0x59, 0x1b, 0x22, 0x59, 0x2d, 0xb0,
-  0x34, 0x2c, 0x20, 0x35, 0xb0, 0x01, 0x60, 0x2d, 0xb0, 0x35, 0x2c, 0x00,
-  0xb1, 0x0e, 0x06, 0x45, 0x42, 0xb0, 0x01, 0x45, 0x63, 0xb8, 0x04, 0x00,
-  0x62, 0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0,
-  0x01, 0x63, 0xb0, 0x01, 0x2b, 0xb0, 0x0e, 0x43, 0x63, 0xb8, 0x04, 0x00,
-  0x62, 0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0,
-  0x01, 0x63, 0xb0, 0x01, 0x2b, 0xb0, 0x00, 0x16, 0xb4, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x44, 0x3e, 0x23, 0x38, 0xb1, 0x34, 0x01, 0x15, 0x2a, 0x21,
-  0x2d, 0xb0, 0x36, 0x2c, 0x20, 0x3c, 0x20, 0x47, 0x20, 0xb0, 0x0e, 0x43,
-  0x63, 0xb8, 0x04, 0x00, 0x62, 0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40,
-  0x60, 0x59, 0x66, 0xb0, 0x01, 0x63, 0x60, 0xb0, 0x00, 0x43, 0x61, 0x38,
-  0x2d, 0xb0, 0x37, 0x2c, 0x2e, 0x17, 0x3c, 0x2d, 0xb0, 0x38, 0x2c, 0x20,
-  0x3c, 0x20, 0x47, 0x20, 0xb0, 0x0e, 0x43, 0x63, 0xb8, 0x04, 0x00, 0x62,
-  0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01,
-  0x63, 0x60, 0xb0, 0x00, 0x43, 0x61, 0xb0, 0x01, 0x43, 0x63, 0x38, 0x2d,
-  0xb0, 0x39, 0x2c, 0xb1, 0x02, 0x00, 0x16, 0x25, 0x20, 0x2e, 0x20, 0x47,
-  0xb0, 0x00, 0x23, 0x42, 0xb0, 0x02, 0x25, 0x49, 0x8a, 0x8a, 0x47, 0x23,
-  0x47, 0x23, 0x61, 0x20, 0x58, 0x62, 0x1b, 0x21, 0x59, 0xb0, 0x01, 0x23,
-  0x42, 0xb2, 0x38, 0x01, 0x01, 0x15, 0x14, 0x2a, 0x2d, 0xb0, 0x3a, 0x2c,
-  0xb0, 0x00, 0x16, 0xb0, 0x17, 0x23, 0x42, 0xb0, 0x04, 0x25, 0xb0, 0x04,
-  0x25, 0x47, 0x23, 0x47, 0x23, 0x61, 0xb1, 0x0c, 0x00, 0x42, 0xb0, 0x0b,
-  0x43, 0x2b, 0x65, 0x8a, 0x2e, 0x23, 0x20, 0x20, 0x3c, 0x8a, 0x38, 0x2d,
-  0xb0, 0x3b, 0x2c, 0xb0, 0x00, 0x16, 0xb0, 0x17, 0x23, 0x42, 0xb0, 0x04,
-  0x25, 0xb0, 0x04, 0x25, 0x20, 0x2e, 0x47, 0x23, 0x47, 0x23, 0x61, 0x20,
-  0xb0, 0x06, 0x23, 0x42, 0xb1, 0x0c, 0x00, 0x42, 0xb0, 0x0b, 0x43, 0x2b,
-  0x20, 0xb0, 0x60, 0x50, 0x58, 0x20, 0xb0, 0x40, 0x51, 0x58, 0xb3, 0x04,
-  0x20, 0x05, 0x20, 0x1b, 0xb3, 0x04, 0x26, 0x05, 0x1a, 0x59, 0x42, 0x42,
-  0x23, 0x20, 0xb0, 0x0a, 0x43, 0x20, 0x8a, 0x23, 0x47, 0x23, 0x47, 0x23,
-  0x61, 0x23, 0x46, 0x60, 0xb0, 0x06, 0x43, 0xb0, 0x02, 0x62, 0x20, 0xb0,
-  0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01, 0x63, 0x60,
-  0x20, 0xb0, 0x01, 0x2b, 0x20, 0x8a, 0x8a, 0x61, 0x20, 0xb0, 0x04, 0x43,
-  0x60, 0x64, 0x23, 0xb0, 0x05, 0x43, 0x61, 0x64, 0x50, 0x58, 0xb0, 0x04,
-  0x43, 0x61, 0x1b, 0xb0, 0x05, 0x43, 0x60, 0x59, 0xb0, 0x03, 0x25, 0xb0,
-  0x02, 0x62, 0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66,
-  0xb0, 0x01, 0x63, 0x61, 0x23, 0x20, 0x20, 0xb0, 0x04, 0x26, 0x23, 0x46,
-  0x61, 0x38, 0x1b, 0x23, 0xb0, 0x0a, 0x43, 0x46, 0xb0, 0x02, 0x25, 0xb0,
-  0x0a, 0x43, 0x47, 0x23, 0x47, 0x23, 0x61, 0x60, 0x20, 0xb0, 0x06, 0x43,
-  0xb0, 0x02, 0x62, 0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59,
-  0x66, 0xb0, 0x01, 0x63, 0x60, 0x23, 0x20, 0xb0, 0x01, 0x2b, 0x23, 0xb0,
-  0x06, 0x43, 0x60, 0xb0, 0x01, 0x2b, 0xb0, 0x05, 0x25, 0x61, 0xb0, 0x05,
-  0x25, 0xb0, 0x02, 0x62, 0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60,
-  0x59, 0x66, 0xb0, 0x01, 0x63, 0xb0, 0x04, 0x26, 0x61, 0x20, 0xb0, 0x04,
-  0x25, 0x60, 0x64, 0x23, 0xb0, 0x03, 0x25, 0x60, 0x64, 0x50, 0x58, 0x21,
-  0x1b, 0x23, 0x21, 0x59, 0x23, 0x20, 0x20, 0xb0, 0x04, 0x26, 0x23, 0x46,
-  0x61, 0x38, 0x59, 0x2d, 0xb0, 0x3c, 0x2c, 0xb0, 0x00, 0x16, 0xb0, 0x17,
-  0x23, 0x42, 0x20, 0x20, 0x20, 0xb0, 0x05, 0x26, 0x20, 0x2e, 0x47, 0x23,
-  0x47, 0x23, 0x61, 0x23, 0x3c, 0x38, 0x2d, 0xb0, 0x3d, 0x2c, 0xb0, 0x00,
-  0x16, 0xb0, 0x17, 0x23, 0x42, 0x20, 0xb0, 0x0a, 0x23, 0x42, 0x20, 0x20,
-  0x20, 0x46, 0x23, 0x47, 0xb0, 0x01, 0x2b, 0x23, 0x61, 0x38, 0x2d, 0xb0,
-  0x3e, 0x2c, 0xb0, 0x00, 0x16, 0xb0, 0x17, 0x23, 0x42, 0xb0, 0x03, 0x25,
-  0xb0, 0x02, 0x25, 0x47, 0x23, 0x47, 0x23, 0x61, 0xb0, 0x00, 0x54, 0x58,
-  0x2e, 0x20, 0x3c, 0x23, 0x21, 0x1b, 0xb0, 0x02, 0x25, 0xb0, 0x02, 0x25,
-  0x47, 0x23, 0x47, 0x23, 0x61, 0x20, 0xb0, 0x05, 0x25, 0xb0, 0x04, 0x25,
-  0x47, 0x23, 0x47, 0x23, 0x61, 0xb0, 0x06, 0x25, 0xb0, 0x05, 0x25, 0x49,
-  0xb0, 0x02, 0x25, 0x61, 0xb9, 0x08, 0x00, 0x08, 0x00, 0x63, 0x63, 0x23,
-  0x20, 0x58, 0x62, 0x1b, 0x21, 0x59, 0x63, 0xb8, 0x04, 0x00, 0x62, 0x20,
-  0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01, 0x63,
-  0x60, 0x23, 0x2e, 0x23, 0x20, 0x20, 0x3c, 0x8a, 0x38, 0x23, 0x21, 0x59,
-  0x2d, 0xb0, 0x3f, 0x2c, 0xb0, 0x00, 0x16, 0xb0, 0x17, 0x23, 0x42, 0x20,
-  0xb0, 0x0a, 0x43, 0x20, 0x2e, 0x47, 0x23, 0x47, 0x23, 0x61, 0x20, 0x60,
-  0xb0, 0x20, 0x60, 0x66, 0xb0, 0x02, 0x62, 0x20, 0xb0, 0x00, 0x50, 0x58,
-  0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01, 0x63, 0x23, 0x20, 0x20, 0x3c,
-  0x8a, 0x38, 0x2d, 0xb0, 0x40, 0x2c, 0x23, 0x20, 0x2e, 0x46, 0xb0, 0x02,
-  0x25, 0x46, 0xb0, 0x17, 0x43, 0x58, 0x50, 0x1b, 0x52, 0x59, 0x58, 0x20,
-  0x3c, 0x59, 0x2e, 0xb1, 0x30, 0x01, 0x14, 0x2b, 0x2d, 0xb0, 0x41, 0x2c,
-  0x23, 0x20, 0x2e, 0x46, 0xb0, 0x02, 0x25, 0x46, 0xb0, 0x17, 0x43, 0x58,
-  0x52, 0x1b, 0x50, 0x59, 0x58, 0x20, 0x3c, 0x59, 0x2e, 0xb1, 0x30, 0x01,
-  0x14, 0x2b, 0x2d, 0xb0, 0x42, 0x2c, 0x23, 0x20, 0x2e, 0x46, 0xb0, 0x02,
-  0x25, 0x46, 0xb0, 0x17, 0x43, 0x58, 0x50, 0x1b, 0x52, 0x59, 0x58, 0x20,
-  0x3c, 0x59, 0x23, 0x20, 0x2e, 0x46, 0xb0, 0x02, 0x25, 0x46, 0xb0, 0x17,
-  0x43, 0x58, 0x52, 0x1b, 0x50, 0x59, 0x58, 0x20, 0x3c, 0x59, 0x2e, 0xb1,
-  0x30, 0x01, 0x14, 0x2b, 0x2d, 0xb0, 0x43, 0x2c, 0xb0, 0x3a, 0x2b, 0x23,
-  0x20, 0x2e, 0x46, 0xb0, 0x02, 0x25, 0x46, 0xb0, 0x17, 0x43, 0x58, 0x50,
-  0x1b, 0x52, 0x59, 0x58, 0x20, 0x3c, 0x59, 0x2e, 0xb1, 0x30, 0x01, 0x14,
-  0x2b, 0x2d, 0xb0, 0x44, 0x2c, 0xb0, 0x3b, 0x2b, 0x8a, 0x20, 0x20, 0x3c,
-  0xb0, 0x06, 0x23, 0x42, 0x8a, 0x38, 0x23, 0x20, 0x2e, 0x46, 0xb0, 0x02,
-  0x25, 0x46, 0xb0, 0x17, 0x43, 0x58, 0x50, 0x1b, 0x52, 0x59, 0x58, 0x20,
-  0x3c, 0x59, 0x2e, 0xb1, 0x30, 0x01, 0x14, 0x2b, 0xb0, 0x06, 0x43, 0x2e,
-  0xb0, 0x30, 0x2b, 0x2d, 0xb0, 0x45, 0x2c, 0xb0, 0x00, 0x16, 0xb0, 0x04,
-  0x25, 0xb0, 0x04, 0x26, 0x20, 0x20, 0x20, 0x46, 0x23, 0x47, 0x61, 0xb0,
-  0x0c, 0x23, 0x42, 0x2e, 0x47, 0x23, 0x47, 0x23, 0x61, 0xb0, 0x0b, 0x43,
-  0x2b, 0x23, 0x20, 0x3c, 0x20, 0x2e, 0x23, 0x38, 0xb1, 0x30, 0x01, 0x14,
-  0x2b, 0x2d, 0xb0, 0x46, 0x2c, 0xb1, 0x0a, 0x04, 0x25, 0x42, 0xb0, 0x00,
-  0x16, 0xb0, 0x04, 0x25, 0xb0, 0x04, 0x25, 0x20, 0x2e, 0x47, 0x23, 0x47,
-  0x23, 0x61, 0x20, 0xb0, 0x06, 0x23, 0x42, 0xb1, 0x0c, 0x00, 0x42, 0xb0,
-  0x0b, 0x43, 0x2b, 0x20, 0xb0, 0x60, 0x50, 0x58, 0x20, 0xb0, 0x40, 0x51,
-  0x58, 0xb3, 0x04, 0x20, 0x05, 0x20, 0x1b, 0xb3, 0x04, 0x26, 0x05, 0x1a,
-  0x59, 0x42, 0x42, 0x23, 0x20, 0x47, 0xb0, 0x06, 0x43, 0xb0, 0x02, 0x62,
-  0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60, 0x59, 0x66, 0xb0, 0x01,
-  0x63, 0x60, 0x20, 0xb0, 0x01, 0x2b, 0x20, 0x8a, 0x8a, 0x61, 0x20, 0xb0,
-  0x04, 0x43, 0x60, 0x64, 0x23, 0xb0, 0x05, 0x43, 0x61, 0x64, 0x50, 0x58,
-  0xb0, 0x04, 0x43, 0x61, 0x1b, 0xb0, 0x05, 0x43, 0x60, 0x59, 0xb0, 0x03,
-  0x25, 0xb0, 0x02, 0x62, 0x20, 0xb0, 0x00, 0x50, 0x58, 0xb0, 0x40, 0x60,
-  0x59, 0x66, 0xb0, 0x01, 0x63, 0x61, 0xb0, 0x02, 0x25, 0x46, 0x61, 0x38,
-  0x23, 0x20, 0x3c, 0x23, 0x38, 0x1b, 0x21, 0x20, 0x20, 0x46, 0x23, 0x47,
-  0xb0, 0x01, 0x2b, 0x23, 0x61, 0x38, 0x21, 0x59, 0xb1, 0x30, 0x01, 0x14,
-  0x2b, 0x2d, 0xb0, 0x47, 0x2c, 0xb1, 0x00, 0x3a, 0x2b, 0x2e, 0xb1, 0x30,
-  0x01, 0x14, 0x2b, 0x2d, 0xb0, 0x48, 0x2c, 0xb1, 0x00, 0x3b, 0x2b, 0x21,
-  0x23, 0x20, 0x20, 0x3c, 0xb0, 0x06, 0x23, 0x42, 0x23, 0x38, 0xb1, 0x30,
-  0x01, 0x14, 0x2b, 0xb0, 0x06, 0x43, 0x2e, 0xb0, 0x30, 0x2b, 0x2d, 0xb0,
-  0x49, 0x2c, 0xb0, 0x00, 0x15, 0x20, 0x47, 0xb0, 0x00, 0x23, 0x42, 0xb2,
-  0x00, 0x01, 0x01, 0x15, 0x14, 0x13, 0x2e, 0xb0, 0x36, 0x2a, 0x2d, 0xb0,
-  0x4a, 0x2c, 0xb0, 0x00, 0x15, 0x20, 0x47, 0xb0, 0x00, 0x23, 0x42, 0xb2,
-  0x00, 0x01, 0x01, 0x15, 0x14, 0x13, 0x2e, 0xb0, 0x36, 0x2a, 0x2d, 0xb0,
-  0x4b, 0x2c, 0xb1, 0x00, 0x01, 0x14, 0x13, 0xb0, 0x37, 0x2a, 0x2d, 0xb0,
-  0x4c, 0x2c, 0xb0, 0x39, 0x2a, 0x2d, 0xb0, 0x4d, 0x2c, 0xb0, 0x00, 0x16,
-  0x45, 0x23, 0x20, 0x2e, 0x20, 0x46, 0x8a, 0x23, 0x61, 0x38, 0xb1, 0x30,
-  0x01, 0x14, 0x2b, 0x2d, 0xb0, 0x4e, 0x2c, 0xb0, 0x0a, 0x23, 0x42, 0xb0,
-  0x4d, 0x2b, 0x2d, 0xb0, 0x4f, 0x2c, 0xb2, 0x00, 0x00, 0x46, 0x2b, 0x2d,
-  0xb0, 0x50, 0x2c, 0xb2, 0x00, 0x01, 0x46, 0x2b, 0x2d, 0xb0, 0x51, 0x2c,
-  0xb2, 0x01, 0x00, 0x46, 0x2b, 0x2d, 0xb0, 0x52, 0x2c, 0xb2, 0x01, 0x01,
-  0x46, 0x2b, 0x2d, 0xb0, 0x53, 0x2c, 0xb2, 0x00, 0x00, 0x47, 0x2b, 0x2d,
-  0xb0, 0x54, 0x2c, 0xb2, 0x00, 0x01, 0x47, 0x2b, 0x2d, 0xb0, 0x55, 0x2c,
-  0xb2, 0x01, 0x00, 0x47, 0x2b, 0x2d, 0xb0, 0x56, 0x2c, 0xb2, 0x01, 0x01,
-  0x47, 0x2b, 0x2d, 0xb0, 0x57, 0x2c, 0xb3, 0x00, 0x00, 0x00, 0x43, 0x2b,
-  0x2d, 0xb0, 0x58, 0x2c, 0xb3, 0x00, 0x01, 0x00, 0x43, 0x2b, 0x2d, 0xb0,
-  0x59, 0x2c, 0xb3, 0x01, 0x00, 0x00, 0x43, 0x2b, 0x2d, 0xb0, 0x5a, 0x2c,
-  0xb3, 0x01, 0x01, 0x00, 0x43, 0x2b, 0x2d, 0xb0, 0x5b, 0x2c, 0xb3, 0x00,
-  0x00, 0x01, 0x43, 0x2b, 0x2d, 0xb0, 0x5c, 0x2c, 0xb3, 0x00, 0x01, 0x01,
-  0x43, 0x2b, 0x2d, 0xb0, 0x5d, 0x2c, 0xb3, 0x01, 0x00, 0x01, 0x43, 0x2b,
-  0x2d, 0xb0, 0x5e, 0x2c, 0xb3, 0x01, 0x01, 0x01, 0x43, 0x2b, 0x2d, 0xb0,
-  0x5f, 0x2c, 0xb2, 0x00, 0x00, 0x45, 0x2b, 0x2d, 0xb0, 0x60, 0x2c, 0xb2,
-  0x00, 0x01, 0x45, 0x2b, 0x2d, 0xb0, 0x61, 0x2c, 0xb2, 0x01, 0x00, 0x45,
-  0x2b, 0x2d, 0xb0, 0x62, 0x2c, 0xb2, 0x01, 0x01, 0x45, 0x2b, 0x2d, 0xb0,
-  0x63, 0x2c, 0xb2, 0x00, 0x00, 0x48, 0x2b, 0x2d, 0xb0, 0x64, 0x2c, 0xb2,
-  0x00, 0x01, 0x48, 0x2b, 0x2d, 0xb0, 0x65, 0x2c, 0xb2, 0x01, 0x00, 0x48,
-  0x2b, 0x2d, 0xb0, 0x66, 0x2c, 0xb2, 0x01, 0x01, 0x48, 0x2b, 0x2d, 0xb0,
-  0x67, 0x2c, 0xb3, 0x00, 0x00, 0x00, 0x44, 0x2b, 0x2d, 0xb0, 0x68, 0x2c,
-  0xb3, 0x00, 0x01, 0x00, 0x44, 0x2b, 0x2d, 0xb0, 0x69, 0x2c, 0xb3, 0x01,
-  0x00, 0x00, 0x44, 0x2b, 0x2d, 0xb0, 0x6a, 0x2c, 0xb3, 0x01, 0x01, 0x00,
-  0x44, 0x2b, 0x2d, 0xb0, 0x6b, 0x2c, 0xb3, 0x00, 0x00, 0x01, 0x44, 0x2b,
-  0x2d, 0xb0, 0x6c, 0x2c, 0xb3, 0x00, 0x01, 0x01, 0x44, 0x2b, 0x2d, 0xb0,
-  0x6d, 0x2c, 0xb3, 0x01, 0x00, 0x01, 0x44, 0x2b, 0x2d, 0xb0, 0x6e, 0x2c,
-  0xb3, 0x01, 0x01, 0x01, 0x44, 0x2b, 0x2d, 0xb0, 0x6f, 0x2c, 0xb1, 0x00,
-  0x3c, 0x2b, 0x2e, 0xb1, 0x30, 0x01, 0x14, 0x2b, 0x2d, 0xb0, 0x70, 0x2c,
-  0xb1, 0x00, 0x3c, 0x2b, 0xb0, 0x40, 0x2b, 0x2d, 0xb0, 0x71, 0x2c, 0xb1,
-  0x00, 0x3c, 0x2b, 0xb0, 0x41, 0x2b, 0x2d, 0xb0, 0x72, 0x2c, 0xb0, 0x00,
-  0x16, 0xb1, 0x00, 0x3c, 0x2b, 0xb0, 0x42, 0x2b, 0x2d, 0xb0, 0x73, 0x2c,
-  0xb1, 0x01, 0x3c, 0x2b, 0xb0, 0x40, 0x2b, 0x2d, 0xb0, 0x74, 0x2c, 0xb1,
-  0x01, 0x3c, 0x2b, 0xb0, 0x41, 0x2b, 0x2d, 0xb0, 0x75, 0x2c, 0xb0, 0x00,
-  0x16, 0xb1, 0x01, 0x3c, 0x2b, 0xb0, 0x42, 0x2b, 0x2d, 0xb0, 0x76, 0x2c,
-  0xb1, 0x00, 0x3d, 0x2b, 0x2e, 0xb1, 0x30, 0x01, 0x14, 0x2b, 0x2d, 0xb0,
-  0x77, 0x2c, 0xb1, 0x00, 0x3d, 0x2b, 0xb0, 0x40, 0x2b, 0x2d, 0xb0, 0x78,
-  0x2c, 0xb1, 0x00, 0x3d, 0x2b, 0xb0, 0x41, 0x2b, 0x2d, 0xb0, 0x79, 0x2c,
-  0xb1, 0x00, 0x3d, 0x2b, 0xb0, 0x42, 0x2b, 0x2d, 0xb0, 0x7a, 0x2c, 0xb1,
-  0x01, 0x3d, 0x2b, 0xb0, 0x40, 0x2b, 0x2d, 0xb0, 0x7b, 0x2c, 0xb1, 0x01,
-  0x3d, 0x2b, 0xb0, 0x41, 0x2b, 0x2d, 0xb0, 0x7c, 0x2c, 0xb1, 0x01, 0x3d,
-  0x2b, 0xb0, 0x42, 0x2b, 0x2d, 0xb0, 0x7d, 0x2c, 0xb1, 0x00, 0x3e, 0x2b,
-  0x2e, 0xb1, 0x30, 0x01, 0x14, 0x2b, 0x2d, 0xb0, 0x7e, 0x2c, 0xb1, 0x00,
-  0x3e, 0x2b, 0xb0, 0x40, 0x2b, 0x2d, 0xb0, 0x7f, 0x2c, 0xb1, 0x00, 0x3e,
-  0x2b, 0xb0, 0x41, 0x2b, 0x2d, 0xb0, 0x80, 0x2c, 0xb1, 0x00, 0x3e, 0x2b,
-  0xb0, 0x42, 0x2b, 0x2d, 0xb0, 0x81, 0x2c, 0xb1, 0x01, 0x3e, 0x2b, 0xb0,
-  0x40, 0x2b, 0x2d, 0xb0, 0x82, 0x2c, 0xb1, 0x01, 0x3e, 0x2b, 0xb0, 0x41,
-  0x2b, 0x2d, 0xb0, 0x83, 0x2c, 0xb1, 0x01, 0x3e, 0x2b, 0xb0, 0x42, 0x2b,
-  0x2d, 0xb0, 0x84, 0x2c, 0xb1, 0x00, 0x3f, 0x2b, 0x2e, 0xb1, 0x30, 0x01,
-  0x14, 0x2b, 0x2d, 0xb0, 0x85, 0x2c, 0xb1, 0x00, 0x3f, 0x2b, 0xb0, 0x40,
-  0x2b, 0x2d, 0xb0, 0x86, 0x2c, 0xb1, 0x00, 0x3f, 0x2b, 0xb0, 0x41, 0x2b,
-  0x2d, 0xb0, 0x87, 0x2c, 0xb1, 0x00, 0x3f, 0x2b, 0xb0, 0x42, 0x2b, 0x2d,
-  0xb0, 0x88, 0x2c, 0xb1, 0x01, 0x3f, 0x2b, 0xb0, 0x40, 0x2b, 0x2d, 0xb0,
-  0x89, 0x2c, 0xb1, 0x01, 0x3f, 0x2b, 0xb0, 0x41, 0x2b, 0x2d, 0xb0, 0x8a,
-  0x2c, 0xb1, 0x01, 0x3f, 0x2b, 0xb0, 0x42, 0x2b, 0x2d, 0xb0, 0x8b, 0x2c,
-  0xb2, 0x0b, 0x00, 0x03, 0x45, 0x50, 0x58, 0xb0, 0x06, 0x1b, 0xb2, 0x04,
-  0x02, 0x03, 0x45, 0x58, 0x23, 0x21, 0x1b, 0x21, 0x59, 0x59, 0x42, 0x2b,
-  0xb0, 0x08, 0x65, 0xb0, 0x03, 0x24, 0x50, 0x78, 0xb1, 0x05, 0x01, 0x15,
-  0x45, 0x58, 0x30, 0x59, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x4b, 0xb8, 0x00,
-  0xc8, 0x52, 0x58, 0xb1, 0x01, 0x01, 0x8e, 0x59, 0xb0, 0x01, 0xb9, 0x08,
-  0x00, 0x08, 0x00, 0x63, 0x70, 0xb1, 0x00, 0x07, 0x42, 0xb2, 0x1b, 0x01,
-  0x00, 0x2a, 0xb1, 0x00, 0x07, 0x42, 0xb3, 0x0e, 0x0a, 0x01, 0x0a, 0x2a,
-  0xb1, 0x00, 0x07, 0x42, 0xb3, 0x18, 0x06, 0x01, 0x0a, 0x2a, 0xb1, 0x00,
-  0x08, 0x42, 0xba, 0x03, 0xc0, 0x00, 0x01, 0x00, 0x0b, 0x2a, 0xb1, 0x00,
-  0x09, 0x42, 0xba, 0x00, 0xc0, 0x00, 0x01, 0x00, 0x0b, 0x2a, 0xb9, 0x00,
-  0x03, 0x00, 0x00, 0x44, 0xb1, 0x24, 0x01, 0x88, 0x51, 0x58, 0xb0, 0x40,
-  0x88, 0x58, 0xb9, 0x00, 0x03, 0x00, 0x64, 0x44, 0xb1, 0x28, 0x01, 0x88,
-  0x51, 0x58, 0xb8, 0x08, 0x00, 0x88, 0x58, 0xb9, 0x00, 0x03, 0x00, 0x00,
-  0x44, 0x59, 0x1b, 0xb1, 0x27, 0x01, 0x88, 0x51, 0x58, 0xba, 0x08, 0x80,
-  0x00, 0x01, 0x04, 0x40, 0x88, 0x63, 0x54, 0x58, 0xb9, 0x00, 0x03, 0x00,
-  0x00, 0x44, 0x59, 0x59, 0x59, 0x59, 0x59, 0xb3, 0x12, 0x06, 0x01, 0x0e,
-  0x2a, 0xb8, 0x01, 0xff, 0x85, 0xb0, 0x04, 0x8d, 0xb1, 0x02, 0x00, 0x44,
-  0xb3, 0x05, 0x64, 0x06, 0x00, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x00, 0x00, 0x00, 0x00
-};
-unsigned int assets_Pixeboy_ttf_len = 33328;
@@ -0,0 +1,30 @@
+#ifndef ADVISOR_H
+#define ADVISOR_H
+
+#include <SDL3/SDL.h>
+
+// Placement hints (Options > Placement Hint). A worker thread looks for a strong
+// placement of the current piece, or of the hold piece, scoring boards with the example
+// bot's heuristic and using the NEXT queue as lookahead; the best one is drawn as a
+// second ghost next to the normal one.
+//
+// Once per drawn gameplay frame the main thread copies the position (row masks, piece,
+// hold and queue) and compares it with the last one it posted. It never waits on the
+// worker: a changed position (a move, a rotation, gravity, a lock or a hold) is handed
+// over under a short lock and bumps a generation counter that the search polls, so a
+// stale search stops within microseconds. The search deepens one piece at a time and
+// publishes every depth it completes. It does not start a deeper pass once a quarter
+// of its time budget is gone and gives up on one that overruns it, so a slow machine
+// just looks fewer pieces ahead.
+//
+// The current piece is rotated where it is (pushed off the walls), slid along its row
+// and dropped; other pieces start where they spawn. Spins and tucks are not searched.
+
+extern bool placementHintEnabled;
+
+void advisorStart();  // start the worker; hints are computed while placementHintEnabled is set
+void advisorStop();   // from close(): stop the worker and log hint timing
+void advisorUpdate(); // each drawn gameplay frame, before the falling piece is stamped on the board
+void renderPlacementHint();
+
+#endif
@@ -0,0 +1,71 @@
+#ifndef ALLOC_CHECK_H
+#define ALLOC_CHECK_H
+
+#include <SDL3/SDL.h>
+
+// Heap allocation tracking, built only with -DTETRIS_ALLOC_CHECK=ON. Global operator
+// new/delete and SDL's allocator are replaced with counting versions; every
+// allocation is charged to the subsystem of the innermost ALLOC_SCOPE on its thread.
+// In normal builds the calls below compile to nothing.
+
+enum class AllocSubsystem : Uint8 {
+    Other,
+    Input,
+    Simulation,
+    Render,
+    Text,    // TTF text re-rendering (score/level labels, menus)
+    Save,
+    History,
+    Audio,   // mixer callback on SDL's audio thread
+    Count
+};
+
+#ifdef TETRIS_ALLOC_CHECK
+
+struct AllocStats {
+    Uint64 count;
+    Uint64 bytes;
+};
+
+class AllocScope {
+    public:
+        explicit AllocScope(AllocSubsystem subsystem);
+        ~AllocScope();
+        AllocScope(const AllocScope&) = delete;
+        AllocScope& operator=(const AllocScope&) = delete;
+    private:
+        AllocSubsystem previous;
+};
+
+#define ALLOC_SCOPE(subsystem) AllocScope allocScope(AllocSubsystem::subsystem)
+
+// Charge this thread's following allocations to `subsystem` (for flat code such as the main loop stages)
+void allocSetSubsystem(AllocSubsystem subsystem);
+
+extern bool allocOverlayVisible; // toggled with F3
+extern bool allocStrictMode;     // --alloc-strict: steady-state gameplay must not allocate
+
+Uint64 heapAllocationCount(); // operator new and SDL allocations since startup, all threads
+
+void allocInstallSdlHooks();              // first thing in main, before SDL allocates anything
+void allocFrameBegin(bool gameplayFrame); // top of every main-loop iteration
+void renderAllocOverlay();                // last frame's counts, drawn over the board
+bool allocReport();                       // log totals on exit; false if strict mode saw an allocation
+
+// Spawn, hold, swap and lock a piece on scratch state and assert none of it allocated.
+// Game state is restored afterwards, so it is safe to call before the first game.
+bool checkPiecePathAllocations();
+
+#else
+
+#define ALLOC_SCOPE(subsystem) ((void)0)
+
+inline void allocSetSubsystem(AllocSubsystem) {}
+inline void allocInstallSdlHooks() {}
+inline void allocFrameBegin(bool) {}
+inline void renderAllocOverlay() {}
+inline bool allocReport() { return true; }
+
+#endif
+
+#endif
@@ -0,0 +1,42 @@
+#ifndef ASSET_REGISTRY_H
+#define ASSET_REGISTRY_H
+
+#include <SDL3/SDL.h>
+
+// Assets are packed at build time by tools/asset_packer.cpp into one binary blob that
+// is linked into the executable. Images are already decoded and resized to the largest
+// size the game draws them at, so no PNG decoding happens at runtime.
+
+enum class AssetKind : Uint8 { Image, Raw };
+
+enum class AssetEncoding : Uint8 {
+    Raw,     // bytes as-is (fonts), or tightly packed RGBA32 pixels for images
+    RleRgba  // run-length encoded RGBA32 pixels, see asset_packer.cpp
+};
+
+struct AssetEntry {
+    const char* name;
+    AssetKind kind;
+    AssetEncoding encoding;
+    int width;          // images only
+    int height;         // images only
+    Uint32 offset;      // into the blob
+    Uint32 size;        // stored bytes
+    Uint32 decodedSize; // bytes after decoding (width * height * 4 for images)
+};
+
+// Defined in the generated tetris_assets.cpp
+extern const AssetEntry kAssetTable[];
+extern const int kAssetCount;
+extern const unsigned char* const kAssetBlob;
+
+// Lookup by name; nullptr if the asset was not packed
+const AssetEntry* findAsset(const char* name);
+
+// Decode an image asset into a new RGBA32 surface (caller destroys it)
+SDL_Surface* createSurfaceFromAsset(const char* name);
+
+// Read-only stream over a raw asset (e.g. for TTF_OpenFontIO)
+SDL_IOStream* openAssetStream(const char* name);
+
+#endif
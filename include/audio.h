@@ -0,0 +1,30 @@
+#ifndef AUDIO_H
+#define AUDIO_H
+
+#include <SDL3/SDL.h>
+
+// Sound effects. Every sample is synthesized to PCM once in initAudio(); after that
+// the game thread only pushes small commands onto a lock-free queue and the audio
+// device's callback does all the mixing. playSound() never allocates, locks or
+// makes a syscall, so it is safe to call from the middle of the simulation.
+
+enum class SoundEffect : Uint8 {
+    Move,
+    Rotate,
+    HardDrop,
+    Lock,
+    LineClear,
+    Tetris,
+    LevelUp,
+    Count
+};
+
+extern bool audioEnabled;     // false with --no-audio
+extern int audioBufferFrames; // device buffer in sample frames, --audio-latency <frames>
+
+bool initAudio();  // after init(); a failure just leaves the game silent
+void closeAudio(); // logs the latency report
+
+void playSound(SoundEffect effect);
+
+#endif
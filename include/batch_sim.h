@@ -0,0 +1,29 @@
+#ifndef BATCH_SIM_H
+#define BATCH_SIM_H
+
+// Batch simulation of many games at once, for comparing randomizers, scoring rules or
+// placement policies over millions of games. No window and no clock: every step places
+// one piece in every lane.
+//
+// A worker thread owns a block of lanes stored structure-of-arrays: the row masks of
+// all lanes for board row y sit next to each other, and so do their current pieces,
+// scores and candidate results. Collision, drop, line-clear and evaluation are written
+// as straight loops over the lanes of a block, with no branches or calls inside, so the
+// compiler turns them into SIMD. Each lane pulls its next game from a shared counter
+// and game g always uses seed + g, so results do not depend on the lane or thread count.
+//
+// The piece shapes, the randomizers and piece queue, the spawn check and the scoring
+// and level rules are the interactive game's own (piece.h, randomizer.h,
+// tetris_utils.h). A placement is a rotation and column dropped straight down from the
+// top; tucks, spins, hold and gravity timing are not modelled. A game ends when the
+// next piece cannot spawn, no placement fits, or after --batch-pieces pieces.
+
+extern int batchGames;            // --batch-sim <games>; 0 = no batch run
+extern int batchLanes;            // --batch-lanes <n>, lanes per thread
+extern int batchThreads;          // --batch-threads <n>; 0 = one per core
+extern int batchPieceLimit;       // --batch-pieces <n>, pieces per game before it is stopped
+extern const char* batchPolicyName; // --batch-policy greedy|random
+extern int batchRandomizer;       // --batch-randomizer <n>; -1 = the one in the settings
+
+int runBatchSim(); // exit code
+#endif
@@ -0,0 +1,38 @@
+#ifndef BOARD_GRID_H
+#define BOARD_GRID_H
+
+#include <SDL3/SDL.h>
+
+// Helpers for the modes that show several boards in one window (local versus, the
+// spectator grid): where each well goes, and the frame timing they log when they exit.
+// The boards fill a near-square grid of equal areas, 1x2 for two boards up to 4x4 for
+// sixteen, each holding its well, a label above it and a column to its right.
+
+struct BoardGridSpacing {
+    int sideCells;     // cells to the right of the well (NEXT, HOLD, meters)
+    float margin;      // around each area, in pixels
+    float labelHeight; // text above the well
+};
+
+struct BoardLayout {
+    float x, y; // top-left of the well
+    float cell;
+};
+
+// Board index of count; the cell size is the largest whole number of pixels that fits
+BoardLayout boardGridLayout(int index, int count, const BoardGridSpacing& spacing);
+
+// Where each frame's time went: stepping the games, preparing what is drawn, drawing
+struct GridFrameStats {
+    Uint64 frames = 0;
+    Uint64 simNs = 0;
+    Uint64 buildNs = 0;
+    Uint64 drawNs = 0;
+    Uint64 worstFrameNs = 0;
+    Uint64 framesOverBudget = 0; // over 1/kScreenFps
+
+    void add(Uint64 frameStart, Uint64 simulated, Uint64 built, Uint64 drawn);
+    void log(const char* mode, int boards) const; // one info line, if any frames ran
+};
+
+#endif
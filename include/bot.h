@@ -0,0 +1,60 @@
+#ifndef BOT_H
+#define BOT_H
+
+#include <SDL3/SDL.h>
+
+// External bot interface. A bot is a separate process that talks to the game over
+// the game's stdin/stdout (--bot-stdio) or a UNIX domain socket it listens on
+// (--bot-socket <path>). For every new piece the game sends the position and the
+// bot answers with a placement or a list of InputActions.
+//
+// Rendered, the game keeps running at its normal frame rate and applies a reply in
+// the frame it arrives. With --headless there is no window: each reply places one
+// piece (a hard drop is added if the bot did not drop), so the game runs exactly as
+// fast as the bot answers. Bot games are never written to the save or leaderboard.
+//
+// Framing: every message is [u8 type][u16 payload length][payload], little-endian.
+// Messages are written in batches (a game over and the next state go out in one
+// write) and either side may put several messages in one write.
+//
+//   game -> bot
+//     Hello     u8 version, u8 board width, u8 board height, u8 queue length, u8 headless
+//     State     u32 seq, u8 piece, u8 rotation, i8 x, i8 y, u8 hold (0xFF none), u8 hold used,
+//               u8 queue[queue length], u32 score, u16 lines, u8 level,
+//               u16 rows[board height] (top row first, bit x set = column x filled)
+//     GameOver  u32 score, u16 lines, u32 pieces
+//   bot -> game (seq echoes the State being answered; stale replies are ignored)
+//     Placement u32 seq, u32 think ns, u8 use hold, u8 rotation, i8 x
+//     Actions   u32 seq, u32 think ns, u8 count, u8 InputAction[count]
+//
+// Pieces, rotations and x are as in piece.h: x is the left column of the rotated
+// bounding box (kPieceShapes). "Think ns" is the time the bot spent deciding (0 if it
+// does not measure it) so the game can report its own round-trip overhead.
+
+enum class BotTransport : Uint8 { None, Stdio, Socket };
+
+enum class BotMessage : Uint8 {
+    Hello = 0x01,
+    State = 0x02,
+    GameOver = 0x03,
+    Placement = 0x10,
+    Actions = 0x11,
+};
+
+constexpr Uint8 kBotProtocolVersion = 1;
+
+extern BotTransport botTransport;
+extern const char* botSocketPath;
+extern bool botHeadless;  // --headless
+extern int botGameLimit;  // --bot-games <n>; headless stops after n games, 0 = until the bot hangs up
+
+bool botOpen();   // connect and send Hello; false leaves the bot inactive
+bool botActive();
+int botGamesPlayed(); // games finished since botOpen()
+void botClose();  // logs round-trip statistics
+
+void botUpdate();   // rendered mode, once per gameplay frame: send the state for a new piece, apply any reply
+void botGameOver(); // queue a GameOver message; the next state goes out with it
+int runHeadlessBot(); // play until the bot hangs up or botGameLimit games; returns the exit code
+
+#endif
@@ -0,0 +1,55 @@
+#ifndef DETERMINISM_H
+#define DETERMINISM_H
+
+#include <SDL3/SDL.h>
+
+// 64-bit hashes of the whole simulation state, and a checker that replays a recorded
+// game and compares the hash of every tick between runs or between builds.
+//
+// The simulation only uses integers: pieces come from the seeded Xoshiro128 in
+// randomizer.h and time is counted in ticks. std::rand, std::mt19937 and float math
+// are only used for particles and menu effects, which no tick reads, so two builds
+// given the same inputs must produce the same hash on every tick. The state is hashed
+// as separate fields so that a mismatch names what went wrong first.
+//
+// --check-determinism <replay> simulates the replay headlessly, hashing the state at
+// the start of every tick. Alone it runs the replay twice in one process; with
+// --hash-against <file> it compares with the stream another run or build wrote with
+// --hash-out <file>. The first divergent tick and the fields that differ are logged
+// and the exit code is 1.
+//
+// Hash stream layout (little-endian):
+//   "THSH" | u16 version | u16 field count | u64 replay seed | u32 first tick |
+//   u32 tick count | u64 field hashes per tick
+
+enum class StateField : Uint8 {
+    Board,      // every cell's color
+    Piece,      // falling piece
+    Hold,       // hold slot and whether it was used this turn
+    Queue,      // next piece and the preview ring
+    Randomizer, // generator state
+    LockDelay,  // landing, lock delay counters, pending lock and I rotation offset
+    Score,      // score, lines, level, pieces and drop speed
+    Timers,     // tick and the last gravity step
+    RowClear,   // the row clear animation
+    Count
+};
+
+constexpr int kStateFieldCount = static_cast<int>(StateField::Count);
+
+struct StateHash {
+    Uint64 fields[kStateFieldCount];
+};
+
+void hashGameState(StateHash& out);
+Uint64 combineStateHash(const StateHash& hash);
+Uint64 gameStateHash(); // the combined hash of the live state
+const char* stateFieldName(StateField field);
+
+extern const char* determinismReplayPath; // --check-determinism <replay>
+extern const char* hashStreamOutPath;     // --hash-out <file>
+extern const char* hashStreamAgainstPath; // --hash-against <file>
+
+int runDeterminismCheck(); // exit code: 0 identical, 1 diverged or failed
+
+#endif
@@ -0,0 +1,29 @@
+#ifndef FINESSE_H
+#define FINESSE_H
+
+#include "tetris_utils.h"
+
+// Finesse trainer: counts the keys pressed for each piece and compares them with the
+// fewest that reach the same placement on an open field.
+//
+// The table is built once at startup by a breadth-first search from the spawn position
+// over taps, DAS to either wall and both rotations, driving the game's own move and
+// rotate functions on an empty board, so wall kicks and the alternating I offsets are
+// the real ones. An entry is [type][I offset at spawn][rotation][column], with rotations
+// that drop the same cells folded together, and holds the move count and the moves.
+//
+// Only key presses from the player count: a DAS charge is one input however many cells
+// it slides, and bot, replay and auto-repeat moves never reach the trainer. A piece that
+// was soft dropped may be a tuck or a spin and is not judged.
+
+constexpr int kFinesseMaxMoves = 8; // longer sequences are not stored
+
+enum class FinesseMove : Uint8 { TapLeft, TapRight, DasLeft, DasRight, RotateCW, RotateCCW };
+
+void finesseInit();                         // before initAudio(), the probe moves would play sounds
+void finesseKeyPressed(InputAction action); // each one-shot action from the player's keys or pad
+void finessePieceLocked();                  // from handlePieceLanded(), before the piece is stamped
+void finesseNewGame();                      // from resetGameplayStateForNewGame()
+void renderFinesseStats();                  // KPP and faults under the HOLD box, once a piece is in
+
+#endif
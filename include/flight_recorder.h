@@ -0,0 +1,24 @@
+#ifndef FLIGHT_RECORDER_H
+#define FLIGHT_RECORDER_H
+
+#include <SDL3/SDL.h>
+
+// Always-on flight recorder. Fixed-size rings keep the live game's recent actions,
+// a replayStateHash() per tick and a keyframe snapshot every 10 seconds, so the last
+// 30-40 seconds can always be written out as a partial replay (see replay.h): the
+// oldest snapshot still covered by the rings, every action since and the per-tick
+// hashes. Load a dump with --replay to step through it; playback warns at the first
+// tick whose state no longer matches the hash recorded in the game.
+//
+// Dumps are written on F6 (flight_dump.trp), on a failed SDL_assert (flight_assert.trp)
+// and on SIGSEGV/SIGBUS/SIGILL/SIGFPE/SIGABRT (flight_crash.trp). Nothing is allocated
+// after flightRecorderInit(), so the crash handler only encodes into reserved memory
+// and writes with the OS file calls.
+
+void flightRecorderInit();          // at startup: reserve the buffers, install the crash and assertion handlers
+void flightGameStarted();           // a new game, or the game was replaced; snapshots again at the next tick end
+void flightRecordAction(Uint8 action); // from applyInputAction
+void flightTickEnded();             // after each live tick (not replay seeks)
+bool flightDump(const char* path = "flight_dump.trp"); // write the recorded window; false if nothing is recorded yet
+
+#endif
@@ -0,0 +1,77 @@
+#ifndef FRAME_ARENA_H
+#define FRAME_ARENA_H
+
+#include <SDL3/SDL.h>
+#include <cstddef>
+#include <new>
+#include <vector>
+
+// Bump allocator for data that only lives until the end of the current frame.
+// Allocation is a pointer bump, freeing is a no-op, and reset() rewinds in O(1).
+// Blocks are never returned to the heap: if a frame overflows the first block the
+// extra block is kept and reused, so after warm-up a session does no heap work here.
+class FrameArena
+{
+    public:
+        static constexpr size_t kDefaultBlockSize = 64 * 1024;
+
+        explicit FrameArena(size_t blockSize = kDefaultBlockSize);
+        ~FrameArena();
+        FrameArena(const FrameArena&) = delete;
+        FrameArena& operator=(const FrameArena&) = delete;
+
+        void* allocate(size_t size, size_t align = alignof(std::max_align_t));
+        void reset();
+
+        size_t used() const { return usedInEarlierBlocks + offset; } // bytes handed out this frame
+        size_t highWater() const { return peak; }                    // most bytes used by any frame
+        size_t blockCount() const { return blocks; }
+
+    private:
+        struct Block {
+            Block* next;
+            size_t size;
+            unsigned char* data() { return reinterpret_cast<unsigned char*>(this + 1); }
+        };
+
+        Block* newBlock(size_t size);
+
+        size_t blockSize;
+        Block* first{ nullptr };
+        Block* current{ nullptr };
+        size_t offset{ 0 };
+        size_t usedInEarlierBlocks{ 0 };
+        size_t peak{ 0 };
+        size_t blocks{ 0 };
+};
+
+// This thread's arena. The main loop resets its own at the top of every iteration;
+// a worker that uses it resets it at the end of each unit of work.
+FrameArena& frameArena();
+
+// STL adaptor so containers can draw from an arena: std::vector<T, ArenaAllocator<T>>
+template <class T>
+struct ArenaAllocator {
+    using value_type = T;
+
+    FrameArena* arena;
+
+    ArenaAllocator() noexcept : arena(&frameArena()) {}
+    explicit ArenaAllocator(FrameArena& a) noexcept : arena(&a) {}
+    template <class U>
+    ArenaAllocator(const ArenaAllocator<U>& other) noexcept : arena(other.arena) {}
+
+    T* allocate(size_t n) { return static_cast<T*>(arena->allocate(n * sizeof(T), alignof(T))); }
+    void deallocate(T*, size_t) noexcept {} // reclaimed by reset()
+
+    template <class U>
+    bool operator==(const ArenaAllocator<U>& other) const noexcept { return arena == other.arena; }
+    template <class U>
+    bool operator!=(const ArenaAllocator<U>& other) const noexcept { return arena != other.arena; }
+};
+
+// Frame-scoped vector; must not outlive the frame it was filled in
+template <class T>
+using FrameVector = std::vector<T, ArenaAllocator<T>>;
+
+#endif
@@ -0,0 +1,53 @@
+#ifndef GAME_HISTORY_H
+#define GAME_HISTORY_H
+
+#include <SDL3/SDL.h>
+
+// One finished game. Stored as-is in the memory-mapped tetris_history.dat, so the
+// layout is fixed: only append fields in place of the reserved bytes.
+struct GameRecord {
+    Uint64 seed;        // piece randomizer seed the game was played with
+    Sint64 finishedAt;  // unix time, seconds
+    Uint32 durationMs;
+    Sint32 score;
+    Sint32 level;       // 1-based, as shown in the HUD
+    Sint32 lines;
+    Uint32 pieces;
+    float pps;          // pieces per second
+    Uint8 mode;         // GameMode
+    Uint8 randomizer;   // RandomizerKind
+    Uint8 reserved[6];
+};
+static_assert(sizeof(GameRecord) == 48, "GameRecord is an on-disk layout");
+
+// Map the history and index files (creating them on first run). The index is
+// rebuilt from the records only if it is missing or out of date.
+bool openGameHistory();
+void closeGameHistory();
+
+// Called when a game starts: resets the per-game counters and picks a new seed
+void beginGameStats();
+
+// Append the game that just ended (from checkGameOver/quitToMenu). Games where no
+// piece was placed are not recorded.
+void recordFinishedGame();
+
+// All queries below read only the index plus the few records they return.
+Uint64 historyGameCount(Uint8 mode);
+
+// Best games for a mode, highest score first; returns how many were written
+int historyTopScores(Uint8 mode, GameRecord* out, int maxCount);
+
+// Fraction (0..1) of recorded games in this mode that scored below `score`
+float historyPercentile(Uint8 mode, int score);
+
+// Score at a given fraction (0..1) of the distribution, e.g. 0.5 for the median
+int historyScoreAtPercentile(Uint8 mode, float fraction);
+
+// Successive personal bests for a mode, oldest first; returns how many were written
+int historyBestTrend(Uint8 mode, GameRecord* out, int maxCount);
+
+// Most recently recorded game, or nullptr
+const GameRecord* historyLastGame();
+
+#endif
@@ -0,0 +1,53 @@
+#ifndef GAME_SNAPSHOT_H
+#define GAME_SNAPSHOT_H
+
+#include "tetris_utils.h"
+#include "randomizer.h"
+#include <type_traits>
+
+// One game's simulation state as a plain value. The game keeps this state in globals;
+// code that runs several games at once (local versus) swaps a game's GameSnapshot in,
+// steps it, and swaps it back out. A swap is two copies of under 2 KB and never
+// allocates. Drawing-only state (particles, the Tetris flash, HUD text) is not part
+// of it.
+struct GameSnapshot {
+    Board board;
+    Piece current;
+    Piece next;
+    Piece hold;
+    int pick;
+    int nextPick;
+    PieceQueue queue;
+
+    bool holdUsed;
+    bool newPiece;
+    bool hardDrop;
+    bool alternateIOffset;
+    bool landed;
+    bool landedOnce;
+    int lockCounter;
+    int lockMoves;
+    int lockRotations;
+
+    int score;
+    int level;
+    int lines;
+    int levelIncrease;
+    int pieces;
+    Uint64 dropSpeed;
+    Uint64 lastDropTime;
+    Uint64 tick;
+
+    bool clearingRows;
+    int clearRowCount;
+    int clearRows[boardHeight];
+    Uint64 clearAnimStart;
+    int clearAnimStep;
+};
+
+static_assert(std::is_trivially_copyable_v<GameSnapshot>, "GameSnapshot must stay a plain value type");
+
+void captureGameSnapshot(GameSnapshot& out);         // globals -> out
+void restoreGameSnapshot(const GameSnapshot& state); // state -> globals
+
+#endif
@@ -38,7 +38,7 @@ void renderUI();
 
 void renderParticles();
 
-int drawPieceIndex();
+extern Uint64 gameSeed;
 
 extern int kScreenWidthStandard;
 extern int kScreenHeightStandard;
@@ -127,9 +127,13 @@ extern std::vector<std::pair<int, int>> wallKickOffsetsIL0;
 extern std::vector<std::pair<int, int>> wallKickOffsetsI0L;
 extern std::vector<std::pair<int, int>> wallKickOffsetsI[8];
 
-enum class GameState { MENU, PLAYING, OPTIONS, PUASE };
+enum class GameState { MENU, PLAYING, OPTIONS, PUASE, LEADERBOARD };
 extern GameState currentState;
 
+// Recorded with each game in the history; only marathon exists so far
+enum class GameMode : Uint8 { Marathon };
+extern GameMode currentGameMode;
+
 // Controller repeat config (ms)
 extern Uint64 kDAS_MS;
 extern Uint64 kARR_MS;
@@ -170,11 +174,15 @@ extern LTexture playTexture;
 extern LTexture optionsTexture;
 extern LTexture backTexture;
 extern LTexture exitTexture;
+extern LTexture scoresTexture;
 
 extern LTexture optionsTitleTexture;
 extern LTexture optionsGridLabel;
 extern LTexture optionsBlockGapLabel;
 extern LTexture optionsPlacementPreviewLabel;
+extern LTexture optionsRandomizerLabel;
+extern LTexture optionsPreviewDepthLabel;
+extern LTexture optionsPlacementHintLabel;
 
 extern LTexture optionsTitleTexture2;
 extern LTexture windowSizeLabel;
@@ -223,6 +231,10 @@ extern int pauseMenuSelection;
 void renderPauseMenu();
 void quitToMenu();
 
+void refreshLeaderboard();
+void renderLeaderboard();
+int handleLeaderboardEvent(const SDL_Event&);
+
 void renderWipeIntro(SDL_Renderer*, int, int);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,19 @@
+#ifndef LATENCY_H
+#define LATENCY_H
+
+#include <SDL3/SDL.h>
+
+// Input-to-photon latency probe, enabled with --latency.
+// Every queued InputAction is stamped with its SDL event timestamp and followed
+// through poll -> apply -> render submit -> SDL_RenderPresent return.
+extern bool latencyModeEnabled;
+
+void latencyInputQueued(Uint64 eventTimestampNs); // an InputAction was queued from an SDL event
+void latencyActionsApplied();                     // the frame's actions have been applied to the simulation
+void renderLatencyMarker();                       // flash marker for photodiode/camera correlation
+void latencyRenderSubmitted();                    // right before SDL_RenderPresent
+void latencyFramePresented();                     // right after SDL_RenderPresent returns
+
+void latencyReport(); // log per-stage percentiles and write latency_samples.csv
+
+#endif
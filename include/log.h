@@ -0,0 +1,59 @@
+#ifndef LOG_H
+#define LOG_H
+
+#include <SDL3/SDL.h>
+
+// Asynchronous, level-gated logging. Callers format into a per-thread lock-free ring
+// and return; a background thread drains the rings and does the actual output, so
+// no log call ever makes a syscall on the game thread.
+//
+// Messages below TETRIS_LOG_LEVEL are removed at compile time (the arguments are not
+// even evaluated). --log-level raises the threshold further at runtime.
+
+enum class LogLevel : Uint8 { Trace, Debug, Info, Warn, Error, Off };
+
+#ifndef TETRIS_LOG_LEVEL
+#ifdef NDEBUG
+#define TETRIS_LOG_LEVEL 2 // Info
+#else
+#define TETRIS_LOG_LEVEL 1 // Debug
+#endif
+#endif
+
+constexpr LogLevel kCompiledLogLevel = static_cast<LogLevel>(TETRIS_LOG_LEVEL);
+
+extern LogLevel logRuntimeLevel;
+
+// Structured fields for gameplay traces; the flusher adds the tick they were logged on
+struct LogFields {
+    int piece;   // index into pieceTypes
+    int fromRot;
+    int toRot;
+    int kick;    // SRS table index, or the nudge for assisted kicks
+    int dx;
+    int dy;
+};
+
+bool parseLogLevel(const char* name, LogLevel& out); // "trace" .. "error", "off"
+
+void logStart();             // start the flusher; before this, logging is synchronous
+void logStop();              // drain everything and stop the flusher (call from close())
+void logSetTick(Uint64 tick); // stamped onto every record from now on
+
+void logMessage(LogLevel level, SDL_PRINTF_FORMAT_STRING const char* fmt, ...) SDL_PRINTF_VARARG_FUNC(2);
+void logEvent(LogLevel level, const char* event, const LogFields& fields);
+
+#define TETRIS_LOG(level, ...) \
+    do { if constexpr (LogLevel::level >= kCompiledLogLevel) logMessage(LogLevel::level, __VA_ARGS__); } while (0)
+
+#define LOG_TRACE(...) TETRIS_LOG(Trace, __VA_ARGS__)
+#define LOG_DEBUG(...) TETRIS_LOG(Debug, __VA_ARGS__)
+#define LOG_INFO(...)  TETRIS_LOG(Info, __VA_ARGS__)
+#define LOG_WARN(...)  TETRIS_LOG(Warn, __VA_ARGS__)
+#define LOG_ERROR(...) TETRIS_LOG(Error, __VA_ARGS__)
+
+// LOG_EVENT(Trace, "rotate.kick", piece, fromRot, toRot, kick, dx, dy)
+#define LOG_EVENT(level, event, ...) \
+    do { if constexpr (LogLevel::level >= kCompiledLogLevel) logEvent(LogLevel::level, event, LogFields{ __VA_ARGS__ }); } while (0)
+
+#endif
@@ -0,0 +1,71 @@
+#ifndef NETPLAY_H
+#define NETPLAY_H
+
+#include "tetris_utils.h"
+
+// Online 1v1 versus over UDP with rollback (--netplay <port> <host:port>). Both sides
+// run the whole match (versus.h) and exchange only button states per tick. A tick is
+// simulated as soon as the local buttons are known, with the peer's buttons predicted
+// to be the ones it held last; when the real ones arrive and differ, the match is put
+// back to the saved state of that tick and the ticks since are simulated again, silently
+// and within the same frame. A side that gets --net-rollback ticks ahead of the last
+// buttons it has from its peer waits for them instead.
+//
+// Saving the state of a tick is one copy of VersusMatch plus the DAS counters (about
+// 6 KB); the last 64 are kept. DAS and ARR run in ticks on both sides, so a held key
+// repeats the same way on both, and every 60 confirmed ticks the sides compare a hash
+// of the match to catch a desync.
+//
+// Every packet carries all the local buttons the peer has not acknowledged yet, so a
+// lost packet costs nothing once the next one arrives. --net-delay, --net-jitter and
+// --net-loss hold back or drop the packets this side sends, to try rollback on
+// localhost; --net-test <ticks> plays random buttons and stops once both sides have
+// confirmed that many ticks, logging the final hash (with --headless, no window).
+// Rollbacks, ticks resimulated and their cost, stalls and packet counts are logged on exit.
+//
+// Packet layout (little-endian): "TNET" | u8 version | u8 type | u64 sender nonce, then
+//   Hello   u16 DAS ticks | u16 ARR ticks | u16 soft drop ARR ticks | u8 randomizer |
+//           u8 heard (0: sent every 250 ms until the peer answers)
+//   Input   u32 ack (the sender has every peer tick before this) | u32 first tick |
+//           u8 count | u8 buttons[count] | u32 hash tick | u64 match hash
+//   Bye
+// The match seed is the two nonces xored; the side with the lower nonce plays board 1.
+// POSIX only, like the bot socket.
+
+enum NetButton : Uint8 {
+    kNetLeft = 1 << 0,
+    kNetRight = 1 << 1,
+    kNetSoftDrop = 1 << 2,
+    kNetHardDrop = 1 << 3,
+    kNetRotateCW = 1 << 4,
+    kNetRotateCCW = 1 << 5,
+    kNetHold = 1 << 6,
+};
+
+enum class NetStatus : Uint8 {
+    Connecting,   // waiting for the peer's Hello
+    Running,      // a tick was simulated this frame
+    Stalled,      // too far ahead of the peer's buttons; nothing simulated
+    Finished,     // the match (or the --net-test run) is over on both sides
+    Disconnected, // the peer said Bye or went quiet
+};
+
+extern int netplayPort;          // --netplay <port> <host:port>: the local UDP port
+extern const char* netplayPeer;  // host:port of the other side
+extern int netDelayMs;           // --net-delay <ms>
+extern int netJitterMs;          // --net-jitter <ms>, added at random on top of the delay
+extern int netLossPercent;       // --net-loss <percent>
+extern int netRollbackLimit;     // --net-rollback <ticks>, at most 30
+extern int netTestTicks;         // --net-test <ticks>; 0 = a real match
+
+bool netplayEnabled();
+bool netplayOpen();              // bind and resolve the peer; false on failure
+NetStatus netplayFrame(Uint8 localButtons); // once per frame: receive, roll back if needed, send, step
+int netplayLocalBoard();         // once connected
+bool netplayResimulating();      // replaying ticks after a misprediction: no sounds
+void netplayStatusText(char* out, size_t size);
+bool netplayClose();             // says Bye and logs statistics; false if the sides desynced
+
+Uint8 netButtonFor(InputAction action); // the button an input action comes from, or 0
+
+#endif
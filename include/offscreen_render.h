@@ -0,0 +1,23 @@
+#ifndef OFFSCREEN_RENDER_H
+#define OFFSCREEN_RENDER_H
+
+#include <SDL3/SDL.h>
+
+// Offscreen rendering for highlight clips. A recorded game (--render-replay) or a bot
+// (--bot-stdio / --bot-socket) is played through the normal gameplay frame and drawing
+// code into a surface owned by the SDL software renderer, so no window or display is
+// needed. Every gameplay frame is read back with SDL_RenderReadPixels and handed to
+// encoder threads that write either frame_NNNNNN.png files into a directory or a single
+// raw Y4M video (4:2:0, 60 fps) when the output path ends in .y4m. Frames are produced
+// as fast as the renderer and encoders allow, not at the game's frame rate.
+
+extern const char* renderOutPath;    // --render-out <dir|file.y4m>
+extern const char* renderReplayPath; // --render-replay <file.trp>
+extern int renderFrameLimit;         // --render-frames <n>; 0 = the whole replay, or until the bot's games end
+
+bool offscreenRenderActive();  // frames are being captured; skips frame pacing and delays
+void offscreenCaptureFrame();  // queue the frame just drawn for encoding; no-op unless active
+int runOffscreenRender();      // instead of init(); returns the exit code
+void closeOffscreenRender();   // after the renderer is destroyed: frees its target surface
+
+#endif
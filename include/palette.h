@@ -0,0 +1,30 @@
+#ifndef PALETTE_H
+#define PALETTE_H
+
+#include <SDL3/SDL.h>
+
+// Block colors by board cell value, which is the piece type + 1 (piece.h); 0 and any
+// other value (versus garbage) are grey. Shared by the single-player board, its ghost
+// piece, local versus and the spectator grid, so a piece looks the same in every mode.
+inline constexpr SDL_Color kPalette[8] = {
+    {127, 127, 127, 255}, // grey: empty, garbage
+    {0, 255, 255, 255},   // cyan: I
+    {255, 255, 0, 255},   // yellow: O
+    {128, 0, 128, 255},   // purple: T
+    {255, 0, 0, 255},     // red: L
+    {0, 0, 255, 255},     // blue: J
+    {0, 255, 0, 255},     // green: S
+    {255, 0, 0, 255},     // red: Z
+};
+
+constexpr float kLockedShade = 0.7f; // locked blocks are drawn darker than the falling piece
+
+constexpr int paletteIndex(int val) { return val >= 1 && val <= 7 ? val : 0; }
+
+constexpr SDL_Color colorFromValue(int val) { return kPalette[paletteIndex(val)]; }
+
+constexpr SDL_Color shadedColor(SDL_Color c, float shade) {
+    return { static_cast<Uint8>(c.r * shade), static_cast<Uint8>(c.g * shade), static_cast<Uint8>(c.b * shade), c.a };
+}
+
+#endif
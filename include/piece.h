@@ -2,19 +2,91 @@
 #define PIECE_H
 
 #include "board.h"
-#include <vector>
+#include <type_traits>
 
+// Cells of a piece packed into a 4x4 grid, bit (sy * 4 + sx)
+struct PieceShape {
+    Uint16 mask;
+    Uint8 width;
+    Uint8 height;
+};
+
+constexpr int kPieceTypeCount = 7; // I O T L J S Z, same order as pieceTypes
+
+// Spawn-state shapes; colors are type + 1
+constexpr PieceShape kSpawnShapes[kPieceTypeCount] = {
+    { 0x000F, 4, 1 }, // I: 1111
+    { 0x0033, 2, 2 }, // O: 11 / 11
+    { 0x0072, 3, 2 }, // T: 010 / 111
+    { 0x0074, 3, 2 }, // L: 001 / 111
+    { 0x0071, 3, 2 }, // J: 100 / 111
+    { 0x0036, 3, 2 }, // S: 011 / 110
+    { 0x0063, 3, 2 }, // Z: 110 / 011
+};
+
+// Quarter turn clockwise of the bounding box (row sx of the result is column sx of the source, read bottom-up)
+constexpr PieceShape rotateShapeClockwise(PieceShape s) {
+    PieceShape r{ 0, s.height, s.width };
+    for (int sy = 0; sy < s.height; ++sy) {
+        for (int sx = 0; sx < s.width; ++sx) {
+            if (s.mask & (1u << (sy * 4 + sx))) {
+                r.mask = static_cast<Uint16>(r.mask | (1u << (sx * 4 + (s.height - 1 - sy))));
+            }
+        }
+    }
+    return r;
+}
+
+struct PieceShapeTable {
+    PieceShape shapes[kPieceTypeCount][4]; // [type][rotation]
+};
+
+constexpr PieceShapeTable buildPieceShapeTable() {
+    PieceShapeTable t{};
+    for (int type = 0; type < kPieceTypeCount; ++type) {
+        t.shapes[type][0] = kSpawnShapes[type];
+        for (int rot = 1; rot < 4; ++rot) t.shapes[type][rot] = rotateShapeClockwise(t.shapes[type][rot - 1]);
+    }
+    return t;
+}
+
+inline constexpr PieceShapeTable kPieceShapes = buildPieceShapeTable();
+
+// Plain value type: copying, swapping or storing a piece never touches the heap
 class Piece
 {
     public:
         // Piece properties
+        int type{ -1 }; // Index into pieceTypes, -1 for an empty slot (e.g. nothing held yet)
+        int rotation{ 0 }; // Current rotation state of the piece
         int width{ 0 }; // Width of the piece in blocks
         int height{ 0 }; // Height of the piece in blocks
-        std::vector<std::vector<int>> shape; // 2D vector representing the piece shape
-        int rotation{ 0 }; // Current rotation state of the piece
-        int color; // Color for each block in the piece
+        Uint16 mask{ 0 }; // Occupied cells for this rotation, see PieceShape
+        int color{ 0 }; // Color for each block in the piece
         int x{ boardWidth / 2 }; // X position on the board
         int y{ 0 }; // Y position on the board
+
+        constexpr bool cell(int sx, int sy) const { return (mask >> (sy * 4 + sx)) & 1u; }
+        constexpr bool isEmpty() const { return mask == 0; }
 };
 
-#endif
\ No newline at end of file
+static_assert(std::is_trivially_copyable_v<Piece>, "Piece must stay a plain value type");
+
+// Switch a piece to another rotation state; the cells come from the static table
+constexpr void setPieceRotation(Piece& piece, int rotation) {
+    const PieceShape& s = kPieceShapes.shapes[piece.type][rotation];
+    piece.rotation = rotation;
+    piece.width = s.width;
+    piece.height = s.height;
+    piece.mask = s.mask;
+}
+
+constexpr Piece makePiece(int type) {
+    Piece piece{};
+    piece.type = type;
+    piece.color = type + 1;
+    setPieceRotation(piece, 0);
+    return piece;
+}
+
+#endif
@@ -0,0 +1,66 @@
+#ifndef POSITION_H
+#define POSITION_H
+
+#include "board.h"
+#include "randomizer.h"
+#include <SDL3/SDL.h>
+#include <vector>
+
+// A complete game position as one line of text, for reproducing rendering, line
+// clear and kick bugs without playing up to them. Fields are separated by spaces:
+//
+//   <rows> <piece> <hold> <queue> <level> <score> <lines> <lock>
+//
+//   rows   boardHeight rows, top first, separated by '/'. A letter is a filled cell
+//          (IOTLJSZ in the piece's color, G grey), a number is that many empty cells
+//          ('.' is also read as one empty cell).
+//   piece  type letter, rotation 0-3, '@', x ',' y (left/top of the rotated box): T0@6,0
+//   hold   a type letter or '-' for none, with '*' appended if hold was used this piece
+//   queue  the next pieces, up to kMaxPreview letters; '-' keeps the generated queue
+//   level  as shown in the HUD (1-based)
+//   lock   counter,moves used,rotations used,flags; flags are any of l (landed),
+//          o (landed once), a (alternate I offset) or '-' for none
+//
+// Files hold one position per line; blank lines and lines starting with '#' are skipped.
+
+struct Position {
+    Uint8 cells[boardWidth][boardHeight]; // board colors: 0 empty, type + 1, 8 grey
+    int piece;
+    int rotation;
+    int x;
+    int y;
+    int hold;          // -1 = empty
+    bool holdUsed;
+    Uint8 queue[kMaxPreview];
+    int queueLength;   // 0 = keep the generated queue
+    int level;         // 0-based, like levelValue
+    int score;
+    int lines;
+    int lockDelayCounter;
+    int lockDelayMovesUsed;
+    int lockDelayRotationsUsed;
+    bool pieceLanded;
+    bool pieceLandedOnce;
+    bool alternateIOffset;
+};
+
+constexpr size_t kMaxPositionText = 512; // longest formatPosition() output plus the terminator
+
+// Parse one position; on failure returns false and points *error at a static description
+bool parsePosition(const char* text, size_t length, Position& out, const char** error = nullptr);
+// Writes a terminated line into out and returns its length (0 if capacity < kMaxPositionText)
+size_t formatPosition(const Position& position, char* out, size_t capacity);
+
+bool loadPositionFile(const char* path, std::vector<Position>& out);
+
+void captureLivePosition(Position& out); // the game in progress, between frames
+void applyLivePosition(const Position& position); // replaces the game in progress; the game is no longer replayable
+void dumpLivePosition(); // debug key: log the live position and append it to positions_dump.txt
+
+// --position <file> [--position-index <n>]: every new game starts from that position
+extern const char* startPositionPath;
+extern int startPositionIndex;
+bool loadStartPosition(); // after the flags are read
+void applyStartPosition(); // from resetGameplayStateForNewGame(); no-op without --position
+
+#endif
@@ -0,0 +1,61 @@
+#ifndef RANDOMIZER_H
+#define RANDOMIZER_H
+
+#include <SDL3/SDL.h>
+
+// Piece generation. Everything here is plain data so a whole generator (or the
+// preview queue built on it) can be copied, stored in a replay, or forked by a
+// search without touching any globals.
+
+enum class RandomizerKind : Uint8 {
+    Bag7,       // each piece once per 7
+    Bag14,      // each piece twice per 14
+    TgmHistory, // TGM2-style: reroll up to 6 times against the last 4 pieces
+    Memoryless, // uniform, independent draws
+    Count
+};
+
+const char* randomizerName(RandomizerKind kind);
+
+// xoshiro128**: 16 bytes of state, a few cycles per draw
+struct Xoshiro128 {
+    Uint32 s[4];
+};
+
+void xoshiroSeed(Xoshiro128& rng, Uint64 seed);
+Uint32 xoshiroNext(Xoshiro128& rng);
+int xoshiroBelow(Xoshiro128& rng, int bound); // uniform in [0, bound)
+
+struct RandomizerState {
+    Xoshiro128 rng;
+    RandomizerKind kind;
+    Uint8 bagIndex;   // next unread slot in bag
+    Uint8 bag[14];    // Bag7 uses the first 7
+    Uint8 history[4]; // TgmHistory, most recent first
+    Uint8 firstDraw;  // TgmHistory: first piece is never S, Z or O
+};
+
+void randomizerInit(RandomizerState& state, RandomizerKind kind, Uint64 seed);
+int randomizerNext(RandomizerState& state); // index into pieceTypes (I O T L J S Z)
+
+// Upcoming pieces. The ring is always kept kMaxPreview deep no matter how many the
+// HUD shows, so the piece sequence for a seed never depends on the preview setting.
+constexpr int kMaxPreview = 6;
+
+struct PieceQueue {
+    RandomizerState gen;
+    Uint8 ring[kMaxPreview];
+    Uint8 head;  // slot of the next piece
+};
+
+void pieceQueueInit(PieceQueue& queue, RandomizerKind kind, Uint64 seed);
+int pieceQueuePop(PieceQueue& queue);
+int pieceQueuePeek(const PieceQueue& queue, int i); // i in [0, kMaxPreview)
+
+// Player settings and the --seed override
+extern RandomizerKind randomizerKind;
+extern int previewDepth; // 1..kMaxPreview pieces shown in the NEXT panel
+extern bool fixedSeedEnabled;
+extern Uint64 fixedSeed;
+
+#endif
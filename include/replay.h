@@ -0,0 +1,91 @@
+#ifndef REPLAY_H
+#define REPLAY_H
+
+#include <SDL3/SDL.h>
+#include <vector>
+
+// Game replays. The simulation is stepped once per gameplay frame (gameTick) and only
+// changes through applyInputAction(), so a replay is just the randomizer seed plus
+// every action with the tick it was applied on. Each finished game is written to
+// last_game.trp.
+//
+// While recording, keyframes (compact snapshots of the board, pieces, randomizer,
+// score and timers) are added once enough events have been written since the last
+// one that they stay around 3% of the file, and at least every kKeyframeMaxTicks.
+// Seeking restores the nearest keyframe and re-simulates silently from there, so any
+// tick of an hour-long game is only a short re-simulation away.
+//
+// File layout (little-endian):
+//   "TRPL" | u16 version | u8 randomizer | u8 flags | u64 seed | u32 ticks |
+//   u32 event count | i32 max level | u32 keyframe count | u32 event bytes | events |
+//   keyframes | tick hashes (kReplayHasHashes only)
+// Each event is a LEB128 tick delta from the previous event followed by a u8 InputAction.
+// Each keyframe is u32 tick | u32 index of its first event | u16 size | snapshot.
+// Tick hashes are u32 first tick | u32 count | u32 replayStateHash() per tick.
+// Version 1 files (a reserved u32 instead of the keyframe fields) still load and
+// seek from tick 0.
+
+struct ReplayEvent {
+    Uint32 tick;
+    Uint8 action; // InputAction
+};
+
+struct ReplayKeyframe {
+    Uint32 tick;
+    Uint32 eventIndex; // first event on or after tick
+    Uint32 offset;     // into Replay::keyframeData
+    Uint16 size;
+};
+
+enum ReplayFlags : Uint8 {
+    kReplayPartial = 1 << 0,   // starts at its first keyframe instead of tick 0 (flight recorder dumps)
+    kReplayHasHashes = 1 << 1, // a tick hash section follows the keyframes
+};
+
+struct Replay {
+    Uint64 seed = 0;
+    Uint8 randomizer = 0; // RandomizerKind
+    Uint8 flags = 0;      // ReplayFlags
+    Uint32 ticks = 0;     // tick the game ended on
+    int maxLevel = 0;     // level select limit the game was played with
+    Uint32 startTick = 0; // first keyframe's tick for partial replays, otherwise 0
+    std::vector<ReplayEvent> events;
+    std::vector<ReplayKeyframe> keyframes;
+    std::vector<Uint8> keyframeData;
+    Uint32 hashStartTick = 0;
+    std::vector<Uint32> tickHashes; // recorded state hashes; playback warns at the first mismatch
+};
+
+constexpr Uint32 kKeyframeMinTicks = 600;   // 10 s
+constexpr Uint32 kKeyframeMaxTicks = 36000; // 10 min, the longest a seek re-simulates
+
+// Recording, driven by the gameplay code
+void replayBeginRecording();              // a game has just been reset (gameTick == 0)
+void replayRecordAction(Uint8 action);    // from applyInputAction, stamped with gameTick
+void replayTickEnded();                   // after each simulated tick; may add a keyframe
+void replayFinishRecording(Uint32 ticks); // the game ended; writes last_game.trp
+void replayDiscardRecording();            // the game was changed outside applyInputAction()
+
+bool saveReplay(const char* path, const Replay& replay);
+bool loadReplay(const char* path, Replay& replay);
+// The file image of a replay; clears out and does not allocate if it has the capacity
+void encodeReplay(const Replay& replay, std::vector<Uint8>& out);
+
+// Append a keyframe snapshot of the live game to out (between ticks, not while rows clear)
+void replayCaptureSnapshot(std::vector<Uint8>& out);
+// Board, falling piece and randomizer state, for spotting where a replay stops matching
+Uint32 replayStateHash();
+
+// Apply a replay's settings (seed, randomizer, level limit) and stop recording, so
+// the next resetGameplayStateForNewGame() starts the recorded game
+void replayBeginPlayback(const Replay& replay);
+bool replayPlaybackActive(); // a recorded game is being replayed; its game over is not saved
+
+// Playback of a loaded replay, tick by tick
+bool replayOpenPlayback(const char* path); // load, replayBeginPlayback() and reset to startTick
+const Replay& playbackReplay();
+void replayApplyTickEvents();              // the recorded actions for the current gameTick
+void replaySeek(Uint32 tick);              // nearest keyframe at or before tick, then silent ticks up to it
+bool replaySeeking();                      // during those silent ticks: no sounds, particles or text renders
+
+#endif
@@ -0,0 +1,21 @@
+#ifndef REPLAY_VIEWER_H
+#define REPLAY_VIEWER_H
+
+#include <SDL3/SDL.h>
+
+// Interactive replay viewer (--replay <file.trp>). Plays a recorded game in the window
+// with a timeline along the bottom of the screen:
+//   Space        pause / resume
+//   Left/Right   step one frame back / forward (pauses)
+//   Shift+Left/Right, PageUp/PageDown   5 seconds back / forward
+//   Home/End     first / last frame
+//   click or drag the timeline to scrub; Escape quits
+// Every jump goes through replaySeek(), so stepping backwards costs one keyframe
+// restore plus a silent re-simulation rather than a replay from the start.
+
+extern const char* replayViewerPath; // --replay <file.trp>
+
+int runReplayViewer();       // after init() and loadMedia(); returns the exit code
+void renderReplayTimeline(); // from presentGameplayFrame(); no-op unless the viewer runs
+
+#endif
@@ -0,0 +1,92 @@
+#ifndef ROW_BOARD_H
+#define ROW_BOARD_H
+
+#include "piece.h"
+
+// The board as one bit mask per row (row 0 at the top, bit x = column x), for code
+// that searches many placements: the batch simulator, the placement advisor and the
+// spectator grid's bots.
+
+constexpr Uint16 kFullRow = static_cast<Uint16>((1u << boardWidth) - 1);
+
+// kPieceShapes as one mask per shape row
+struct RowShape {
+    Uint16 rows[4];
+    int width;
+    int height;
+};
+
+struct RowShapeTable {
+    RowShape shapes[kPieceTypeCount][4]; // [type][rotation]
+};
+
+constexpr RowShapeTable buildRowShapes() {
+    RowShapeTable t{};
+    for (int type = 0; type < kPieceTypeCount; ++type) {
+        for (int rot = 0; rot < 4; ++rot) {
+            const PieceShape& s = kPieceShapes.shapes[type][rot];
+            RowShape& r = t.shapes[type][rot];
+            for (int sy = 0; sy < 4; ++sy) r.rows[sy] = static_cast<Uint16>((s.mask >> (sy * 4)) & 0xF);
+            r.width = s.width;
+            r.height = s.height;
+        }
+    }
+    return t;
+}
+
+inline constexpr RowShapeTable kRowShapes = buildRowShapes();
+
+// Rotations with different cells; the rest repeat one of them when dropped from above
+constexpr int kDistinctRotations[kPieceTypeCount] = { 2, 1, 4, 4, 4, 2, 2 };
+
+// example_bot's heuristic in hundredths; lower cost is better
+constexpr int kAggregateWeight = 51;
+constexpr int kHolesWeight = 36;
+constexpr int kBumpinessWeight = 18;
+constexpr int kLinesWeight = 76;
+
+// Shifts and adds rather than a builtin, so loops over many boards still vectorize
+constexpr int popcount16(Uint32 v) {
+    v = v - ((v >> 1) & 0x5555);
+    v = (v & 0x3333) + ((v >> 2) & 0x3333);
+    v = (v + (v >> 4)) & 0x0F0F;
+    return static_cast<int>((v + (v >> 8)) & 0x1F);
+}
+
+inline bool rowShapeFits(const Uint16* rows, const RowShape& s, int x, int y) {
+    if (x < 0 || x + s.width > boardWidth || y < 0 || y + s.height > boardHeight) return false;
+    for (int sy = 0; sy < s.height; ++sy) {
+        if (rows[y + sy] & (s.rows[sy] << x)) return false;
+    }
+    return true;
+}
+
+// Stamp a shape and remove the rows it fills; returns how many
+inline int lockRowShape(Uint16* rows, const RowShape& s, int x, int y) {
+    int full = 0;
+    for (int sy = 0; sy < s.height; ++sy) {
+        rows[y + sy] = static_cast<Uint16>(rows[y + sy] | (s.rows[sy] << x));
+        full += rows[y + sy] == kFullRow;
+    }
+    if (full == 0) return 0;
+    int write = boardHeight - 1;
+    for (int row = boardHeight - 1; row >= 0; --row) {
+        if (rows[row] != kFullRow) rows[write--] = rows[row];
+    }
+    while (write >= 0) rows[write--] = 0;
+    return full;
+}
+
+// Aggregate height, holes and bumpiness, counted row by row as in the batch simulator
+inline int rowBoardCost(const Uint16* rows) {
+    int cost = 0;
+    Uint16 seen = 0;
+    for (int y = 0; y < boardHeight; ++y) {
+        cost += kHolesWeight * popcount16(seen & ~rows[y] & kFullRow);
+        seen = static_cast<Uint16>(seen | rows[y]);
+        cost += kAggregateWeight * popcount16(seen) + kBumpinessWeight * popcount16((seen ^ (seen >> 1)) & (kFullRow >> 1));
+    }
+    return cost;
+}
+
+#endif
@@ -0,0 +1,43 @@
+#ifndef SAVE_DATA_H
+#define SAVE_DATA_H
+
+#include <SDL3/SDL.h>
+
+// Everything persisted in tetris_save.dat. All fields are 32-bit ints so the on-disk
+// payload is a flat list of little-endian values in declaration order.
+// To add a field: append it here and to kSaveFields in save_data.cpp. Older files
+// simply lack the trailing value and keep the default; older builds ignore it.
+struct SaveData {
+    int fullscreen = 0;
+    int windowSize = 0;
+    int gridLines = 1;
+    int blockGap = 0;
+    int placementPreview = 0;
+    int hardDropKey = SDLK_SPACE;
+    int holdKey = SDLK_H;
+    int rotateClockwiseKey = SDLK_UP;
+    int rotateCounterClockwiseKey = SDLK_LCTRL;
+    int hardDropButton = SDL_GAMEPAD_BUTTON_SOUTH;
+    int holdButton = SDL_GAMEPAD_BUTTON_LEFT_SHOULDER;
+    int rotateClockwiseButton = SDL_GAMEPAD_BUTTON_WEST;
+    int rotateCounterClockwiseButton = SDL_GAMEPAD_BUTTON_EAST;
+    int highScore = 0;
+    int maxLevel = 0;
+    int randomizer = 0;   // RandomizerKind
+    int previewDepth = 1;
+    int placementHint = 0;
+};
+
+// Load the save file once at startup and apply it to the globals. Files in the
+// pre-versioned 15-field layout are migrated and rewritten in the current format.
+void readSaveData();
+
+// Snapshot the current settings and records into the in-memory save and queue a
+// background write. Never touches the disk on the calling thread; back-to-back
+// calls coalesce into a single write of the newest state.
+void writeSaveData();
+
+// Finish any queued write and stop the save thread (call from close())
+void flushSaveData();
+
+#endif
@@ -0,0 +1,34 @@
+#ifndef SPECTATOR_H
+#define SPECTATOR_H
+
+#include <vector>
+
+// Spectator grid (--spectate <1-16>, --spectate-replay <file>): up to 16 games in one
+// window, for showing a room full of games on one screen. Slots are filled with the
+// replays given, in order, and the rest with bot games that place each piece with the
+// example bot's weights, one piece deep, a move every few ticks so it can be followed.
+// A finished replay starts over and a finished bot game gets a new seed, after a pause
+// on the final board. Like local versus, each game is a GameSnapshot swapped into the
+// gameplay globals to step it, so every board runs the normal rules, without sounds.
+//
+// Boards are laid out in a near-square grid, with the cell size picked to fit. Every
+// board keeps the vertices it was last drawn with (cells and ghost, its HUD text) and
+// rebuilds them only when something it shows changed: the stack, the falling piece,
+// NEXT, HOLD, the score or the lines. A frame is then three draw calls for the whole
+// grid whatever the number of boards: the well outlines, one SDL_RenderGeometry for
+// every cell, and one SDL_RenderGeometry for all the text, which comes from a glyph
+// atlas (printable ASCII rendered once from the game font into one texture).
+//
+// Space pauses, Escape quits. The time spent simulating, rebuilding and drawing, the
+// worst frame and the frames over the 60 fps budget are logged when the mode exits.
+// Spectated games are not recorded as replays, flight recorder data or game history.
+
+constexpr int kSpectatorMaxBoards = 16;
+
+extern int spectatorBoards;                       // --spectate <boards>; 0 = off
+extern std::vector<const char*> spectatorReplays; // --spectate-replay <file>, repeatable
+
+int runSpectator();      // after init(), loadMedia() and initAudio(); returns the exit code
+bool spectatorActive();  // the grid is running; the single-game recorders and sounds stay out of it
+
+#endif
@@ -0,0 +1,33 @@
+#ifndef STARTUP_H
+#define STARTUP_H
+
+#include <SDL3/SDL.h>
+#include <SDL3_ttf/SDL_ttf.h>
+
+// Images embedded in the executable that are decoded off the main thread at startup
+enum class StartupImage { WindowIcon, SplashLogo, MenuLogo, Count };
+
+// Kick off image decodes and the font open on worker threads (call before init()).
+// The splash logo is only decoded when the splash screen will be shown.
+void beginStartupDecodes(bool wantSplash);
+
+// Hand a decoded surface to the caller (caller destroys it). With wait=false this
+// returns nullptr while the decode is still running; it also returns nullptr if the
+// decode failed or the surface was already taken.
+SDL_Surface* takeDecodedImage(StartupImage image, bool wait);
+
+// Blocks until the font has been opened; nullptr on failure
+TTF_Font* waitForFont();
+
+// Gamepad subsystem is brought up after the first interactive frame
+void ensureGamepadSubsystem();
+bool gamepadSubsystemReady();
+
+// Startup timeline instrumentation
+void startupMark(const char* stage);
+void startupFirstInteractiveFrame(); // records time-to-first-interactive-frame and logs the timeline once
+
+// Free anything the game never picked up
+void shutdownStartupDecodes();
+
+#endif
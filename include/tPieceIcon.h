@@ -1,30 +0,0 @@
-unsigned char assets_tPieceIcon_png[] = {
-  0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d,
-  0x49, 0x48, 0x44, 0x52, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x64,
-  0x08, 0x06, 0x00, 0x00, 0x00, 0x70, 0xe2, 0x95, 0x54, 0x00, 0x00, 0x00,
-  0x01, 0x73, 0x52, 0x47, 0x42, 0x01, 0xd9, 0xc9, 0x2c, 0x7f, 0x00, 0x00,
-  0x00, 0x04, 0x67, 0x41, 0x4d, 0x41, 0x00, 0x00, 0xb1, 0x8f, 0x0b, 0xfc,
-  0x61, 0x05, 0x00, 0x00, 0x00, 0x20, 0x63, 0x48, 0x52, 0x4d, 0x00, 0x00,
-  0x7a, 0x26, 0x00, 0x00, 0x80, 0x84, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00,
-  0x80, 0xe8, 0x00, 0x00, 0x75, 0x30, 0x00, 0x00, 0xea, 0x60, 0x00, 0x00,
-  0x3a, 0x98, 0x00, 0x00, 0x17, 0x70, 0x9c, 0xba, 0x51, 0x3c, 0x00, 0x00,
-  0x00, 0x06, 0x62, 0x4b, 0x47, 0x44, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff,
-  0xa0, 0xbd, 0xa7, 0x93, 0x00, 0x00, 0x00, 0x09, 0x70, 0x48, 0x59, 0x73,
-  0x00, 0x00, 0x0e, 0xc4, 0x00, 0x00, 0x0e, 0xc4, 0x01, 0x95, 0x2b, 0x0e,
-  0x1b, 0x00, 0x00, 0x00, 0x98, 0x49, 0x44, 0x41, 0x54, 0x78, 0xda, 0xed,
-  0xdb, 0xb1, 0x0d, 0x00, 0x20, 0x08, 0x00, 0x41, 0x74, 0x72, 0x36, 0xd7,
-  0xda, 0xd2, 0x0a, 0x12, 0xee, 0x16, 0xc0, 0xf8, 0x26, 0x56, 0x44, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0xad, 0x4e, 0x87, 0xc9, 0xc8,
-  0x53, 0x34, 0xb7, 0xcd, 0x3d, 0x6c, 0x6f, 0xb2, 0x17, 0x41, 0x04, 0x41,
-  0x10, 0x41, 0x10, 0x44, 0x10, 0x04, 0x11, 0x04, 0x41, 0x04, 0x41, 0x10,
-  0x04, 0x11, 0x04, 0x41, 0x04, 0x41, 0x10, 0x41, 0x10, 0x44, 0x10, 0x04,
-  0x41, 0x10, 0x41, 0x10, 0x44, 0x10, 0x04, 0x11, 0x04, 0x41, 0x04, 0x01,
-  0xe8, 0xef, 0xd9, 0x8b, 0xa8, 0xde, 0xcf, 0x98, 0x3e, 0xdf, 0x1f, 0xe2,
-  0x53, 0x47, 0x10, 0x41, 0x10, 0x44, 0x10, 0x04, 0x11, 0x04, 0x41, 0x10,
-  0x44, 0x10, 0x04, 0x11, 0x04, 0x41, 0x04, 0x41, 0x10, 0x41, 0x10, 0x44,
-  0x10, 0x04, 0x41, 0x10, 0x41, 0x10, 0x44, 0x10, 0x04, 0x11, 0x04, 0x41,
-  0x04, 0x41, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x2f,
-  0x17, 0x85, 0xf5, 0x0c, 0x77, 0x1b, 0x75, 0xba, 0x5f, 0x00, 0x00, 0x00,
-  0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82
-};
-unsigned int assets_tPieceIcon_png_len = 321;
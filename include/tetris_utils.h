@@ -4,6 +4,8 @@
 #include "board.h"
 #include "piece.h"
 #include "globals.h"
+#include "randomizer.h"
+#include <algorithm>
 #include <vector>
 #include <string>
 
@@ -31,12 +33,13 @@ void renderBoardBlocksDuringAnimation();
 
 void renderGhostPiece();
 
-void animateRowClear();
+void animateRowClear(bool draw = true);
+void collapseClearedRows(); // drop the rows above each entry in rowsToClear; the end of animateRowClear
 
-bool checkGameOver();
-
-void readSaveData();
-void writeSaveData();
+bool spawnBlocked();         // the current piece overlaps the stack where it spawned
+bool checkGameOver();        // spawnBlocked(), and if so animate, record the game and restart
+bool gameCountsForRecords(); // the game may raise the high score and go into the save file and history
+bool silentSimulation();     // ticks nobody sees through the single-player view: no HUD text or particles
 
 void autoDrop(bool canPlaceNextPiece);
 
@@ -44,11 +47,24 @@ void handleLockDelay(bool canPlaceNextPiece);
 
 void handlePieceLanded();
 
+// Scoring and speed rules, shared with the batch simulator (batch_sim.h)
+constexpr int kLinesPerLevel = 10;
+constexpr int lineClearScore(int rows, int level) { // rows cleared by one piece at a 0-based level
+    constexpr int kPoints[5] = { 0, 40, 100, 300, 1200 };
+    return rows >= 0 && rows <= 4 ? kPoints[rows] * (level + 1) : 0;
+}
+constexpr int levelForLines(int lines) { return lines / kLinesPerLevel; }
+constexpr int dropSpeedForLevel(int level) { return std::max(50000000, 900000000 - level * 70000000); } // ns per row, capped at 0.05s
+
 void resetGameplayStateForNewGame();
 
 std::string chooseWindowTitle();
 
 extern Piece pieceTypes[7];
+extern PieceQueue pieceQueue;
+void seedPieceRandomizer(Uint64 seed);
+int popNextPiece();
+
 extern int pickPiece;
 extern int nextPickPiece;
 extern Piece currentPiece;
@@ -65,6 +81,7 @@ extern Piece holdPiece;
 extern bool newPiece;
 extern bool holdUsed;
 extern int rowsCleared;
+extern int piecesPlaced;
 extern int levelIncrease;
 extern bool hardDropFlag;
 extern bool alternateIPieceRotationOffset;
@@ -81,6 +98,12 @@ extern bool pieceLandedOnce;
 
 extern Board board;
 
+// Gameplay runs on its own clock of one tick per gameplay frame, so the same seed and
+// inputs on the same ticks always play out the same game (see replay.h)
+extern Uint64 gameTick;
+constexpr Uint64 kTickNs = 1000000000 / kScreenFps;
+inline Uint64 gameTimeNs() { return gameTick * kTickNs; }
+
 enum class InputAction {
     None,
     MoveLeft,
@@ -94,6 +117,18 @@ enum class InputAction {
     IncreaseLevel
 };
 
+// The actions queued during one frame; fixed capacity so input polling never allocates
+struct InputActionList {
+    static constexpr size_t kCapacity = 64;
+    InputAction items[kCapacity];
+    size_t count = 0;
+
+    void push_back(InputAction action) { if (count < kCapacity) items[count++] = action; }
+    size_t size() const { return count; }
+    const InputAction* begin() const { return items; }
+    const InputAction* end() const { return items + count; }
+};
+
 void moveLeft();
 void moveRight();
 void rotateClockwise();
@@ -104,4 +139,10 @@ void hold();
 void increaseLevel();
 void pauseGame();
 
+void applyInputAction(InputAction action); // records the action for the replay, then applies it
+
+void runGameplayFrame();     // simulate and draw one tick of PLAYING
+bool simulateGameplayTick(); // the same tick without drawing or waiting; false if the spawn is blocked
+void presentGameplayFrame(); // overlays, offscreen capture and present, for every gameplay frame
+
 #endif
\ No newline at end of file
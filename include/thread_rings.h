@@ -0,0 +1,151 @@
+#ifndef THREAD_RINGS_H
+#define THREAD_RINGS_H
+
+#include <SDL3/SDL.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+// Per-thread lock-free record rings drained by one background thread, shared by the
+// logger and the span tracer. Each thread that writes gets its own single-producer,
+// single-consumer ring on first use; rings are registered once and never freed, so the
+// drainer can always read them. A full ring drops the record and counts it instead of
+// blocking the writer.
+//
+// The thread's ring is cached in a thread_local per instantiation, so keep to one
+// ThreadRings per record type. ThreadInfo is extra per-ring data for the owner (the
+// tracer keeps each thread's track name there).
+
+struct NoThreadInfo {};
+
+template <typename Record, size_t kRingSize, int kMaxRings, typename ThreadInfo = NoThreadInfo>
+class ThreadRings {
+    static_assert((kRingSize & (kRingSize - 1)) == 0, "ring size must be a power of two");
+
+    public:
+        struct Ring {
+            std::atomic<size_t> head{ 0 }; // next slot to write
+            std::atomic<size_t> tail{ 0 }; // next slot to read
+            std::atomic<Uint64> dropped{ 0 };
+            int index = 0;                 // registration order
+            SDL_ThreadID thread{ 0 };
+            ThreadInfo info;
+            Record records[kRingSize];
+        };
+
+        // This thread's ring, registering it on first use (init(ring) runs then, on this
+        // thread); nullptr once kMaxRings threads have registered
+        template <typename Init>
+        Ring* ringForThisThread(Init init) {
+            if (threadRing || threadRingFailed) return threadRing;
+            std::lock_guard<std::mutex> lock(registerMutex);
+            const int n = ringCount.load(std::memory_order_relaxed);
+            if (n >= kMaxRings) {
+                threadRingFailed = true;
+                return nullptr;
+            }
+            Ring* ring = new Ring();
+            ring->index = n;
+            ring->thread = SDL_GetCurrentThreadID();
+            init(*ring);
+            rings[n] = ring;
+            ringCount.store(n + 1, std::memory_order_release);
+            threadRing = ring;
+            return ring;
+        }
+        Ring* ringForThisThread() {
+            return ringForThisThread([](Ring&) {});
+        }
+
+        // Producer: the next free slot, or nullptr (and one more drop) if the ring is full.
+        // Fill it, then publish().
+        Record* claim(Ring& ring) {
+            const size_t head = ring.head.load(std::memory_order_relaxed);
+            if (head - ring.tail.load(std::memory_order_acquire) >= kRingSize) {
+                ring.dropped.fetch_add(1, std::memory_order_relaxed);
+                return nullptr;
+            }
+            return &ring.records[head & (kRingSize - 1)];
+        }
+
+        // Producer: hand the claimed record to the drainer; returns how many are now queued
+        size_t publish(Ring& ring) {
+            const size_t head = ring.head.fetch_add(1, std::memory_order_release) + 1;
+            return head - ring.tail.load(std::memory_order_relaxed);
+        }
+
+        // Consumer: visit(ring, record) for every queued record, oldest first in each ring,
+        // then dropped(ring, count) for a ring that dropped records since the last drain
+        template <typename Visit, typename Dropped>
+        void drain(Visit visit, Dropped dropped) {
+            const int n = ringCount.load(std::memory_order_acquire);
+            for (int i = 0; i < n; ++i) {
+                Ring& ring = *rings[i];
+                size_t tail = ring.tail.load(std::memory_order_relaxed);
+                const size_t head = ring.head.load(std::memory_order_acquire);
+                for (; tail != head; ++tail) visit(ring, ring.records[tail & (kRingSize - 1)]);
+                ring.tail.store(tail, std::memory_order_release);
+                if (const Uint64 count = ring.dropped.exchange(0, std::memory_order_relaxed)) dropped(ring, count);
+            }
+        }
+
+        // Consumer: forget everything queued so far; reset(ring) may clear the owner's info
+        template <typename Reset>
+        void discard(Reset reset) {
+            const int n = ringCount.load(std::memory_order_acquire);
+            for (int i = 0; i < n; ++i) {
+                Ring& ring = *rings[i];
+                ring.tail.store(ring.head.load(std::memory_order_acquire), std::memory_order_release);
+                ring.dropped.store(0, std::memory_order_relaxed);
+                reset(ring);
+            }
+        }
+
+    private:
+        Ring* rings[kMaxRings] = {};
+        std::atomic<int> ringCount{ 0 };
+        std::mutex registerMutex;
+        inline static thread_local Ring* threadRing = nullptr;
+        inline static thread_local bool threadRingFailed = false;
+};
+
+// The background thread: drain() every interval, when woken, and once more on stop()
+class RingDrainThread {
+    public:
+        template <typename Drain>
+        void start(std::chrono::milliseconds interval, Drain drain) {
+            stopRequested = false;
+            thread = std::thread([this, interval, drain] {
+                std::unique_lock<std::mutex> lock(mutex);
+                while (!stopRequested) {
+                    cv.wait_for(lock, interval);
+                    lock.unlock();
+                    drain();
+                    lock.lock();
+                }
+                lock.unlock();
+                drain();
+            });
+        }
+
+        void wake() { cv.notify_one(); }
+
+        void stop() {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                stopRequested = true;
+            }
+            cv.notify_one();
+            thread.join();
+        }
+
+    private:
+        std::thread thread;
+        std::mutex mutex;
+        std::condition_variable cv;
+        bool stopRequested = false;
+};
+
+#endif
@@ -0,0 +1,52 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <SDL3/SDL.h>
+#include <atomic>
+
+// Span tracing for offline frame analysis. While a session is running, every
+// TRACE_SCOPE records its name, start and duration (SDL_GetTicksNS) into a per-thread
+// lock-free ring; a background thread drains the rings into a Chrome trace-event JSON
+// file that opens in Perfetto (ui.perfetto.dev) or chrome://tracing. Sessions start
+// with --trace <file> or F5 and stop with F5 or on exit. When no session is running a
+// span costs one relaxed atomic load.
+//
+// Span names must be string literals without quotes or backslashes: only the pointer
+// is stored, and the writer copies the text into the JSON as is.
+
+extern std::atomic<bool> traceEnabled;
+extern const char* traceOutPath; // --trace <file>; F5 sessions use it too, or trace.json
+
+bool traceStart(const char* path); // open the file and start recording
+void traceStop();                  // stop recording, write out everything queued and close the file
+void traceToggle();                // F5
+void traceSetThreadName(const char* name); // label this thread's track; call before its first span
+
+// Record a span that started at startNs and ends now; durations of ~0 are kept
+void traceRecord(const char* name, Uint64 startNs);
+// A zero-length marker, drawn as an arrow on the thread's track
+void traceInstant(const char* name);
+
+class TraceSpan {
+    public:
+        explicit TraceSpan(const char* name)
+            : name(name), startNs(traceEnabled.load(std::memory_order_relaxed) ? SDL_GetTicksNS() : 0) {}
+        ~TraceSpan() { end(); }
+        TraceSpan(const TraceSpan&) = delete;
+        TraceSpan& operator=(const TraceSpan&) = delete;
+
+        // End early, for flat code such as the main loop stages
+        void end() {
+            if (startNs != 0) traceRecord(name, startNs);
+            startNs = 0;
+        }
+    private:
+        const char* name;
+        Uint64 startNs; // 0 = not recording
+};
+
+#define TRACE_CONCAT_(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_(a, b)
+#define TRACE_SCOPE(name) TraceSpan TRACE_CONCAT(traceSpan, __LINE__)(name)
+
+#endif
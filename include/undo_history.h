@@ -0,0 +1,32 @@
+#ifndef UNDO_HISTORY_H
+#define UNDO_HISTORY_H
+
+#include <SDL3/SDL.h>
+
+// Practice mode (--practice): Ctrl+Z takes back the last placement and Ctrl+Y (or
+// Ctrl+Shift+Z) puts it back, while playing. Holding the keys steps through pieces at
+// the key repeat rate, which rewinds several seconds of play. A new placement after an
+// undo drops the placements that could have been redone.
+//
+// The history keeps one small entry per piece: the state at the moment that piece
+// spawned (piece, hold, score, lines, level and how many pieces had been drawn from the
+// randomizer) and the rows that changed since the piece before, as each row packed 4
+// bits a cell and xored with the row it replaced, so the same bytes step both ways.
+// The board itself is never copied into the history; the piece queue is rebuilt from
+// its state at the start of the game by drawing the recorded number of pieces again.
+//
+// Both are fixed rings allocated once: 10,000 entries of 24 bytes and 512 KB for the
+// changed rows (9 bytes a row, a few rows a piece), about 750 KB in all. The oldest
+// pieces are dropped when either ring is full; a typical game keeps all 10,000. A game
+// with a placement taken back is not saved to the high score, game history or
+// last_game.trp.
+
+extern bool practiceModeEnabled; // --practice
+
+void undoHistoryReset(); // from resetGameplayStateForNewGame()
+void undoHistoryTick();  // at the end of each gameplay tick, after the lock and row clear
+bool undoPlacement();    // false if there is nothing older to go back to
+bool redoPlacement();    // false if there is nothing newer
+bool undoHistoryTookBack(); // a placement of this game was taken back
+
+#endif
@@ -0,0 +1,64 @@
+#ifndef VERSUS_H
+#define VERSUS_H
+
+#include "game_snapshot.h"
+#include "randomizer.h"
+#include <type_traits>
+
+// Local versus (--versus <2-4>): two to four games side by side in one window, all on
+// the same piece sequence. Each game lives in a GameSnapshot (game_snapshot.h) that is
+// swapped into the gameplay globals to step it, so every board runs the normal rules.
+//
+// Players take the connected gamepads (SDL_GetGamepads) in order; players left over
+// get a keyboard half:
+//   left   A/D move, S soft drop, W hard drop, Q/E rotate, Left Shift hold
+//   right  arrows move and soft drop, Up hard drop, ./slash rotate, Right Shift hold
+// Gamepads use the D-pad and the bindings from the Controls menu. Pads plugged in
+// during a match go to a player without controls.
+//
+// Clearing 2, 3 or 4 lines sends 1, 2 or 4 garbage rows, first cancelling garbage
+// still waiting for the sender; with more than two players the targets take turns.
+// Waiting garbage rises from the bottom when the receiver's next piece locks without
+// clearing a line, at most 8 rows at a time, with one gap per batch. The last player
+// standing wins; R or Start plays again, Escape quits.
+//
+// All boards are drawn with one SDL_RenderFillRects call per color, and the time the
+// simulation and drawing take per frame is logged when the mode exits. Versus games
+// are not recorded as replays, flight recorder data or game history.
+//
+// Everything the rules read is in one VersusMatch value, so online play (netplay.h)
+// can save and restore a whole match with a copy.
+
+constexpr int kVersusMaxPlayers = 4;
+
+struct VersusBoard {
+    GameSnapshot state;
+    bool alive;
+    int pendingGarbage; // rows waiting to rise
+    int linesSent;      // garbage rows sent
+    int nextTarget;     // who the next garbage goes to
+};
+
+struct VersusMatch {
+    VersusBoard boards[kVersusMaxPlayers];
+    int players;
+    Xoshiro128 garbageRng; // garbage gaps
+    int winner;            // -1 while the match runs, or on a draw
+    bool over;
+};
+
+static_assert(std::is_trivially_copyable_v<VersusMatch>, "VersusMatch must stay a plain value type");
+
+extern int versusPlayers; // --versus <players>; 0 = no versus match
+extern VersusMatch versusMatch;
+
+void versusStartMatch(int players, Uint64 seed); // fresh boards, all dealt from seed
+
+// One tick of every board still in, each with its own actions, garbage included.
+// Leaves the gameplay globals holding whichever board was stepped last.
+void versusStep(const InputActionList* actions);
+
+int runVersus();     // after init(), loadMedia() and initAudio() (online --headless: before); returns the exit code
+bool versusActive(); // a match is running; the single-game recorders stay out of it
+
+#endif
@@ -0,0 +1,322 @@
+#include "advisor.h"
+#include "row_board.h"
+#include "tetris_utils.h"
+#include "globals.h"
+#include "replay.h"
+#include "trace.h"
+#include "log.h"
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <thread>
+
+bool placementHintEnabled = false;
+
+namespace {
+    constexpr int kMaxDepth = 1 + kMaxPreview;
+    constexpr Uint64 kSearchBudgetNs = 100000000; // a pass still running after this is abandoned
+    constexpr Uint64 kDeepenBudgetNs = kSearchBudgetNs / 4; // the next pass costs ~20x the last
+    constexpr int kPollInterval = 256; // placements between checks for a newer position
+    constexpr int kTopOutCost = 1 << 24;
+    constexpr int kNoPlacement = INT_MAX;
+
+    // Everything the search reads, copied on the main thread
+    struct Position {
+        Uint16 rows[boardHeight];
+        int type;
+        int rotation;
+        int x;
+        int y;
+        int hold; // -1 if nothing is held
+        bool holdUsed;
+        int next[kMaxPreview];
+        int nextCount; // the pieces the NEXT panel shows
+        int piecesPlaced;
+        Uint64 postedNs;
+    };
+
+    bool samePosition(const Position& a, const Position& b) {
+        return std::memcmp(a.rows, b.rows, sizeof(a.rows)) == 0 && a.type == b.type && a.rotation == b.rotation &&
+               a.x == b.x && a.y == b.y && a.hold == b.hold && a.holdUsed == b.holdUsed &&
+               std::equal(a.next, a.next + a.nextCount, b.next) && a.nextCount == b.nextCount &&
+               a.piecesPlaced == b.piecesPlaced;
+    }
+
+    struct Hint {
+        bool valid = false;
+        int piecesPlaced = 0; // which piece it was computed for
+        bool holdUsed = false;
+        bool useHold = false;
+        int type = 0;
+        int rotation = 0;
+        int x = 0;
+        int y = 0;
+        int depth = 0;
+    };
+
+    struct Start {
+        int x;
+        int y;
+        int rotation;
+    };
+
+    constexpr Start kSpawn{ boardWidth / 2, 0, 0 };
+
+    std::thread worker;
+    std::mutex advisorMutex;
+    std::condition_variable advisorCv;
+    Position request;        // guarded by advisorMutex
+    bool requestPending = false;
+    Hint published;          // guarded by advisorMutex
+    std::atomic<Uint64> latestGeneration{ 0 }; // bumped for every posted position
+    std::atomic<bool> stopping{ false };
+
+    // Main thread only
+    Position lastPosted;
+    bool havePosted = false;
+
+    // Worker only, logged by advisorStop
+    Uint64 searches = 0;
+    Uint64 abandoned = 0;    // superseded or over budget before the first hint
+    Uint64 firstHintNs = 0;  // posted to depth 1, summed
+    Uint64 worstFirstHintNs = 0;
+    Uint64 finalHintNs = 0;  // posted to the deepest hint, summed
+    Uint64 depthCounts[kMaxDepth + 1] = {};
+
+    struct Search {
+        Uint64 generation;
+        Uint64 deadlineNs;
+        int polls = 0;
+        bool aborted = false;
+
+        bool shouldStop() {
+            if (aborted || ++polls % kPollInterval != 0) return aborted;
+            aborted = stopping.load(std::memory_order_relaxed) || latestGeneration.load(std::memory_order_relaxed) != generation ||
+                      SDL_GetTicksNS() > deadlineNs;
+            return aborted;
+        }
+    };
+
+    // Rotate in place (pushed off the walls), slide along the row to col and drop:
+    // the top row it lands on, or -1 if any step is blocked
+    int landingRow(const Uint16* rows, int type, Start from, int rotation, int col) {
+        if (!rowShapeFits(rows, kRowShapes.shapes[type][from.rotation], from.x, from.y)) return -1; // a blocked spawn is a top out
+        const RowShape& s = kRowShapes.shapes[type][rotation];
+        int x = std::clamp(from.x, 0, boardWidth - s.width);
+        if (!rowShapeFits(rows, s, x, from.y)) return -1;
+        while (x != col) {
+            x += col > x ? 1 : -1;
+            if (!rowShapeFits(rows, s, x, from.y)) return -1;
+        }
+        int y = from.y;
+        while (rowShapeFits(rows, s, x, y + 1)) ++y;
+        return y;
+    }
+
+    // The lowest cost after placing pieces[0..count) in order, each from its spawn
+    int bestFollowUp(Search& search, const Uint16* rows, const int* pieces, int count) {
+        if (count == 0) return rowBoardCost(rows);
+        const int type = pieces[0];
+        int best = kNoPlacement;
+        for (int rot = 0; rot < kDistinctRotations[type]; ++rot) {
+            const RowShape& s = kRowShapes.shapes[type][rot];
+            for (int col = 0; col + s.width <= boardWidth; ++col) {
+                if (search.shouldStop()) return best;
+                const int y = landingRow(rows, type, kSpawn, rot, col);
+                if (y < 0) continue;
+                Uint16 after[boardHeight];
+                std::memcpy(after, rows, sizeof(after));
+                const int lines = lockRowShape(after, s, col, y);
+                const int cost = bestFollowUp(search, after, pieces + 1, count - 1);
+                if (cost != kNoPlacement) best = std::min(best, cost - kLinesWeight * lines);
+            }
+        }
+        return best == kNoPlacement ? kTopOutCost : best;
+    }
+
+    // Best placement of the current piece (or the hold) looking depth - 1 pieces ahead
+    bool searchDepth(Search& search, const Position& pos, int depth, Hint& hint) {
+        int best = kNoPlacement;
+        for (int useHold = 0; useHold < 2; ++useHold) {
+            if (useHold && pos.holdUsed) break;
+            int type = pos.type;
+            Start from{ pos.x, pos.y, pos.rotation };
+            const int* rest = pos.next;
+            int restCount = pos.nextCount;
+            if (useHold) {
+                from = kSpawn;
+                if (pos.hold >= 0) {
+                    type = pos.hold;
+                } else if (restCount > 0) {
+                    type = rest[0]; // holding into an empty slot plays the next piece now
+                    rest++;
+                    restCount--;
+                } else {
+                    break;
+                }
+            }
+            restCount = std::min(restCount, depth - 1);
+
+            for (int rot = 0; rot < kDistinctRotations[type]; ++rot) {
+                const RowShape& s = kRowShapes.shapes[type][rot];
+                for (int col = 0; col + s.width <= boardWidth; ++col) {
+                    if (search.shouldStop()) return false;
+                    const int y = landingRow(pos.rows, type, from, rot, col);
+                    if (y < 0) continue;
+                    Uint16 after[boardHeight];
+                    std::memcpy(after, pos.rows, sizeof(after));
+                    const int lines = lockRowShape(after, s, col, y);
+                    const int cost = bestFollowUp(search, after, rest, restCount) - kLinesWeight * lines;
+                    if (cost < best) {
+                        best = cost;
+                        hint = Hint{ true, pos.piecesPlaced, pos.holdUsed, useHold != 0, type, rot, col, y, 1 + restCount };
+                    }
+                }
+            }
+        }
+        return !search.aborted && best != kNoPlacement;
+    }
+
+    void runSearch(const Position& pos, Uint64 searchGeneration) {
+        TRACE_SCOPE("placement hint");
+        searches++;
+        Search search{ searchGeneration, pos.postedNs + kSearchBudgetNs };
+        const int maxDepth = std::min(kMaxDepth, 1 + pos.nextCount);
+        int depth = 0;
+        Uint64 elapsed = 0;
+        for (int d = 1; d <= maxDepth; ++d) {
+            Hint hint;
+            if (!searchDepth(search, pos, d, hint)) break;
+            elapsed = SDL_GetTicksNS() - pos.postedNs;
+            {
+                std::lock_guard<std::mutex> lock(advisorMutex);
+                if (latestGeneration.load(std::memory_order_relaxed) != searchGeneration) break; // superseded while publishing
+                published = hint;
+            }
+            if (d == 1) {
+                firstHintNs += elapsed;
+                worstFirstHintNs = std::max(worstFirstHintNs, elapsed);
+            }
+            depth = d;
+            if (elapsed > kDeepenBudgetNs) break;
+        }
+        if (depth == 0) {
+            abandoned++;
+            return;
+        }
+        finalHintNs += elapsed;
+        depthCounts[depth]++;
+        LOG_DEBUG("Hint: depth %d in %.2f ms", depth, elapsed / 1e6);
+    }
+
+    void workerMain() {
+        traceSetThreadName("advisor");
+        std::unique_lock<std::mutex> lock(advisorMutex);
+        for (;;) {
+            advisorCv.wait(lock, [] { return requestPending || stopping.load(); });
+            if (stopping.load()) return;
+            const Position pos = request;
+            const Uint64 searchGeneration = latestGeneration.load(std::memory_order_relaxed);
+            requestPending = false;
+            lock.unlock();
+            runSearch(pos, searchGeneration);
+            lock.lock();
+        }
+    }
+
+    Position capturePosition() {
+        Position p{};
+        for (int y = 0; y < boardHeight; ++y) {
+            Uint16 row = 0;
+            for (int x = 0; x < boardWidth; ++x) {
+                if (board.current[x][y] != 0) row = static_cast<Uint16>(row | (1u << x));
+            }
+            p.rows[y] = row;
+        }
+        p.type = currentPiece.type;
+        p.rotation = currentPiece.rotation;
+        p.x = currentPiece.x;
+        p.y = currentPiece.y;
+        p.hold = holdPiece.type;
+        p.holdUsed = holdUsed;
+        p.nextCount = previewDepth;
+        for (int i = 0; i < p.nextCount; ++i) p.next[i] = pieceQueuePeek(pieceQueue, i);
+        p.piecesPlaced = piecesPlaced;
+        return p;
+    }
+}
+
+void advisorStart() {
+    if (worker.joinable()) return;
+    stopping = false;
+    worker = std::thread(workerMain);
+}
+
+void advisorStop() {
+    if (!worker.joinable()) return;
+    {
+        std::lock_guard<std::mutex> lock(advisorMutex);
+        stopping = true;
+    }
+    advisorCv.notify_one();
+    worker.join();
+
+    const Uint64 hinted = searches - abandoned;
+    if (hinted == 0) return;
+    LOG_INFO("Hints: %llu searches, %llu superseded first; first hint %.2f ms avg, %.2f ms worst; final %.2f ms avg",
+             static_cast<unsigned long long>(searches), static_cast<unsigned long long>(abandoned),
+             firstHintNs / 1e6 / hinted, worstFirstHintNs / 1e6, finalHintNs / 1e6 / hinted);
+    for (int d = 1; d <= kMaxDepth; ++d) {
+        if (depthCounts[d] > 0) LOG_INFO("Hints: depth %d reached %llu times", d, static_cast<unsigned long long>(depthCounts[d]));
+    }
+}
+
+void advisorUpdate() {
+    if (!placementHintEnabled || !worker.joinable() || paused || clearingRows || newPiece || replayPlaybackActive()) return;
+    Position p = capturePosition();
+    if (havePosted && samePosition(p, lastPosted)) return;
+    p.postedNs = SDL_GetTicksNS();
+    lastPosted = p;
+    havePosted = true;
+    {
+        std::lock_guard<std::mutex> lock(advisorMutex);
+        request = p;
+        requestPending = true;
+        latestGeneration.fetch_add(1, std::memory_order_relaxed);
+    }
+    advisorCv.notify_one();
+}
+
+void renderPlacementHint() {
+    if (!placementHintEnabled || clearingRows) return;
+    Hint hint;
+    {
+        std::lock_guard<std::mutex> lock(advisorMutex);
+        hint = published;
+    }
+    // A hint for an earlier piece is hidden; one for this piece stays up while the next search runs
+    if (!hint.valid || hint.piecesPlaced != piecesPlaced || hint.holdUsed != holdUsed) return;
+
+    SDL_BlendMode oldMode;
+    SDL_GetRenderDrawBlendMode(gRenderer, &oldMode);
+    SDL_SetRenderDrawBlendMode(gRenderer, SDL_BLENDMODE_BLEND);
+
+    // White for the current piece, gold when the hint is to hold first
+    if (hint.useHold) SDL_SetRenderDrawColor(gRenderer, 255, 200, 60, 70);
+    else SDL_SetRenderDrawColor(gRenderer, 255, 255, 255, 60);
+    const PieceShape& s = kPieceShapes.shapes[hint.type][hint.rotation];
+    const float inset = spacing / 2.0f + 4.0f;
+    for (int sy = 0; sy < s.height; ++sy) {
+        for (int sx = 0; sx < s.width; ++sx) {
+            if (!(s.mask & (1u << (sy * 4 + sx)))) continue;
+            const SDL_FRect rect{ static_cast<float>((hint.x + sx) * blockSize) + inset,
+                                  static_cast<float>((hint.y + sy) * blockSize) + inset,
+                                  blockSize - 2 * inset, blockSize - 2 * inset };
+            SDL_RenderFillRect(gRenderer, &rect);
+        }
+    }
+    SDL_SetRenderDrawBlendMode(gRenderer, oldMode);
+}
@@ -0,0 +1,235 @@
+#include "alloc_check.h"
+
+#ifdef TETRIS_ALLOC_CHECK
+
+#include "globals.h"
+#include "frame_arena.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+bool allocOverlayVisible = false;
+bool allocStrictMode = false;
+
+namespace {
+    constexpr int kSubsystemCount = static_cast<int>(AllocSubsystem::Count);
+    constexpr const char* kSubsystemNames[kSubsystemCount] = {
+        "Other", "Input", "Simulation", "Render", "Text", "Save", "History", "Audio"
+    };
+    // Gameplay frames that follow a state change may still size caches; skip them
+    constexpr int kWarmupFrames = 120;
+    constexpr int kMaxLoggedViolations = 10;
+
+    std::atomic<Uint64> allocCounts[kSubsystemCount];
+    std::atomic<Uint64> allocBytes[kSubsystemCount];
+    thread_local AllocSubsystem currentSubsystem = AllocSubsystem::Other;
+
+    SDL_malloc_func realMalloc = nullptr;
+    SDL_calloc_func realCalloc = nullptr;
+    SDL_realloc_func realRealloc = nullptr;
+    SDL_free_func realFree = nullptr;
+
+    // Main thread only
+    Uint64 frameStartCounts[kSubsystemCount];
+    Uint64 frameStartBytes[kSubsystemCount];
+    AllocStats lastFrame[kSubsystemCount];
+    bool lastFrameGameplay = false;
+    int warmFrames = 0;
+    Uint64 gameplayFramesChecked = 0;
+    Uint64 allocatingFrames = 0;
+    Uint64 exemptFrames = 0;                 // allocated, but only in the exempt subsystems
+    AllocStats exemptTotals[kSubsystemCount]; // exempt allocations in checked gameplay frames
+    AllocStats peakFrame{ 0, 0 };
+
+    void countAllocation(size_t size) {
+        const int s = static_cast<int>(currentSubsystem);
+        allocCounts[s].fetch_add(1, std::memory_order_relaxed);
+        allocBytes[s].fetch_add(size, std::memory_order_relaxed);
+    }
+
+    void* countedAlloc(std::size_t size) {
+        countAllocation(size);
+        if (size == 0) size = 1;
+        if (void* p = std::malloc(size)) return p;
+        throw std::bad_alloc();
+    }
+
+    void* SDLCALL countedSdlMalloc(size_t size) {
+        countAllocation(size);
+        return realMalloc(size);
+    }
+
+    void* SDLCALL countedSdlCalloc(size_t nmemb, size_t size) {
+        countAllocation(nmemb * size);
+        return realCalloc(nmemb, size);
+    }
+
+    void* SDLCALL countedSdlRealloc(void* mem, size_t size) {
+        if (size != 0) countAllocation(size);
+        return realRealloc(mem, size);
+    }
+
+    void SDLCALL countedSdlFree(void* mem) {
+        realFree(mem);
+    }
+
+    // Subsystems whose allocations are event-driven (a score change, a finished game)
+    // rather than per-frame work. Strict mode deliberately does not fail on them: the
+    // score label is a new texture whenever the score changes. They are still counted
+    // in checked frames and reported on exit, next to the pass/fail result.
+    bool isSteadyStateSubsystem(int s) {
+        const AllocSubsystem sub = static_cast<AllocSubsystem>(s);
+        return sub != AllocSubsystem::Text && sub != AllocSubsystem::Save && sub != AllocSubsystem::History;
+    }
+
+    void checkSteadyState() {
+        AllocStats steady{ 0, 0 };
+        Uint64 exempt = 0;
+        for (int s = 0; s < kSubsystemCount; ++s) {
+            if (!isSteadyStateSubsystem(s)) {
+                exempt += lastFrame[s].count;
+                exemptTotals[s].count += lastFrame[s].count;
+                exemptTotals[s].bytes += lastFrame[s].bytes;
+                continue;
+            }
+            steady.count += lastFrame[s].count;
+            steady.bytes += lastFrame[s].bytes;
+        }
+        gameplayFramesChecked++;
+        if (steady.count == 0) {
+            if (exempt > 0) exemptFrames++;
+            return;
+        }
+        if (allocatingFrames++ < kMaxLoggedViolations) {
+            SDL_Log("alloc: gameplay frame made %llu allocations (%llu bytes)",
+                    static_cast<unsigned long long>(steady.count), static_cast<unsigned long long>(steady.bytes));
+            for (int s = 0; s < kSubsystemCount; ++s) {
+                if (lastFrame[s].count == 0 || !isSteadyStateSubsystem(s)) continue;
+                SDL_Log("alloc:   %-10s %llu (%llu bytes)", kSubsystemNames[s],
+                        static_cast<unsigned long long>(lastFrame[s].count), static_cast<unsigned long long>(lastFrame[s].bytes));
+            }
+        }
+    }
+}
+
+void* operator new(std::size_t size) { return countedAlloc(size); }
+void* operator new[](std::size_t size) { return countedAlloc(size); }
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    countAllocation(size);
+    return std::malloc(size ? size : 1);
+}
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    countAllocation(size);
+    return std::malloc(size ? size : 1);
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+
+AllocScope::AllocScope(AllocSubsystem subsystem) : previous(currentSubsystem) {
+    currentSubsystem = subsystem;
+}
+
+AllocScope::~AllocScope() {
+    currentSubsystem = previous;
+}
+
+void allocSetSubsystem(AllocSubsystem subsystem) {
+    currentSubsystem = subsystem;
+}
+
+Uint64 heapAllocationCount() {
+    Uint64 total = 0;
+    for (const auto& c : allocCounts) total += c.load(std::memory_order_relaxed);
+    return total;
+}
+
+void allocInstallSdlHooks() {
+    SDL_GetOriginalMemoryFunctions(&realMalloc, &realCalloc, &realRealloc, &realFree);
+    if (!SDL_SetMemoryFunctions(countedSdlMalloc, countedSdlCalloc, countedSdlRealloc, countedSdlFree)) {
+        SDL_Log("alloc: could not hook SDL allocator: %s", SDL_GetError());
+    }
+}
+
+void allocFrameBegin(bool gameplayFrame) {
+    AllocStats total{ 0, 0 };
+    for (int s = 0; s < kSubsystemCount; ++s) {
+        const Uint64 count = allocCounts[s].load(std::memory_order_relaxed);
+        const Uint64 bytes = allocBytes[s].load(std::memory_order_relaxed);
+        lastFrame[s] = AllocStats{ count - frameStartCounts[s], bytes - frameStartBytes[s] };
+        frameStartCounts[s] = count;
+        frameStartBytes[s] = bytes;
+        total.count += lastFrame[s].count;
+        total.bytes += lastFrame[s].bytes;
+    }
+    if (total.count > peakFrame.count) peakFrame = total;
+
+    // Judge the frame that just ended by the state it started in
+    if (lastFrameGameplay && warmFrames >= kWarmupFrames) checkSteadyState();
+    warmFrames = lastFrameGameplay ? warmFrames + 1 : 0;
+    lastFrameGameplay = gameplayFrame;
+}
+
+void renderAllocOverlay() {
+    if (!allocOverlayVisible) return;
+    ALLOC_SCOPE(Text); // the debug font texture is created on first use
+
+    AllocStats total{ 0, 0 };
+    int rows = 0;
+    for (int s = 0; s < kSubsystemCount; ++s) {
+        total.count += lastFrame[s].count;
+        total.bytes += lastFrame[s].bytes;
+        if (lastFrame[s].count) rows++;
+    }
+    const float x = 8.f, y = 8.f, line = 10.f;
+    SDL_FRect panel{ x - 4.f, y - 4.f, 232.f, (rows + 2) * line + 8.f };
+    SDL_SetRenderDrawBlendMode(gRenderer, SDL_BLENDMODE_BLEND);
+    SDL_SetRenderDrawColor(gRenderer, 0, 0, 0, 180);
+    SDL_RenderFillRect(gRenderer, &panel);
+
+    char text[64];
+    SDL_SetRenderDrawColor(gRenderer, total.count ? 255 : 128, 255, total.count ? 64 : 128, 255);
+    SDL_snprintf(text, sizeof(text), "heap/frame %llu (%llu B)",
+                 static_cast<unsigned long long>(total.count), static_cast<unsigned long long>(total.bytes));
+    SDL_RenderDebugText(gRenderer, x, y, text);
+    float row = y + line;
+    for (int s = 0; s < kSubsystemCount; ++s) {
+        if (!lastFrame[s].count) continue;
+        SDL_snprintf(text, sizeof(text), " %-10s %llu (%llu B)", kSubsystemNames[s],
+                     static_cast<unsigned long long>(lastFrame[s].count), static_cast<unsigned long long>(lastFrame[s].bytes));
+        SDL_RenderDebugText(gRenderer, x, row, text);
+        row += line;
+    }
+    SDL_SetRenderDrawColor(gRenderer, 128, 128, 128, 255);
+    SDL_snprintf(text, sizeof(text), "total %llu", static_cast<unsigned long long>(heapAllocationCount()));
+    SDL_RenderDebugText(gRenderer, x, row, text);
+}
+
+bool allocReport() {
+    SDL_Log("alloc: %llu allocations since startup, peak frame %llu (%llu bytes)",
+            static_cast<unsigned long long>(heapAllocationCount()),
+            static_cast<unsigned long long>(peakFrame.count), static_cast<unsigned long long>(peakFrame.bytes));
+    for (int s = 0; s < kSubsystemCount; ++s) {
+        SDL_Log("alloc:   %-10s %llu (%llu bytes)", kSubsystemNames[s],
+                static_cast<unsigned long long>(allocCounts[s].load(std::memory_order_relaxed)),
+                static_cast<unsigned long long>(allocBytes[s].load(std::memory_order_relaxed)));
+    }
+    SDL_Log("alloc: frame arena high water %zu bytes in %zu blocks", frameArena().highWater(), frameArena().blockCount());
+    SDL_Log("alloc: %llu of %llu steady-state gameplay frames allocated",
+            static_cast<unsigned long long>(allocatingFrames), static_cast<unsigned long long>(gameplayFramesChecked));
+    SDL_Log("alloc: %llu more allocated only in exempt subsystems, which strict mode does not fail on:",
+            static_cast<unsigned long long>(exemptFrames));
+    for (int s = 0; s < kSubsystemCount; ++s) {
+        if (isSteadyStateSubsystem(s)) continue;
+        SDL_Log("alloc:   %-10s %llu (%llu bytes)", kSubsystemNames[s], static_cast<unsigned long long>(exemptTotals[s].count),
+                static_cast<unsigned long long>(exemptTotals[s].bytes));
+    }
+    if (allocStrictMode && allocatingFrames > 0) {
+        SDL_Log("alloc: strict mode FAILED");
+        return false;
+    }
+    return true;
+}
+
+#endif
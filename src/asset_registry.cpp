@@ -0,0 +1,73 @@
+#include "asset_registry.h"
+#include <cstring>
+
+const AssetEntry* findAsset(const char* name) {
+    for (int i = 0; i < kAssetCount; ++i) {
+        if (SDL_strcmp(kAssetTable[i].name, name) == 0) return &kAssetTable[i];
+    }
+    SDL_Log("Asset '%s' was not packed", name);
+    return nullptr;
+}
+
+namespace {
+    // Inverse of the packer's encoder: a header byte with the high bit set is a run of
+    // (h & 0x7F) + 1 copies of the following pixel, otherwise h + 1 literal pixels follow.
+    bool decodeRle(const unsigned char* src, size_t srcSize, SDL_Surface* dst) {
+        const size_t pixelCount = static_cast<size_t>(dst->w) * dst->h;
+        unsigned char* pixels = static_cast<unsigned char*>(dst->pixels);
+        size_t p = 0;
+        size_t i = 0;
+        auto pixelAt = [&](size_t n) {
+            return pixels + (n / dst->w) * dst->pitch + (n % dst->w) * 4;
+        };
+        while (i < srcSize && p < pixelCount) {
+            const unsigned char header = src[i++];
+            const size_t count = (header & 0x7F) + 1;
+            if (p + count > pixelCount) return false;
+            if (header & 0x80) {
+                if (i + 4 > srcSize) return false;
+                for (size_t n = 0; n < count; ++n) std::memcpy(pixelAt(p++), src + i, 4);
+                i += 4;
+            } else {
+                if (i + count * 4 > srcSize) return false;
+                for (size_t n = 0; n < count; ++n, i += 4) std::memcpy(pixelAt(p++), src + i, 4);
+            }
+        }
+        return p == pixelCount;
+    }
+}
+
+SDL_Surface* createSurfaceFromAsset(const char* name) {
+    const AssetEntry* entry = findAsset(name);
+    if (!entry || entry->kind != AssetKind::Image) return nullptr;
+
+    SDL_Surface* surface = SDL_CreateSurface(entry->width, entry->height, SDL_PIXELFORMAT_RGBA32);
+    if (!surface) {
+        SDL_Log("Could not create surface for asset '%s': %s", name, SDL_GetError());
+        return nullptr;
+    }
+
+    const unsigned char* src = kAssetBlob + entry->offset;
+    bool ok = true;
+    if (entry->encoding == AssetEncoding::RleRgba) {
+        ok = decodeRle(src, entry->size, surface);
+    } else {
+        const size_t rowBytes = static_cast<size_t>(entry->width) * 4;
+        ok = entry->size == rowBytes * entry->height;
+        for (int y = 0; ok && y < entry->height; ++y) {
+            std::memcpy(static_cast<unsigned char*>(surface->pixels) + y * surface->pitch, src + y * rowBytes, rowBytes);
+        }
+    }
+    if (!ok) {
+        SDL_Log("Asset '%s' is corrupt", name);
+        SDL_DestroySurface(surface);
+        return nullptr;
+    }
+    return surface;
+}
+
+SDL_IOStream* openAssetStream(const char* name) {
+    const AssetEntry* entry = findAsset(name);
+    if (!entry) return nullptr;
+    return SDL_IOFromConstMem(kAssetBlob + entry->offset, entry->size);
+}
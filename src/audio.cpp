@@ -0,0 +1,245 @@
+#include "audio.h"
+#include "alloc_check.h"
+#include "log.h"
+#include "replay.h"
+#include "netplay.h"
+#include "spectator.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <vector>
+
+bool audioEnabled = true;
+int audioBufferFrames = 256; // ~5.3 ms at 48 kHz
+
+namespace {
+    constexpr int kSampleRate = 48000;
+    constexpr int kEffectCount = static_cast<int>(SoundEffect::Count);
+    constexpr int kMixChunk = 512;      // frames mixed per pass in the callback
+    constexpr int kMaxVoices = 16;
+    constexpr size_t kQueueSize = 64;   // commands, power of two
+    constexpr float kMasterVolume = 0.35f;
+    constexpr float kTwoPi = 6.28318531f;
+
+    struct SoundCommand {
+        Uint64 ns; // when playSound was called
+        SoundEffect effect;
+    };
+
+    // Single producer (the game thread), single consumer (the audio callback)
+    SoundCommand commands[kQueueSize];
+    std::atomic<size_t> commandHead{ 0 };
+    std::atomic<size_t> commandTail{ 0 };
+    std::atomic<Uint64> commandsDropped{ 0 };
+
+    struct Voice {
+        const float* samples; // nullptr when the voice is free
+        int length;
+        int position;         // negative while waiting to start
+    };
+
+    // Audio thread only; read by closeAudio once the stream is gone
+    Voice voices[kMaxVoices];
+    float mixBuffer[kMixChunk];
+    Uint64 lastCallbackNs = 0;
+    Uint64 soundsStarted = 0;
+    Uint64 voicesStolen = 0;
+    Uint64 scheduleTotalNs = 0;
+    Uint64 scheduleMaxNs = 0;
+
+    // Written once in initAudio before the device starts, read-only afterwards
+    std::vector<float> sampleData[kEffectCount];
+    SDL_AudioStream* stream = nullptr;
+    int deviceFrames = 0;
+    int deviceRate = kSampleRate;
+
+    enum class Wave { Sine, Square, Triangle, Noise };
+
+    // Mix a tone into out starting at startMs: a sweep from startHz to endHz with a
+    // short attack, exponential decay and a short release so it never clicks
+    void addTone(std::vector<float>& out, float startMs, float lengthMs, float startHz, float endHz,
+                 Wave wave, float gain, float decay) {
+        const int start = static_cast<int>(startMs * kSampleRate / 1000.f);
+        const int length = static_cast<int>(lengthMs * kSampleRate / 1000.f);
+        const int ramp = kSampleRate / 500; // 2 ms
+        if (out.size() < static_cast<size_t>(start + length)) out.resize(start + length, 0.f);
+
+        Uint32 noise = 0x9E3779B9u;
+        float phase = 0.f;
+        for (int i = 0; i < length; ++i) {
+            const float t = static_cast<float>(i) / kSampleRate;
+            const float hz = startHz + (endHz - startHz) * i / length;
+            phase += kTwoPi * hz / kSampleRate;
+            if (phase >= kTwoPi) phase -= kTwoPi;
+
+            float s = 0.f;
+            switch (wave) {
+                case Wave::Sine: s = std::sin(phase); break;
+                case Wave::Square: s = phase < kTwoPi * 0.5f ? 1.f : -1.f; break;
+                case Wave::Triangle: s = 1.f - 4.f * std::fabs(phase / kTwoPi - 0.5f); break;
+                case Wave::Noise:
+                    noise = noise * 1664525u + 1013904223u;
+                    s = static_cast<float>(noise >> 8) / 8388608.f - 1.f;
+                    break;
+            }
+            float env = std::exp(-decay * t);
+            env *= std::min(1.f, static_cast<float>(i) / ramp);
+            env *= std::min(1.f, static_cast<float>(length - i) / ramp);
+            out[start + i] += s * env * gain;
+        }
+    }
+
+    void synthesizeSamples() {
+        std::vector<float>& move = sampleData[static_cast<int>(SoundEffect::Move)];
+        addTone(move, 0, 30, 1200, 1200, Wave::Square, 0.18f, 60);
+
+        std::vector<float>& rotate = sampleData[static_cast<int>(SoundEffect::Rotate)];
+        addTone(rotate, 0, 45, 700, 1100, Wave::Triangle, 0.4f, 40);
+
+        std::vector<float>& hardDrop = sampleData[static_cast<int>(SoundEffect::HardDrop)];
+        addTone(hardDrop, 0, 90, 160, 60, Wave::Sine, 0.9f, 30);
+        addTone(hardDrop, 0, 60, 0, 0, Wave::Noise, 0.3f, 60);
+
+        std::vector<float>& lock = sampleData[static_cast<int>(SoundEffect::Lock)];
+        addTone(lock, 0, 60, 220, 180, Wave::Triangle, 0.6f, 50);
+
+        std::vector<float>& lineClear = sampleData[static_cast<int>(SoundEffect::LineClear)];
+        const float arpeggio[] = { 523.f, 659.f, 784.f }; // C5 E5 G5
+        for (int i = 0; i < 3; ++i) addTone(lineClear, i * 50.f, 90, arpeggio[i], arpeggio[i], Wave::Square, 0.2f, 12);
+
+        std::vector<float>& tetris = sampleData[static_cast<int>(SoundEffect::Tetris)];
+        const float chord[] = { 523.f, 659.f, 784.f, 1047.f };
+        for (float hz : chord) addTone(tetris, 0, 450, hz, hz, Wave::Square, 0.14f, 6);
+        addTone(tetris, 0, 300, 400, 1600, Wave::Sine, 0.3f, 4);
+
+        std::vector<float>& levelUp = sampleData[static_cast<int>(SoundEffect::LevelUp)];
+        const float fanfare[] = { 392.f, 523.f, 659.f, 784.f }; // G4 C5 E5 G5
+        for (int i = 0; i < 4; ++i) addTone(levelUp, i * 90.f, i == 3 ? 260.f : 110.f, fanfare[i], fanfare[i], Wave::Triangle, 0.45f, 8);
+    }
+
+    void startVoice(const SoundCommand& cmd, Uint64 nowNs) {
+        const std::vector<float>& pcm = sampleData[static_cast<int>(cmd.effect)];
+        if (pcm.empty()) return;
+
+        // A command that arrived partway through the last period starts the same
+        // distance into this one, so every sound lands a fixed time after its input
+        // instead of jittering by up to a whole period
+        Uint64 delayNs = 0;
+        if (lastCallbackNs && cmd.ns > lastCallbackNs) {
+            const Uint64 periodNs = static_cast<Uint64>(deviceFrames) * 1000000000ull / deviceRate;
+            delayNs = std::min(cmd.ns - lastCallbackNs, periodNs);
+        }
+        const int delayFrames = static_cast<int>(delayNs * kSampleRate / 1000000000ull);
+
+        // Free voice, or steal the one closest to finishing
+        Voice* slot = nullptr;
+        for (Voice& v : voices) {
+            if (!v.samples) { slot = &v; break; }
+            if (!slot || v.length - v.position < slot->length - slot->position) slot = &v;
+        }
+        if (slot->samples) voicesStolen++;
+        *slot = Voice{ pcm.data(), static_cast<int>(pcm.size()), -delayFrames };
+
+        const Uint64 scheduledNs = nowNs - std::min(nowNs, cmd.ns) + delayNs;
+        scheduleTotalNs += scheduledNs;
+        scheduleMaxNs = std::max(scheduleMaxNs, scheduledNs);
+        soundsStarted++;
+    }
+
+    void mixVoices(int frames) {
+        std::fill(mixBuffer, mixBuffer + frames, 0.f);
+        for (Voice& v : voices) {
+            if (!v.samples) continue;
+            int i = 0;
+            if (v.position < 0) {
+                i = std::min(frames, -v.position);
+                v.position += i;
+            }
+            for (; i < frames && v.position < v.length; ++i) mixBuffer[i] += v.samples[v.position++];
+            if (v.position >= v.length) v.samples = nullptr;
+        }
+        for (int i = 0; i < frames; ++i) mixBuffer[i] = std::clamp(mixBuffer[i] * kMasterVolume, -1.f, 1.f);
+    }
+
+    // Runs on SDL's audio thread whenever the device wants more data
+    void SDLCALL audioCallback(void*, SDL_AudioStream* s, int additionalAmount, int) {
+        ALLOC_SCOPE(Audio);
+        const Uint64 now = SDL_GetTicksNS();
+
+        size_t tail = commandTail.load(std::memory_order_relaxed);
+        const size_t head = commandHead.load(std::memory_order_acquire);
+        for (; tail != head; ++tail) startVoice(commands[tail & (kQueueSize - 1)], now);
+        commandTail.store(tail, std::memory_order_release);
+        lastCallbackNs = now;
+
+        for (int frames = additionalAmount / static_cast<int>(sizeof(float)); frames > 0;) {
+            const int n = std::min(frames, kMixChunk);
+            mixVoices(n);
+            SDL_PutAudioStreamData(s, mixBuffer, n * static_cast<int>(sizeof(float)));
+            frames -= n;
+        }
+    }
+}
+
+bool initAudio() {
+    if (!audioEnabled) {
+        LOG_INFO("Audio disabled");
+        return false;
+    }
+    synthesizeSamples();
+
+    if (!SDL_InitSubSystem(SDL_INIT_AUDIO)) {
+        LOG_WARN("Audio could not initialize! SDL error: %s", SDL_GetError());
+        return false;
+    }
+
+    // Ask for a small device buffer; the driver may round it up
+    char frames[16];
+    SDL_snprintf(frames, sizeof(frames), "%d", audioBufferFrames);
+    SDL_SetHint(SDL_HINT_AUDIO_DEVICE_SAMPLE_FRAMES, frames);
+
+    const SDL_AudioSpec spec{ SDL_AUDIO_F32, 1, kSampleRate };
+    stream = SDL_OpenAudioDeviceStream(SDL_AUDIO_DEVICE_DEFAULT_PLAYBACK, &spec, audioCallback, nullptr);
+    if (!stream) {
+        LOG_WARN("Audio device could not be opened! SDL error: %s", SDL_GetError());
+        SDL_QuitSubSystem(SDL_INIT_AUDIO);
+        return false;
+    }
+
+    SDL_AudioSpec deviceSpec = spec;
+    if (!SDL_GetAudioDeviceFormat(SDL_GetAudioStreamDevice(stream), &deviceSpec, &deviceFrames) || deviceFrames <= 0) {
+        deviceFrames = audioBufferFrames;
+    }
+    deviceRate = deviceSpec.freq > 0 ? deviceSpec.freq : kSampleRate;
+    LOG_INFO("Audio: %d Hz, %d-frame device buffer (%.1f ms, %d requested)",
+             deviceRate, deviceFrames, deviceFrames * 1000.0 / deviceRate, audioBufferFrames);
+
+    SDL_ResumeAudioStreamDevice(stream);
+    return true;
+}
+
+void closeAudio() {
+    if (!stream) return;
+    SDL_DestroyAudioStream(stream); // the callback has stopped once this returns
+    stream = nullptr;
+    SDL_QuitSubSystem(SDL_INIT_AUDIO);
+
+    if (soundsStarted == 0) return;
+    const double bufferMs = deviceFrames * 1000.0 / deviceRate;
+    LOG_INFO("Audio: %llu sounds, input to mix avg %.2f ms max %.2f ms (+%.1f ms device buffer), %llu voices stolen, %llu dropped",
+             static_cast<unsigned long long>(soundsStarted),
+             scheduleTotalNs / 1000000.0 / soundsStarted, scheduleMaxNs / 1000000.0, bufferMs,
+             static_cast<unsigned long long>(voicesStolen),
+             static_cast<unsigned long long>(commandsDropped.load(std::memory_order_relaxed)));
+}
+
+void playSound(SoundEffect effect) {
+    if (!stream || replaySeeking() || netplayResimulating() || spectatorActive()) return;
+    const size_t head = commandHead.load(std::memory_order_relaxed);
+    if (head - commandTail.load(std::memory_order_acquire) >= kQueueSize) {
+        commandsDropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    commands[head & (kQueueSize - 1)] = SoundCommand{ SDL_GetTicksNS(), effect };
+    commandHead.store(head + 1, std::memory_order_release);
+}
@@ -0,0 +1,349 @@
+#include "batch_sim.h"
+#include "tetris_utils.h"
+#include "row_board.h"
+#include "randomizer.h"
+#include "log.h"
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <cstring>
+#include <functional>
+#include <thread>
+#include <vector>
+
+int batchGames = 0;
+int batchLanes = 32;
+int batchThreads = 0;
+int batchPieceLimit = 1000;
+const char* batchPolicyName = "greedy";
+int batchRandomizer = -1;
+
+namespace {
+    constexpr int kPadRows = 3;             // full rows under the board, so a drop needs no bounds check
+    constexpr int kSpawnX = boardWidth / 2; // where handlePieceLanded puts every new piece
+    constexpr Uint64 kPolicySeedMix = 0x9E3779B97F4A7C15ull;
+
+    enum class Policy { Greedy, Random };
+
+    // Totals for one thread, added together at the end
+    struct BatchStats {
+        Uint64 games = 0;
+        Uint64 toppedOut = 0;
+        Uint64 pieces = 0;
+        Uint64 lines = 0;
+        Uint64 score = 0;
+        std::vector<Uint64> linesHistogram; // games by lines cleared
+    };
+
+    struct BatchRun {
+        Policy policy = Policy::Greedy;
+        RandomizerKind kind = RandomizerKind::Bag7;
+        Uint64 seed = 0;
+        int games = 0;
+        int pieceLimit = 0;
+        std::atomic<int> nextGame{ 0 };
+    };
+
+    // Every per-lane array is indexed [lane]; rows is [y * lanes + lane]
+    struct LaneBlock {
+        int lanes = 0;
+        int live = 0;                 // lanes with a game in progress
+        std::vector<Uint16> rows;     // boardHeight rows, then kPadRows full ones
+        std::vector<Uint8> playing;
+        std::vector<Uint8> piece;     // the type to place this step
+        std::vector<int> score;
+        std::vector<int> lines;
+        std::vector<int> pieces;
+        std::vector<PieceQueue> queue;
+        std::vector<Xoshiro128> policyRng;
+
+        // The candidate being evaluated
+        std::vector<Uint16> shape[4]; // piece rows moved to the candidate column; all 0 if it does not apply
+        std::vector<Uint8> falling;
+        std::vector<int> land;        // top row after the drop; -1 if it does not fit at the top
+        std::vector<Uint16> seen;     // cells at or above the current row, per column
+        std::vector<int> cost;
+
+        // The best candidate of this step
+        std::vector<int> bestCost;
+        std::vector<int> bestRot;
+        std::vector<int> bestCol;
+        std::vector<int> bestLand;
+    };
+
+    void allocateBlock(LaneBlock& b, int lanes) {
+        b.lanes = lanes;
+        b.rows.assign(static_cast<size_t>(boardHeight + kPadRows) * lanes, kFullRow);
+        for (std::vector<Uint8>* v : { &b.playing, &b.piece, &b.falling }) v->assign(lanes, 0);
+        for (std::vector<int>* v : { &b.score, &b.lines, &b.pieces, &b.land, &b.cost,
+                                     &b.bestCost, &b.bestRot, &b.bestCol, &b.bestLand }) {
+            v->assign(lanes, 0);
+        }
+        for (std::vector<Uint16>& v : b.shape) v.assign(lanes, 0);
+        b.seen.assign(lanes, 0);
+        b.queue.resize(lanes);
+        b.policyRng.resize(lanes);
+    }
+
+    bool spawnBlockedInLane(const LaneBlock& b, int lane) {
+        const RowShape& s = kRowShapes.shapes[b.piece[lane]][0];
+        for (int sy = 0; sy < s.height; ++sy) {
+            if (b.rows[sy * b.lanes + lane] & (s.rows[sy] << kSpawnX)) return true;
+        }
+        return false;
+    }
+
+    // The next game from the shared counter, or the lane goes idle
+    void startGame(LaneBlock& b, BatchRun& run, int lane) {
+        const int game = run.nextGame.fetch_add(1, std::memory_order_relaxed);
+        for (int y = 0; y < boardHeight; ++y) b.rows[y * b.lanes + lane] = 0; // idle lanes stay empty too
+        if (game >= run.games) {
+            b.playing[lane] = 0;
+            return;
+        }
+        b.score[lane] = 0;
+        b.lines[lane] = 0;
+        b.pieces[lane] = 0;
+        pieceQueueInit(b.queue[lane], run.kind, run.seed + static_cast<Uint64>(game));
+        xoshiroSeed(b.policyRng[lane], (run.seed + static_cast<Uint64>(game)) ^ kPolicySeedMix);
+        b.piece[lane] = static_cast<Uint8>(pieceQueuePop(b.queue[lane]));
+        b.playing[lane] = 1;
+        b.live++;
+    }
+
+    void finishGame(LaneBlock& b, BatchRun& run, BatchStats& stats, int lane, bool toppedOut) {
+        stats.games++;
+        stats.toppedOut += toppedOut;
+        stats.pieces += static_cast<Uint64>(b.pieces[lane]);
+        stats.lines += static_cast<Uint64>(b.lines[lane]);
+        stats.score += static_cast<Uint64>(b.score[lane]);
+        stats.linesHistogram[std::min<size_t>(b.lines[lane], stats.linesHistogram.size() - 1)]++;
+        b.live--;
+        startGame(b, run, lane);
+    }
+
+    // The first row that is not empty in every lane. A piece fits anywhere above it,
+    // so drops and scoring can start there instead of at the top.
+    int firstStackRow(const LaneBlock& b) {
+        for (int y = 0; y < boardHeight; ++y) {
+            Uint16 any = 0;
+            const Uint16* r = &b.rows[static_cast<size_t>(y) * b.lanes];
+            for (int lane = 0; lane < b.lanes; ++lane) any |= r[lane];
+            if (any) return y;
+        }
+        return boardHeight;
+    }
+
+    // false if the candidate applies to no lane. Lanes it applies to start falling
+    // from firstRow, where every piece still fits.
+    bool prepareCandidate(LaneBlock& b, int rot, int col, int firstRow) {
+        int applying = 0;
+        for (int lane = 0; lane < b.lanes; ++lane) {
+            const int type = b.piece[lane];
+            const RowShape& s = kRowShapes.shapes[type][rot];
+            const bool applies = b.playing[lane] && rot < kDistinctRotations[type] && col + s.width <= boardWidth;
+            for (int sy = 0; sy < 4; ++sy) b.shape[sy][lane] = applies ? static_cast<Uint16>(s.rows[sy] << col) : 0;
+            b.falling[lane] = applies;
+            b.land[lane] = applies ? firstRow - 1 : -1;
+            applying += applies;
+        }
+        return applying > 0;
+    }
+
+    // Lower every lane's piece one row at a time until it collides; the padding rows
+    // stop it at the floor
+    void dropCandidate(LaneBlock& b, int firstRow) {
+        const int n = b.lanes;
+        const Uint16* s0 = b.shape[0].data();
+        const Uint16* s1 = b.shape[1].data();
+        const Uint16* s2 = b.shape[2].data();
+        const Uint16* s3 = b.shape[3].data();
+        Uint8* falling = b.falling.data();
+        int* land = b.land.data();
+        for (int y = firstRow; y < boardHeight; ++y) {
+            const Uint16* r0 = &b.rows[static_cast<size_t>(y) * n];
+            const Uint16* r1 = r0 + n;
+            const Uint16* r2 = r1 + n;
+            const Uint16* r3 = r2 + n;
+            for (int lane = 0; lane < n; ++lane) {
+                const Uint16 hit = (r0[lane] & s0[lane]) | (r1[lane] & s1[lane]) | (r2[lane] & s2[lane]) | (r3[lane] & s3[lane]);
+                falling[lane] &= hit == 0;
+                land[lane] += falling[lane];
+            }
+        }
+    }
+
+    // The board after the drop, top to bottom with full rows skipped as if already
+    // cleared. A column's height is the number of rows at or below its top cell, so
+    // summing the filled columns of "seen" over the rows gives the aggregate height,
+    // and columns whose "seen" differs from their neighbour's give the bumpiness. The
+    // terms go straight into the cost: every extra array written in the loop is one
+    // more aliasing check before the compiler will vectorize it.
+    void scoreCandidate(LaneBlock& b, int firstRow) {
+        const int n = b.lanes;
+        const Uint16* s0 = b.shape[0].data();
+        const Uint16* s1 = b.shape[1].data();
+        const Uint16* s2 = b.shape[2].data();
+        const Uint16* s3 = b.shape[3].data();
+        const int* land = b.land.data();
+        Uint16* seen = b.seen.data();
+        int* cost = b.cost.data();
+        std::fill(b.seen.begin(), b.seen.end(), 0);
+        std::fill(b.cost.begin(), b.cost.end(), 0);
+        for (int y = firstRow; y < boardHeight; ++y) {
+            const Uint16* r = &b.rows[static_cast<size_t>(y) * n];
+            for (int lane = 0; lane < n; ++lane) {
+                // Masks rather than branches, which would stop the loop vectorizing
+                const int d = y - land[lane];
+                const Uint16 p = (s0[lane] & -static_cast<Uint16>(d == 0)) | (s1[lane] & -static_cast<Uint16>(d == 1)) |
+                                 (s2[lane] & -static_cast<Uint16>(d == 2)) | (s3[lane] & -static_cast<Uint16>(d == 3));
+                const Uint16 row = r[lane] | p;
+                const Uint16 keep = -static_cast<Uint16>(row != kFullRow); // all ones unless the row clears
+                const Uint16 above = seen[lane];
+                const Uint16 kept = above | (row & keep);
+                cost[lane] += kHolesWeight * popcount16(above & ~row & kFullRow) +
+                              kAggregateWeight * popcount16(kept & keep) +
+                              kBumpinessWeight * popcount16((kept ^ (kept >> 1)) & (kFullRow >> 1) & keep) -
+                              kLinesWeight * (row == kFullRow);
+                seen[lane] = kept;
+            }
+        }
+    }
+
+    void randomCost(LaneBlock& b) {
+        for (int lane = 0; lane < b.lanes; ++lane) b.cost[lane] = static_cast<int>(xoshiroNext(b.policyRng[lane]) >> 1);
+    }
+
+    void keepBest(LaneBlock& b, int rot, int col) {
+        for (int lane = 0; lane < b.lanes; ++lane) {
+            const bool better = b.land[lane] >= 0 && b.cost[lane] < b.bestCost[lane];
+            b.bestCost[lane] = better ? b.cost[lane] : b.bestCost[lane];
+            b.bestRot[lane] = better ? rot : b.bestRot[lane];
+            b.bestCol[lane] = better ? col : b.bestCol[lane];
+            b.bestLand[lane] = better ? b.land[lane] : b.bestLand[lane];
+        }
+    }
+
+    // Lock the chosen placement, clear lines, score, and spawn the next piece
+    void placeBest(LaneBlock& b, BatchRun& run, BatchStats& stats) {
+        const int n = b.lanes;
+        for (int lane = 0; lane < n; ++lane) {
+            if (!b.playing[lane]) continue;
+            if (b.bestLand[lane] < 0) { // nothing fits
+                finishGame(b, run, stats, lane, true);
+                continue;
+            }
+            const RowShape& s = kRowShapes.shapes[b.piece[lane]][b.bestRot[lane]];
+            const int top = b.bestLand[lane];
+            int full = 0;
+            for (int sy = 0; sy < s.height; ++sy) {
+                Uint16& row = b.rows[(top + sy) * n + lane];
+                row = static_cast<Uint16>(row | (s.rows[sy] << b.bestCol[lane]));
+                full += row == kFullRow;
+            }
+            if (full > 0) {
+                int write = boardHeight - 1;
+                for (int y = boardHeight - 1; y >= 0; --y) {
+                    const Uint16 row = b.rows[y * n + lane];
+                    if (row != kFullRow) b.rows[write-- * n + lane] = row;
+                }
+                for (; write >= 0; --write) b.rows[write * n + lane] = 0;
+            }
+
+            b.score[lane] += lineClearScore(full, levelForLines(b.lines[lane]));
+            b.lines[lane] += full;
+            b.pieces[lane]++;
+            if (b.pieces[lane] >= run.pieceLimit) {
+                finishGame(b, run, stats, lane, false);
+                continue;
+            }
+            b.piece[lane] = static_cast<Uint8>(pieceQueuePop(b.queue[lane]));
+            if (spawnBlockedInLane(b, lane)) finishGame(b, run, stats, lane, true);
+        }
+    }
+
+    void runLanes(BatchRun& run, int lanes, BatchStats& stats) {
+        LaneBlock b;
+        allocateBlock(b, lanes);
+        stats.linesHistogram.assign(static_cast<size_t>(run.pieceLimit) * 4 / boardWidth + 2, 0);
+        for (int lane = 0; lane < lanes; ++lane) startGame(b, run, lane);
+
+        while (b.live > 0) {
+            std::fill(b.bestCost.begin(), b.bestCost.end(), INT_MAX);
+            std::fill(b.bestLand.begin(), b.bestLand.end(), -1);
+            const int firstRow = std::max(0, firstStackRow(b) - 4); // pieces are at most 4 rows tall
+            for (int rot = 0; rot < 4; ++rot) {
+                for (int col = 0; col < boardWidth; ++col) {
+                    if (!prepareCandidate(b, rot, col, firstRow)) continue;
+                    dropCandidate(b, firstRow);
+                    if (run.policy == Policy::Greedy) scoreCandidate(b, firstRow);
+                    else randomCost(b);
+                    keepBest(b, rot, col);
+                }
+            }
+            placeBest(b, run, stats);
+        }
+    }
+
+    int linesPercentile(const std::vector<Uint64>& histogram, Uint64 games, int percent) {
+        const Uint64 rank = games * percent / 100;
+        Uint64 seen = 0;
+        for (size_t lines = 0; lines < histogram.size(); ++lines) {
+            seen += histogram[lines];
+            if (seen > rank) return static_cast<int>(lines);
+        }
+        return static_cast<int>(histogram.size()) - 1;
+    }
+}
+
+int runBatchSim() {
+    BatchRun run;
+    if (std::strcmp(batchPolicyName, "greedy") == 0) run.policy = Policy::Greedy;
+    else if (std::strcmp(batchPolicyName, "random") == 0) run.policy = Policy::Random;
+    else {
+        LOG_ERROR("Unknown --batch-policy %s (greedy or random)", batchPolicyName);
+        return 1;
+    }
+    if (batchRandomizer >= static_cast<int>(RandomizerKind::Count)) {
+        LOG_ERROR("Unknown --batch-randomizer %d (0-%d)", batchRandomizer, static_cast<int>(RandomizerKind::Count) - 1);
+        return 1;
+    }
+    run.kind = batchRandomizer >= 0 ? static_cast<RandomizerKind>(batchRandomizer) : randomizerKind;
+    run.seed = fixedSeedEnabled ? fixedSeed : SDL_GetTicksNS();
+    run.games = batchGames;
+    run.pieceLimit = std::max(1, batchPieceLimit);
+
+    const int cores = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    const int threadCount = std::clamp(batchThreads > 0 ? batchThreads : cores, 1, run.games);
+    const int lanes = std::clamp(batchLanes, 1, std::max(1, run.games / threadCount));
+    LOG_INFO("Batch: %d games, %s, %s policy, seed %llu, %d threads x %d lanes", run.games,
+             randomizerName(run.kind), batchPolicyName, static_cast<unsigned long long>(run.seed), threadCount, lanes);
+
+    std::vector<BatchStats> stats(threadCount);
+    std::vector<std::thread> workers;
+    const Uint64 startNs = SDL_GetTicksNS();
+    for (int t = 0; t < threadCount; ++t) workers.emplace_back(runLanes, std::ref(run), lanes, std::ref(stats[t]));
+    for (std::thread& w : workers) w.join();
+    const double seconds = (SDL_GetTicksNS() - startNs) / 1000000000.0;
+
+    BatchStats total;
+    total.linesHistogram.assign(stats[0].linesHistogram.size(), 0);
+    for (const BatchStats& s : stats) {
+        total.games += s.games;
+        total.toppedOut += s.toppedOut;
+        total.pieces += s.pieces;
+        total.lines += s.lines;
+        total.score += s.score;
+        for (size_t i = 0; i < s.linesHistogram.size(); ++i) total.linesHistogram[i] += s.linesHistogram[i];
+    }
+
+    const double games = static_cast<double>(total.games);
+    const double gamesPerSecond = seconds > 0 ? games / seconds : 0.0;
+    LOG_INFO("Batch: %.2fs, %.0f games/s, %.0f games/s per core, %.0f pieces/s", seconds, gamesPerSecond,
+             gamesPerSecond / std::min(threadCount, cores), seconds > 0 ? total.pieces / seconds : 0.0);
+    LOG_INFO("Batch: mean score %.0f, lines %.1f, pieces %.1f, %.1f%% topped out", total.score / games,
+             total.lines / games, total.pieces / games, 100.0 * total.toppedOut / games);
+    LOG_INFO("Batch: lines p10 %d, p50 %d, p90 %d", linesPercentile(total.linesHistogram, total.games, 10),
+             linesPercentile(total.linesHistogram, total.games, 50), linesPercentile(total.linesHistogram, total.games, 90));
+    return 0;
+}
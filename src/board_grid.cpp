@@ -0,0 +1,40 @@
+#include "board_grid.h"
+#include "globals.h"
+#include "log.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    constexpr Uint64 kFrameBudgetNs = 1000000000 / kScreenFps;
+}
+
+BoardLayout boardGridLayout(int index, int count, const BoardGridSpacing& spacing) {
+    const int cols = static_cast<int>(std::ceil(std::sqrt(static_cast<float>(count))));
+    const int rows = (count + cols - 1) / cols;
+    const float areaW = static_cast<float>(kScreenWidth) / cols;
+    const float areaH = static_cast<float>(kScreenHeight) / rows;
+    const float cell = std::floor(std::min((areaW - 2 * spacing.margin) / (boardWidth + spacing.sideCells),
+                                           (areaH - 2 * spacing.margin - spacing.labelHeight) / boardHeight));
+    const float areaX = (index % cols) * areaW;
+    const float areaY = (index / cols) * areaH;
+    return { areaX + std::floor((areaW - (boardWidth + spacing.sideCells) * cell) / 2),
+             areaY + spacing.margin + spacing.labelHeight, cell };
+}
+
+void GridFrameStats::add(Uint64 frameStart, Uint64 simulated, Uint64 built, Uint64 drawn) {
+    frames++;
+    simNs += simulated - frameStart;
+    buildNs += built - simulated;
+    drawNs += drawn - built;
+    worstFrameNs = std::max(worstFrameNs, drawn - frameStart);
+    if (drawn - frameStart > kFrameBudgetNs) framesOverBudget++;
+}
+
+void GridFrameStats::log(const char* mode, int boards) const {
+    if (frames == 0) return;
+    char build[32] = ""; // only the modes that prepare vertices ahead of drawing
+    if (buildNs > 0) SDL_snprintf(build, sizeof(build), ", rebuild %.3f ms", buildNs / 1e6 / frames);
+    LOG_INFO("%s: %llu frames, %d boards: simulate %.3f ms%s, draw %.3f ms, worst %.3f ms, %llu over budget", mode,
+             static_cast<unsigned long long>(frames), boards, simNs / 1e6 / frames, build, drawNs / 1e6 / frames,
+             worstFrameNs / 1e6, static_cast<unsigned long long>(framesOverBudget));
+}
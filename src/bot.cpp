@@ -0,0 +1,367 @@
+#include "bot.h"
+#include "tetris_utils.h"
+#include "log.h"
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#ifndef _WIN32
+#include <cerrno>
+#include <csignal>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+BotTransport botTransport = BotTransport::None;
+const char* botSocketPath = nullptr;
+bool botHeadless = false;
+int botGameLimit = 0;
+
+namespace {
+    constexpr size_t kHeaderSize = 3;
+    constexpr size_t kBufferSize = 4096;
+    constexpr size_t kMaxSamples = 1 << 16;
+
+    int readFd = -1;
+    int writeFd = -1;
+    int socketFd = -1;
+    bool connected = false;
+
+    Uint8 outBuf[kBufferSize];
+    size_t outLen = 0;
+    Uint8 inBuf[kBufferSize];
+    size_t inLen = 0;
+
+    Uint32 stateSeq = 0;
+    bool awaitingReply = false;
+    bool stateNeeded = true;
+    int statePieceCount = -1;
+    Uint64 stateSentNs = 0;
+
+    std::vector<Uint64> roundTripNs;
+    std::vector<Uint64> overheadNs; // round trip minus the bot's own think time
+    Uint64 gamesPlayed = 0;
+    Uint64 repliesApplied = 0;
+    Uint64 staleReplies = 0;
+
+    struct Message {
+        BotMessage type;
+        const Uint8* payload;
+        size_t length;
+    };
+
+    void put8(Uint8 v) { outBuf[outLen++] = v; }
+    void put16(Uint16 v) { put8(static_cast<Uint8>(v)); put8(static_cast<Uint8>(v >> 8)); }
+    void put32(Uint32 v) { put16(static_cast<Uint16>(v)); put16(static_cast<Uint16>(v >> 16)); }
+    Uint16 get16(const Uint8* p) { return static_cast<Uint16>(p[0] | (p[1] << 8)); }
+    Uint32 get32(const Uint8* p) { return get16(p) | (static_cast<Uint32>(get16(p + 2)) << 16); }
+
+    // Reserve room for a message of up to maxPayload bytes; returns where its header is
+    size_t beginMessage(BotMessage type, size_t maxPayload) {
+        SDL_assert(outLen + kHeaderSize + maxPayload <= kBufferSize);
+        const size_t at = outLen;
+        put8(static_cast<Uint8>(type));
+        put16(0);
+        return at;
+    }
+
+    void endMessage(size_t at) {
+        const size_t length = outLen - at - kHeaderSize;
+        outBuf[at + 1] = static_cast<Uint8>(length);
+        outBuf[at + 2] = static_cast<Uint8>(length >> 8);
+    }
+
+    void disconnect(const char* why) {
+        if (!connected) return;
+        connected = false;
+        LOG_INFO("Bot disconnected: %s", why);
+    }
+
+#ifndef _WIN32
+    bool flush() {
+        size_t sent = 0;
+        while (connected && sent < outLen) {
+            const ssize_t n = write(writeFd, outBuf + sent, outLen - sent);
+            if (n < 0 && errno == EINTR) continue;
+            if (n <= 0) {
+                disconnect(n < 0 ? strerror(errno) : "write failed");
+                break;
+            }
+            sent += static_cast<size_t>(n);
+        }
+        outLen = 0;
+        return connected;
+    }
+
+    // Read whatever is available; with wait, block until at least one byte arrives
+    bool fill(bool wait) {
+        if (!connected || inLen == kBufferSize) return false;
+        if (!wait) {
+            pollfd p{ readFd, POLLIN, 0 };
+            if (poll(&p, 1, 0) <= 0) return false;
+        }
+        for (;;) {
+            const ssize_t n = read(readFd, inBuf + inLen, kBufferSize - inLen);
+            if (n < 0 && errno == EINTR) continue;
+            if (n <= 0) {
+                disconnect(n == 0 ? "end of stream" : strerror(errno));
+                return false;
+            }
+            inLen += static_cast<size_t>(n);
+            return true;
+        }
+    }
+#else
+    bool flush() { outLen = 0; return false; }
+    bool fill(bool) { return false; }
+#endif
+
+    // Next complete message from the input buffer. It stays valid until the next call.
+    size_t consumed = 0;
+    bool nextMessage(Message& m, bool wait) {
+        if (consumed) {
+            inLen -= consumed;
+            std::memmove(inBuf, inBuf + consumed, inLen);
+            consumed = 0;
+        }
+        for (;;) {
+            if (inLen >= kHeaderSize) {
+                const size_t length = get16(inBuf + 1);
+                if (kHeaderSize + length > kBufferSize) {
+                    disconnect("message too large");
+                    return false;
+                }
+                if (inLen >= kHeaderSize + length) {
+                    m = Message{ static_cast<BotMessage>(inBuf[0]), inBuf + kHeaderSize, length };
+                    consumed = kHeaderSize + length;
+                    return true;
+                }
+            }
+            if (!fill(wait)) return false;
+        }
+    }
+
+    void sendState() {
+        const size_t at = beginMessage(BotMessage::State, 32 + kMaxPreview + 2 * boardHeight);
+        put32(++stateSeq);
+        put8(static_cast<Uint8>(currentPiece.type));
+        put8(static_cast<Uint8>(currentPiece.rotation));
+        put8(static_cast<Uint8>(currentPiece.x));
+        put8(static_cast<Uint8>(currentPiece.y));
+        put8(holdPiece.isEmpty() ? 0xFF : static_cast<Uint8>(holdPiece.type));
+        put8(holdUsed ? 1 : 0);
+        for (int i = 0; i < kMaxPreview; ++i) put8(static_cast<Uint8>(pieceQueuePeek(pieceQueue, i)));
+        put32(static_cast<Uint32>(scoreValue));
+        put16(static_cast<Uint16>(rowsCleared));
+        put8(static_cast<Uint8>(levelValue + 1));
+        for (int y = 0; y < boardHeight; ++y) {
+            Uint16 row = 0;
+            for (int x = 0; x < boardWidth; ++x) {
+                if (board.current[x][y] != 0) row |= static_cast<Uint16>(1u << x);
+            }
+            put16(row);
+        }
+        endMessage(at);
+
+        stateSentNs = SDL_GetTicksNS();
+        awaitingReply = true;
+        flush();
+    }
+
+    void applyAction(InputAction action) {
+        switch (action) {
+            case InputAction::MoveLeft:
+            case InputAction::MoveRight:
+            case InputAction::RotateClockwise:
+            case InputAction::RotateCounterClockwise:
+            case InputAction::SoftDrop:
+            case InputAction::HardDrop:
+            case InputAction::Hold:
+                applyInputAction(action);
+                break;
+            default: break; // pause and level select stay with the player
+        }
+    }
+
+    // Reach the placement through the normal moves so kicks and collisions apply
+    void applyPlacement(bool useHold, int rotation, int x) {
+        if (useHold) applyInputAction(InputAction::Hold);
+        rotation &= 3;
+        if (rotation == (currentPiece.rotation + 3) % 4) applyInputAction(InputAction::RotateCounterClockwise);
+        for (int i = 0; i < 2 && currentPiece.rotation != rotation; ++i) {
+            const int before = currentPiece.rotation;
+            applyInputAction(InputAction::RotateClockwise);
+            if (currentPiece.rotation == before) break; // blocked, or an O piece
+        }
+        while (currentPiece.x > x && checkPlacement(currentPiece, board, -1, 0)) applyInputAction(InputAction::MoveLeft);
+        while (currentPiece.x < x && checkPlacement(currentPiece, board, 1, 0)) applyInputAction(InputAction::MoveRight);
+        applyInputAction(InputAction::HardDrop);
+    }
+
+    // True if m answered the outstanding state
+    bool handleMessage(const Message& m) {
+        if (m.type != BotMessage::Placement && m.type != BotMessage::Actions) {
+            LOG_WARN("Bot sent unknown message type %d", static_cast<int>(m.type));
+            return false;
+        }
+        if (m.length < 8 || !awaitingReply || get32(m.payload) != stateSeq) {
+            staleReplies++;
+            return false;
+        }
+        const Uint64 now = SDL_GetTicksNS();
+        const Uint64 rtt = now - stateSentNs;
+        const Uint64 think = get32(m.payload + 4);
+        if (roundTripNs.size() < kMaxSamples) {
+            roundTripNs.push_back(rtt);
+            overheadNs.push_back(rtt - std::min(rtt, think));
+        }
+        awaitingReply = false;
+        repliesApplied++;
+
+        if (m.type == BotMessage::Placement) {
+            if (m.length < 11) return true;
+            applyPlacement(m.payload[8] != 0, m.payload[9], static_cast<Sint8>(m.payload[10]));
+        } else {
+            const size_t count = m.length > 8 ? std::min<size_t>(m.payload[8], m.length - 9) : 0;
+            for (size_t i = 0; i < count; ++i) applyAction(static_cast<InputAction>(m.payload[9 + i]));
+        }
+        return true;
+    }
+
+    double percentileUs(std::vector<Uint64>& values, double p) {
+        const size_t idx = static_cast<size_t>(p * (values.size() - 1) + 0.5);
+        std::nth_element(values.begin(), values.begin() + idx, values.end());
+        return values[idx] / 1000.0;
+    }
+
+    void logRoundTrips(const char* name, std::vector<Uint64>& values) {
+        if (values.empty()) return;
+        const double p50 = percentileUs(values, 0.50);
+        const double p99 = percentileUs(values, 0.99);
+        const double max = *std::max_element(values.begin(), values.end()) / 1000.0;
+        LOG_INFO("Bot %-9s p50=%8.1fus p99=%8.1fus max=%8.1fus", name, p50, p99, max);
+    }
+}
+
+bool botOpen() {
+    if (botTransport == BotTransport::None) return false;
+#ifdef _WIN32
+    LOG_ERROR("Bot mode needs POSIX pipes or UNIX sockets and is not available on Windows");
+    return false;
+#else
+    if (botTransport == BotTransport::Stdio) {
+        readFd = STDIN_FILENO;
+        writeFd = STDOUT_FILENO;
+    } else {
+        sockaddr_un addr{};
+        addr.sun_family = AF_UNIX;
+        if (!botSocketPath || std::strlen(botSocketPath) >= sizeof(addr.sun_path)) {
+            LOG_ERROR("Bot socket path is missing or too long");
+            return false;
+        }
+        std::strcpy(addr.sun_path, botSocketPath);
+        socketFd = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (socketFd < 0 || connect(socketFd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0) {
+            LOG_ERROR("Could not connect to bot at %s: %s", botSocketPath, strerror(errno));
+            if (socketFd >= 0) ::close(socketFd);
+            socketFd = -1;
+            return false;
+        }
+        readFd = writeFd = socketFd;
+    }
+    signal(SIGPIPE, SIG_IGN); // a bot that exits shows up as a failed write, not a dead game
+    connected = true;
+    roundTripNs.reserve(kMaxSamples);
+    overheadNs.reserve(kMaxSamples);
+
+    const size_t at = beginMessage(BotMessage::Hello, 5);
+    put8(kBotProtocolVersion);
+    put8(boardWidth);
+    put8(boardHeight);
+    put8(kMaxPreview);
+    put8(botHeadless ? 1 : 0);
+    endMessage(at);
+    LOG_INFO("Bot connected over %s", botTransport == BotTransport::Stdio ? "stdin/stdout" : botSocketPath);
+    return flush();
+#endif
+}
+
+bool botActive() {
+    return connected;
+}
+
+int botGamesPlayed() {
+    return static_cast<int>(gamesPlayed);
+}
+
+void botClose() {
+    if (botTransport == BotTransport::None) return;
+    disconnect("game closed");
+#ifndef _WIN32
+    if (socketFd >= 0) ::close(socketFd);
+    socketFd = -1;
+#endif
+    LOG_INFO("Bot answered %llu states over %llu games (%llu stale replies)",
+             static_cast<unsigned long long>(repliesApplied), static_cast<unsigned long long>(gamesPlayed),
+             static_cast<unsigned long long>(staleReplies));
+    logRoundTrips("roundtrip", roundTripNs);
+    logRoundTrips("overhead", overheadNs);
+}
+
+void botUpdate() {
+    if (!connected || clearingRows || currentState != GameState::PLAYING) return; // the board is final once a clear has collapsed
+    if (!awaitingReply && (stateNeeded || piecesPlaced != statePieceCount)) {
+        stateNeeded = false;
+        statePieceCount = piecesPlaced;
+        sendState();
+    }
+    Message m;
+    while (awaitingReply && nextMessage(m, false)) handleMessage(m);
+}
+
+void botGameOver() {
+    gamesPlayed++;
+    awaitingReply = false;
+    stateNeeded = true;
+    if (!connected) return;
+    const size_t at = beginMessage(BotMessage::GameOver, 10);
+    put32(static_cast<Uint32>(scoreValue));
+    put16(static_cast<Uint16>(rowsCleared));
+    put32(static_cast<Uint32>(piecesPlaced));
+    endMessage(at);
+}
+
+int runHeadlessBot() {
+    if (!connected) return 1;
+    resetGameplayStateForNewGame();
+    const Uint64 startNs = SDL_GetTicksNS();
+    Uint64 pieces = 0;
+
+    while (connected) {
+        if (spawnBlocked()) {
+            botGameOver();
+            resetGameplayStateForNewGame();
+            if (botGameLimit > 0 && gamesPlayed >= static_cast<Uint64>(botGameLimit)) break;
+            continue;
+        }
+        sendState();
+
+        Message m;
+        bool answered = false;
+        while (!answered && nextMessage(m, true)) answered = handleMessage(m);
+        if (!answered) break;
+
+        if (!hardDropFlag) applyInputAction(InputAction::HardDrop); // every answer places exactly one piece
+        handlePieceLanded();
+        if (clearingRows) collapseClearedRows();
+        pieces++;
+    }
+    flush(); // a final GameOver
+
+    const double seconds = (SDL_GetTicksNS() - startNs) / 1000000000.0;
+    LOG_INFO("Headless: %llu pieces in %.2fs (%.0f pieces/s)", static_cast<unsigned long long>(pieces),
+             seconds, seconds > 0 ? pieces / seconds : 0.0);
+    return 0;
+}
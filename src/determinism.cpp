@@ -0,0 +1,276 @@
+#include "determinism.h"
+#include "replay.h"
+#include "tetris_utils.h"
+#include "globals.h"
+#include "randomizer.h"
+#include "log.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+const char* determinismReplayPath = nullptr;
+const char* hashStreamOutPath = nullptr;
+const char* hashStreamAgainstPath = nullptr;
+
+namespace {
+    constexpr unsigned char kMagic[4] = { 'T', 'H', 'S', 'H' };
+    constexpr Uint16 kStreamVersion = 1;
+    constexpr size_t kStreamHeaderSize = 24;
+
+    const char* const kFieldNames[kStateFieldCount] = {
+        "board", "piece", "hold", "queue", "randomizer", "lock delay", "score", "timers", "row clear"
+    };
+
+    // Multiply and xor-shift over whole words: not cryptographic, just well mixed and cheap
+    struct Hasher {
+        Uint64 h = 0x9E3779B97F4A7C15ull;
+
+        void mix(Uint64 v) {
+            h ^= v;
+            h *= 0xBF58476D1CE4E5B9ull;
+            h ^= h >> 31;
+        }
+
+        void mixPiece(const Piece& p) {
+            mix(static_cast<Uint64>(p.type & 0xFF) | static_cast<Uint64>(p.rotation & 0xFF) << 8 |
+                static_cast<Uint64>(p.width & 0xFF) << 16 | static_cast<Uint64>(p.height & 0xFF) << 24 |
+                static_cast<Uint64>(p.mask) << 32 | static_cast<Uint64>(p.color & 0xFFFF) << 48);
+            mix(static_cast<Uint32>(p.x) | static_cast<Uint64>(static_cast<Uint32>(p.y)) << 32);
+        }
+
+        void mixBytes(const Uint8* p, size_t n) {
+            for (size_t i = 0; i < n; i += 8) {
+                Uint64 v = 0;
+                std::memcpy(&v, p + i, std::min<size_t>(8, n - i));
+                mix(v);
+            }
+        }
+    };
+
+    struct HashStream {
+        Uint64 seed = 0;
+        Uint32 firstTick = 0;
+        std::vector<StateHash> ticks;
+    };
+
+    void putBytes(std::vector<Uint8>& out, Uint64 v, int bytes) {
+        for (int i = 0; i < bytes; ++i) out.push_back(static_cast<Uint8>(v >> (8 * i)));
+    }
+
+    Uint64 getBytes(const Uint8* p, int bytes) {
+        Uint64 v = 0;
+        for (int i = 0; i < bytes; ++i) v |= static_cast<Uint64>(p[i]) << (8 * i);
+        return v;
+    }
+
+    // The state at the start of every tick, from the replay's first tick to its game over
+    bool simulateReplay(HashStream& out, Uint64& hashNs) {
+        if (!replayOpenPlayback(determinismReplayPath)) return false;
+        const Replay& replay = playbackReplay();
+        out.seed = replay.seed;
+        out.firstTick = replay.startTick;
+        out.ticks.clear();
+        out.ticks.reserve(replay.ticks - replay.startTick + 1);
+        hashNs = 0;
+        while (gameTick <= replay.ticks) {
+            const Uint64 start = SDL_GetTicksNS();
+            out.ticks.emplace_back();
+            hashGameState(out.ticks.back());
+            hashNs += SDL_GetTicksNS() - start;
+            replayApplyTickEvents();
+            if (!simulateGameplayTick()) break;
+        }
+        return true;
+    }
+
+    bool writeStream(const char* path, const HashStream& stream) {
+        std::vector<Uint8> out;
+        out.reserve(kStreamHeaderSize + stream.ticks.size() * sizeof(StateHash));
+        out.insert(out.end(), kMagic, kMagic + 4);
+        putBytes(out, kStreamVersion, 2);
+        putBytes(out, kStateFieldCount, 2);
+        putBytes(out, stream.seed, 8);
+        putBytes(out, stream.firstTick, 4);
+        putBytes(out, stream.ticks.size(), 4);
+        for (const StateHash& h : stream.ticks) {
+            for (Uint64 field : h.fields) putBytes(out, field, 8);
+        }
+
+        std::FILE* f = std::fopen(path, "wb");
+        if (!f) return false;
+        const bool ok = std::fwrite(out.data(), 1, out.size(), f) == out.size();
+        return std::fclose(f) == 0 && ok;
+    }
+
+    bool readStream(const char* path, HashStream& stream) {
+        std::FILE* f = std::fopen(path, "rb");
+        if (!f) {
+            LOG_ERROR("Could not open hash stream %s", path);
+            return false;
+        }
+        std::vector<Uint8> data;
+        Uint8 chunk[4096];
+        for (size_t n; (n = std::fread(chunk, 1, sizeof(chunk), f)) > 0;) data.insert(data.end(), chunk, chunk + n);
+        std::fclose(f);
+
+        if (data.size() < kStreamHeaderSize || std::memcmp(data.data(), kMagic, 4) != 0 ||
+            getBytes(data.data() + 4, 2) != kStreamVersion) {
+            LOG_ERROR("%s is not a version %d hash stream", path, kStreamVersion);
+            return false;
+        }
+        const Uint64 fieldCount = getBytes(data.data() + 6, 2);
+        if (fieldCount != kStateFieldCount) {
+            LOG_ERROR("%s hashes %llu fields, this build %d", path, static_cast<unsigned long long>(fieldCount),
+                      kStateFieldCount);
+            return false;
+        }
+        stream.seed = getBytes(data.data() + 8, 8);
+        stream.firstTick = static_cast<Uint32>(getBytes(data.data() + 16, 4));
+        const Uint32 count = static_cast<Uint32>(getBytes(data.data() + 20, 4));
+        if (count > (data.size() - kStreamHeaderSize) / (8 * kStateFieldCount)) {
+            LOG_ERROR("Hash stream %s is truncated", path);
+            return false;
+        }
+        stream.ticks.resize(count);
+        const Uint8* p = data.data() + kStreamHeaderSize;
+        for (StateHash& h : stream.ticks) {
+            for (Uint64& field : h.fields) {
+                field = getBytes(p, 8);
+                p += 8;
+            }
+        }
+        return true;
+    }
+
+    bool compareStreams(const HashStream& run, const HashStream& other, const char* what) {
+        if (run.seed != other.seed || run.firstTick != other.firstTick) {
+            LOG_ERROR("%s was hashed from another replay", what);
+            return false;
+        }
+        const size_t shared = std::min(run.ticks.size(), other.ticks.size());
+        for (size_t i = 0; i < shared; ++i) {
+            if (std::memcmp(&run.ticks[i], &other.ticks[i], sizeof(StateHash)) == 0) continue;
+            char fields[96] = "";
+            int len = 0;
+            for (int f = 0; f < kStateFieldCount && len < static_cast<int>(sizeof(fields)); ++f) {
+                if (run.ticks[i].fields[f] == other.ticks[i].fields[f]) continue;
+                len += SDL_snprintf(fields + len, sizeof(fields) - len, "%s%s", len ? ", " : "", kFieldNames[f]);
+            }
+            const Uint64 tick = run.firstTick + i;
+            LOG_ERROR("Diverges from %s at tick %llu (%.2fs): %s", what, static_cast<unsigned long long>(tick),
+                      tick / static_cast<double>(kScreenFps), fields);
+            return false;
+        }
+        if (run.ticks.size() != other.ticks.size()) {
+            LOG_ERROR("Matches %s up to tick %llu, but one run ends there", what,
+                      static_cast<unsigned long long>(run.firstTick + shared));
+            return false;
+        }
+        LOG_INFO("Determinism: all %zu ticks match %s", shared, what);
+        return true;
+    }
+}
+
+void hashGameState(StateHash& out) {
+    Hasher cells;
+    for (int y = 0; y < boardHeight; ++y) {
+        Uint64 row = 0; // 4 bits per cell; colors are 0-15
+        for (int x = 0; x < boardWidth; ++x) row |= static_cast<Uint64>(board.current[x][y] & 0xF) << (4 * x);
+        cells.mix(row);
+    }
+    out.fields[static_cast<int>(StateField::Board)] = cells.h;
+
+    Hasher piece;
+    piece.mixPiece(currentPiece);
+    piece.mix(static_cast<Uint32>(pickPiece));
+    out.fields[static_cast<int>(StateField::Piece)] = piece.h;
+
+    Hasher hold;
+    hold.mixPiece(holdPiece);
+    hold.mix(holdUsed);
+    out.fields[static_cast<int>(StateField::Hold)] = hold.h;
+
+    Hasher queue;
+    queue.mixPiece(nextPiece);
+    queue.mix(static_cast<Uint32>(nextPickPiece));
+    queue.mixBytes(pieceQueue.ring, kMaxPreview);
+    queue.mix(pieceQueue.head);
+    out.fields[static_cast<int>(StateField::Queue)] = queue.h;
+
+    const RandomizerState& gen = pieceQueue.gen;
+    Hasher rng;
+    for (Uint32 word : gen.rng.s) rng.mix(word);
+    rng.mix(static_cast<Uint64>(gen.kind) | static_cast<Uint64>(gen.bagIndex) << 8 |
+            static_cast<Uint64>(gen.firstDraw) << 16);
+    rng.mixBytes(gen.bag, sizeof(gen.bag));
+    rng.mixBytes(gen.history, sizeof(gen.history));
+    out.fields[static_cast<int>(StateField::Randomizer)] = rng.h;
+
+    Hasher lock;
+    lock.mix(static_cast<Uint64>(pieceLanded) | static_cast<Uint64>(pieceLandedOnce) << 1 |
+             static_cast<Uint64>(newPiece) << 2 | static_cast<Uint64>(hardDropFlag) << 3 |
+             static_cast<Uint64>(alternateIPieceRotationOffset) << 4);
+    lock.mix(static_cast<Uint32>(lockDelayCounter) | static_cast<Uint64>(static_cast<Uint32>(lockDelayMovesUsed)) << 32);
+    lock.mix(static_cast<Uint32>(lockDelayRotationsUsed));
+    out.fields[static_cast<int>(StateField::LockDelay)] = lock.h;
+
+    Hasher scoring;
+    scoring.mix(static_cast<Uint32>(scoreValue) | static_cast<Uint64>(static_cast<Uint32>(rowsCleared)) << 32);
+    scoring.mix(static_cast<Uint32>(levelValue) | static_cast<Uint64>(static_cast<Uint32>(levelIncrease)) << 32);
+    scoring.mix(static_cast<Uint32>(piecesPlaced));
+    scoring.mix(dropSpeed);
+    out.fields[static_cast<int>(StateField::Score)] = scoring.h;
+
+    Hasher timers;
+    timers.mix(gameTick);
+    timers.mix(lastDropTime);
+    out.fields[static_cast<int>(StateField::Timers)] = timers.h;
+
+    Hasher clear;
+    clear.mix(clearingRows);
+    clear.mix(clearAnimStart);
+    clear.mix(static_cast<Uint32>(clearAnimStep));
+    for (int row : rowsToClear) clear.mix(static_cast<Uint32>(row));
+    out.fields[static_cast<int>(StateField::RowClear)] = clear.h;
+}
+
+Uint64 combineStateHash(const StateHash& hash) {
+    Hasher h;
+    for (Uint64 field : hash.fields) h.mix(field);
+    return h.h;
+}
+
+Uint64 gameStateHash() {
+    StateHash hash;
+    hashGameState(hash);
+    return combineStateHash(hash);
+}
+
+const char* stateFieldName(StateField field) {
+    return field < StateField::Count ? kFieldNames[static_cast<int>(field)] : "?";
+}
+
+int runDeterminismCheck() {
+    HashStream first;
+    Uint64 hashNs = 0;
+    const Uint64 startNs = SDL_GetTicksNS();
+    if (!simulateReplay(first, hashNs)) return 1;
+    const double seconds = (SDL_GetTicksNS() - startNs) / 1000000000.0;
+    const size_t ticks = first.ticks.size();
+    LOG_INFO("Determinism: %s, %zu ticks in %.2fs, %.0f ns per state hash", determinismReplayPath, ticks,
+             seconds, ticks ? static_cast<double>(hashNs) / ticks : 0.0);
+
+    if (hashStreamOutPath && !writeStream(hashStreamOutPath, first)) {
+        LOG_ERROR("Could not write %s", hashStreamOutPath);
+        return 1;
+    }
+
+    HashStream other;
+    if (hashStreamAgainstPath) {
+        if (!readStream(hashStreamAgainstPath, other)) return 1;
+        return compareStreams(first, other, hashStreamAgainstPath) ? 0 : 1;
+    }
+    if (!simulateReplay(other, hashNs)) return 1;
+    return compareStreams(first, other, "a second run") ? 0 : 1;
+}
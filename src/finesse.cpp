@@ -0,0 +1,240 @@
+#include "finesse.h"
+#include "row_board.h"
+#include "globals.h"
+#include "log.h"
+#include <algorithm>
+#include <cstring>
+
+namespace {
+    constexpr int kMoveCount = 6;
+    constexpr int kStateCount = 2 * 4 * boardWidth; // I offset, rotation, column
+    constexpr Uint8 kUnreached = 0xFF;
+    constexpr int kProbeRow = 2; // a little below spawn, so a kick can lift the piece as it would mid-fall
+    constexpr Uint64 kFaultShownMs = 2000;
+
+    struct Entry {
+        Uint8 count = kUnreached;
+        Uint8 length = 0; // moves stored, at most kFinesseMaxMoves
+        FinesseMove moves[kFinesseMaxMoves];
+    };
+
+    // [type][I offset at spawn][rotation folded by kDistinctRotations][column]
+    Entry table[kPieceTypeCount][2][4][boardWidth];
+
+    struct ProbeState {
+        int rotation;
+        int x;
+        bool alternate;
+    };
+
+    int stateIndex(const ProbeState& s) { return ((s.alternate ? 4 : 0) + s.rotation) * boardWidth + s.x; }
+
+    ProbeState stateAt(int index) {
+        return { (index / boardWidth) % 4, index % boardWidth, index >= 4 * boardWidth };
+    }
+
+    // Run one move with the game's own functions on the (empty) board
+    bool probe(int type, const ProbeState& from, FinesseMove move, ProbeState& to) {
+        currentPiece = makePiece(type);
+        setPieceRotation(currentPiece, from.rotation);
+        currentPiece.x = from.x;
+        currentPiece.y = kProbeRow;
+        alternateIPieceRotationOffset = from.alternate;
+        switch (move) {
+            case FinesseMove::TapLeft: moveLeft(); break;
+            case FinesseMove::TapRight: moveRight(); break;
+            case FinesseMove::DasLeft: while (checkPlacement(currentPiece, board, -1, 0)) moveLeft(); break;
+            case FinesseMove::DasRight: while (checkPlacement(currentPiece, board, 1, 0)) moveRight(); break;
+            case FinesseMove::RotateCW: rotateClockwise(); break;
+            case FinesseMove::RotateCCW: rotateCounterClockwise(); break;
+        }
+        to = { currentPiece.rotation, currentPiece.x, alternateIPieceRotationOffset };
+        return to.x >= 0 && to.x < boardWidth;
+    }
+
+    void searchFrom(int type, bool alternate) {
+        Uint8 dist[kStateCount];
+        int parent[kStateCount];
+        FinesseMove via[kStateCount];
+        int queue[kStateCount];
+        std::memset(dist, kUnreached, sizeof(dist));
+
+        const int start = stateIndex({ 0, boardWidth / 2, alternate });
+        dist[start] = 0;
+        parent[start] = -1;
+        int head = 0, tail = 0;
+        queue[tail++] = start;
+        while (head < tail) {
+            const int s = queue[head++];
+            for (int m = 0; m < kMoveCount; ++m) {
+                ProbeState next;
+                if (!probe(type, stateAt(s), static_cast<FinesseMove>(m), next)) continue;
+                const int n = stateIndex(next);
+                if (dist[n] != kUnreached) continue;
+                dist[n] = dist[s] + 1;
+                parent[n] = s;
+                via[n] = static_cast<FinesseMove>(m);
+                queue[tail++] = n;
+            }
+        }
+
+        // Breadth-first order, so the first state to fill an entry is a shortest one
+        for (int i = 0; i < tail; ++i) {
+            const ProbeState s = stateAt(queue[i]);
+            Entry& e = table[type][alternate][s.rotation % kDistinctRotations[type]][s.x];
+            if (e.count != kUnreached) continue;
+            e.count = dist[queue[i]];
+            e.length = static_cast<Uint8>(std::min<int>(e.count, kFinesseMaxMoves));
+            int at = queue[i];
+            for (int k = e.count - 1; k >= 0; --k, at = parent[at]) {
+                if (k < kFinesseMaxMoves) e.moves[k] = via[at];
+            }
+        }
+    }
+
+    const char* moveName(FinesseMove move) {
+        switch (move) {
+            case FinesseMove::TapLeft: return "<";
+            case FinesseMove::TapRight: return ">";
+            case FinesseMove::DasLeft: return "<<";
+            case FinesseMove::DasRight: return ">>";
+            case FinesseMove::RotateCW: return "cw";
+            case FinesseMove::RotateCCW: return "ccw";
+        }
+        return "?";
+    }
+
+    // The piece in play
+    int pieceInputs = 0; // moves and rotations
+    int pieceKeys = 0;   // every key, hold and drops included
+    bool pieceSoftDropped = false;
+    bool pieceAlternateAtSpawn = false;
+
+    // This game
+    int gamePieces = 0;
+    int gameKeys = 0;
+    int gameJudged = 0;
+    int gameFaults = 0;
+    int gameExtraInputs = 0;
+
+    Uint64 lastFaultAt = 0;
+    char lastFaultText[48] = "";
+
+    void startPiece() {
+        pieceInputs = 0;
+        pieceKeys = 0;
+        pieceSoftDropped = false;
+        pieceAlternateAtSpawn = alternateIPieceRotationOffset;
+    }
+}
+
+void finesseInit() {
+    const Piece savedPiece = currentPiece;
+    const Board savedBoard = board;
+    const bool savedAlternate = alternateIPieceRotationOffset;
+    const bool savedLanded = pieceLanded;
+    const bool savedLandedOnce = pieceLandedOnce;
+    board = Board();
+    pieceLanded = false; // no lock delay budget, and kicks in falling order
+    pieceLandedOnce = false;
+
+    for (int type = 0; type < kPieceTypeCount; ++type) {
+        searchFrom(type, false);
+        searchFrom(type, true);
+    }
+
+    currentPiece = savedPiece;
+    board = savedBoard;
+    alternateIPieceRotationOffset = savedAlternate;
+    pieceLanded = savedLanded;
+    pieceLandedOnce = savedLandedOnce;
+
+    int placements = 0, worst = 0;
+    for (int type = 0; type < kPieceTypeCount; ++type) {
+        for (int rot = 0; rot < kDistinctRotations[type]; ++rot) {
+            for (int x = 0; x < boardWidth; ++x) {
+                const Entry& e = table[type][0][rot][x];
+                if (e.count == kUnreached) continue;
+                placements++;
+                worst = std::max<int>(worst, e.count);
+            }
+        }
+    }
+    LOG_DEBUG("Finesse: %d open-field placements, at most %d inputs", placements, worst);
+}
+
+void finesseKeyPressed(InputAction action) {
+    switch (action) {
+        case InputAction::MoveLeft:
+        case InputAction::MoveRight:
+        case InputAction::RotateClockwise:
+        case InputAction::RotateCounterClockwise:
+            pieceInputs++;
+            pieceKeys++;
+            break;
+        case InputAction::SoftDrop:
+            pieceSoftDropped = true;
+            pieceKeys++;
+            break;
+        case InputAction::HardDrop:
+            pieceKeys++;
+            break;
+        case InputAction::Hold: {
+            const int keys = pieceKeys + 1;
+            if (!holdUsed) startPiece(); // a fresh piece from spawn, but the hold key is paid for
+            pieceKeys = keys;
+        } break;
+        default: break;
+    }
+}
+
+void finessePieceLocked() {
+    if (pieceKeys == 0) { startPiece(); return; } // bot, replay, or nothing pressed
+    gamePieces++;
+    gameKeys += pieceKeys;
+    const int rot = currentPiece.rotation % kDistinctRotations[currentPiece.type];
+    const Entry* e = currentPiece.x >= 0 && currentPiece.x < boardWidth
+        ? &table[currentPiece.type][pieceAlternateAtSpawn][rot][currentPiece.x] : nullptr;
+    if (!pieceSoftDropped && e && e->count != kUnreached) {
+        gameJudged++;
+        if (pieceInputs > e->count) {
+            gameFaults++;
+            gameExtraInputs += pieceInputs - e->count;
+            lastFaultAt = SDL_GetTicks();
+            int len = SDL_snprintf(lastFaultText, sizeof(lastFaultText), "best:");
+            for (int i = 0; i < e->length && len < static_cast<int>(sizeof(lastFaultText)); ++i) {
+                len += SDL_snprintf(lastFaultText + len, sizeof(lastFaultText) - len, " %s", moveName(e->moves[i]));
+            }
+            LOG_DEBUG("Finesse fault: %d inputs where %d do (%s)", pieceInputs, e->count, lastFaultText);
+        }
+    }
+    startPiece();
+}
+
+void finesseNewGame() {
+    if (gamePieces > 0) {
+        LOG_INFO("Finesse: %d faults in %d judged pieces (%d extra inputs), %.2f keys per piece",
+                 gameFaults, gameJudged, gameExtraInputs, static_cast<double>(gameKeys) / gamePieces);
+    }
+    gamePieces = gameKeys = gameJudged = gameFaults = gameExtraInputs = 0;
+    lastFaultAt = 0;
+    startPiece();
+}
+
+void renderFinesseStats() {
+    if (gamePieces == 0) return;
+    const float x = 488.f, line = 10.f;
+    float y = 526.f;
+    char text[32];
+    SDL_SetRenderDrawColor(gRenderer, 255, 255, 255, 255);
+    SDL_snprintf(text, sizeof(text), "KPP %.2f", static_cast<double>(gameKeys) / gamePieces);
+    SDL_RenderDebugText(gRenderer, x, y, text);
+    y += line;
+
+    const bool recent = lastFaultAt != 0 && SDL_GetTicks() - lastFaultAt < kFaultShownMs;
+    if (recent) SDL_SetRenderDrawColor(gRenderer, 255, 64, 64, 255);
+    SDL_snprintf(text, sizeof(text), "faults %d/%d", gameFaults, gameJudged);
+    SDL_RenderDebugText(gRenderer, x, y, text);
+    y += line;
+    if (recent) SDL_RenderDebugText(gRenderer, x, y, lastFaultText);
+}
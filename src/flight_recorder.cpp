@@ -0,0 +1,222 @@
+#include "flight_recorder.h"
+#include "replay.h"
+#include "globals.h"
+#include "tetris_utils.h"
+#include "randomizer.h"
+#include "versus.h"
+#include "spectator.h"
+#include "log.h"
+#include <algorithm>
+#include <atomic>
+#include <csignal>
+#include <cstring>
+#include <vector>
+
+#ifdef _WIN32
+#include <io.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#define TETRIS_OPEN_WRITE(path) _open(path, _O_WRONLY | _O_CREAT | _O_TRUNC | _O_BINARY, _S_IREAD | _S_IWRITE)
+#define TETRIS_WRITE(fd, data, size) _write(fd, data, static_cast<unsigned>(size))
+#define TETRIS_CLOSE(fd) _close(fd)
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#define TETRIS_OPEN_WRITE(path) open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644)
+#define TETRIS_WRITE(fd, data, size) write(fd, data, size)
+#define TETRIS_CLOSE(fd) close(fd)
+#endif
+
+namespace {
+    constexpr Uint32 kSnapshotInterval = 10 * kScreenFps;
+    constexpr int kSnapshotSlots = 4;           // the oldest is 30-40 seconds back
+    constexpr size_t kEventCapacity = 4096;     // power of two
+    constexpr Uint32 kHashCapacity = kSnapshotSlots * kSnapshotInterval;
+    constexpr size_t kSnapshotReserve = 512;    // a full board is under 300 bytes
+    constexpr size_t kDumpReserve = 64 + kEventCapacity * 6 + kSnapshotReserve + kHashCapacity * 4;
+    const char* const kAssertPath = "flight_assert.trp";
+    const char* const kCrashPath = "flight_crash.trp";
+
+    struct Snapshot {
+        bool valid = false;
+        Uint32 tick = 0;
+        Uint64 eventCount = 0; // actions recorded before it was taken
+        std::vector<Uint8> data;
+    };
+
+    bool initialized = false;
+    ReplayEvent events[kEventCapacity];
+    Uint64 eventCount = 0; // this game, including the ones the ring has overwritten
+    Uint32 hashes[kHashCapacity]; // by tick % kHashCapacity
+    Uint32 firstHashTick = 0;
+    Uint32 lastHashTick = 0;
+    bool haveHashes = false;
+    Snapshot snapshots[kSnapshotSlots];
+    int nextSlot = 0;
+    bool snapshotDue = true;
+    Uint32 lastSnapshotTick = 0;
+
+    Uint64 seed = 0;
+    Uint8 randomizer = 0;
+    int maxLevel = 0;
+
+    Replay dump;                 // reserved once and refilled for every dump
+    std::vector<Uint8> dumpBytes;
+    std::atomic<bool> dumping{ false };
+    SDL_AssertionHandler defaultAssertionHandler = nullptr;
+
+    bool writeFile(const char* path, const Uint8* data, size_t size) {
+        const int fd = TETRIS_OPEN_WRITE(path);
+        if (fd < 0) return false;
+        bool ok = true;
+        while (size > 0 && ok) {
+            const auto n = TETRIS_WRITE(fd, data, size);
+            ok = n > 0;
+            if (ok) {
+                data += n;
+                size -= static_cast<size_t>(n);
+            }
+        }
+        return TETRIS_CLOSE(fd) == 0 && ok;
+    }
+
+    // The oldest snapshot whose actions are all still in the ring
+    const Snapshot* oldestCoveredSnapshot() {
+        const Snapshot* best = nullptr;
+        for (const Snapshot& s : snapshots) {
+            if (!s.valid || eventCount - s.eventCount > kEventCapacity) continue;
+            if (!best || s.tick < best->tick) best = &s;
+        }
+        return best;
+    }
+
+    // Fill dump and dumpBytes without allocating; safe to call from the crash handler
+    bool encodeDump() {
+        const Snapshot* from = oldestCoveredSnapshot();
+        if (!from) return false;
+
+        dump.seed = seed;
+        dump.randomizer = randomizer;
+        dump.maxLevel = maxLevel;
+        dump.flags = kReplayPartial;
+        dump.startTick = from->tick;
+        dump.ticks = std::max(static_cast<Uint32>(gameTick), from->tick + 1);
+
+        dump.events.clear();
+        for (Uint64 i = from->eventCount; i < eventCount; ++i) dump.events.push_back(events[i & (kEventCapacity - 1)]);
+
+        dump.keyframes.clear();
+        dump.keyframeData.clear();
+        dump.keyframeData.insert(dump.keyframeData.end(), from->data.begin(), from->data.end());
+        dump.keyframes.push_back(ReplayKeyframe{ from->tick, 0, 0, static_cast<Uint16>(from->data.size()) });
+
+        dump.tickHashes.clear();
+        if (haveHashes) {
+            Uint32 first = std::max(from->tick, firstHashTick);
+            if (lastHashTick - first >= kHashCapacity) first = lastHashTick - kHashCapacity + 1;
+            dump.hashStartTick = first;
+            for (Uint32 t = first; t <= lastHashTick; ++t) dump.tickHashes.push_back(hashes[t % kHashCapacity]);
+        }
+
+        encodeReplay(dump, dumpBytes);
+        return true;
+    }
+
+    void writeToStderr(const char* text) {
+        [[maybe_unused]] const auto n = TETRIS_WRITE(2, text, std::strlen(text));
+    }
+
+    void onCrashSignal(int sig) {
+        std::signal(sig, SIG_DFL);
+        if (!dumping.exchange(true)) {
+            if (encodeDump() && writeFile(kCrashPath, dumpBytes.data(), dumpBytes.size())) {
+                writeToStderr("Flight recorder: wrote flight_crash.trp\n");
+            } else {
+                writeToStderr("Flight recorder: nothing written\n");
+            }
+        }
+        std::raise(sig);
+    }
+
+    SDL_AssertState onAssertion(const SDL_AssertData* data, void* userdata) {
+        if (data->trigger_count <= 1) flightDump(kAssertPath); // once per assert, not for every repeat
+        return defaultAssertionHandler ? defaultAssertionHandler(data, userdata) : SDL_ASSERTION_ABORT;
+    }
+}
+
+void flightRecorderInit() {
+    if (initialized) return;
+    for (Snapshot& s : snapshots) s.data.reserve(kSnapshotReserve);
+    dump.events.reserve(kEventCapacity);
+    dump.keyframes.reserve(1);
+    dump.keyframeData.reserve(kSnapshotReserve);
+    dump.tickHashes.reserve(kHashCapacity);
+    dumpBytes.reserve(kDumpReserve);
+
+    std::signal(SIGSEGV, onCrashSignal);
+    std::signal(SIGILL, onCrashSignal);
+    std::signal(SIGFPE, onCrashSignal);
+    std::signal(SIGABRT, onCrashSignal);
+#ifdef SIGBUS
+    std::signal(SIGBUS, onCrashSignal);
+#endif
+    defaultAssertionHandler = SDL_GetDefaultAssertionHandler();
+    SDL_SetAssertionHandler(onAssertion, nullptr);
+    initialized = true;
+}
+
+void flightGameStarted() {
+    eventCount = 0;
+    haveHashes = false;
+    for (Snapshot& s : snapshots) s.valid = false;
+    nextSlot = 0;
+    snapshotDue = true;
+    seed = gameSeed;
+    randomizer = static_cast<Uint8>(randomizerKind);
+    maxLevel = maxLevelAchieved;
+}
+
+void flightRecordAction(Uint8 action) {
+    if (replaySeeking() || versusActive() || spectatorActive()) return; // these interleave several games
+    events[eventCount & (kEventCapacity - 1)] = ReplayEvent{ static_cast<Uint32>(gameTick), action };
+    eventCount++;
+}
+
+void flightTickEnded() {
+    if (!initialized || replaySeeking() || versusActive() || spectatorActive()) return;
+    const Uint32 tick = static_cast<Uint32>(gameTick);
+    if (!haveHashes) {
+        firstHashTick = tick;
+        haveHashes = true;
+    }
+    hashes[tick % kHashCapacity] = replayStateHash();
+    lastHashTick = tick;
+
+    if (clearingRows || (!snapshotDue && tick - lastSnapshotTick < kSnapshotInterval)) return;
+    Snapshot& s = snapshots[nextSlot];
+    s.valid = false; // a crash while it is rewritten must not use half of it
+    s.data.clear();
+    replayCaptureSnapshot(s.data);
+    s.tick = tick;
+    s.eventCount = eventCount;
+    s.valid = true;
+    nextSlot = (nextSlot + 1) % kSnapshotSlots;
+    lastSnapshotTick = tick;
+    snapshotDue = false;
+}
+
+bool flightDump(const char* path) {
+    if (dumping.exchange(true)) return false;
+    const bool encoded = encodeDump();
+    const bool ok = encoded && writeFile(path, dumpBytes.data(), dumpBytes.size());
+    if (!encoded) {
+        LOG_WARN("Flight recorder: nothing recorded yet");
+    } else if (!ok) {
+        LOG_ERROR("Flight recorder: could not write %s", path);
+    } else {
+        LOG_INFO("Flight recorder: wrote %s (ticks %u-%u, %zu actions, %zu bytes)", path, dump.startTick, dump.ticks,
+                 dump.events.size(), dumpBytes.size());
+    }
+    dumping = false;
+    return ok;
+}
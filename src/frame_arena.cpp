@@ -0,0 +1,58 @@
+#include "frame_arena.h"
+#include "log.h"
+#include <algorithm>
+#include <cstdint>
+
+FrameArena::FrameArena(size_t blockSize) : blockSize(blockSize) {}
+
+FrameArena::~FrameArena() {
+    for (Block* b = first; b;) {
+        Block* next = b->next;
+        SDL_free(b);
+        b = next;
+    }
+}
+
+FrameArena::Block* FrameArena::newBlock(size_t size) {
+    Block* b = static_cast<Block*>(SDL_malloc(sizeof(Block) + size));
+    if (!b) throw std::bad_alloc();
+    b->next = nullptr;
+    b->size = size;
+    blocks++;
+    return b;
+}
+
+void* FrameArena::allocate(size_t size, size_t align) {
+    if (!first) first = current = newBlock(blockSize);
+
+    for (;;) {
+        const uintptr_t base = reinterpret_cast<uintptr_t>(current->data());
+        const uintptr_t p = (base + offset + align - 1) & ~static_cast<uintptr_t>(align - 1);
+        if (p + size <= base + current->size) {
+            offset = p + size - base;
+            return reinterpret_cast<void*>(p);
+        }
+        // Move on to the next block, splicing in a new one if there is none or it is too small
+        usedInEarlierBlocks += offset;
+        offset = 0;
+        if (!current->next || current->next->size < size + align) {
+            Block* b = newBlock(std::max(blockSize, size + align));
+            b->next = current->next;
+            current->next = b;
+            LOG_WARN("Frame arena grew to %zu blocks (%zu bytes requested)", blocks, size);
+        }
+        current = current->next;
+    }
+}
+
+void FrameArena::reset() {
+    peak = std::max(peak, used());
+    current = first;
+    offset = 0;
+    usedInEarlierBlocks = 0;
+}
+
+FrameArena& frameArena() {
+    thread_local FrameArena arena;
+    return arena;
+}
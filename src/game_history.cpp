@@ -0,0 +1,382 @@
+#include "game_history.h"
+#include "globals.h"
+#include "tetris_utils.h"
+#include "alloc_check.h"
+#include "trace.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+    constexpr char kHistoryPath[] = "tetris_history.dat";
+    constexpr char kIndexPath[] = "tetris_history.idx";
+    constexpr Uint32 kHistoryVersion = 1;
+    constexpr Uint32 kIndexVersion = 1;
+
+    constexpr int kModeCount = 4;         // room for GameMode values added later
+    constexpr int kTopK = 100;
+    constexpr int kTrendMax = 128;
+    constexpr int kBucketsPerOctave = 16; // ~4.4% wide score buckets
+    constexpr int kHistogramBuckets = 512;
+    constexpr Uint64 kMinRecordCapacity = 1024;
+
+    // tetris_history.dat: header, then GameRecords back to back. The file is grown
+    // ahead of time, so recordCount (written after the record) is what marks the end.
+    struct HistoryHeader {
+        char magic[4];
+        Uint32 version;
+        Uint32 recordSize;
+        Uint32 reserved;
+        Uint64 recordCount;
+    };
+    constexpr size_t kRecordsOffset = 64;
+
+    struct IndexEntry {
+        Sint32 score;
+        Uint32 record; // position in tetris_history.dat
+    };
+
+    struct ModeIndex {
+        Uint64 games;
+        Uint32 topCount;
+        Uint32 trendCount;
+        IndexEntry top[kTopK];       // best first
+        IndexEntry trend[kTrendMax]; // personal bests, oldest first
+        Uint32 histogram[kHistogramBuckets];
+    };
+
+    // tetris_history.idx: fixed size, derived entirely from the records, so it is
+    // rebuilt whenever it does not match instead of being versioned carefully
+    struct IndexFile {
+        char magic[4];
+        Uint32 version;
+        Uint32 recordSize;
+        Uint32 modeCount;
+        Uint64 indexedRecords;
+        ModeIndex modes[kModeCount];
+    };
+
+    struct MappedFile {
+#ifdef _WIN32
+        HANDLE file = INVALID_HANDLE_VALUE;
+        HANDLE mapping = nullptr;
+#else
+        int fd = -1;
+#endif
+        unsigned char* data = nullptr;
+        size_t size = 0;
+    };
+
+    MappedFile historyFile;
+    MappedFile indexFile;
+    bool historyOpen = false;
+
+    void unmapView(MappedFile& f) {
+        if (!f.data) return;
+#ifdef _WIN32
+        UnmapViewOfFile(f.data);
+        CloseHandle(f.mapping);
+        f.mapping = nullptr;
+#else
+        munmap(f.data, f.size);
+#endif
+        f.data = nullptr;
+    }
+
+    // (Re)map the whole file, first growing it to at least minSize bytes
+    bool mapView(MappedFile& f, size_t minSize) {
+        unmapView(f);
+#ifdef _WIN32
+        LARGE_INTEGER current;
+        if (!GetFileSizeEx(f.file, &current)) return false;
+        size_t size = static_cast<size_t>(current.QuadPart);
+        if (size < minSize) size = minSize;
+        f.mapping = CreateFileMappingA(f.file, nullptr, PAGE_READWRITE,
+                                       static_cast<DWORD>(static_cast<Uint64>(size) >> 32),
+                                       static_cast<DWORD>(size), nullptr);
+        if (!f.mapping) return false;
+        f.data = static_cast<unsigned char*>(MapViewOfFile(f.mapping, FILE_MAP_WRITE, 0, 0, size));
+        if (!f.data) {
+            CloseHandle(f.mapping);
+            f.mapping = nullptr;
+            return false;
+        }
+#else
+        struct stat st;
+        if (fstat(f.fd, &st) != 0) return false;
+        size_t size = static_cast<size_t>(st.st_size);
+        if (size < minSize) {
+            if (ftruncate(f.fd, static_cast<off_t>(minSize)) != 0) return false;
+            size = minSize;
+        }
+        void* p = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, f.fd, 0);
+        if (p == MAP_FAILED) return false;
+        f.data = static_cast<unsigned char*>(p);
+#endif
+        f.size = size;
+        return true;
+    }
+
+    bool openMapped(MappedFile& f, const char* path, size_t minSize) {
+#ifdef _WIN32
+        f.file = CreateFileA(path, GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr,
+                             OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (f.file == INVALID_HANDLE_VALUE) return false;
+#else
+        f.fd = open(path, O_RDWR | O_CREAT, 0644);
+        if (f.fd < 0) return false;
+#endif
+        return mapView(f, minSize);
+    }
+
+    void closeMapped(MappedFile& f) {
+        if (f.data) {
+#ifdef _WIN32
+            FlushViewOfFile(f.data, 0);
+#else
+            msync(f.data, f.size, MS_SYNC);
+#endif
+        }
+        unmapView(f);
+#ifdef _WIN32
+        if (f.file != INVALID_HANDLE_VALUE) CloseHandle(f.file);
+        f.file = INVALID_HANDLE_VALUE;
+#else
+        if (f.fd >= 0) close(f.fd);
+        f.fd = -1;
+#endif
+        f.size = 0;
+    }
+
+    HistoryHeader* header() { return reinterpret_cast<HistoryHeader*>(historyFile.data); }
+    IndexFile* index() { return reinterpret_cast<IndexFile*>(indexFile.data); }
+
+    GameRecord* recordAt(Uint64 i) {
+        return reinterpret_cast<GameRecord*>(historyFile.data + kRecordsOffset) + i;
+    }
+
+    Uint64 recordCapacity() {
+        return (historyFile.size - kRecordsOffset) / sizeof(GameRecord);
+    }
+
+    int bucketOf(int score) {
+        if (score <= 0) return 0;
+        int b = 1 + static_cast<int>(std::log2(static_cast<double>(score)) * kBucketsPerOctave);
+        return std::min(b, kHistogramBuckets - 1);
+    }
+
+    // Lowest score that lands in bucket b
+    double bucketFloor(int b) {
+        if (b <= 0) return 0.0;
+        return std::exp2(static_cast<double>(b - 1) / kBucketsPerOctave);
+    }
+
+    void indexRecord(const GameRecord& r, Uint32 position) {
+        if (r.mode >= kModeCount) return;
+        ModeIndex& m = index()->modes[r.mode];
+        m.games++;
+        m.histogram[bucketOf(r.score)]++;
+
+        // New personal best goes on the trend before the top list changes
+        if (m.topCount == 0 || r.score > m.top[0].score) {
+            if (m.trendCount == kTrendMax) {
+                std::memmove(m.trend, m.trend + 1, sizeof(IndexEntry) * (kTrendMax - 1));
+                m.trendCount--;
+            }
+            m.trend[m.trendCount++] = IndexEntry{ r.score, position };
+        }
+
+        // Ties keep the older game ahead
+        Uint32 slot = m.topCount;
+        while (slot > 0 && m.top[slot - 1].score < r.score) --slot;
+        if (slot >= static_cast<Uint32>(kTopK)) return;
+        const Uint32 last = std::min<Uint32>(m.topCount, kTopK - 1);
+        std::memmove(m.top + slot + 1, m.top + slot, sizeof(IndexEntry) * (last - slot));
+        m.top[slot] = IndexEntry{ r.score, position };
+        if (m.topCount < static_cast<Uint32>(kTopK)) m.topCount++;
+    }
+
+    void rebuildIndex() {
+        IndexFile* idx = index();
+        std::memset(idx, 0, sizeof(IndexFile));
+        std::memcpy(idx->magic, "THIX", 4);
+        idx->version = kIndexVersion;
+        idx->recordSize = sizeof(GameRecord);
+        idx->modeCount = kModeCount;
+        const Uint64 count = header()->recordCount;
+        for (Uint64 i = 0; i < count; ++i) indexRecord(*recordAt(i), static_cast<Uint32>(i));
+        idx->indexedRecords = count;
+        SDL_Log("Rebuilt game history index (%llu games)", (unsigned long long)count);
+    }
+
+    bool indexMatches() {
+        const IndexFile* idx = index();
+        return std::memcmp(idx->magic, "THIX", 4) == 0 && idx->version == kIndexVersion &&
+               idx->recordSize == sizeof(GameRecord) && idx->modeCount == kModeCount &&
+               idx->indexedRecords == header()->recordCount;
+    }
+
+    const ModeIndex* modeIndex(Uint8 mode) {
+        if (!historyOpen || mode >= kModeCount) return nullptr;
+        return &index()->modes[mode];
+    }
+}
+
+bool openGameHistory() {
+    ALLOC_SCOPE(History);
+    const size_t initialSize = kRecordsOffset + kMinRecordCapacity * sizeof(GameRecord);
+    if (!openMapped(historyFile, kHistoryPath, initialSize) ||
+        !openMapped(indexFile, kIndexPath, sizeof(IndexFile))) {
+        SDL_Log("Could not map game history files, history disabled");
+        closeMapped(historyFile);
+        closeMapped(indexFile);
+        return false;
+    }
+
+    HistoryHeader* h = header();
+    if (std::memcmp(h->magic, "THST", 4) != 0) {
+        // Fresh file (all zeroes after growing)
+        std::memcpy(h->magic, "THST", 4);
+        h->version = kHistoryVersion;
+        h->recordSize = sizeof(GameRecord);
+        h->recordCount = 0;
+    } else if (h->version != kHistoryVersion || h->recordSize != sizeof(GameRecord)) {
+        SDL_Log("Unsupported game history format, history disabled");
+        closeMapped(historyFile);
+        closeMapped(indexFile);
+        return false;
+    }
+    if (h->recordCount > recordCapacity()) h->recordCount = recordCapacity(); // truncated file
+
+    historyOpen = true;
+    if (!indexMatches()) rebuildIndex();
+    return true;
+}
+
+void closeGameHistory() {
+    if (!historyOpen) return;
+    historyOpen = false;
+    closeMapped(indexFile);
+    closeMapped(historyFile);
+}
+
+void beginGameStats() {
+    piecesPlaced = 0;
+    gameSeed = fixedSeedEnabled ? fixedSeed
+                                : SDL_GetPerformanceCounter() ^ (SDL_GetTicksNS() * 0x9E3779B97F4A7C15ull);
+    seedPieceRandomizer(gameSeed);
+}
+
+void recordFinishedGame() {
+    ALLOC_SCOPE(History);
+    TRACE_SCOPE("recordFinishedGame");
+    if (!historyOpen || piecesPlaced == 0) return;
+
+    GameRecord r{};
+    r.seed = gameSeed;
+    SDL_Time now = 0;
+    SDL_GetCurrentTime(&now);
+    r.finishedAt = now / 1000000000;
+    const Uint64 elapsedNs = gameTimeNs(); // ticks played: time paused does not count
+    r.durationMs = static_cast<Uint32>(elapsedNs / 1000000);
+    r.score = scoreValue;
+    r.level = levelValue + 1;
+    r.lines = rowsCleared;
+    r.pieces = static_cast<Uint32>(piecesPlaced);
+    r.pps = elapsedNs > 0 ? static_cast<float>(piecesPlaced / (elapsedNs / 1e9)) : 0.0f;
+    r.mode = static_cast<Uint8>(currentGameMode);
+    r.randomizer = static_cast<Uint8>(pieceQueue.gen.kind);
+
+    HistoryHeader* h = header();
+    if (h->recordCount >= recordCapacity()) {
+        const size_t grown = kRecordsOffset + recordCapacity() * 2 * sizeof(GameRecord);
+        if (!mapView(historyFile, grown)) {
+            SDL_Log("Could not grow game history file, game not recorded");
+            historyOpen = false;
+            return;
+        }
+        h = header();
+    }
+
+    // Record first, then the count, so a crash in between only loses this game
+    const Uint64 position = h->recordCount;
+    *recordAt(position) = r;
+    h->recordCount = position + 1;
+
+    indexRecord(r, static_cast<Uint32>(position));
+    index()->indexedRecords = h->recordCount;
+}
+
+Uint64 historyGameCount(Uint8 mode) {
+    const ModeIndex* m = modeIndex(mode);
+    return m ? m->games : 0;
+}
+
+int historyTopScores(Uint8 mode, GameRecord* out, int maxCount) {
+    const ModeIndex* m = modeIndex(mode);
+    if (!m) return 0;
+    const int n = std::min(static_cast<int>(m->topCount), maxCount);
+    for (int i = 0; i < n; ++i) out[i] = *recordAt(m->top[i].record);
+    return n;
+}
+
+float historyPercentile(Uint8 mode, int score) {
+    const ModeIndex* m = modeIndex(mode);
+    if (!m || m->games == 0) return 0.0f;
+    const int b = bucketOf(score);
+    Uint64 below = 0;
+    for (int i = 0; i < b; ++i) below += m->histogram[i];
+    // Assume scores are spread evenly inside the bucket
+    const double lo = bucketFloor(b);
+    const double hi = bucketFloor(b + 1);
+    const double within = hi > lo ? (score - lo) / (hi - lo) : 0.0;
+    const double estimate = below + m->histogram[b] * std::clamp(within, 0.0, 1.0);
+    return static_cast<float>(estimate / static_cast<double>(m->games));
+}
+
+int historyScoreAtPercentile(Uint8 mode, float fraction) {
+    const ModeIndex* m = modeIndex(mode);
+    if (!m || m->games == 0) return 0;
+    const double target = std::clamp(static_cast<double>(fraction), 0.0, 1.0) * m->games;
+    double seen = 0.0;
+    for (int b = 0; b < kHistogramBuckets; ++b) {
+        const Uint32 count = m->histogram[b];
+        if (count > 0 && seen + count >= target) {
+            const double t = (target - seen) / count;
+            const double lo = bucketFloor(b);
+            return static_cast<int>(lo + (bucketFloor(b + 1) - lo) * t);
+        }
+        seen += count;
+    }
+    return m->topCount ? m->top[0].score : 0;
+}
+
+int historyBestTrend(Uint8 mode, GameRecord* out, int maxCount) {
+    const ModeIndex* m = modeIndex(mode);
+    if (!m) return 0;
+    // Keep the most recent bests if the caller has less room
+    const int n = std::min(static_cast<int>(m->trendCount), maxCount);
+    const int first = static_cast<int>(m->trendCount) - n;
+    for (int i = 0; i < n; ++i) out[i] = *recordAt(m->trend[first + i].record);
+    return n;
+}
+
+const GameRecord* historyLastGame() {
+    if (!historyOpen || header()->recordCount == 0) return nullptr;
+    return recordAt(header()->recordCount - 1);
+}
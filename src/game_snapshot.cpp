@@ -0,0 +1,72 @@
+#include "game_snapshot.h"
+#include "globals.h"
+#include <algorithm>
+
+void captureGameSnapshot(GameSnapshot& out) {
+    out.board = board;
+    out.current = currentPiece;
+    out.next = nextPiece;
+    out.hold = holdPiece;
+    out.pick = pickPiece;
+    out.nextPick = nextPickPiece;
+    out.queue = pieceQueue;
+
+    out.holdUsed = holdUsed;
+    out.newPiece = newPiece;
+    out.hardDrop = hardDropFlag;
+    out.alternateIOffset = alternateIPieceRotationOffset;
+    out.landed = pieceLanded;
+    out.landedOnce = pieceLandedOnce;
+    out.lockCounter = lockDelayCounter;
+    out.lockMoves = lockDelayMovesUsed;
+    out.lockRotations = lockDelayRotationsUsed;
+
+    out.score = scoreValue;
+    out.level = levelValue;
+    out.lines = rowsCleared;
+    out.levelIncrease = levelIncrease;
+    out.pieces = piecesPlaced;
+    out.dropSpeed = dropSpeed;
+    out.lastDropTime = lastDropTime;
+    out.tick = gameTick;
+
+    out.clearingRows = clearingRows;
+    out.clearRowCount = static_cast<int>(std::min<size_t>(rowsToClear.size(), boardHeight));
+    std::copy_n(rowsToClear.begin(), out.clearRowCount, out.clearRows);
+    out.clearAnimStart = clearAnimStart;
+    out.clearAnimStep = clearAnimStep;
+}
+
+void restoreGameSnapshot(const GameSnapshot& state) {
+    board = state.board;
+    currentPiece = state.current;
+    nextPiece = state.next;
+    holdPiece = state.hold;
+    pickPiece = state.pick;
+    nextPickPiece = state.nextPick;
+    pieceQueue = state.queue;
+
+    holdUsed = state.holdUsed;
+    newPiece = state.newPiece;
+    hardDropFlag = state.hardDrop;
+    alternateIPieceRotationOffset = state.alternateIOffset;
+    pieceLanded = state.landed;
+    pieceLandedOnce = state.landedOnce;
+    lockDelayCounter = state.lockCounter;
+    lockDelayMovesUsed = state.lockMoves;
+    lockDelayRotationsUsed = state.lockRotations;
+
+    scoreValue = state.score;
+    levelValue = state.level;
+    rowsCleared = state.lines;
+    levelIncrease = state.levelIncrease;
+    piecesPlaced = state.pieces;
+    dropSpeed = state.dropSpeed;
+    lastDropTime = state.lastDropTime;
+    gameTick = state.tick;
+
+    clearingRows = state.clearingRows;
+    rowsToClear.assign(state.clearRows, state.clearRows + state.clearRowCount); // reserved for boardHeight rows
+    clearAnimStart = state.clearAnimStart;
+    clearAnimStep = state.clearAnimStep;
+}
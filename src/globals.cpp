@@ -1,10 +1,18 @@
 #include "globals.h"
 #include "ltimer.h"
 #include "tetris_utils.h"
-#include "tPieceIcon.h"
-#include "Pixeboy_ttf.h"
-#include "splashLogo.h"
-#include "Logo.h"
+#include "startup.h"
+#include "save_data.h"
+#include "game_history.h"
+#include "frame_arena.h"
+#include "log.h"
+#include "audio.h"
+#include "bot.h"
+#include "replay.h"
+#include "offscreen_render.h"
+#include "trace.h"
+#include "advisor.h"
+#include "finesse.h"
 #include <SDL3/SDL.h>
 #include <SDL3_image/SDL_image.h>
 #include <SDL3_ttf/SDL_ttf.h>
@@ -41,7 +49,7 @@ static const char* buttonName(SDL_GamepadButton b) {
 
 // Add helper to acquire first available gamepad
 void AcquireFirstGamepadIfNone() {
-    if (gActiveGamepad) return;
+    if (gActiveGamepad || !gamepadSubsystemReady()) return;
     int count = 0;
     SDL_JoystickID* ids = SDL_GetGamepads(&count);
     for (int i = 0; i < count; ++i) {
@@ -65,10 +73,9 @@ void showSplashScreen()
 {
     //SDL_Log("Showing splash screen...");
 
-    // Load logo using SDL_image
+    // Logo was decoded on a worker thread while the window came up
     SDL_Texture* logoTex = nullptr;
-    SDL_IOStream* io_stream = SDL_IOFromMem(assets_splashLogo_png, assets_splashLogo_png_len);
-    SDL_Surface* splashSurface = IMG_Load_IO(io_stream, 1); // 1 = auto free rw
+    SDL_Surface* splashSurface = takeDecodedImage(StartupImage::SplashLogo, true);
     if (splashSurface != nullptr) {
         logoTex = SDL_CreateTextureFromSurface(gRenderer, splashSurface);
         SDL_DestroySurface(splashSurface);
@@ -204,8 +211,7 @@ bool loadMedia()
 {
     bool success{ true };
 
-    SDL_IOStream* io_stream = SDL_IOFromMem(assets_Pixeboy_ttf, assets_Pixeboy_ttf_len);
-    gFont = TTF_OpenFontIO(io_stream, 1, 24); // 1 = auto free rw
+    gFont = waitForFont(); // opened on a worker thread by beginStartupDecodes()
 
     if( gFont == nullptr )
     {
@@ -258,6 +264,7 @@ bool loadMedia()
         }
     }
 
+    startupMark("media loaded");
     return success;
 }
 
@@ -328,9 +335,10 @@ bool init(std::string title)
                 SDL_Log("Could not set window aspect ratio: %s", SDL_GetError());
             }
 
-            // Set window icon
-            SDL_IOStream* io_stream = SDL_IOFromMem(assets_tPieceIcon_png, assets_tPieceIcon_png_len);
-            SDL_Surface* iconSurface = IMG_Load_IO(io_stream, 1); // 1 = auto free rw
+            startupMark("window created");
+
+            // Set window icon (decoded on a worker thread, tiny so it is done by now)
+            SDL_Surface* iconSurface = takeDecodedImage(StartupImage::WindowIcon, true);
             if (iconSurface != nullptr) {
                 SDL_SetWindowIcon(gWindow, iconSurface);
                 SDL_DestroySurface(iconSurface);
@@ -338,20 +346,8 @@ bool init(std::string title)
                 SDL_Log("Could not load icon! SDL_image error: %s\n", SDL_GetError());
             }
 
-            if ( TTF_Init() == false )
-            {
-                SDL_Log( "SDL_ttf could not initialize! SDL_ttf error: %s\n", SDL_GetError() );
-                success = false;
-            }
-
-            if (SDL_InitSubSystem(SDL_INIT_GAMEPAD) == false)
-            {
-                SDL_Log("SDL gamepad subsystem could not initialize: %s", SDL_GetError());
-            }
-            else
-            {
-                AcquireFirstGamepadIfNone();
-            }
+            // TTF_Init and the font open happen in beginStartupDecodes(); the gamepad
+            // subsystem is initialized after the first interactive frame
 
             SDL_SetHint(SDL_HINT_MOUSE_DOUBLE_CLICK_TIME, "350");
             
@@ -371,12 +367,18 @@ void pollForNewGamepad() {
 }
 
 void capFrameRate(){
+    if (offscreenRenderActive()) return; // offscreen frames are produced as fast as they can be encoded
     Uint64 nsPerFrame = 1000000000 / kScreenFps;
     Uint64 frameNs{ capTimer.getTicksNS() };
     if( frameNs < nsPerFrame )
     {
+        TRACE_SCOPE("capFrameRate sleep");
         SDL_DelayNS( nsPerFrame - frameNs );
     }
+    else
+    {
+        traceInstant("frame over budget"); // no sleep left: this frame missed its deadline
+    }
 }
 
 static inline void ApplyFullscreenCursorState() {
@@ -396,7 +398,46 @@ void toggleFullscreen() {
     fullscreenEnabled = !isFullscreen;
 }
 
+// Draw a piece's occupied cells centered in `area` with the given cell step
+static void renderPiecePreview(const Piece& piece, const SDL_FRect& area, float step) {
+    // Compute bounding box of occupied cells
+    int minSX = piece.width, maxSX = -1;
+    int minSY = piece.height, maxSY = -1;
+    for (int sy = 0; sy < piece.height; ++sy) {
+        for (int sx = 0; sx < piece.width; ++sx) {
+            if (piece.cell(sx, sy)) {
+                if (sx < minSX) minSX = sx;
+                if (sx > maxSX) maxSX = sx;
+                if (sy < minSY) minSY = sy;
+                if (sy > maxSY) maxSY = sy;
+            }
+        }
+    }
+    // Empty (e.g. nothing held yet): nothing to draw
+    if (maxSX < minSX || maxSY < minSY) return;
+
+    // Minis cap the block gap so large gap settings do not erase them
+    const float gap = (step < blockSize / 2.0f) ? std::min(spacing, step / 4.0f) : spacing;
+    const float drawSize = step - gap;                    // size of each drawn block
+    const float pieceW = (maxSX - minSX + 1) * step - gap; // total drawn width
+    const float pieceH = (maxSY - minSY + 1) * step - gap; // total drawn height
+    const float baseX = area.x + (area.w - pieceW) / 2.0f;
+    const float baseY = area.y + (area.h - pieceH) / 2.0f;
+
+    for (int sy = 0; sy < piece.height; ++sy) {
+        for (int sx = 0; sx < piece.width; ++sx) {
+            if (piece.cell(sx, sy)) {
+                const float x = baseX + (sx - minSX) * step + gap / 2.0f;
+                const float y = baseY + (sy - minSY) * step + gap / 2.0f;
+                SDL_FRect rect{ x, y, drawSize, drawSize };
+                SDL_RenderFillRect(gRenderer, &rect);
+            }
+        }
+    }
+}
+
 void renderUI() {
+    TRACE_SCOPE("renderUI");
     //clear screen
     SDL_SetRenderDrawColor(gRenderer, 0, 0, 0, 255);
     SDL_RenderClear(gRenderer);
@@ -405,7 +446,11 @@ void renderUI() {
     scoreLabel.render( 520, 40);
     score.render( 520, 80 );
     levelLabel.render( 520, 120 );
-    level.loadFromRenderedText( std::to_string(levelValue+1), { 0xFF, 0xFF, 0xFF, 0xFF } );
+    static int shownLevel = -1; // re-render the level text only when it changes
+    if (levelValue + 1 != shownLevel) {
+        shownLevel = levelValue + 1;
+        level.loadFromRenderedText( std::to_string(shownLevel), { 0xFF, 0xFF, 0xFF, 0xFF } );
+    }
     level.render( 520, 160 );
     nextLabel.render( 520, 200 );
     holdLabel.render( 520, 380 );
@@ -418,88 +463,31 @@ void renderUI() {
 
     SDL_SetRenderDrawColor( gRenderer, 128, 128, 128, 255 ); // Gray color for pieces
 
-    // ---- Render NEXT piece centered in nextFRect ----
-    {
-        // Compute bounding box of occupied cells
-        int minSX = nextPiece.width, maxSX = -1;
-        int minSY = nextPiece.height, maxSY = -1;
-        for (int sy = 0; sy < nextPiece.height; ++sy) {
-            for (int sx = 0; sx < nextPiece.width; ++sx) {
-                if (nextPiece.shape[sy][sx] != 0) {
-                    if (sx < minSX) minSX = sx;
-                    if (sx > maxSX) maxSX = sx;
-                    if (sy < minSY) minSY = sy;
-                    if (sy > maxSY) maxSY = sy;
-                }
-            }
-        }
-        // If piece is empty (shouldn't happen), skip drawing
-        if (maxSX >= minSX && maxSY >= minSY) {
-            const float step = blockSize / 2.0f;                 // cell-to-cell step
-            const float drawSize = step - spacing;               // size of each drawn block
-            const int cellsX = (maxSX - minSX + 1);
-            const int cellsY = (maxSY - minSY + 1);
-            const float pieceW = cellsX * step - spacing;        // total drawn width
-            const float pieceH = cellsY * step - spacing;        // total drawn height
-
-            const float baseX = nextFRect.x + (nextFRect.w - pieceW) / 2.0f;
-            const float baseY = nextFRect.y + (nextFRect.h - pieceH) / 2.0f;
-
-            for (int sy = 0; sy < nextPiece.height; ++sy) {
-                for (int sx = 0; sx < nextPiece.width; ++sx) {
-                    if (nextPiece.shape[sy][sx] != 0) {
-                        const float x = baseX + (sx - minSX) * step + spacing / 2.0f;
-                        const float y = baseY + (sy - minSY) * step + spacing / 2.0f;
-                        SDL_FRect rect{ x, y, drawSize, drawSize };
-                        SDL_RenderFillRect(gRenderer, &rect);
-                    }
-                }
-            }
+    // ---- Render NEXT queue ----
+    const float previewStep = blockSize / 2.0f; // cell-to-cell step
+    if (previewDepth <= 1) {
+        renderPiecePreview(nextPiece, nextFRect, previewStep);
+    } else {
+        // First piece at full preview size in the top of the box, the rest as
+        // minis in a 3-wide grid underneath
+        SDL_FRect firstArea{ nextFRect.x, nextFRect.y, nextFRect.w, 56.f };
+        renderPiecePreview(nextPiece, firstArea, previewStep);
+        const float miniW = nextFRect.w / 3.0f;
+        const float miniH = (nextFRect.h - firstArea.h) / 2.0f;
+        for (int i = 1; i < previewDepth; ++i) {
+            const int slot = i - 1;
+            SDL_FRect mini{ nextFRect.x + (slot % 3) * miniW, firstArea.y + firstArea.h + (slot / 3) * miniH, miniW, miniH };
+            renderPiecePreview(pieceTypes[pieceQueuePeek(pieceQueue, i)], mini, previewStep / 2.0f);
         }
     }
 
     // ---- Render HOLD piece centered in holdFRect ----
-    {
-        // Compute bounding box of occupied cells
-        int minSX = holdPiece.width, maxSX = -1;
-        int minSY = holdPiece.height, maxSY = -1;
-        for (int sy = 0; sy < holdPiece.height; ++sy) {
-            for (int sx = 0; sx < holdPiece.width; ++sx) {
-                if (holdPiece.shape[sy][sx] != 0) {
-                    if (sx < minSX) minSX = sx;
-                    if (sx > maxSX) maxSX = sx;
-                    if (sy < minSY) minSY = sy;
-                    if (sy > maxSY) maxSY = sy;
-                }
-            }
-        }
-        if (maxSX >= minSX && maxSY >= minSY) {
-            const float step = blockSize / 2.0f;
-            const float drawSize = step - spacing;
-            const int cellsX = (maxSX - minSX + 1);
-            const int cellsY = (maxSY - minSY + 1);
-            const float pieceW = cellsX * step - spacing;
-            const float pieceH = cellsY * step - spacing;
-
-            const float baseX = holdFRect.x + (holdFRect.w - pieceW) / 2.0f;
-            const float baseY = holdFRect.y + (holdFRect.h - pieceH) / 2.0f;
-
-            for (int sy = 0; sy < holdPiece.height; ++sy) {
-                for (int sx = 0; sx < holdPiece.width; ++sx) {
-                    if (holdPiece.shape[sy][sx] != 0) {
-                        const float x = baseX + (sx - minSX) * step + spacing / 2.0f;
-                        const float y = baseY + (sy - minSY) * step + spacing / 2.0f;
-                        SDL_FRect rect{ x, y, drawSize, drawSize };
-                        SDL_RenderFillRect(gRenderer, &rect);
-                    }
-                }
-            }
-        }
-    }
+    renderPiecePreview(holdPiece, holdFRect, previewStep);
 
     SDL_SetRenderDrawColor( gRenderer, 255, 255, 255, 255 ); // set render color to white
     SDL_RenderRect( gRenderer, &nextFRect ); // Render a rectangle for the next piece
     SDL_RenderRect( gRenderer, &holdFRect ); // Render a rectangle for the hold piece
+    renderFinesseStats();
     
     if (gridLinesEnabled) { // Draw grid lines
         SDL_SetRenderDrawColor(gRenderer, 40, 40, 40, 255);
@@ -519,6 +507,7 @@ void renderUI() {
 }
 
 void renderParticles() {
+    TRACE_SCOPE("renderParticles");
     for (auto it = particles.begin(); it != particles.end();) {
         it->x += it->vx;
         it->y += it->vy;
@@ -559,67 +548,19 @@ int levelValue = 0;
 int maxLevelAchieved = 0;
 int highScoreValue = 0;
 
-// Define Tetris pieces
-Piece iPiece = {
-    4, // width
-    1, // height
-    std::vector<std::vector<int>>{ { 1, 1, 1, 1 } }, // shape
-    0, // rotation
-    1  // color
-};
-
-Piece oPiece = {
-    2, // width
-    2, // height
-    std::vector<std::vector<int>>{ { 1, 1 }, { 1, 1 } }, // shape
-    0, // rotation
-    2  // color
-};
-
-Piece tPiece = {
-    3, // width
-    2, // height
-    std::vector<std::vector<int>>{ { 0, 1, 0 }, { 1, 1, 1 } }, // shape
-    0, // rotation
-    3  // color
-};
-
-Piece lPiece = {
-    3, // width
-    2, // height
-    std::vector<std::vector<int>>{ { 0, 0, 1 }, { 1, 1, 1 } }, // shape
-    0, // rotation
-    4  // color
-};
-
-Piece jPiece = {
-    3, // width
-    2, // height
-    std::vector<std::vector<int>>{ { 1, 0, 0 }, { 1, 1, 1 } }, // shape
-    0, // rotation
-    5  // color
-};
-
-Piece sPiece = {
-    3, // width
-    2, // height
-    std::vector<std::vector<int>>{ { 0, 1, 1 }, { 1, 1, 0 } }, // shape
-    0, // rotation
-    6  // color
-};
-
-Piece zPiece = {
-    3, // width
-    2, // height
-    std::vector<std::vector<int>>{ { 1, 1, 0 }, { 0, 1, 1 } }, // shape
-    0, // rotation
-    7  // color
-};
+// Define Tetris pieces (shapes live in kPieceShapes, see piece.h)
+Piece iPiece = makePiece(0);
+Piece oPiece = makePiece(1);
+Piece tPiece = makePiece(2);
+Piece lPiece = makePiece(3);
+Piece jPiece = makePiece(4);
+Piece sPiece = makePiece(5);
+Piece zPiece = makePiece(6);
 
 float spacing = 2.0f; // Amount of spacing between blocks
 
 LTimer capTimer; //frames per second timer
-Uint64 lastDropTime = SDL_GetTicksNS();
+Uint64 lastDropTime = 0; // gameTimeNs() of the last gravity step
 Uint64 dropSpeed{ 900000000 }; // Milliseconds between drops
 
 // Wall kick offset vectors (J, L, S, T, Z pieces)
@@ -663,8 +604,8 @@ std::vector<std::pair<int, int>> wallKickOffsetsI0L = {{0, 0}, {-1, 0}, {2, 0},
 
 std::vector<std::pair<int, int>> wallKickOffsetsI[8] = {wallKickOffsetsI0R, wallKickOffsetsIR2, wallKickOffsetsI2L, wallKickOffsetsIL0, wallKickOffsetsI0L, wallKickOffsetsIL2, wallKickOffsetsI2R, wallKickOffsetsIR0};
 
-// 7-bag RNG (safe for cross-translation-unit use)
-static std::mt19937& pieceRng() {
+// Cosmetic RNG for the menu backgrounds; gameplay pieces come from the seeded queue
+static std::mt19937& menuRng() {
     static std::mt19937 rng([] {
         const auto now = std::chrono::high_resolution_clock::now().time_since_epoch().count();
         return std::mt19937(static_cast<unsigned int>(now));
@@ -672,31 +613,10 @@ static std::mt19937& pieceRng() {
     return rng;
 }
 
-static std::array<int, 7>& pieceBag() {
-    static std::array<int, 7> bag{};
-    return bag;
-}
-
-static size_t& pieceBagIndex() {
-    static size_t index = pieceBag().size();
-    return index;
-}
-
-static void refillBag() {
-    auto& bag = pieceBag();
-    for (int i = 0; i < 7; ++i) bag[i] = i;
-    std::shuffle(bag.begin(), bag.end(), pieceRng());
-    pieceBagIndex() = 0;
-}
-
-int drawPieceIndex() {
-    auto& bag = pieceBag();
-    auto& index = pieceBagIndex();
-    if (index >= bag.size()) refillBag();
-    return bag[index++];
-}
+Uint64 gameSeed = 0; // Piece seed of the current game (recorded with its history)
 
 GameState currentState = GameState::MENU;
+GameMode currentGameMode = GameMode::Marathon;
 
 // Controller repeat config (ms)
 Uint64 kDAS_MS          = 167; // delay before auto-repeat
@@ -732,11 +652,15 @@ LTexture playTexture;
 LTexture optionsTexture;
 LTexture backTexture;
 LTexture exitTexture;
+LTexture scoresTexture;
 
 LTexture optionsTitleTexture;
 LTexture optionsGridLabel;
 LTexture optionsBlockGapLabel;
 LTexture optionsPlacementPreviewLabel;
+LTexture optionsRandomizerLabel;
+LTexture optionsPreviewDepthLabel;
+LTexture optionsPlacementHintLabel;
 
 LTexture optionsTitleTexture2;
 LTexture windowSizeLabel;
@@ -752,9 +676,9 @@ LTexture inputConfigKeyDirectionLabel;
 
 int menuSelection = 0;
 
-// Helper to move menu selection (0..2) with wrap-around
+// Helper to move menu selection (0..3) with wrap-around
 static inline void moveMenuSelection(int delta) {
-    const int count = 3; // Play, Options, Exit
+    const int count = 4; // Play, Options, Scores, Exit
     menuSelection = (menuSelection + delta + count) % count;
 }
 
@@ -799,16 +723,16 @@ static void initMenuBackgroundPieces() {
         const Piece* p = kAllPiecesPtr[i % 7];
         MenuBouncePiece mb{
             p,
-            sx(pieceRng()), sy(pieceRng()),
+            sx(menuRng()), sy(menuRng()),
             0.f, 0.f,
             0.f,
             1.f,
             kMenuColors[i % 7],
-            sc(pieceRng())
+            sc(menuRng())
         };
         // ensure non-zero velocity
-        mb.vx = (sv(pieceRng()) >= 0 ? sv(pieceRng()) + 20.f : sv(pieceRng()) - 20.f);
-        mb.vy = (sv(pieceRng()) >= 0 ? sv(pieceRng()) + 20.f : sv(pieceRng()) - 20.f);
+        mb.vx = (sv(menuRng()) >= 0 ? sv(menuRng()) + 20.f : sv(menuRng()) - 20.f);
+        mb.vy = (sv(menuRng()) >= 0 ? sv(menuRng()) + 20.f : sv(menuRng()) - 20.f);
         gMenuPieces.push_back(mb);
     }
     gMenuPiecesInit = true;
@@ -834,7 +758,7 @@ static void renderMenuBackgroundPieces() {
         SDL_SetRenderDrawColor(gRenderer, m.color.r, m.color.g, m.color.b, m.color.a);
         for (int yy = 0; yy < m.piece->height; ++yy) {
             for (int xx = 0; xx < m.piece->width; ++xx) {
-                if (m.piece->shape[yy][xx]) {
+                if (m.piece->cell(xx, yy)) {
                     SDL_FRect r{
                         m.x + xx * m.cellSize,
                         m.y + yy * m.cellSize,
@@ -848,11 +772,10 @@ static void renderMenuBackgroundPieces() {
     }
 }
 
-// Lazy-load and cache logo texture (avoid per-frame load cost)
+// Cache logo texture once its background decode has finished (never blocks the menu)
 static SDL_Texture* getMenuLogoTexture() {
     if (gMenuLogoTex) return gMenuLogoTex;
-    SDL_IOStream* io_stream = SDL_IOFromMem(assets_Logo_png, assets_Logo_png_len);
-    SDL_Surface* logoSurface = IMG_Load_IO(io_stream, 1);
+    SDL_Surface* logoSurface = takeDecodedImage(StartupImage::MenuLogo, false);
     if (logoSurface) {
         gMenuLogoTex = SDL_CreateTextureFromSurface(gRenderer, logoSurface);
         SDL_DestroySurface(logoSurface);
@@ -888,13 +811,13 @@ static void initMenuFallingPieces() {
         const Piece* p = kAllPiecesPtr[i % 7];
         gMenuFallingPieces.push_back(MenuFallingPiece{
             p,
-            sx(pieceRng()),
-            sy(pieceRng()),
-            sv(pieceRng()),
-            sd(pieceRng()),
-            sc(pieceRng()),
+            sx(menuRng()),
+            sy(menuRng()),
+            sv(menuRng()),
+            sd(menuRng()),
+            sc(menuRng()),
             kMenuColors[i % 7],
-            (Uint8)ca(pieceRng())
+            (Uint8)ca(menuRng())
         });
     }
     gMenuFallingInit = true;
@@ -906,13 +829,13 @@ static void respawnFallingPiece(MenuFallingPiece& m) {
     std::uniform_real_distribution<float> sv(55.f, 150.f);
     std::uniform_real_distribution<float> sd(-12.f, 12.f);
     std::uniform_int_distribution<int> ca(55, 95);
-    m.cellSize = sc(pieceRng());
+    m.cellSize = sc(menuRng());
     float w = m.piece->width * m.cellSize;
-    m.x = std::min(std::max(0.f, sx(pieceRng())), (float)kScreenWidth - w);
+    m.x = std::min(std::max(0.f, sx(menuRng())), (float)kScreenWidth - w);
     m.y = -m.piece->height * m.cellSize - (float)(rand()%120);
-    m.vy = sv(pieceRng());
-    m.drift = sd(pieceRng());
-    m.alpha = (Uint8)ca(pieceRng());
+    m.vy = sv(menuRng());
+    m.drift = sd(menuRng());
+    m.alpha = (Uint8)ca(menuRng());
 }
 
 static void updateMenuFallingPieces(float dt) {
@@ -933,7 +856,7 @@ static void renderMenuFallingPieces() {
         SDL_SetRenderDrawColor(gRenderer, m.color.r, m.color.g, m.color.b, m.alpha);
         for (int yy = 0; yy < m.piece->height; ++yy) {
             for (int xx = 0; xx < m.piece->width; ++xx) {
-                if (m.piece->shape[yy][xx]) {
+                if (m.piece->cell(xx, yy)) {
                     SDL_FRect r{
                         m.x + xx * m.cellSize,
                         m.y + yy * m.cellSize,
@@ -1000,26 +923,32 @@ void renderMenu() {
     playTexture.loadFromRenderedText("Play", {255,255,255,255});
     optionsTexture.loadFromRenderedText("Options", {255,255,255,255});
     exitTexture.loadFromRenderedText("Exit", {255,255,255,255});
+    scoresTexture.loadFromRenderedText("Scores", {255,255,255,255});
 
     int rightX = kScreenWidth - 250;
     int centerY = kScreenHeight / 2;
 
     const int yPlay    = centerY - 10;
     const int yOptions = centerY + 40;
-    const int yExit    = centerY + 90;
+    const int yScores  = centerY + 90;
+    const int yExit    = centerY + 140;
 
     const int xPlay    = rightX;
     const int xOptions = rightX - 15;
+    const int xScores  = rightX - 12;
     const int xExit    = rightX - 5;
 
     const LTexture* selTex = (menuSelection == 0) ? &playTexture
                            : (menuSelection == 1) ? &optionsTexture
+                           : (menuSelection == 2) ? &scoresTexture
                            : &exitTexture;
     const int selX = (menuSelection == 0) ? xPlay
                    : (menuSelection == 1) ? xOptions
+                   : (menuSelection == 2) ? xScores
                    : xExit;
     const int selY = (menuSelection == 0) ? yPlay
                    : (menuSelection == 1) ? yOptions
+                   : (menuSelection == 2) ? yScores
                    : yExit;
 
     SDL_SetRenderDrawColor(gRenderer, 49,117,73,95);
@@ -1033,6 +962,7 @@ void renderMenu() {
 
     playTexture.render(xPlay, yPlay);
     optionsTexture.render(xOptions, yOptions);
+    scoresTexture.render(xScores, yScores);
     exitTexture.render(xExit, yExit);
 }
 
@@ -1102,7 +1032,7 @@ static inline void moveBlockGapSelection(int delta) {
 
 // Helper to move menu selection (0..4) with wrap-around
 static inline void moveGameOptionsMenuSelection(int delta) {
-    const int count = 5; // tab, grid, gap, preview, back
+    const int count = 8; // tab, grid, gap, preview, randomizer, queue, hint, back
     GameOptionsMenuSelection = (GameOptionsMenuSelection + delta + count) % count;
 }
 
@@ -1141,10 +1071,13 @@ void renderGameOptions() {
     const int yGame = centerY;
     const int yVideo = centerY;
     const int yInput = centerY;
-    const int yGridLines = centerY + 150;
-    const int yBlockGap = centerY + 250;
-    const int yPlacementPreview = centerY + 350;
-    const int yBack = centerY + 450;
+    const int yGridLines = centerY + 110;
+    const int yBlockGap = centerY + 180;
+    const int yPlacementPreview = centerY + 250;
+    const int yRandomizer = centerY + 320;
+    const int yPreviewDepth = centerY + 390;
+    const int yPlacementHint = centerY + 460;
+    const int yBack = centerY + 540;
 
     //x positions
     const int xGame = rightX - 60; //140
@@ -1153,6 +1086,9 @@ void renderGameOptions() {
     const int xGridLines = rightX - 150;
     const int xBlockGap = rightX - 150;
     const int xPlacementPreview = rightX - 150;
+    const int xRandomizer = rightX - 150;
+    const int xPreviewDepth = rightX - 150;
+    const int xPlacementHint = rightX - 150;
     const int xBack = rightX - 150;
 
     optionsTitleTexture.loadFromRenderedText("Game", {255,255,255,255});
@@ -1166,6 +1102,9 @@ void renderGameOptions() {
     optionsPlacementPreviewLabel.loadFromRenderedText( (placementPreviewSelection == 0) ? "Placement Preview    < Ghost Piece & Highlights >"
                                                         : (placementPreviewSelection == 1) ? "Placement Preview    < Ghost Piece Only >"
                                                         : "Placement Preview    < None >" , {255,255,255,255});
+    optionsRandomizerLabel.loadFromRenderedText(std::string("Randomizer        < ") + randomizerName(randomizerKind) + " >", {255,255,255,255});
+    optionsPreviewDepthLabel.loadFromRenderedText("Next Pieces       < " + std::to_string(previewDepth) + " >", {255,255,255,255});
+    optionsPlacementHintLabel.loadFromRenderedText(placementHintEnabled ? "Placement Hint    < ON >" : "Placement Hint    < OFF >", {255,255,255,255});
     backTexture.loadFromRenderedText("Return", {255,255,255,255});
 
     // Selection rectangle around the chosen option
@@ -1173,16 +1112,25 @@ void renderGameOptions() {
                            : (GameOptionsMenuSelection == 1) ? &optionsGridLabel
                            : (GameOptionsMenuSelection == 2) ? &optionsBlockGapLabel
                            : (GameOptionsMenuSelection == 3) ? &optionsPlacementPreviewLabel
+                           : (GameOptionsMenuSelection == 4) ? &optionsRandomizerLabel
+                           : (GameOptionsMenuSelection == 5) ? &optionsPreviewDepthLabel
+                           : (GameOptionsMenuSelection == 6) ? &optionsPlacementHintLabel
                            : &backTexture;
     const int selX = (GameOptionsMenuSelection == 0) ? xGame
                    : (GameOptionsMenuSelection == 1) ? xGridLines
                    : (GameOptionsMenuSelection == 2) ? xBlockGap
                    : (GameOptionsMenuSelection == 3) ? xPlacementPreview
+                   : (GameOptionsMenuSelection == 4) ? xRandomizer
+                   : (GameOptionsMenuSelection == 5) ? xPreviewDepth
+                   : (GameOptionsMenuSelection == 6) ? xPlacementHint
                    : xBack;
     const int selY = (GameOptionsMenuSelection == 0) ? yGame
                    : (GameOptionsMenuSelection == 1) ? yGridLines
                    : (GameOptionsMenuSelection == 2) ? yBlockGap
                    : (GameOptionsMenuSelection == 3) ? yPlacementPreview
+                   : (GameOptionsMenuSelection == 4) ? yRandomizer
+                   : (GameOptionsMenuSelection == 5) ? yPreviewDepth
+                   : (GameOptionsMenuSelection == 6) ? yPlacementHint
                    : yBack;
 
     const int padX = 18;
@@ -1210,10 +1158,34 @@ void renderGameOptions() {
     optionsGridLabel.render(xGridLines, yGridLines);
     optionsBlockGapLabel.render(xBlockGap, yBlockGap);
     optionsPlacementPreviewLabel.render(xPlacementPreview, yPlacementPreview);
+    optionsRandomizerLabel.render(xRandomizer, yRandomizer);
+    optionsPreviewDepthLabel.render(xPreviewDepth, yPreviewDepth);
+    optionsPlacementHintLabel.render(xPlacementHint, yPlacementHint);
     backTexture.render(xBack, yBack);
 
 }
 
+// Left/right on the selected Game options row (delta is -1 or +1)
+static void changeGameOption(int delta) {
+    if (GameOptionsMenuSelection == 0) { // Game tab
+        optionsTab = (delta < 0) ? 2 : 1;
+    } else if (GameOptionsMenuSelection == 1) { // Grid lines
+        gridLinesEnabled = !gridLinesEnabled;
+    } else if (GameOptionsMenuSelection == 2) { // Block gap
+        blockGapSelection = (blockGapSelection + delta + 4) % 4;
+        spacing = blockGapValues[blockGapSelection];
+    } else if (GameOptionsMenuSelection == 3) { // Placement preview
+        placementPreviewSelection = (placementPreviewSelection + delta + 3) % 3;
+    } else if (GameOptionsMenuSelection == 4) { // Randomizer (applies from the next game)
+        const int count = static_cast<int>(RandomizerKind::Count);
+        randomizerKind = static_cast<RandomizerKind>((static_cast<int>(randomizerKind) + delta + count) % count);
+    } else if (GameOptionsMenuSelection == 5) { // Preview depth 1..kMaxPreview
+        previewDepth = (previewDepth - 1 + delta + kMaxPreview) % kMaxPreview + 1;
+    } else if (GameOptionsMenuSelection == 6) { // Placement hint
+        placementHintEnabled = !placementHintEnabled;
+    }
+}
+
 int handleGameOptionsMenuEvent(const SDL_Event& e) {
     //handke keyboard input for menu navigation
     if (e.type == SDL_EVENT_KEY_DOWN) {
@@ -1222,27 +1194,9 @@ int handleGameOptionsMenuEvent(const SDL_Event& e) {
         } else if (e.key.key == SDLK_DOWN) {
             moveGameOptionsMenuSelection(1);
         }else if (e.key.key == SDLK_LEFT) {
-            if (GameOptionsMenuSelection == 0) { // Game tab
-                optionsTab = 2;
-            } else if (GameOptionsMenuSelection == 1) { // Grid lines
-                gridLinesEnabled = !gridLinesEnabled;
-            } else if (GameOptionsMenuSelection == 2) { // Block gap
-                blockGapSelection = (blockGapSelection - 1 + 4) % 4;
-                spacing = blockGapValues[blockGapSelection];
-            } else if (GameOptionsMenuSelection == 3) { // Placement preview
-                placementPreviewSelection = (placementPreviewSelection - 1 + 3) % 3;
-            }
+            changeGameOption(-1);
         } else if (e.key.key == SDLK_RIGHT) {
-            if (GameOptionsMenuSelection == 0) { // Game tab
-                optionsTab = 1;
-            } else if (GameOptionsMenuSelection == 1) { // Grid lines
-                gridLinesEnabled = !gridLinesEnabled;
-            } else if (GameOptionsMenuSelection == 2) { // Block gap
-                blockGapSelection = (blockGapSelection + 1) % 4;
-                spacing = blockGapValues[blockGapSelection];
-            } else if (GameOptionsMenuSelection == 3) { // Placement preview
-                placementPreviewSelection = (placementPreviewSelection + 1) % 3;
-            }
+            changeGameOption(1);
 
         } else if (e.key.key == SDLK_ESCAPE) {
             GameOptionsMenuSelection = 0;
@@ -1259,32 +1213,14 @@ int handleGameOptionsMenuEvent(const SDL_Event& e) {
         } else if (e.gbutton.button == SDL_GAMEPAD_BUTTON_DPAD_DOWN) {
             moveGameOptionsMenuSelection(1);
         } else if (e.gbutton.button == SDL_GAMEPAD_BUTTON_DPAD_RIGHT) {
-            if (GameOptionsMenuSelection == 0) { // Game tab
-                optionsTab = 1;
-            } else if (GameOptionsMenuSelection == 1) { // Grid lines
-                gridLinesEnabled = !gridLinesEnabled;
-            } else if (GameOptionsMenuSelection == 2) { // Block gap
-                blockGapSelection = (blockGapSelection + 1) % 4;
-                spacing = blockGapValues[blockGapSelection];
-            } else if (GameOptionsMenuSelection == 3) { // Placement preview
-                placementPreviewSelection = (placementPreviewSelection + 1) % 3;
-            }
+            changeGameOption(1);
         } else if (e.gbutton.button == SDL_GAMEPAD_BUTTON_DPAD_LEFT) {
-            if (GameOptionsMenuSelection == 0) { // Game tab
-                optionsTab = 2;
-            } else if (GameOptionsMenuSelection == 1) { // Grid lines
-                gridLinesEnabled = !gridLinesEnabled;
-            } else if (GameOptionsMenuSelection == 2) { // Block gap
-                blockGapSelection = (blockGapSelection - 1 + 4) % 4;
-                spacing = blockGapValues[blockGapSelection];
-            } else if (GameOptionsMenuSelection == 3) { // Placement preview
-                placementPreviewSelection = (placementPreviewSelection - 1 + 3) % 3;
-            }
+            changeGameOption(-1);
         } else if (e.gbutton.button == SDL_GAMEPAD_BUTTON_EAST) {
             GameOptionsMenuSelection = 0;
             return 4;
         } else if (e.gbutton.button == SDL_GAMEPAD_BUTTON_SOUTH) {
-            if (GameOptionsMenuSelection == 4) { // Back
+            if (GameOptionsMenuSelection == 7) { // Back
                 GameOptionsMenuSelection = 0;
                 return 4; // Return to main menu
             } 
@@ -1323,31 +1259,13 @@ int handleGameOptionsMenuEvent(const SDL_Event& e) {
         const int v = e.gaxis.value;
         if (v <= -kAxisPress) {
             if (!pauseAxisLeftHeld) {
-                if (GameOptionsMenuSelection == 0) { // Game tab
-                    optionsTab = 2;
-                } else if (GameOptionsMenuSelection == 1) { // Grid lines
-                    gridLinesEnabled = !gridLinesEnabled;
-                } else if (GameOptionsMenuSelection == 2) { // Block gap
-                    blockGapSelection = (blockGapSelection - 1 + 4) % 4;
-                    spacing = blockGapValues[blockGapSelection];
-                } else if (GameOptionsMenuSelection == 3) { // Placement preview
-                    placementPreviewSelection = (placementPreviewSelection - 1 + 3) % 3;
-                }
+                changeGameOption(-1);
                 pauseAxisLeftHeld = true;
                 pauseAxisRightHeld = false;
             }
         } else if (v >= kAxisPress) {
             if (!pauseAxisRightHeld) {
-                if (GameOptionsMenuSelection == 0) { // Game tab
-                    optionsTab = 1;
-                } else if (GameOptionsMenuSelection == 1) { // Grid lines
-                    gridLinesEnabled = !gridLinesEnabled;
-                } else if (GameOptionsMenuSelection == 2) { // Block gap
-                    blockGapSelection = (blockGapSelection + 1) % 4;
-                    spacing = blockGapValues[blockGapSelection];
-                } else if (GameOptionsMenuSelection == 3) { // Placement preview
-                    placementPreviewSelection = (placementPreviewSelection + 1) % 3;
-                }
+                changeGameOption(1);
                 pauseAxisRightHeld = true;
                 pauseAxisLeftHeld = false;
             }
@@ -2064,10 +1982,152 @@ void renderPauseMenu() {
     SDL_SetRenderDrawBlendMode(gRenderer, prevBlend);
 }
 
+// ---- Leaderboard ----
+// Text is rendered once when the screen is opened; the history index answers
+// every query without reading the full history file.
+static constexpr int kLeaderboardRows = 10;
+static constexpr int kLeaderboardColumns = 5; // rank, score, level, lines, pps
+static LTexture leaderboardTitle;
+static LTexture leaderboardHeader[kLeaderboardColumns];
+static LTexture leaderboardCells[kLeaderboardRows][kLeaderboardColumns];
+static LTexture leaderboardSummary;
+static LTexture leaderboardLastGame;
+static LTexture leaderboardTrend;
+static LTexture leaderboardBack;
+static int leaderboardRowCount = 0;
+static const int kLeaderboardColumnX[kLeaderboardColumns] = { 50, 110, 290, 380, 480 };
+
+void refreshLeaderboard() {
+    const SDL_Color white{255, 255, 255, 255};
+    const SDL_Color grey{170, 170, 170, 255};
+    const Uint8 mode = static_cast<Uint8>(currentGameMode);
+
+    leaderboardTitle.loadFromRenderedText("HIGH SCORES", white);
+    leaderboardBack.loadFromRenderedText("Back", white);
+    const char* headers[kLeaderboardColumns] = { "#", "Score", "Level", "Lines", "PPS" };
+    for (int c = 0; c < kLeaderboardColumns; ++c) leaderboardHeader[c].loadFromRenderedText(headers[c], grey);
+
+    GameRecord top[kLeaderboardRows];
+    leaderboardRowCount = historyTopScores(mode, top, kLeaderboardRows);
+    char pps[16];
+    for (int r = 0; r < leaderboardRowCount; ++r) {
+        SDL_snprintf(pps, sizeof(pps), "%.2f", top[r].pps);
+        leaderboardCells[r][0].loadFromRenderedText(std::to_string(r + 1), grey);
+        leaderboardCells[r][1].loadFromRenderedText(std::to_string(top[r].score), white);
+        leaderboardCells[r][2].loadFromRenderedText(std::to_string(top[r].level), white);
+        leaderboardCells[r][3].loadFromRenderedText(std::to_string(top[r].lines), white);
+        leaderboardCells[r][4].loadFromRenderedText(pps, white);
+    }
+
+    const Uint64 games = historyGameCount(mode);
+    if (games == 0) {
+        leaderboardSummary.loadFromRenderedText("No games played yet", grey);
+        leaderboardLastGame.destroy();
+        leaderboardTrend.destroy();
+        return;
+    }
+    leaderboardSummary.loadFromRenderedText("Games " + std::to_string(games) + "   Median " +
+                                            std::to_string(historyScoreAtPercentile(mode, 0.5f)), grey);
+
+    if (const GameRecord* last = historyLastGame(); last && last->mode == mode) {
+        const int beat = static_cast<int>(historyPercentile(mode, last->score) * 100.0f + 0.5f);
+        leaderboardLastGame.loadFromRenderedText("Last " + std::to_string(last->score) + " beat " +
+                                                 std::to_string(beat) + "% of games", grey);
+    } else {
+        leaderboardLastGame.destroy();
+    }
+
+    GameRecord trend[5];
+    const int trendCount = historyBestTrend(mode, trend, 5);
+    std::string trendText = "Bests";
+    for (int i = 0; i < trendCount; ++i) trendText += (i ? " > " : " ") + std::to_string(trend[i].score);
+    leaderboardTrend.loadFromRenderedText(trendText, grey);
+}
+
+void renderLeaderboard() {
+    static Uint64 lastTicks = SDL_GetTicksNS();
+    Uint64 now = SDL_GetTicksNS();
+    float dt = (now - lastTicks) / 1'000'000'000.0f;
+    if (dt > 0.05f) dt = 0.05f;
+    lastTicks = now;
+
+    if (!gMenuPiecesInit) initMenuBackgroundPieces();
+
+    SDL_SetRenderDrawColor(gRenderer, 0, 0, 0, 255);
+    SDL_RenderClear(gRenderer);
+
+    updateMenuBackgroundPieces(dt);
+    renderMenuBackgroundPieces();
+
+    SDL_BlendMode prev;
+    SDL_GetRenderDrawBlendMode(gRenderer, &prev);
+    SDL_SetRenderDrawBlendMode(gRenderer, SDL_BLENDMODE_BLEND);
+    SDL_SetRenderDrawColor(gRenderer, 0, 0, 0, 175);
+    SDL_FRect dim{0.f, 0.f, (float)kScreenWidth, (float)kScreenHeight};
+    SDL_RenderFillRect(gRenderer, &dim);
+
+    leaderboardTitle.render((kScreenWidth - leaderboardTitle.getWidth()) / 2, 30);
+
+    const int headerY = 90;
+    const int rowH = 34;
+    for (int c = 0; c < kLeaderboardColumns; ++c) leaderboardHeader[c].render(kLeaderboardColumnX[c], headerY);
+    for (int r = 0; r < leaderboardRowCount; ++r) {
+        for (int c = 0; c < kLeaderboardColumns; ++c) {
+            leaderboardCells[r][c].render(kLeaderboardColumnX[c], headerY + rowH * (r + 1));
+        }
+    }
+
+    const int footerY = headerY + rowH * (kLeaderboardRows + 1) + 10;
+    leaderboardSummary.render(kLeaderboardColumnX[0], footerY);
+    if (leaderboardLastGame.isLoaded()) leaderboardLastGame.render(kLeaderboardColumnX[0], footerY + 30);
+    if (leaderboardTrend.isLoaded()) leaderboardTrend.render(kLeaderboardColumnX[0], footerY + 60);
+
+    // Only one option, so it is always highlighted
+    const int backX = (kScreenWidth - leaderboardBack.getWidth()) / 2;
+    const int backY = kScreenHeight - 60;
+    SDL_SetRenderDrawColor(gRenderer, 49, 117, 73, 180);
+    SDL_FRect selectRect{ (float)(backX - 18), (float)(backY - 10),
+                          (float)(leaderboardBack.getWidth() + 36), (float)(leaderboardBack.getHeight() + 20) };
+    SDL_RenderFillRect(gRenderer, &selectRect);
+    leaderboardBack.render(backX, backY);
+
+    SDL_SetRenderDrawBlendMode(gRenderer, prev);
+}
+
+// Returns 0 when the player backs out, -1 otherwise
+int handleLeaderboardEvent(const SDL_Event& e) {
+    if (e.type == SDL_EVENT_KEY_DOWN) {
+        if (e.key.key == SDLK_RETURN || e.key.key == SDLK_KP_ENTER ||
+            e.key.key == SDLK_ESCAPE || e.key.key == SDLK_BACKSPACE) {
+            return 0;
+        }
+    }
+    if (e.type == SDL_EVENT_GAMEPAD_BUTTON_DOWN) {
+        if (e.gbutton.button == SDL_GAMEPAD_BUTTON_SOUTH || e.gbutton.button == SDL_GAMEPAD_BUTTON_EAST) {
+            return 0;
+        }
+    }
+    return -1;
+}
+
+static void destroyLeaderboardTextures() {
+    leaderboardTitle.destroy();
+    for (auto& t : leaderboardHeader) t.destroy();
+    for (auto& row : leaderboardCells) for (auto& t : row) t.destroy();
+    leaderboardSummary.destroy();
+    leaderboardLastGame.destroy();
+    leaderboardTrend.destroy();
+    leaderboardBack.destroy();
+}
+
 void quitToMenu() {
 
-    writeSaveData();
-    maxLevelAchieved = std::max(levelValue, maxLevelAchieved);
+    replayFinishRecording(static_cast<Uint32>(gameTick));
+    if (gameCountsForRecords()) {
+        writeSaveData();
+        recordFinishedGame();
+        maxLevelAchieved = std::max(levelValue, maxLevelAchieved);
+    }
 
     // Reset game state
     currentState = GameState::MENU;
@@ -2081,10 +2141,8 @@ void quitToMenu() {
     for (int x = 0; x < boardWidth; ++x)
         for (int y = 0; y < boardHeight; ++y)
             board.current[x][y] = 0;
-    pickPiece = drawPieceIndex();
-    nextPickPiece = drawPieceIndex();
+    pickPiece = popNextPiece();
     currentPiece = pieceTypes[pickPiece];
-    nextPiece = pieceTypes[nextPickPiece];
     currentPiece.x = boardWidth / 2;
     currentPiece.y = 0;
     score.loadFromRenderedText(std::to_string(scoreValue), { 0xFF, 0xFF, 0xFF, 0xFF });
@@ -2108,6 +2166,7 @@ void renderWipeIntro(SDL_Renderer* renderer, int screenWidth, int screenHeight)
 
         int wipeHeight = static_cast<int>(screenHeight * eased);
 
+        frameArena().reset();
         renderBoardBlocks();
         renderUI();
         renderParticles();
@@ -2126,6 +2185,15 @@ void renderWipeIntro(SDL_Renderer* renderer, int screenWidth, int screenHeight)
 
 void close()
 {
+    advisorStop();
+    // Let any queued save reach the disk before tearing down
+    flushSaveData();
+    closeGameHistory();
+    closeAudio();
+    botClose();
+    traceStop(); // finish the trace file while logging still goes through the flusher
+    logStop(); // write out anything still queued; later messages are logged directly
+
     // Close active gamepad if open
     if (gActiveGamepad) {
         SDL_CloseGamepad(gActiveGamepad);
@@ -2148,6 +2216,8 @@ void close()
     // Menu / options textures
     titleTexture.destroy();
     playTexture.destroy();
+    scoresTexture.destroy();
+    destroyLeaderboardTextures();
     optionsTexture.destroy();
     backTexture.destroy();
 
@@ -2155,6 +2225,9 @@ void close()
     optionsGridLabel.destroy();
     optionsBlockGapLabel.destroy();
     optionsPlacementPreviewLabel.destroy();
+    optionsRandomizerLabel.destroy();
+    optionsPreviewDepthLabel.destroy();
+    optionsPlacementHintLabel.destroy();
 
     optionsTitleTexture2.destroy();
     windowSizeLabel.destroy();
@@ -2171,12 +2244,15 @@ void close()
     // Destroy cached menu logo texture
     destroyMenuLogoTexture();
 
+    shutdownStartupDecodes();
+
     // Close font and quit TTF
     if (gFont) { TTF_CloseFont( gFont ); gFont = nullptr; }
     TTF_Quit();
 
     // Destroy renderer and window once
     if (gRenderer) { SDL_DestroyRenderer( gRenderer ); gRenderer = nullptr; }
+    closeOffscreenRender(); // the software renderer's target surface
     if (gWindow)   { SDL_DestroyWindow( gWindow );   gWindow = nullptr; }
 
     // Quit SDL subsystems
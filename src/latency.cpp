@@ -0,0 +1,133 @@
+#include "latency.h"
+#include "globals.h"
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+
+bool latencyModeEnabled = false;
+
+namespace {
+    struct LatencySample {
+        Uint64 eventNs;     // SDL event timestamp
+        Uint64 polledNs;    // dequeued from SDL_PollEvent and turned into an InputAction
+        Uint64 appliedNs;   // moveLeft/hardDrop/... returned
+        Uint64 submittedNs; // frame handed to SDL_RenderPresent
+        Uint64 presentedNs; // SDL_RenderPresent returned
+    };
+
+    constexpr int kMaxPending = 32;
+    constexpr size_t kMaxSamples = 1 << 16;
+
+    LatencySample pending[kMaxPending];
+    int pendingCount = 0;
+    bool markerThisFrame = false;
+    std::vector<LatencySample> samples;
+    size_t samplesDropped = 0;
+
+    struct StageStats { double p50, p90, p99, max; };
+
+    StageStats computeStats(std::vector<double>& values) {
+        StageStats s{0.0, 0.0, 0.0, 0.0};
+        if (values.empty()) return s;
+        std::sort(values.begin(), values.end());
+        auto pct = [&](double p) {
+            size_t idx = static_cast<size_t>(p * (values.size() - 1) + 0.5);
+            return values[std::min(idx, values.size() - 1)];
+        };
+        s.p50 = pct(0.50);
+        s.p90 = pct(0.90);
+        s.p99 = pct(0.99);
+        s.max = values.back();
+        return s;
+    }
+
+    void logStage(const char* name, Uint64 LatencySample::*from, Uint64 LatencySample::*to) {
+        std::vector<double> ms;
+        ms.reserve(samples.size());
+        for (const auto& s : samples) {
+            ms.push_back(static_cast<double>(s.*to - s.*from) / 1000000.0);
+        }
+        StageStats st = computeStats(ms);
+        SDL_Log("latency %-8s p50=%7.3fms p90=%7.3fms p99=%7.3fms max=%7.3fms",
+                name, st.p50, st.p90, st.p99, st.max);
+    }
+}
+
+void latencyInputQueued(Uint64 eventTimestampNs) {
+    if (!latencyModeEnabled) return;
+    if (pendingCount >= kMaxPending) { samplesDropped++; return; }
+    Uint64 now = SDL_GetTicksNS();
+    // Some drivers deliver events without a timestamp; fall back to the poll time
+    if (eventTimestampNs == 0 || eventTimestampNs > now) eventTimestampNs = now;
+    pending[pendingCount++] = LatencySample{ eventTimestampNs, now, 0, 0, 0 };
+}
+
+void latencyActionsApplied() {
+    if (!latencyModeEnabled || pendingCount == 0) return;
+    Uint64 now = SDL_GetTicksNS();
+    for (int i = 0; i < pendingCount; ++i) {
+        if (pending[i].appliedNs == 0) pending[i].appliedNs = now;
+    }
+    markerThisFrame = true;
+}
+
+void renderLatencyMarker() {
+    if (!latencyModeEnabled) return;
+    // Solid square in the bottom-right corner: white on the first frame that shows
+    // a new input, black otherwise, so a photodiode sees a clean edge.
+    const float size = 32.0f;
+    SDL_FRect marker{ kScreenWidth - size, kScreenHeight - size, size, size };
+    if (markerThisFrame) SDL_SetRenderDrawColor(gRenderer, 255, 255, 255, 255);
+    else SDL_SetRenderDrawColor(gRenderer, 0, 0, 0, 255);
+    SDL_RenderFillRect(gRenderer, &marker);
+}
+
+void latencyRenderSubmitted() {
+    if (!latencyModeEnabled || pendingCount == 0) return;
+    Uint64 now = SDL_GetTicksNS();
+    for (int i = 0; i < pendingCount; ++i) {
+        if (pending[i].appliedNs == 0) pending[i].appliedNs = now;
+        pending[i].submittedNs = now;
+    }
+}
+
+void latencyFramePresented() {
+    if (!latencyModeEnabled) return;
+    markerThisFrame = false;
+    if (pendingCount == 0) return;
+    Uint64 now = SDL_GetTicksNS();
+    if (samples.capacity() == 0) samples.reserve(kMaxSamples);
+    for (int i = 0; i < pendingCount; ++i) {
+        if (pending[i].submittedNs == 0) continue; // not part of this frame
+        pending[i].presentedNs = now;
+        if (samples.size() < kMaxSamples) samples.push_back(pending[i]);
+        else samplesDropped++;
+    }
+    pendingCount = 0;
+}
+
+void latencyReport() {
+    if (!latencyModeEnabled) return;
+    SDL_Log("latency: %zu samples (%zu dropped)", samples.size(), samplesDropped);
+    if (samples.empty()) return;
+
+    logStage("poll", &LatencySample::eventNs, &LatencySample::polledNs);
+    logStage("apply", &LatencySample::polledNs, &LatencySample::appliedNs);
+    logStage("submit", &LatencySample::appliedNs, &LatencySample::submittedNs);
+    logStage("present", &LatencySample::submittedNs, &LatencySample::presentedNs);
+    logStage("total", &LatencySample::eventNs, &LatencySample::presentedNs);
+
+    // Raw samples, so present times can be lined up with photodiode/camera captures
+    if (FILE* f = std::fopen("latency_samples.csv", "w")) {
+        std::fprintf(f, "event_ns,polled_ns,applied_ns,submitted_ns,presented_ns\n");
+        for (const auto& s : samples) {
+            std::fprintf(f, "%llu,%llu,%llu,%llu,%llu\n",
+                         (unsigned long long)s.eventNs, (unsigned long long)s.polledNs,
+                         (unsigned long long)s.appliedNs, (unsigned long long)s.submittedNs,
+                         (unsigned long long)s.presentedNs);
+        }
+        std::fclose(f);
+    } else {
+        SDL_Log("Could not write latency_samples.csv");
+    }
+}
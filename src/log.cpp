@@ -0,0 +1,163 @@
+#include "log.h"
+#include "thread_rings.h"
+#include <atomic>
+#include <chrono>
+#include <cstdarg>
+
+LogLevel logRuntimeLevel = LogLevel::Trace;
+
+namespace {
+    constexpr size_t kRingSize = 256;  // records per thread, power of two
+    constexpr int kMaxRings = 32;      // threads that may log
+    constexpr size_t kTextSize = 120;
+    constexpr auto kFlushInterval = std::chrono::milliseconds(20);
+
+    struct LogRecord {
+        Uint64 ns;
+        Uint64 tick;
+        const char* event;  // nullptr for plain text records
+        LogFields fields;
+        LogLevel level;
+        char text[kTextSize];
+    };
+
+    using LogRings = ThreadRings<LogRecord, kRingSize, kMaxRings>;
+    LogRings rings; // a thread that cannot get one logs synchronously
+
+    std::atomic<Uint64> currentTick{ 0 };
+    std::atomic<bool> running{ false };
+    RingDrainThread flusher;
+
+    const char* levelName(LogLevel level) {
+        switch (level) {
+            case LogLevel::Trace: return "TRACE";
+            case LogLevel::Debug: return "DEBUG";
+            case LogLevel::Info: return "INFO";
+            case LogLevel::Warn: return "WARN";
+            case LogLevel::Error: return "ERROR";
+            default: return "?";
+        }
+    }
+
+    // Traces and debug output go through at INFO priority so SDL's default filter keeps them
+    SDL_LogPriority sdlPriority(LogLevel level) {
+        switch (level) {
+            case LogLevel::Warn: return SDL_LOG_PRIORITY_WARN;
+            case LogLevel::Error: return SDL_LOG_PRIORITY_ERROR;
+            default: return SDL_LOG_PRIORITY_INFO;
+        }
+    }
+
+    void output(const LogRecord& r) {
+        const SDL_LogPriority priority = sdlPriority(r.level);
+        if (r.event) {
+            const LogFields& f = r.fields;
+            SDL_LogMessage(SDL_LOG_CATEGORY_APPLICATION, priority,
+                           "[%s t=%llu] %s piece=%d rot=%d->%d kick=%d d=(%d,%d)",
+                           levelName(r.level), static_cast<unsigned long long>(r.tick), r.event,
+                           f.piece, f.fromRot, f.toRot, f.kick, f.dx, f.dy);
+        } else {
+            SDL_LogMessage(SDL_LOG_CATEGORY_APPLICATION, priority, "[%s t=%llu] %s",
+                           levelName(r.level), static_cast<unsigned long long>(r.tick), r.text);
+        }
+    }
+
+    // Claim the next slot in this thread's ring, or nullptr if the record should be
+    // written synchronously (flusher not running) or dropped (ring full)
+    LogRecord* beginRecord(LogLevel level, bool& synchronous) {
+        synchronous = !running.load(std::memory_order_acquire);
+        if (synchronous) return nullptr;
+        LogRings::Ring* ring = rings.ringForThisThread();
+        if (!ring) {
+            synchronous = true;
+            return nullptr;
+        }
+        LogRecord* r = rings.claim(*ring);
+        if (!r) return nullptr;
+        r->ns = SDL_GetTicksNS();
+        r->tick = currentTick.load(std::memory_order_relaxed);
+        r->level = level;
+        return r;
+    }
+
+    void commitRecord(LogLevel level) {
+        const size_t queued = rings.publish(*rings.ringForThisThread());
+        // Wake the flusher early for problems, or before a burst fills the ring
+        if (level >= LogLevel::Warn || queued == kRingSize / 2) flusher.wake();
+    }
+
+    void drainRings() {
+        rings.drain([](LogRings::Ring&, const LogRecord& r) { output(r); },
+                    [](LogRings::Ring& ring, Uint64 dropped) {
+                        SDL_Log("log: thread %llu dropped %llu records (ring full)",
+                                static_cast<unsigned long long>(ring.thread), static_cast<unsigned long long>(dropped));
+                    });
+    }
+}
+
+bool parseLogLevel(const char* name, LogLevel& out) {
+    static const char* const kNames[] = { "trace", "debug", "info", "warn", "error", "off" };
+    for (size_t i = 0; i < SDL_arraysize(kNames); ++i) {
+        if (SDL_strcasecmp(name, kNames[i]) == 0) {
+            out = static_cast<LogLevel>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+void logStart() {
+    if (running.load()) return;
+    rings.ringForThisThread(); // register the caller now so its first hot-path log does not allocate
+    flusher.start(kFlushInterval, drainRings);
+    running.store(true, std::memory_order_release);
+}
+
+void logStop() {
+    if (!running.exchange(false)) return;
+    flusher.stop();
+}
+
+void logSetTick(Uint64 tick) {
+    currentTick.store(tick, std::memory_order_relaxed);
+}
+
+void logMessage(LogLevel level, const char* fmt, ...) {
+    if (level < logRuntimeLevel) return;
+    bool synchronous = false;
+    LogRecord* r = beginRecord(level, synchronous);
+    char local[kTextSize];
+    char* text = r ? r->text : local;
+    if (!r && !synchronous) return; // dropped
+
+    va_list ap;
+    va_start(ap, fmt);
+    SDL_vsnprintf(text, kTextSize, fmt, ap);
+    va_end(ap);
+
+    if (synchronous) {
+        SDL_LogMessage(SDL_LOG_CATEGORY_APPLICATION, sdlPriority(level), "%s", text);
+        return;
+    }
+    r->event = nullptr;
+    commitRecord(level);
+}
+
+void logEvent(LogLevel level, const char* event, const LogFields& fields) {
+    if (level < logRuntimeLevel) return;
+    bool synchronous = false;
+    LogRecord* r = beginRecord(level, synchronous);
+    if (synchronous) {
+        LogRecord tmp{};
+        tmp.tick = currentTick.load(std::memory_order_relaxed);
+        tmp.event = event;
+        tmp.fields = fields;
+        tmp.level = level;
+        output(tmp);
+        return;
+    }
+    if (!r) return; // dropped
+    r->event = event;
+    r->fields = fields;
+    commitRecord(level);
+}
@@ -1,5 +1,6 @@
 #include "ltexture.h"
 #include "globals.h"
+#include "alloc_check.h"
 #include <SDL3/SDL.h>
 #include <SDL3_image/SDL_image.h>
 #include <SDL3_ttf/SDL_ttf.h>
@@ -90,9 +91,17 @@ bool LTexture::isLoaded()
 #if defined(SDL_TTF_MAJOR_VERSION)
 bool LTexture::loadFromRenderedText( std::string textureText, SDL_Color textColor )
 {
+    ALLOC_SCOPE(Text);
+
     //Clean up existing texture
     destroy();
 
+    //Nothing to draw into when running headless
+    if( gRenderer == nullptr )
+    {
+        return false;
+    }
+
     //Load text surface
     if( SDL_Surface* textSurface = TTF_RenderText_Blended( gFont, textureText.c_str(), 0, textColor ); textSurface == nullptr )
     {
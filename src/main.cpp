@@ -4,6 +4,29 @@
 #include "board.h"
 #include "piece.h"
 #include "tetris_utils.h"
+#include "latency.h"
+#include "startup.h"
+#include "save_data.h"
+#include "game_history.h"
+#include "alloc_check.h"
+#include "frame_arena.h"
+#include "log.h"
+#include "audio.h"
+#include "bot.h"
+#include "replay.h"
+#include "offscreen_render.h"
+#include "position.h"
+#include "replay_viewer.h"
+#include "trace.h"
+#include "flight_recorder.h"
+#include "batch_sim.h"
+#include "advisor.h"
+#include "finesse.h"
+#include "determinism.h"
+#include "versus.h"
+#include "netplay.h"
+#include "spectator.h"
+#include "undo_history.h"
 
 #include <SDL3/SDL.h>
 #include <SDL3/SDL_main.h>
@@ -14,20 +37,145 @@
 #include <vector>
 #include <ctime>
 #include <math.h>
+#include <cstdlib>
+#include <algorithm>
 
 int main( int argc, char* args[] )
 {
     //Final exit code
     int exitCode{ 0 };
 
+    allocInstallSdlHooks(); //counts SDL allocations in TETRIS_ALLOC_CHECK builds
+
+    startupMark("process start");
+
     //Seed random number generator
     std::srand(static_cast<unsigned int>(time(0)));
     std::srand(static_cast<unsigned int>(std::time(0)));
 
     bool playing = false;
 
+    //Command line options
+    bool vsyncEnabled = false;
+    bool showSplash = true;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = args[i];
+        if (arg == "--latency") { latencyModeEnabled = true; } // input-to-photon latency probe
+        else if (arg == "--vsync") { vsyncEnabled = true; }
+        else if (arg == "--no-splash") { showSplash = false; } // kiosk fast path
+        else if (arg == "--seed" && i + 1 < argc) { // same piece sequence every game
+            fixedSeedEnabled = true;
+            fixedSeed = std::strtoull(args[++i], nullptr, 0);
+        }
+        else if (arg == "--log-level" && i + 1 < argc) { // trace/debug/info/warn/error/off, within what was compiled in
+            if (!parseLogLevel(args[++i], logRuntimeLevel)) SDL_Log("Unknown log level '%s'", args[i]);
+        }
+        else if (arg == "--no-audio") { audioEnabled = false; }
+        else if (arg == "--audio-latency" && i + 1 < argc) { // device buffer in sample frames
+            audioBufferFrames = std::max(32, std::atoi(args[++i]));
+        }
+        else if (arg == "--bot-stdio") { botTransport = BotTransport::Stdio; } // bot protocol on stdin/stdout
+        else if (arg == "--bot-socket" && i + 1 < argc) { // connect to a bot listening on a UNIX socket
+            botTransport = BotTransport::Socket;
+            botSocketPath = args[++i];
+        }
+        else if (arg == "--headless") { botHeadless = true; } // no window: a bot, or a --net-test run
+        else if (arg == "--bot-games" && i + 1 < argc) { botGameLimit = std::atoi(args[++i]); }
+        else if (arg == "--render-out" && i + 1 < argc) { renderOutPath = args[++i]; } // offscreen: PNG directory or .y4m file
+        else if (arg == "--render-replay" && i + 1 < argc) { renderReplayPath = args[++i]; }
+        else if (arg == "--render-frames" && i + 1 < argc) { renderFrameLimit = std::atoi(args[++i]); }
+        else if (arg == "--trace" && i + 1 < argc) { traceOutPath = args[++i]; } // Chrome trace-event JSON of frame spans
+        else if (arg == "--replay" && i + 1 < argc) { replayViewerPath = args[++i]; } // watch a replay with a seekable timeline
+        else if (arg == "--batch-sim" && i + 1 < argc) { batchGames = std::atoi(args[++i]); } // many games at once, no window
+        else if (arg == "--batch-lanes" && i + 1 < argc) { batchLanes = std::atoi(args[++i]); }
+        else if (arg == "--batch-threads" && i + 1 < argc) { batchThreads = std::atoi(args[++i]); }
+        else if (arg == "--batch-pieces" && i + 1 < argc) { batchPieceLimit = std::atoi(args[++i]); }
+        else if (arg == "--batch-policy" && i + 1 < argc) { batchPolicyName = args[++i]; }
+        else if (arg == "--batch-randomizer" && i + 1 < argc) { batchRandomizer = std::atoi(args[++i]); }
+        else if (arg == "--check-determinism" && i + 1 < argc) { determinismReplayPath = args[++i]; } // hash every tick of a replay
+        else if (arg == "--hash-out" && i + 1 < argc) { hashStreamOutPath = args[++i]; }
+        else if (arg == "--hash-against" && i + 1 < argc) { hashStreamAgainstPath = args[++i]; }
+        else if (arg == "--versus" && i + 1 < argc) { versusPlayers = std::atoi(args[++i]); } // 2-4 local players
+        else if (arg == "--netplay" && i + 2 < argc) { // online 1v1: local UDP port, peer host:port
+            netplayPort = std::atoi(args[++i]);
+            netplayPeer = args[++i];
+        }
+        else if (arg == "--net-delay" && i + 1 < argc) { netDelayMs = std::max(0, std::atoi(args[++i])); }
+        else if (arg == "--net-jitter" && i + 1 < argc) { netJitterMs = std::max(0, std::atoi(args[++i])); }
+        else if (arg == "--net-loss" && i + 1 < argc) { netLossPercent = std::clamp(std::atoi(args[++i]), 0, 100); }
+        else if (arg == "--net-rollback" && i + 1 < argc) { netRollbackLimit = std::atoi(args[++i]); }
+        else if (arg == "--net-test" && i + 1 < argc) { netTestTicks = std::max(0, std::atoi(args[++i])); } // random buttons
+        else if (arg == "--spectate" && i + 1 < argc) { spectatorBoards = std::atoi(args[++i]); } // grid of up to 16 games
+        else if (arg == "--spectate-replay" && i + 1 < argc) { spectatorReplays.push_back(args[++i]); }
+        else if (arg == "--practice") { practiceModeEnabled = true; } // Ctrl+Z / Ctrl+Y take back and replay placements
+        else if (arg == "--position" && i + 1 < argc) { startPositionPath = args[++i]; } // every game starts from this position
+        else if (arg == "--position-index" && i + 1 < argc) { startPositionIndex = std::atoi(args[++i]); }
+#ifdef TETRIS_ALLOC_CHECK
+        else if (arg == "--alloc-strict") { allocStrictMode = true; } // fail if steady-state gameplay allocates
+#endif
+    }
+
+    logStart(); //log calls from here on are queued and written by a background thread
+    traceSetThreadName("main");
+    flightRecorderInit(); //recent inputs and state, dumped as a replay on F6, failed asserts and crashes
+    if (traceOutPath) traceStart(traceOutPath); //a failure is logged and the game runs untraced
+
+    if (!loadStartPosition()) {
+        logStop();
+        return 1;
+    }
+
+#ifdef TETRIS_ALLOC_CHECK
+    checkPiecePathAllocations(); //before any worker thread can allocate concurrently
+#endif
+
     //load save
     readSaveData();
+    openGameHistory();
+    startupMark("save data read");
+
+    //bot-driven or --net-test headless run: no window, no audio, no rendering
+    if (botHeadless && netplayEnabled() && netTestTicks > 0) {
+        exitCode = runVersus();
+        close();
+        return exitCode;
+    }
+    if (botHeadless) {
+        if (!botOpen()) {
+            SDL_Log("--headless needs a bot (--bot-stdio or --bot-socket <path>)");
+            exitCode = 1;
+        } else {
+            exitCode = runHeadlessBot();
+        }
+        close();
+        return exitCode;
+    }
+
+    //offscreen render of a replay or bot games: software renderer, no window
+    if (renderOutPath) {
+        exitCode = runOffscreenRender();
+        close();
+        return exitCode;
+    }
+
+    //batch simulation: rules only, no window
+    if (batchGames > 0) {
+        exitCode = runBatchSim();
+        close();
+        return exitCode;
+    }
+
+    //determinism check: replay headlessly and compare per-tick state hashes
+    if (determinismReplayPath) {
+        exitCode = runDeterminismCheck();
+        close();
+        return exitCode;
+    }
+
+    finesseInit(); //open-field input table; drives the move functions, so before initAudio
+
+    //decode images and open the font on worker threads while the window comes up
+    beginStartupDecodes(showSplash);
 
     //Initialize
     if( init(chooseWindowTitle()) == false ) //initialize SDL Components
@@ -48,12 +196,45 @@ int main( int argc, char* args[] )
 
         applyWindowSize(WindowSizeMenuSelection, true); //apply saved window size at startup
 
+        initAudio(); //synthesizes the sound effects; the game runs silent if this fails
+
+        if (replayViewerPath) { //the viewer has its own loop and never touches the save file
+            exitCode = runReplayViewer();
+            close();
+            return exitCode;
+        }
+
+        if (versusPlayers > 0 || netplayEnabled()) { //versus has its own loop and never touches the save file
+            exitCode = runVersus();
+            close();
+            return exitCode;
+        }
+
+        if (spectatorBoards > 0 || !spectatorReplays.empty()) { //the grid has its own loop and never touches the save file
+            exitCode = runSpectator();
+            close();
+            return exitCode;
+        }
+
+        advisorStart(); //placement hints are searched on a worker thread
+
+        if (botOpen()) { //a bot plays from the first frame
+            resetGameplayStateForNewGame();
+            currentState = GameState::PLAYING;
+            playing = true;
+        }
+
         if (fullscreenEnabled) {SDL_SetWindowFullscreen(gWindow, true);}
 
-        AcquireFirstGamepadIfNone();
+        if (vsyncEnabled && !SDL_SetRenderVSync(gRenderer, 1)) {
+            SDL_Log("Could not enable vsync: %s", SDL_GetError());
+        }
 
         // Show splash screen (logo first, then text)
-        showSplashScreen();
+        if (showSplash) {
+            showSplashScreen();
+            startupMark("splash finished");
+        }
         
         bool quit{ false }; //The quit flag
 
@@ -61,19 +242,49 @@ int main( int argc, char* args[] )
         SDL_Event e;
         SDL_zero( e );
 
+        Uint64 frameCount = 0; //stamped onto log records
+
         while( quit == false ) //The main loop
         {
+            TRACE_SCOPE("frame");
             capTimer.start();
+            frameArena().reset(); //everything transient from the last frame is gone
+            logSetTick(++frameCount);
+            allocFrameBegin(currentState == GameState::PLAYING);
+            allocSetSubsystem(AllocSubsystem::Input);
 
             if (!gActiveGamepad) {
                 AcquireFirstGamepadIfNone();
             }
 
-            std::vector<InputAction> actions;
+            InputActionList actions;
 
+            TraceSpan pollSpan("event poll");
             while( SDL_PollEvent( &e ) == true ) //While there are events to handle
             {
                 if( e.type == SDL_EVENT_QUIT ) { quit = true; }
+                if (e.type == SDL_EVENT_KEY_DOWN && e.key.key == SDLK_F5 && !e.key.repeat) { traceToggle(); } // start/stop a trace session
+#ifdef TETRIS_ALLOC_CHECK
+                if (e.type == SDL_EVENT_KEY_DOWN && e.key.key == SDLK_F3 && !e.key.repeat) { allocOverlayVisible = !allocOverlayVisible; }
+#endif
+                if (e.type == SDL_EVENT_KEY_DOWN && e.key.key == SDLK_F4 && !e.key.repeat &&
+                    (currentState == GameState::PLAYING || currentState == GameState::PUASE)) {
+                    dumpLivePosition(); // log the board, pieces and counters as a position line
+                }
+                if (e.type == SDL_EVENT_KEY_DOWN && e.key.key == SDLK_F6 && !e.key.repeat &&
+                    (currentState == GameState::PLAYING || currentState == GameState::PUASE)) {
+                    flightDump(); // the last 30-40 seconds as a replay, for --replay
+                }
+                // Not while a replay or a bot is playing: their games must follow their own inputs
+                if (e.type == SDL_EVENT_KEY_DOWN && practiceModeEnabled && currentState == GameState::PLAYING &&
+                    !replayPlaybackActive() && !botActive() &&
+                    (e.key.mod & SDL_KMOD_CTRL) && (e.key.key == SDLK_Z || e.key.key == SDLK_Y)) {
+                    // Key repeat steps on through the history; not a game key even if Z or Y is bound to one
+                    const bool redo = e.key.key == SDLK_Y || (e.key.mod & SDL_KMOD_SHIFT);
+                    if (redo) redoPlacement();
+                    else undoPlacement();
+                    continue;
+                }
 
                 //look for gamepad connection/disconnection
                 switch (e.type) {
@@ -120,7 +331,11 @@ int main( int argc, char* args[] )
                         case 1: // Options menu
                             currentState = GameState::OPTIONS;
                             break;
-                        case 2: // Exit program
+                        case 2: // Leaderboard
+                            refreshLeaderboard();
+                            currentState = GameState::LEADERBOARD;
+                            break;
+                        case 3: // Exit program
                             quit = true;
                             break;
                         default:
@@ -171,6 +386,8 @@ int main( int argc, char* args[] )
 
 
                         
+                } else if (currentState == GameState::LEADERBOARD) {
+                    if (handleLeaderboardEvent(e) == 0) currentState = GameState::MENU;
                 } else if (currentState == GameState::PUASE) {
                     if (e.type == SDL_EVENT_GAMEPAD_BUTTON_DOWN) {
                         if (e.gbutton.button == SDL_GAMEPAD_BUTTON_DPAD_LEFT) {
@@ -223,6 +440,7 @@ int main( int argc, char* args[] )
                 // Only collect game input while playing
                 if (currentState == GameState::PLAYING) {
                     playing = true;
+                    const size_t queuedBefore = actions.size();
                     if (e.type == SDL_EVENT_KEY_DOWN) {
                         // Ignore OS key repeat; we implement DAS/ARR ourselves
                         if (e.key.repeat) {
@@ -495,6 +713,10 @@ int main( int argc, char* args[] )
                             }
                         }
                     }
+                    // Stamp every action queued by this event for the latency probe
+                    for (size_t i = queuedBefore; i < actions.size(); ++i) {
+                        latencyInputQueued(e.common.timestamp);
+                    }
                 } else {
                     playing = false;
                     // Clear held states when leaving PLAYING
@@ -506,10 +728,14 @@ int main( int argc, char* args[] )
                 }
             }
 
+            pollSpan.end();
+
             // After processing all events, render exactly once based on state
+            allocSetSubsystem(AllocSubsystem::Render);
             if (currentState == GameState::MENU) {
                 renderMenu();
                 SDL_RenderPresent(gRenderer);
+                startupFirstInteractiveFrame();
                 capFrameRate();
                 continue;
             } else if (currentState == GameState::OPTIONS) {
@@ -522,13 +748,22 @@ int main( int argc, char* args[] )
                 SDL_RenderPresent(gRenderer);
                 capFrameRate();
                 continue;
+            } else if (currentState == GameState::LEADERBOARD) {
+                renderLeaderboard();
+                SDL_RenderPresent(gRenderer);
+                capFrameRate();
+                continue;
             } else if (currentState == GameState::PUASE) {
                 //renderUI();
                 renderPauseMenu();
                  // draw the game scene behind the pause menu
                 //renderBoardBlocks(); // draw board on top of UI
                 
+                renderAllocOverlay();
+                renderLatencyMarker();
+                latencyRenderSubmitted();
                 SDL_RenderPresent(gRenderer);
+                latencyFramePresented();
                 capFrameRate();
                 continue;
             }
@@ -536,42 +771,39 @@ int main( int argc, char* args[] )
             if (!playing) continue; // Skip the rest of the loop if not playing
 
             // One-shot actions from this frame's events
+            allocSetSubsystem(AllocSubsystem::Simulation);
+            TraceSpan dispatchSpan("action dispatch");
             for (InputAction action : actions) { // handle input actions
-                switch (action) {
-                    case InputAction::MoveLeft: { moveLeft(); break; }
-                    case InputAction::MoveRight: { moveRight(); break; }
-                    case InputAction::RotateClockwise: { rotateClockwise(); break; }
-                    case InputAction::RotateCounterClockwise: { rotateCounterClockwise(); break; }
-                    case InputAction::SoftDrop: { softDrop(); break; }
-                    case InputAction::HardDrop: { hardDrop(); break; }
-                    case InputAction::Hold: { hold(); break; }
-                    case InputAction::Pause: {
-                        currentState = GameState::PUASE;
-                        break;
-                    }
-                    case InputAction::IncreaseLevel: { increaseLevel(); break; }
-                    default: break;
+                if (action == InputAction::Pause) {
+                    currentState = GameState::PUASE;
+                } else {
+                    finesseKeyPressed(action);
+                    applyInputAction(action);
                 }
 
                 if (currentState != GameState::PLAYING) {
                     break;
                 }
             }
+            latencyActionsApplied();
+            botUpdate();
+            dispatchSpan.end();
 
             // Inject auto-repeat moves for held D-pad buttons (DAS/ARR)
+            TraceSpan repeatSpan("DAS/ARR repeat");
             bool repeatedHorizontalThisFrame = false;
             const Uint64 now = SDL_GetTicks();
 
             // Horizontal (last-direction-wins)
             if (activeH == HDir::Left && gpLeft.held) {
                 if (now - gpLeft.pressedAt >= kDAS_MS && now - gpLeft.lastRepeatAt >= kARR_MS) {
-                    moveLeft();
+                    applyInputAction(InputAction::MoveLeft);
                     gpLeft.lastRepeatAt = now;
                     repeatedHorizontalThisFrame = true;
                 }
             } else if (activeH == HDir::Right && gpRight.held) {
                 if (now - gpRight.pressedAt >= kDAS_MS && now - gpRight.lastRepeatAt >= kARR_MS) {
-                    moveRight();
+                    applyInputAction(InputAction::MoveRight);
                     gpRight.lastRepeatAt = now;
                     repeatedHorizontalThisFrame = true;
                 }
@@ -580,12 +812,12 @@ int main( int argc, char* args[] )
             // Soft drop repeat
             if (gpDown.held) {
                 if (now - gpDown.pressedAt >= kDAS_MS && now - gpDown.lastRepeatAt >= kSoftDrop_ARR_MS) {
-                    softDrop();
+                    applyInputAction(InputAction::SoftDrop);
                     gpDown.lastRepeatAt = now;
                 }
             }
 
-            renderUI();
+            repeatSpan.end();
 
             // if (paused) // todo add paused as a game state
             // { 
@@ -593,34 +825,11 @@ int main( int argc, char* args[] )
             //     continue; 
             // } // Skip the rest of the loop while paused
 
-            if (clearingRows) { animateRowClear(); continue; } // Skip rest of loop while animating
-
-            //check game over
-            if (currentPiece.y == 0) { if (checkGameOver()) { continue; } } // Skip rest of loop and start new game
-
-            // Check if the piece can be placed at its next position
-            bool canPlaceNext = checkPlacement(currentPiece, board, 0, 1);
-
-            // Place the current piece's shape onto the board at its current position
-            pieceSet(currentPiece, board, currentPiece.color);
-             
-            renderBoardBlocks();
-
-            renderParticles();
-
-            SDL_RenderPresent( gRenderer ); //update screen
-
-            if (!newPiece) { pieceSet(currentPiece, board); } // Clear the piece's current position on the board
-
-            autoDrop(canPlaceNext); // Handle automatic piece dropping based on drop speed
-
-            handleLockDelay(canPlaceNext); // Handle lock delay if the piece has landed
-
-            handlePieceLanded(); // Handle piece landing and row clearing
-            
-            capFrameRate();
+            runGameplayFrame(); // draw, then gravity, lock delay, locking and row clears
         } 
     }
+    latencyReport();
     close(); //Clean up
+    if (!allocReport()) exitCode = 1; //TETRIS_ALLOC_CHECK builds only
     return exitCode; //End program
 }
\ No newline at end of file
@@ -0,0 +1,638 @@
+#include "netplay.h"
+#include "versus.h"
+#include "determinism.h"
+#include "globals.h"
+#include "randomizer.h"
+#include "log.h"
+#include <algorithm>
+#include <cstring>
+
+#ifndef _WIN32
+#include <cerrno>
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+int netplayPort = 0;
+const char* netplayPeer = nullptr;
+int netDelayMs = 0;
+int netJitterMs = 0;
+int netLossPercent = 0;
+int netRollbackLimit = 8;
+int netTestTicks = 0;
+
+namespace {
+    constexpr unsigned char kMagic[4] = { 'T', 'N', 'E', 'T' };
+    constexpr Uint8 kProtocolVersion = 1;
+    constexpr size_t kHeaderSize = 14;   // magic, version, type, nonce
+    constexpr size_t kHelloSize = kHeaderSize + 8;
+    constexpr size_t kMaxPacket = 128;
+    constexpr int kHistory = 64;         // saved ticks; more than twice the largest rollback
+    constexpr int kMaxRollback = 30;
+    constexpr Uint32 kHashInterval = 60;
+    constexpr int kHashHistory = 8;
+    constexpr int kQueueSize = 256;      // packets held back by --net-delay
+    constexpr Uint64 kHelloIntervalNs = 250000000;
+    constexpr Uint64 kTimeoutNs = 5000000000;
+    constexpr Uint64 kTestConnectTimeoutNs = 30000000000;
+    constexpr Uint64 kFlushTimeoutNs = 2000000000;
+    constexpr Uint32 kNoTick = 0xFFFFFFFF;
+    constexpr Uint8 kHeldButtons = kNetLeft | kNetRight | kNetSoftDrop;
+
+    enum class PacketType : Uint8 { Hello = 1, Input = 2, Bye = 3 };
+
+    // DAS, ARR and soft drop ARR in ticks, from the settings of the side playing the board
+    struct Repeat {
+        int das;
+        int arr;
+        int softArr;
+    };
+
+    // Held-button bookkeeping for one board; it decides repeats, so it is saved with the match
+    struct KeyState {
+        Uint8 held;
+        Sint8 lastDir; // -1 or 1: the direction pressed last wins while both are held
+        Uint16 leftTicks, rightTicks, downTicks; // since pressed
+    };
+
+    struct SavedTick {
+        VersusMatch match;
+        KeyState keys[2];
+        Uint32 overAt;
+    };
+
+    struct HashRecord {
+        Uint32 tick;
+        Uint64 hash;
+    };
+
+    struct Outgoing {
+        bool used;
+        Uint64 dueNs;
+        size_t size;
+        Uint8 data[kMaxPacket];
+    };
+
+    struct Writer {
+        Uint8 data[kMaxPacket];
+        size_t size = 0;
+
+        void put8(Uint8 v) { data[size++] = v; }
+        void put16(Uint16 v) { put8(static_cast<Uint8>(v)); put8(static_cast<Uint8>(v >> 8)); }
+        void put32(Uint32 v) { put16(static_cast<Uint16>(v)); put16(static_cast<Uint16>(v >> 16)); }
+        void put64(Uint64 v) { put32(static_cast<Uint32>(v)); put32(static_cast<Uint32>(v >> 32)); }
+    };
+
+    Uint16 get16(const Uint8* p) { return static_cast<Uint16>(p[0] | (p[1] << 8)); }
+    Uint32 get32(const Uint8* p) { return get16(p) | (static_cast<Uint32>(get16(p + 2)) << 16); }
+    Uint64 get64(const Uint8* p) { return get32(p) | (static_cast<Uint64>(get32(p + 4)) << 32); }
+
+    // Connection
+    int sock = -1;
+#ifndef _WIN32
+    sockaddr_in peerAddr{};
+#endif
+    Uint64 localNonce = 0;
+    Uint64 peerNonce = 0;
+    bool connected = false;
+    bool peerLeft = false;
+    Uint64 openedNs = 0;
+    Uint64 lastHeardNs = 0;
+    Uint64 lastHelloNs = 0;
+    Outgoing outgoing[kQueueSize];
+    Xoshiro128 lossRng;
+    RandomizerKind savedRandomizer = RandomizerKind::Bag7;
+
+    // Match
+    int localIndex = 0;
+    Repeat repeat[2];
+    KeyState keys[2];
+    Uint32 overAt = kNoTick;   // the tick the match ended on, if it has
+    Uint32 tick = 0;           // the next tick to simulate
+    Uint32 remoteContiguous = 0; // every peer tick before this is known
+    Uint32 peerAck = 0;        // the peer has every local tick before this
+    Uint32 rollbackFrom = kNoTick;
+    bool resimulating = false;
+    SavedTick saved[kHistory]; // the state at the start of tick t, in slot t % kHistory
+    Uint8 localButtons[kHistory];
+    Uint8 pendingButtons = 0;  // pressed in frames that simulated nothing; they go into the next tick
+    Uint8 remoteButtons[kHistory];
+    Uint32 remoteKnown[kHistory]; // t + 1 once tick t's buttons arrived
+    Uint8 remoteUsed[kHistory];   // what tick t was simulated with
+    Xoshiro128 testRng;
+    Uint8 testHeld = 0;
+    bool finishReported = false;
+
+    // Desync checks
+    HashRecord localHashes[kHashHistory];
+    HashRecord latestHash{ kNoTick, 0 };
+    HashRecord peerHash{ kNoTick, 0 }; // the peer's, waiting for ours
+    Uint32 nextHashTick = kHashInterval;
+    Uint32 checkedTick = 0;
+
+    // Statistics
+    Uint64 rollbacks = 0;
+    Uint64 resimTicks = 0;
+    Uint64 maxResimTicks = 0;
+    Uint64 resimNs = 0;
+    Uint64 maxResimNs = 0;
+    Uint64 stalledFrames = 0;
+    Uint64 packetsSent = 0;
+    Uint64 packetsDropped = 0;
+    Uint64 packetsReceived = 0;
+    Uint64 queueOverflows = 0;
+    Uint64 hashChecks = 0;
+    Uint64 desyncs = 0;
+
+    int msToTicks(Uint64 ms) { return static_cast<int>((ms * kScreenFps + 999) / 1000); }
+
+    Repeat localRepeat() {
+        return { msToTicks(kDAS_MS), std::max(1, msToTicks(kARR_MS)), std::max(1, msToTicks(kSoftDrop_ARR_MS)) };
+    }
+
+    bool repeatDue(Uint16 held, int das, int arr) { return held >= das && (held - das) % arr == 0; }
+
+    void countHeld(Uint16& ticks, bool held) {
+        if (held && ticks < 0xFFFF) ticks++;
+    }
+
+    // The same edges and repeats on both sides: presses, then DAS/ARR, hard drop last
+    void buttonsToActions(int b, Uint8 buttons, InputActionList& out) {
+        KeyState& k = keys[b];
+        const Repeat& r = repeat[b];
+        const Uint8 pressed = buttons & ~k.held;
+        countHeld(k.leftTicks, buttons & k.held & kNetLeft);
+        countHeld(k.rightTicks, buttons & k.held & kNetRight);
+        countHeld(k.downTicks, buttons & k.held & kNetSoftDrop);
+
+        if (pressed & kNetHold) out.push_back(InputAction::Hold);
+        if (pressed & kNetRotateCW) out.push_back(InputAction::RotateClockwise);
+        if (pressed & kNetRotateCCW) out.push_back(InputAction::RotateCounterClockwise);
+        if (pressed & kNetLeft) { out.push_back(InputAction::MoveLeft); k.leftTicks = 0; k.lastDir = -1; }
+        if (pressed & kNetRight) { out.push_back(InputAction::MoveRight); k.rightTicks = 0; k.lastDir = 1; }
+        if (pressed & kNetSoftDrop) { out.push_back(InputAction::SoftDrop); k.downTicks = 0; }
+        if (k.lastDir < 0 && !(buttons & kNetLeft)) k.lastDir = buttons & kNetRight ? 1 : 0;
+        if (k.lastDir > 0 && !(buttons & kNetRight)) k.lastDir = buttons & kNetLeft ? -1 : 0;
+
+        if (k.lastDir < 0 && !(pressed & kNetLeft) && repeatDue(k.leftTicks, r.das, r.arr)) {
+            out.push_back(InputAction::MoveLeft);
+        }
+        if (k.lastDir > 0 && !(pressed & kNetRight) && repeatDue(k.rightTicks, r.das, r.arr)) {
+            out.push_back(InputAction::MoveRight);
+        }
+        if ((buttons & kNetSoftDrop) && !(pressed & kNetSoftDrop) && repeatDue(k.downTicks, r.das, r.softArr)) {
+            out.push_back(InputAction::SoftDrop);
+        }
+        if (pressed & kNetHardDrop) out.push_back(InputAction::HardDrop);
+        k.held = buttons;
+    }
+
+    // --net-test: wander about holding a direction, with the odd rotation, drop and hold
+    Uint8 testButtons() {
+        if (xoshiroBelow(testRng, 12) == 0) {
+            constexpr Uint8 kChoices[6] = { kNetLeft, kNetRight, kNetSoftDrop, 0, 0, 0 };
+            testHeld = kChoices[xoshiroBelow(testRng, 6)];
+        }
+        Uint8 buttons = testHeld;
+        if (xoshiroBelow(testRng, 16) == 0) buttons |= xoshiroBelow(testRng, 2) ? kNetRotateCW : kNetRotateCCW;
+        if (xoshiroBelow(testRng, 45) == 0) buttons |= kNetHardDrop;
+        if (xoshiroBelow(testRng, 300) == 0) buttons |= kNetHold;
+        return buttons;
+    }
+
+    Uint64 hashMatch(const VersusMatch& m) {
+        Uint64 h = 0xCBF29CE484222325ull;
+        const auto mix = [&h](Uint64 v) { h = (h ^ v) * 0x100000001B3ull; h ^= h >> 29; };
+        for (int i = 0; i < m.players; ++i) {
+            const VersusBoard& b = m.boards[i];
+            restoreGameSnapshot(b.state); // every board is restored before it is stepped again
+            mix(gameStateHash());
+            mix(static_cast<Uint64>(b.alive) | static_cast<Uint64>(static_cast<Uint32>(b.pendingGarbage)) << 32);
+            mix(static_cast<Uint32>(b.linesSent) | static_cast<Uint64>(static_cast<Uint32>(b.nextTarget)) << 32);
+        }
+        for (Uint32 word : m.garbageRng.s) mix(word);
+        mix(static_cast<Uint32>(m.winner) | static_cast<Uint64>(m.over) << 32);
+        return h;
+    }
+
+    Uint32 endTick() {
+        if (overAt != kNoTick) return overAt;
+        return netTestTicks > 0 ? static_cast<Uint32>(netTestTicks) : kNoTick;
+    }
+
+    // Predicted until they arrive: the peer most likely still holds what it held last
+    Uint8 remoteButtonsAt(Uint32 t) {
+        const int slot = t % kHistory;
+        if (remoteKnown[slot] == t + 1) return remoteButtons[slot];
+        if (remoteContiguous == 0) return 0;
+        return remoteButtons[(remoteContiguous - 1) % kHistory] & kHeldButtons;
+    }
+
+    void simulateTick(Uint32 t) {
+        const int slot = t % kHistory;
+        SavedTick& s = saved[slot];
+        s.match = versusMatch;
+        s.keys[0] = keys[0];
+        s.keys[1] = keys[1];
+        s.overAt = overAt;
+
+        Uint8 buttons[2];
+        buttons[localIndex] = localButtons[slot];
+        buttons[1 - localIndex] = remoteUsed[slot] = remoteButtonsAt(t);
+        if (versusMatch.over) return; // nothing moves once the match is decided
+        InputActionList actions[kVersusMaxPlayers];
+        for (int b = 0; b < 2; ++b) buttonsToActions(b, buttons[b], actions[b]);
+        versusStep(actions);
+        if (versusMatch.over) overAt = t + 1;
+    }
+
+    // Back to the first tick simulated with wrong buttons, then forward again to now
+    void rollBack() {
+        if (rollbackFrom >= tick) {
+            rollbackFrom = kNoTick;
+            return;
+        }
+        const Uint64 start = SDL_GetTicksNS();
+        const SavedTick& s = saved[rollbackFrom % kHistory];
+        versusMatch = s.match;
+        keys[0] = s.keys[0];
+        keys[1] = s.keys[1];
+        overAt = s.overAt;
+        resimulating = true;
+        for (Uint32 t = rollbackFrom; t < tick; ++t) simulateTick(t);
+        resimulating = false;
+
+        const Uint64 ns = SDL_GetTicksNS() - start;
+        const Uint64 count = tick - rollbackFrom;
+        rollbacks++;
+        resimTicks += count;
+        maxResimTicks = std::max(maxResimTicks, count);
+        resimNs += ns;
+        maxResimNs = std::max(maxResimNs, ns);
+        rollbackFrom = kNoTick;
+    }
+
+    void compareHash(const HashRecord& mine, const HashRecord& theirs) {
+        checkedTick = mine.tick;
+        hashChecks++;
+        if (mine.hash == theirs.hash) return;
+        desyncs++;
+        LOG_ERROR("Netplay: desync at tick %u (%.2fs): match hash %016llx here, %016llx on the peer", mine.tick,
+                  mine.tick / static_cast<double>(kScreenFps), static_cast<unsigned long long>(mine.hash),
+                  static_cast<unsigned long long>(theirs.hash));
+    }
+
+    void receivePeerHash(const HashRecord& theirs) {
+        if (theirs.tick == kNoTick || theirs.tick <= checkedTick) return;
+        const HashRecord& mine = localHashes[(theirs.tick / kHashInterval) % kHashHistory];
+        if (mine.tick == theirs.tick) compareHash(mine, theirs);
+        else peerHash = theirs; // not confirmed here yet
+    }
+
+    // A confirmed tick is final on both sides, so its hash must match the peer's
+    void hashConfirmedTicks() {
+        while (nextHashTick <= remoteContiguous && nextHashTick <= tick) {
+            const VersusMatch& m = nextHashTick == tick ? versusMatch : saved[nextHashTick % kHistory].match;
+            latestHash = { nextHashTick, hashMatch(m) };
+            localHashes[(nextHashTick / kHashInterval) % kHashHistory] = latestHash;
+            if (peerHash.tick == nextHashTick) compareHash(latestHash, peerHash);
+            nextHashTick += kHashInterval;
+        }
+    }
+
+#ifndef _WIN32
+    void sendNow(const Uint8* data, size_t size) {
+        sendto(sock, data, size, 0, reinterpret_cast<const sockaddr*>(&peerAddr), sizeof(peerAddr));
+    }
+#else
+    void sendNow(const Uint8*, size_t) {}
+#endif
+
+    // The latency and loss injector sits here, on the way out
+    void transmit(const Writer& w, bool lossless) {
+        packetsSent++;
+        if (!lossless && netLossPercent > 0 && xoshiroBelow(lossRng, 100) < netLossPercent) {
+            packetsDropped++;
+            return;
+        }
+        const int delayMs = netDelayMs + (netJitterMs > 0 ? xoshiroBelow(lossRng, netJitterMs + 1) : 0);
+        if (delayMs <= 0) {
+            sendNow(w.data, w.size);
+            return;
+        }
+        for (Outgoing& o : outgoing) {
+            if (o.used) continue;
+            o.used = true;
+            o.dueNs = SDL_GetTicksNS() + static_cast<Uint64>(delayMs) * 1000000;
+            o.size = w.size;
+            std::memcpy(o.data, w.data, w.size);
+            return;
+        }
+        queueOverflows++;
+    }
+
+    // Returns how many packets are still held back
+    int flushOutgoing(Uint64 now) {
+        int waiting = 0;
+        for (Outgoing& o : outgoing) {
+            if (!o.used) continue;
+            if (o.dueNs > now) { waiting++; continue; }
+            sendNow(o.data, o.size);
+            o.used = false;
+        }
+        return waiting;
+    }
+
+    void putHeader(Writer& w, PacketType type) {
+        for (unsigned char c : kMagic) w.put8(c);
+        w.put8(kProtocolVersion);
+        w.put8(static_cast<Uint8>(type));
+        w.put64(localNonce);
+    }
+
+    void sendHello(Uint64 now) {
+        Writer w;
+        putHeader(w, PacketType::Hello);
+        const Repeat r = localRepeat();
+        w.put16(static_cast<Uint16>(r.das));
+        w.put16(static_cast<Uint16>(r.arr));
+        w.put16(static_cast<Uint16>(r.softArr));
+        w.put8(static_cast<Uint8>(randomizerKind));
+        w.put8(connected ? 1 : 0);
+        transmit(w, false);
+        lastHelloNs = now;
+    }
+
+    // Every local tick the peer has not acknowledged, so one arrival makes up for any losses
+    void sendInput(PacketType type) {
+        Writer w;
+        putHeader(w, type);
+        const Uint32 first = std::max(peerAck, tick > kHistory ? tick - kHistory : 0);
+        const Uint32 count = tick - first;
+        w.put32(remoteContiguous);
+        w.put32(first);
+        w.put8(static_cast<Uint8>(count));
+        for (Uint32 t = first; t < tick; ++t) w.put8(localButtons[t % kHistory]);
+        w.put32(latestHash.tick);
+        w.put64(latestHash.hash);
+        transmit(w, type == PacketType::Bye);
+    }
+
+    void startSession(const Uint8* p) {
+        const Repeat mine = localRepeat();
+        localIndex = localNonce < peerNonce ? 0 : 1;
+        repeat[localIndex] = mine;
+        repeat[1 - localIndex] = { std::max<int>(0, get16(p)), std::max<int>(1, get16(p + 2)),
+                                   std::max<int>(1, get16(p + 4)) };
+        savedRandomizer = randomizerKind;
+        const Uint8 peerRandomizer = p[6];
+        if (localIndex == 1 && peerRandomizer < static_cast<Uint8>(RandomizerKind::Count)) {
+            randomizerKind = static_cast<RandomizerKind>(peerRandomizer); // board 1's side picks
+        }
+
+        const Uint64 seed = localNonce ^ peerNonce;
+        versusStartMatch(2, seed);
+        keys[0] = keys[1] = KeyState{};
+        overAt = kNoTick;
+        tick = remoteContiguous = peerAck = 0;
+        rollbackFrom = kNoTick;
+        std::memset(remoteKnown, 0, sizeof(remoteKnown));
+        for (HashRecord& h : localHashes) h = { kNoTick, 0 };
+        xoshiroSeed(testRng, seed ^ static_cast<Uint64>(localIndex + 1));
+        connected = true;
+        LOG_INFO("Netplay: connected to %s as P%d, %s randomizer", netplayPeer, localIndex + 1,
+                 randomizerName(randomizerKind));
+    }
+
+    void receiveInput(const Uint8* p, size_t size) {
+        const Uint32 ack = get32(p);
+        const Uint32 first = get32(p + 4);
+        const Uint32 count = p[8];
+        if (size < 9 + count + 12) return;
+        peerAck = std::max(peerAck, ack);
+        for (Uint32 i = 0; i < count; ++i) {
+            const Uint32 t = first + i;
+            if (t < remoteContiguous || t + 1 >= remoteContiguous + kHistory) continue;
+            const int slot = t % kHistory;
+            if (remoteKnown[slot] == t + 1) continue;
+            remoteKnown[slot] = t + 1;
+            remoteButtons[slot] = p[9 + i];
+            if (t < tick && remoteUsed[slot] != remoteButtons[slot]) rollbackFrom = std::min(rollbackFrom, t);
+        }
+        while (remoteKnown[remoteContiguous % kHistory] == remoteContiguous + 1) remoteContiguous++;
+        receivePeerHash({ get32(p + 9 + count), get64(p + 13 + count) });
+    }
+
+#ifndef _WIN32
+    void receivePackets(Uint64 now) {
+        Uint8 data[512];
+        for (;;) {
+            sockaddr_in from{};
+            socklen_t fromLen = sizeof(from);
+            const ssize_t n = recvfrom(sock, data, sizeof(data), 0, reinterpret_cast<sockaddr*>(&from), &fromLen);
+            if (n < 0 && errno == EINTR) continue;
+            if (n < 0) break; // EAGAIN: nothing more this frame
+            const size_t size = static_cast<size_t>(n);
+            if (from.sin_addr.s_addr != peerAddr.sin_addr.s_addr || from.sin_port != peerAddr.sin_port) continue;
+            if (size < kHeaderSize || std::memcmp(data, kMagic, 4) != 0 || data[4] != kProtocolVersion) continue;
+            const PacketType type = static_cast<PacketType>(data[5]);
+            const Uint64 nonce = get64(data + 6);
+            if (nonce == localNonce || (connected && nonce != peerNonce)) continue; // our own echo, or a stale peer
+            packetsReceived++;
+            lastHeardNs = now;
+
+            if (type == PacketType::Hello) {
+                if (size < kHelloSize) continue;
+                if (!connected) {
+                    peerNonce = nonce;
+                    startSession(data + kHeaderSize);
+                }
+                if (!data[kHeaderSize + 7]) lastHelloNs = 0; // the peer has not heard ours: answer it
+            } else if (connected && (type == PacketType::Input || type == PacketType::Bye)) {
+                if (size >= kHeaderSize + 9) receiveInput(data + kHeaderSize, size - kHeaderSize);
+                if (type == PacketType::Bye) peerLeft = true;
+            }
+        }
+    }
+#else
+    void receivePackets(Uint64) {}
+#endif
+
+    bool finished() {
+        const Uint32 end = endTick();
+        return end != kNoTick && tick >= end && remoteContiguous >= end && peerAck >= end;
+    }
+
+    void reportFinish() {
+        finishReported = true;
+        const Uint32 end = endTick();
+        const VersusMatch& m = end == tick ? versusMatch : saved[end % kHistory].match;
+        if (m.over && m.winner >= 0) LOG_INFO("Netplay: P%d wins", m.winner + 1);
+        else if (m.over) LOG_INFO("Netplay: draw");
+        LOG_INFO("Netplay: finished at tick %u, match hash %016llx", end,
+                 static_cast<unsigned long long>(hashMatch(m)));
+    }
+}
+
+bool netplayEnabled() {
+    return netplayPeer != nullptr;
+}
+
+bool netplayOpen() {
+#ifdef _WIN32
+    LOG_ERROR("Netplay needs POSIX sockets and is not available on Windows");
+    return false;
+#else
+    const char* colon = std::strrchr(netplayPeer, ':');
+    char host[256];
+    if (!colon || static_cast<size_t>(colon - netplayPeer) >= sizeof(host) || netplayPort <= 0 || netplayPort > 65535) {
+        LOG_ERROR("--netplay takes a local port and the peer as host:port");
+        return false;
+    }
+    std::memcpy(host, netplayPeer, colon - netplayPeer);
+    host[colon - netplayPeer] = '\0';
+
+    addrinfo hints{};
+    hints.ai_family = AF_INET;
+    hints.ai_socktype = SOCK_DGRAM;
+    addrinfo* found = nullptr;
+    if (getaddrinfo(host, colon + 1, &hints, &found) != 0 || !found) {
+        LOG_ERROR("Could not resolve %s", netplayPeer);
+        return false;
+    }
+    std::memcpy(&peerAddr, found->ai_addr, sizeof(peerAddr));
+    freeaddrinfo(found);
+
+    sockaddr_in local{};
+    local.sin_family = AF_INET;
+    local.sin_addr.s_addr = htonl(INADDR_ANY);
+    local.sin_port = htons(static_cast<Uint16>(netplayPort));
+    sock = socket(AF_INET, SOCK_DGRAM, 0);
+    if (sock < 0 || fcntl(sock, F_SETFL, O_NONBLOCK) != 0 ||
+        bind(sock, reinterpret_cast<sockaddr*>(&local), sizeof(local)) != 0) {
+        LOG_ERROR("Could not open UDP port %d: %s", netplayPort, strerror(errno));
+        if (sock >= 0) ::close(sock);
+        sock = -1;
+        return false;
+    }
+
+    Xoshiro128 nonceRng;
+    xoshiroSeed(nonceRng, SDL_GetPerformanceCounter() ^ SDL_GetTicksNS() ^ static_cast<Uint64>(netplayPort) << 48);
+    localNonce = static_cast<Uint64>(xoshiroNext(nonceRng)) << 32 | xoshiroNext(nonceRng);
+    xoshiroSeed(lossRng, localNonce);
+    netRollbackLimit = std::clamp(netRollbackLimit, 1, kMaxRollback);
+    openedNs = lastHeardNs = SDL_GetTicksNS();
+    LOG_INFO("Netplay: UDP port %d, waiting for %s (rollback up to %d ticks, delay %d+%d ms, loss %d%%)",
+             netplayPort, netplayPeer, netRollbackLimit, netDelayMs, netJitterMs, netLossPercent);
+    return true;
+#endif
+}
+
+NetStatus netplayFrame(Uint8 input) {
+    const Uint64 now = SDL_GetTicksNS();
+    receivePackets(now);
+    if (!connected) {
+        if (now - lastHelloNs >= kHelloIntervalNs) sendHello(now);
+        flushOutgoing(now);
+        if (netTestTicks > 0 && now - openedNs > kTestConnectTimeoutNs) {
+            LOG_ERROR("Netplay: %s never answered", netplayPeer);
+            return NetStatus::Disconnected;
+        }
+        return NetStatus::Connecting;
+    }
+    if (lastHelloNs == 0) sendHello(now);
+    if (!peerLeft && now - lastHeardNs > kTimeoutNs) {
+        LOG_WARN("Netplay: nothing from %s for %llu s", netplayPeer, static_cast<unsigned long long>(kTimeoutNs / 1000000000));
+        peerLeft = true;
+    }
+
+    rollBack();
+    hashConfirmedTicks();
+
+    // Presses are edges the caller reports once, so a stalled frame keeps them for the next tick
+    pendingButtons |= input;
+    NetStatus status = NetStatus::Stalled;
+    const Uint32 end = endTick();
+    if (tick < end && tick < remoteContiguous + netRollbackLimit) { // the peer may well be ahead
+        localButtons[tick % kHistory] = netTestTicks > 0 ? testButtons() : pendingButtons;
+        pendingButtons = 0;
+        simulateTick(tick);
+        tick++;
+        status = NetStatus::Running;
+    } else if (tick < end) {
+        stalledFrames++;
+    }
+    sendInput(PacketType::Input);
+    flushOutgoing(now);
+
+    if (finished()) {
+        if (!finishReported) reportFinish();
+        return NetStatus::Finished;
+    }
+    if (peerLeft && (end == kNoTick || remoteContiguous < end)) return NetStatus::Disconnected;
+    return status;
+}
+
+int netplayLocalBoard() {
+    return localIndex;
+}
+
+bool netplayResimulating() {
+    return resimulating;
+}
+
+void netplayStatusText(char* out, size_t size) {
+    if (!connected) {
+        SDL_snprintf(out, size, "Waiting for %s...   Esc: quit", netplayPeer);
+    } else if (finished()) {
+        SDL_snprintf(out, size, "Match over   Esc: quit");
+    } else if (peerLeft) {
+        SDL_snprintf(out, size, "Peer left   Esc: quit");
+    } else {
+        SDL_snprintf(out, size, "ahead %d  rollbacks %llu (%.1f ticks)", static_cast<int>(tick - remoteContiguous),
+                     static_cast<unsigned long long>(rollbacks), rollbacks ? static_cast<double>(resimTicks) / rollbacks : 0.0);
+    }
+}
+
+bool netplayClose() {
+    if (sock < 0) return true;
+#ifndef _WIN32
+    if (connected) sendInput(PacketType::Bye);
+    // Let packets held back by --net-delay go out before the socket does
+    const Uint64 start = SDL_GetTicksNS();
+    while (flushOutgoing(SDL_GetTicksNS()) > 0 && SDL_GetTicksNS() - start < kFlushTimeoutNs) SDL_Delay(1);
+    ::close(sock);
+#endif
+    sock = -1;
+    if (!connected) return true;
+    randomizerKind = savedRandomizer;
+
+    LOG_INFO("Netplay: %u ticks, %llu rollbacks (%.1f per 100 ticks), %.1f ticks resimulated per rollback, at most %llu",
+             tick, static_cast<unsigned long long>(rollbacks), tick ? 100.0 * rollbacks / tick : 0.0,
+             rollbacks ? static_cast<double>(resimTicks) / rollbacks : 0.0, static_cast<unsigned long long>(maxResimTicks));
+    LOG_INFO("Netplay: resimulating took %.3f ms per rollback, worst %.3f ms; %llu frames stalled",
+             rollbacks ? resimNs / 1e6 / rollbacks : 0.0, maxResimNs / 1e6, static_cast<unsigned long long>(stalledFrames));
+    LOG_INFO("Netplay: %llu packets sent (%llu dropped by --net-loss, %llu over the delay queue), %llu received",
+             static_cast<unsigned long long>(packetsSent), static_cast<unsigned long long>(packetsDropped),
+             static_cast<unsigned long long>(queueOverflows), static_cast<unsigned long long>(packetsReceived));
+    if (desyncs > 0) LOG_ERROR("Netplay: %llu of %llu hash checks failed", static_cast<unsigned long long>(desyncs),
+                               static_cast<unsigned long long>(hashChecks));
+    else LOG_INFO("Netplay: %llu hash checks, all in sync", static_cast<unsigned long long>(hashChecks));
+    return desyncs == 0;
+}
+
+Uint8 netButtonFor(InputAction action) {
+    switch (action) {
+        case InputAction::MoveLeft: return kNetLeft;
+        case InputAction::MoveRight: return kNetRight;
+        case InputAction::SoftDrop: return kNetSoftDrop;
+        case InputAction::HardDrop: return kNetHardDrop;
+        case InputAction::RotateClockwise: return kNetRotateCW;
+        case InputAction::RotateCounterClockwise: return kNetRotateCCW;
+        case InputAction::Hold: return kNetHold;
+        default: return 0;
+    }
+}
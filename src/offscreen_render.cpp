@@ -0,0 +1,255 @@
+#include "offscreen_render.h"
+#include "globals.h"
+#include "tetris_utils.h"
+#include "startup.h"
+#include "replay.h"
+#include "bot.h"
+#include "frame_arena.h"
+#include "log.h"
+#include "trace.h"
+#include <SDL3_image/SDL_image.h>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+const char* renderOutPath = nullptr;
+const char* renderReplayPath = nullptr;
+int renderFrameLimit = 0;
+
+namespace {
+    constexpr int kMaxEncoders = 8;
+    constexpr size_t kQueueCapacity = 16; // frames read back but not yet encoded
+
+    struct FrameJob {
+        SDL_Surface* surface;
+        Uint64 index;
+    };
+
+    SDL_Surface* target = nullptr; // what the software renderer draws into
+    bool active = false;
+    bool writeY4m = false;
+    std::FILE* y4mFile = nullptr;
+
+    // Readback happens on the main thread (the renderer is not thread-safe); the
+    // surfaces it returns are converted and written by the encoders
+    std::vector<std::thread> encoders;
+    int encoderCount = 0;
+    std::mutex queueMutex;
+    std::condition_variable workCv;
+    std::condition_variable spaceCv;
+    FrameJob queue[kQueueCapacity];
+    size_t queueHead = 0;
+    size_t queueCount = 0;
+    bool stopping = false;
+
+    // Y4M frames are converted in parallel but written in order
+    std::mutex writeMutex;
+    std::condition_variable writeCv;
+    Uint64 nextWrite = 0;
+
+    Uint64 framesQueued = 0;
+    Uint64 readbackNs = 0;
+    Uint64 stallNs = 0; // main thread waiting for a free queue slot
+    std::atomic<Uint64> encodeNs{ 0 };
+    std::atomic<bool> encodeFailed{ false };
+
+    bool endsWith(const char* s, const char* suffix) {
+        const size_t n = std::strlen(s);
+        const size_t m = std::strlen(suffix);
+        return n >= m && SDL_strcasecmp(s + n - m, suffix) == 0;
+    }
+
+    void encodePng(const FrameJob& job) {
+        char path[1024];
+        std::snprintf(path, sizeof(path), "%s/frame_%06llu.png", renderOutPath, static_cast<unsigned long long>(job.index));
+        if (!IMG_SavePNG(job.surface, path)) {
+            if (!encodeFailed.exchange(true)) LOG_ERROR("Could not write %s: %s", path, SDL_GetError());
+        }
+    }
+
+    void encodeY4m(const FrameJob& job, std::vector<Uint8>& yuv) {
+        const int w = job.surface->w;
+        const int h = job.surface->h;
+        yuv.resize(static_cast<size_t>(w) * h + 2 * static_cast<size_t>((w + 1) / 2) * ((h + 1) / 2));
+        const bool converted = SDL_ConvertPixelsAndColorspace(w, h, job.surface->format, SDL_COLORSPACE_SRGB, 0,
+                                                              job.surface->pixels, job.surface->pitch,
+                                                              SDL_PIXELFORMAT_IYUV, SDL_COLORSPACE_BT601_LIMITED, 0,
+                                                              yuv.data(), w);
+
+        std::unique_lock<std::mutex> lock(writeMutex);
+        writeCv.wait(lock, [&] { return nextWrite == job.index; });
+        if (!converted) {
+            if (!encodeFailed.exchange(true)) LOG_ERROR("Could not convert frame %llu to YUV: %s",
+                                                        static_cast<unsigned long long>(job.index), SDL_GetError());
+        } else if (std::fputs("FRAME\n", y4mFile) < 0 || std::fwrite(yuv.data(), 1, yuv.size(), y4mFile) != yuv.size()) {
+            if (!encodeFailed.exchange(true)) LOG_ERROR("Could not write %s", renderOutPath);
+        }
+        nextWrite++;
+        lock.unlock();
+        writeCv.notify_all();
+    }
+
+    void encoderMain() {
+        traceSetThreadName("encoder");
+        std::vector<Uint8> yuv; // one I420 frame, reused
+        for (;;) {
+            FrameJob job;
+            {
+                std::unique_lock<std::mutex> lock(queueMutex);
+                workCv.wait(lock, [] { return queueCount > 0 || stopping; });
+                if (queueCount == 0) return;
+                job = queue[queueHead];
+                queueHead = (queueHead + 1) % kQueueCapacity;
+                queueCount--;
+            }
+            spaceCv.notify_one();
+
+            const Uint64 start = SDL_GetTicksNS();
+            TRACE_SCOPE("encode frame");
+            if (writeY4m) encodeY4m(job, yuv);
+            else encodePng(job);
+            SDL_DestroySurface(job.surface);
+            encodeNs += SDL_GetTicksNS() - start;
+        }
+    }
+
+    void startEncoders() {
+        encoderCount = std::clamp(static_cast<int>(std::thread::hardware_concurrency()) - 1, 1, kMaxEncoders);
+        stopping = false;
+        for (int i = 0; i < encoderCount; ++i) encoders.emplace_back(encoderMain);
+    }
+
+    // Encode everything still queued, then join
+    void stopEncoders() {
+        {
+            std::lock_guard<std::mutex> lock(queueMutex);
+            stopping = true;
+        }
+        workCv.notify_all();
+        for (std::thread& t : encoders) t.join();
+        encoders.clear();
+    }
+
+    bool openOutput() {
+        writeY4m = endsWith(renderOutPath, ".y4m");
+        if (!writeY4m) {
+            if (!SDL_CreateDirectory(renderOutPath)) {
+                LOG_ERROR("Could not create %s: %s", renderOutPath, SDL_GetError());
+                return false;
+            }
+            return true;
+        }
+        y4mFile = std::fopen(renderOutPath, "wb");
+        if (!y4mFile) {
+            LOG_ERROR("Could not open %s for writing", renderOutPath);
+            return false;
+        }
+        std::fprintf(y4mFile, "YUV4MPEG2 W%d H%d F%d:1 Ip A1:1 C420mpeg2 XCOLORRANGE=LIMITED\n",
+                     target->w, target->h, kScreenFps);
+        return true;
+    }
+
+    bool openRenderTarget() {
+        target = SDL_CreateSurface(kScreenWidth, kScreenHeight, SDL_PIXELFORMAT_RGBA32);
+        if (!target) {
+            LOG_ERROR("Could not create the offscreen surface: %s", SDL_GetError());
+            return false;
+        }
+        gRenderer = SDL_CreateSoftwareRenderer(target);
+        if (!gRenderer) {
+            LOG_ERROR("Could not create the software renderer: %s", SDL_GetError());
+            return false;
+        }
+        return true;
+    }
+
+    bool frameLimitReached() {
+        return renderFrameLimit > 0 && framesQueued >= static_cast<Uint64>(renderFrameLimit);
+    }
+}
+
+bool offscreenRenderActive() {
+    return active;
+}
+
+void offscreenCaptureFrame() {
+    if (!active || frameLimitReached()) return;
+
+    TRACE_SCOPE("offscreen readback");
+    const Uint64 start = SDL_GetTicksNS();
+    SDL_Surface* frame = SDL_RenderReadPixels(gRenderer, nullptr);
+    const Uint64 readDone = SDL_GetTicksNS();
+    readbackNs += readDone - start;
+    if (!frame) {
+        if (!encodeFailed.exchange(true)) LOG_ERROR("SDL_RenderReadPixels failed: %s", SDL_GetError());
+        return;
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(queueMutex);
+        spaceCv.wait(lock, [] { return queueCount < kQueueCapacity; });
+        queue[(queueHead + queueCount) % kQueueCapacity] = FrameJob{ frame, framesQueued++ };
+        queueCount++;
+    }
+    workCv.notify_one();
+    stallNs += SDL_GetTicksNS() - readDone;
+}
+
+int runOffscreenRender() {
+    const bool fromReplay = renderReplayPath != nullptr;
+    if (!fromReplay && !botOpen()) {
+        LOG_ERROR("--render-out needs --render-replay <file> or a bot (--bot-stdio or --bot-socket <path>)");
+        return 1;
+    }
+
+    beginStartupDecodes(false);
+    if (!openRenderTarget() || !openOutput()) return 1;
+    if (!loadMedia()) {
+        LOG_ERROR("Unable to load media!");
+        return 1;
+    }
+    if (fromReplay && !replayOpenPlayback(renderReplayPath)) return 1; // resets to tick 0, which draws the HUD text
+    if (!fromReplay) resetGameplayStateForNewGame();
+
+    startEncoders();
+    active = true;
+    currentState = GameState::PLAYING;
+
+    // Replays run tick by tick, applying each recorded action on the tick it was made
+    const Uint64 startNs = SDL_GetTicksNS();
+    for (Uint64 tick = fromReplay ? playbackReplay().startTick : 0; !frameLimitReached() && !encodeFailed; ++tick) {
+        frameArena().reset();
+        if (fromReplay) {
+            if (tick > playbackReplay().ticks) break;
+            replayApplyTickEvents();
+        } else {
+            if (!botActive() || (botGameLimit > 0 && botGamesPlayed() >= botGameLimit)) break;
+            botUpdate();
+        }
+        runGameplayFrame();
+    }
+
+    active = false;
+    stopEncoders();
+    if (y4mFile && std::fclose(y4mFile) != 0) encodeFailed = true;
+    y4mFile = nullptr;
+
+    const double seconds = (SDL_GetTicksNS() - startNs) / 1000000000.0;
+    const double frames = framesQueued > 0 ? static_cast<double>(framesQueued) : 1.0;
+    LOG_INFO("Offscreen: %llu frames to %s in %.2fs (%.0f fps, %.1fx real time)",
+             static_cast<unsigned long long>(framesQueued), renderOutPath, seconds,
+             seconds > 0 ? framesQueued / seconds : 0.0, seconds > 0 ? framesQueued / (seconds * kScreenFps) : 0.0);
+    LOG_INFO("Offscreen per frame: readback %.3f ms, encode %.3f ms on %d threads, main thread stalled %.3f ms",
+             readbackNs / frames / 1e6, encodeNs.load() / frames / 1e6, encoderCount, stallNs / frames / 1e6);
+    return encodeFailed ? 1 : 0;
+}
+
+void closeOffscreenRender() {
+    if (!encoders.empty()) stopEncoders();
+    if (target) { SDL_DestroySurface(target); target = nullptr; }
+}
@@ -0,0 +1,368 @@
+#include "position.h"
+#include "tetris_utils.h"
+#include "replay.h"
+#include "flight_recorder.h"
+#include "alloc_check.h"
+#include "log.h"
+#include <algorithm>
+#include <cstdio>
+#include <string>
+
+const char* startPositionPath = nullptr;
+int startPositionIndex = 0;
+
+namespace {
+    constexpr char kCellLetters[] = ".IOTLJSZG"; // by board color
+    constexpr char kDumpPath[] = "positions_dump.txt";
+    constexpr int kGrey = 8;
+    constexpr int kMaxNumber = 1000000000;
+
+    Position startPosition{};
+    bool startPositionLoaded = false;
+
+    int typeFromLetter(char c) {
+        for (int type = 0; type < kPieceTypeCount; ++type) {
+            if (kCellLetters[type + 1] == c) return type;
+        }
+        return -1;
+    }
+
+    // Parsing walks a [p, end) range and never allocates
+    struct Cursor {
+        const char* p;
+        const char* end;
+
+        bool done() const { return p >= end; }
+        char peek() const { return p < end ? *p : '\0'; }
+        bool accept(char c) {
+            if (peek() != c) return false;
+            ++p;
+            return true;
+        }
+        bool digit() const { return peek() >= '0' && peek() <= '9'; }
+    };
+
+    bool readInt(Cursor& c, int& out) {
+        const bool negative = c.accept('-');
+        if (!c.digit()) return false;
+        int value = 0;
+        while (c.digit()) {
+            value = value * 10 + (*c.p++ - '0');
+            if (value > kMaxNumber) return false;
+        }
+        out = negative ? -value : value;
+        return true;
+    }
+
+    bool skipSpaces(Cursor& c) {
+        if (c.peek() != ' ' && c.peek() != '\t') return false;
+        while (c.peek() == ' ' || c.peek() == '\t') ++c.p;
+        return true;
+    }
+
+    char* putInt(char* p, int value) {
+        if (value < 0) {
+            *p++ = '-';
+            value = -value;
+        }
+        char digits[12];
+        int n = 0;
+        do {
+            digits[n++] = static_cast<char>('0' + value % 10);
+            value /= 10;
+        } while (value > 0);
+        while (n > 0) *p++ = digits[--n];
+        return p;
+    }
+
+    bool fail(const char** error, const char* message) {
+        if (error) *error = message;
+        return false;
+    }
+}
+
+bool parsePosition(const char* text, size_t length, Position& out, const char** error) {
+    Position p{};
+    Cursor c{ text, text + length };
+
+    for (int y = 0; y < boardHeight; ++y) {
+        if (y > 0 && !c.accept('/')) return fail(error, "expected '/' between rows");
+        for (int x = 0; x < boardWidth;) {
+            if (c.digit()) {
+                int run = 0;
+                if (!readInt(c, run) || run <= 0 || x + run > boardWidth) return fail(error, "row is not boardWidth cells");
+                x += run;
+                continue;
+            }
+            const char letter = c.peek();
+            if (letter == '.') { // also accepted for an empty cell, handy when editing by hand
+                x++;
+                ++c.p;
+                continue;
+            }
+            const int type = typeFromLetter(letter);
+            if (type < 0 && letter != 'G') return fail(error, "bad board cell");
+            p.cells[x++][y] = static_cast<Uint8>(type < 0 ? kGrey : type + 1);
+            ++c.p;
+        }
+    }
+
+    if (!skipSpaces(c)) return fail(error, "expected the current piece");
+    p.piece = typeFromLetter(c.peek());
+    if (p.piece < 0) return fail(error, "bad piece type");
+    ++c.p;
+    if (!readInt(c, p.rotation) || p.rotation < 0 || p.rotation > 3) return fail(error, "bad piece rotation");
+    if (!c.accept('@') || !readInt(c, p.x) || !c.accept(',') || !readInt(c, p.y)) return fail(error, "bad piece position");
+    const PieceShape& shape = kPieceShapes.shapes[p.piece][p.rotation];
+    if (p.x < 0 || p.y < 0 || p.x + shape.width > boardWidth || p.y + shape.height > boardHeight) {
+        return fail(error, "piece is outside the board");
+    }
+
+    if (!skipSpaces(c)) return fail(error, "expected the hold piece");
+    p.hold = -1;
+    if (!c.accept('-')) {
+        p.hold = typeFromLetter(c.peek());
+        if (p.hold < 0) return fail(error, "bad hold piece");
+        ++c.p;
+    }
+    p.holdUsed = c.accept('*');
+
+    if (!skipSpaces(c)) return fail(error, "expected the queue");
+    if (!c.accept('-')) {
+        while (!c.done() && c.peek() != ' ' && c.peek() != '\t') {
+            const int type = typeFromLetter(c.peek());
+            if (type < 0 || p.queueLength == kMaxPreview) return fail(error, "bad queue");
+            p.queue[p.queueLength++] = static_cast<Uint8>(type);
+            ++c.p;
+        }
+        if (p.queueLength == 0) return fail(error, "bad queue");
+    }
+
+    int level = 0;
+    if (!skipSpaces(c) || !readInt(c, level) || level < 1) return fail(error, "bad level");
+    p.level = level - 1;
+    if (!skipSpaces(c) || !readInt(c, p.score) || p.score < 0) return fail(error, "bad score");
+    if (!skipSpaces(c) || !readInt(c, p.lines) || p.lines < 0) return fail(error, "bad line count");
+
+    if (!skipSpaces(c) || !readInt(c, p.lockDelayCounter) || !c.accept(',') ||
+        !readInt(c, p.lockDelayMovesUsed) || !c.accept(',') ||
+        !readInt(c, p.lockDelayRotationsUsed) || !c.accept(',')) {
+        return fail(error, "bad lock delay counters");
+    }
+    if (!c.accept('-')) {
+        for (bool any = false;; any = true) {
+            if (c.accept('l')) p.pieceLanded = true;
+            else if (c.accept('o')) p.pieceLandedOnce = true;
+            else if (c.accept('a')) p.alternateIOffset = true;
+            else if (any) break;
+            else return fail(error, "bad lock delay flags");
+        }
+    }
+
+    while (c.peek() == ' ' || c.peek() == '\t' || c.peek() == '\r' || c.peek() == '\n') ++c.p;
+    if (!c.done()) return fail(error, "unexpected text after the position");
+
+    out = p;
+    return true;
+}
+
+size_t formatPosition(const Position& position, char* out, size_t capacity) {
+    if (capacity < kMaxPositionText) return 0;
+    char* p = out;
+
+    for (int y = 0; y < boardHeight; ++y) {
+        if (y > 0) *p++ = '/';
+        int run = 0;
+        for (int x = 0; x < boardWidth; ++x) {
+            const int color = position.cells[x][y];
+            if (color == 0) {
+                run++;
+                continue;
+            }
+            if (run > 0) p = putInt(p, run);
+            run = 0;
+            *p++ = kCellLetters[std::min(color, kGrey)];
+        }
+        if (run > 0) p = putInt(p, run);
+    }
+
+    *p++ = ' ';
+    *p++ = kCellLetters[position.piece + 1];
+    *p++ = static_cast<char>('0' + position.rotation);
+    *p++ = '@';
+    p = putInt(p, position.x);
+    *p++ = ',';
+    p = putInt(p, position.y);
+
+    *p++ = ' ';
+    *p++ = position.hold < 0 ? '-' : kCellLetters[position.hold + 1];
+    if (position.holdUsed) *p++ = '*';
+
+    *p++ = ' ';
+    if (position.queueLength == 0) *p++ = '-';
+    for (int i = 0; i < position.queueLength; ++i) *p++ = kCellLetters[position.queue[i] + 1];
+
+    *p++ = ' ';
+    p = putInt(p, position.level + 1);
+    *p++ = ' ';
+    p = putInt(p, position.score);
+    *p++ = ' ';
+    p = putInt(p, position.lines);
+
+    *p++ = ' ';
+    p = putInt(p, position.lockDelayCounter);
+    *p++ = ',';
+    p = putInt(p, position.lockDelayMovesUsed);
+    *p++ = ',';
+    p = putInt(p, position.lockDelayRotationsUsed);
+    *p++ = ',';
+    if (position.pieceLanded) *p++ = 'l';
+    if (position.pieceLandedOnce) *p++ = 'o';
+    if (position.alternateIOffset) *p++ = 'a';
+    if (p[-1] == ',') *p++ = '-';
+
+    *p = '\0';
+    return static_cast<size_t>(p - out);
+}
+
+bool loadPositionFile(const char* path, std::vector<Position>& out) {
+    size_t size = 0;
+    char* data = static_cast<char*>(SDL_LoadFile(path, &size));
+    if (!data) {
+        LOG_ERROR("Could not read positions from %s: %s", path, SDL_GetError());
+        return false;
+    }
+
+    const Uint64 start = SDL_GetTicksNS();
+    bool ok = true;
+    int lineNumber = 0;
+    for (size_t pos = 0; pos < size;) {
+        size_t end = pos;
+        while (end < size && data[end] != '\n') ++end;
+        lineNumber++;
+        const char* line = data + pos;
+        const size_t length = end - pos;
+        pos = end + 1;
+
+        size_t first = 0;
+        while (first < length && (line[first] == ' ' || line[first] == '\t' || line[first] == '\r')) ++first;
+        if (first == length || line[first] == '#') continue;
+
+        Position position;
+        const char* error = nullptr;
+        if (!parsePosition(line + first, length - first, position, &error)) {
+            LOG_ERROR("%s:%d: %s", path, lineNumber, error);
+            ok = false;
+            continue;
+        }
+        out.push_back(position);
+    }
+    LOG_DEBUG("Parsed %zu positions from %s in %.1f us", out.size(), path, (SDL_GetTicksNS() - start) / 1000.0);
+    SDL_free(data);
+    return ok;
+}
+
+void captureLivePosition(Position& out) {
+    out = Position{};
+    for (int x = 0; x < boardWidth; ++x) {
+        for (int y = 0; y < boardHeight; ++y) {
+            out.cells[x][y] = static_cast<Uint8>(std::clamp(board.current[x][y], 0, kGrey));
+        }
+    }
+    out.piece = currentPiece.type;
+    out.rotation = currentPiece.rotation;
+    out.x = currentPiece.x;
+    out.y = currentPiece.y;
+    out.hold = holdPiece.isEmpty() ? -1 : holdPiece.type;
+    out.holdUsed = holdUsed;
+    out.queueLength = kMaxPreview;
+    for (int i = 0; i < kMaxPreview; ++i) out.queue[i] = static_cast<Uint8>(pieceQueuePeek(pieceQueue, i));
+    out.level = levelValue;
+    out.score = scoreValue;
+    out.lines = rowsCleared;
+    out.lockDelayCounter = lockDelayCounter;
+    out.lockDelayMovesUsed = lockDelayMovesUsed;
+    out.lockDelayRotationsUsed = lockDelayRotationsUsed;
+    out.pieceLanded = pieceLanded;
+    out.pieceLandedOnce = pieceLandedOnce;
+    out.alternateIOffset = alternateIPieceRotationOffset;
+}
+
+void applyLivePosition(const Position& position) {
+    for (int x = 0; x < boardWidth; ++x) {
+        for (int y = 0; y < boardHeight; ++y) {
+            board.current[x][y] = position.cells[x][y];
+        }
+    }
+
+    pickPiece = position.piece;
+    currentPiece = pieceTypes[pickPiece];
+    setPieceRotation(currentPiece, position.rotation);
+    currentPiece.x = position.x;
+    currentPiece.y = position.y;
+    holdPiece = position.hold < 0 ? Piece() : pieceTypes[position.hold];
+    holdUsed = position.holdUsed;
+
+    // The listed pieces replace the front of the ring; later ones still come from the seed
+    for (int i = 0; i < position.queueLength; ++i) {
+        pieceQueue.ring[(pieceQueue.head + i) % kMaxPreview] = position.queue[i];
+    }
+    nextPickPiece = pieceQueuePeek(pieceQueue, 0);
+    nextPiece = pieceTypes[nextPickPiece];
+
+    levelValue = position.level;
+    dropSpeed = dropSpeedForLevel(levelValue);
+    scoreValue = position.score;
+    rowsCleared = position.lines;
+
+    lockDelayCounter = position.lockDelayCounter;
+    lockDelayMovesUsed = position.lockDelayMovesUsed;
+    lockDelayRotationsUsed = position.lockDelayRotationsUsed;
+    pieceLanded = position.pieceLanded;
+    pieceLandedOnce = position.pieceLandedOnce;
+    alternateIPieceRotationOffset = position.alternateIOffset;
+
+    newPiece = false;
+    hardDropFlag = false;
+    clearingRows = false;
+    rowsToClear.clear();
+
+    score.loadFromRenderedText(std::to_string(scoreValue), { 0xFF, 0xFF, 0xFF, 0xFF });
+    replayDiscardRecording(); // a replay only knows how to start from an empty board
+    flightGameStarted();      // the flight recorder snapshots the new position instead
+}
+
+void dumpLivePosition() {
+    Position position;
+    captureLivePosition(position);
+    char text[kMaxPositionText];
+    formatPosition(position, text, sizeof(text));
+    SDL_Log("Position: %s", text); // longer than a log record holds
+    SDL_SetClipboardText(text);
+
+    ALLOC_SCOPE(Save);
+    std::FILE* f = std::fopen(kDumpPath, "a");
+    if (!f) {
+        LOG_WARN("Could not append to %s", kDumpPath);
+        return;
+    }
+    std::fprintf(f, "%s\n", text);
+    std::fclose(f);
+}
+
+bool loadStartPosition() {
+    if (!startPositionPath) return true;
+    std::vector<Position> positions;
+    if (!loadPositionFile(startPositionPath, positions)) return false;
+    if (startPositionIndex < 0 || startPositionIndex >= static_cast<int>(positions.size())) {
+        LOG_ERROR("%s has %zu positions; --position-index %d is out of range", startPositionPath, positions.size(), startPositionIndex);
+        return false;
+    }
+    startPosition = positions[startPositionIndex];
+    startPositionLoaded = true;
+    return true;
+}
+
+void applyStartPosition() {
+    if (startPositionLoaded) applyLivePosition(startPosition);
+}
@@ -0,0 +1,151 @@
+#include "randomizer.h"
+
+RandomizerKind randomizerKind = RandomizerKind::Bag7;
+int previewDepth = 1;
+bool fixedSeedEnabled = false;
+Uint64 fixedSeed = 0;
+
+namespace {
+    // Piece indices as laid out in pieceTypes
+    constexpr Uint8 kPieceO = 1;
+    constexpr Uint8 kPieceS = 5;
+    constexpr Uint8 kPieceZ = 6;
+    constexpr int kTgmRolls = 6;
+
+    Uint32 rotl(Uint32 x, int k) {
+        return (x << k) | (x >> (32 - k));
+    }
+
+    Uint64 splitmix64(Uint64& x) {
+        Uint64 z = (x += 0x9E3779B97F4A7C15ull);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
+
+    void refillBag(RandomizerState& st, int size) {
+        for (int i = 0; i < size; ++i) st.bag[i] = static_cast<Uint8>(i % 7);
+        for (int i = size - 1; i > 0; --i) { // Fisher-Yates
+            const int j = xoshiroBelow(st.rng, i + 1);
+            const Uint8 t = st.bag[i];
+            st.bag[i] = st.bag[j];
+            st.bag[j] = t;
+        }
+        st.bagIndex = 0;
+    }
+
+    int drawBag(RandomizerState& st, int size) {
+        if (st.bagIndex >= size) refillBag(st, size);
+        return st.bag[st.bagIndex++];
+    }
+
+    bool inHistory(const RandomizerState& st, int piece) {
+        for (Uint8 h : st.history) if (h == piece) return true;
+        return false;
+    }
+
+    int drawTgm(RandomizerState& st) {
+        int piece;
+        if (st.firstDraw) {
+            do { piece = xoshiroBelow(st.rng, 7); } while (piece == kPieceS || piece == kPieceZ || piece == kPieceO);
+            st.firstDraw = 0;
+        } else {
+            piece = xoshiroBelow(st.rng, 7);
+            for (int roll = 1; roll < kTgmRolls && inHistory(st, piece); ++roll) {
+                piece = xoshiroBelow(st.rng, 7);
+            }
+        }
+        for (int i = 3; i > 0; --i) st.history[i] = st.history[i - 1];
+        st.history[0] = static_cast<Uint8>(piece);
+        return piece;
+    }
+}
+
+const char* randomizerName(RandomizerKind kind) {
+    switch (kind) {
+        case RandomizerKind::Bag7: return "7-Bag";
+        case RandomizerKind::Bag14: return "14-Bag";
+        case RandomizerKind::TgmHistory: return "TGM History";
+        case RandomizerKind::Memoryless: return "Memoryless";
+        default: return "?";
+    }
+}
+
+void xoshiroSeed(Xoshiro128& rng, Uint64 seed) {
+    const Uint64 a = splitmix64(seed);
+    const Uint64 b = splitmix64(seed);
+    rng.s[0] = static_cast<Uint32>(a);
+    rng.s[1] = static_cast<Uint32>(a >> 32);
+    rng.s[2] = static_cast<Uint32>(b);
+    rng.s[3] = static_cast<Uint32>(b >> 32);
+    if ((rng.s[0] | rng.s[1] | rng.s[2] | rng.s[3]) == 0) rng.s[0] = 1; // all-zero state is stuck
+}
+
+Uint32 xoshiroNext(Xoshiro128& rng) {
+    Uint32* s = rng.s;
+    const Uint32 result = rotl(s[1] * 5, 7) * 9;
+    const Uint32 t = s[1] << 9;
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = rotl(s[3], 11);
+    return result;
+}
+
+int xoshiroBelow(Xoshiro128& rng, int bound) {
+    // Lemire's multiply-shift with rejection, so small bounds stay unbiased
+    const Uint32 range = static_cast<Uint32>(bound);
+    Uint64 m = static_cast<Uint64>(xoshiroNext(rng)) * range;
+    Uint32 low = static_cast<Uint32>(m);
+    if (low < range) {
+        const Uint32 threshold = (0u - range) % range;
+        while (low < threshold) {
+            m = static_cast<Uint64>(xoshiroNext(rng)) * range;
+            low = static_cast<Uint32>(m);
+        }
+    }
+    return static_cast<int>(m >> 32);
+}
+
+void randomizerInit(RandomizerState& state, RandomizerKind kind, Uint64 seed) {
+    state = RandomizerState{};
+    xoshiroSeed(state.rng, seed);
+    state.kind = kind;
+    state.bagIndex = 14; // empty, refilled on first draw
+    // TGM2 starts with a Z S S Z history
+    state.history[0] = kPieceZ;
+    state.history[1] = kPieceS;
+    state.history[2] = kPieceS;
+    state.history[3] = kPieceZ;
+    state.firstDraw = 1;
+}
+
+int randomizerNext(RandomizerState& state) {
+    switch (state.kind) {
+        case RandomizerKind::Bag14: return drawBag(state, 14);
+        case RandomizerKind::TgmHistory: return drawTgm(state);
+        case RandomizerKind::Memoryless: return xoshiroBelow(state.rng, 7);
+        case RandomizerKind::Bag7:
+        default: return drawBag(state, 7);
+    }
+}
+
+void pieceQueueInit(PieceQueue& queue, RandomizerKind kind, Uint64 seed) {
+    randomizerInit(queue.gen, kind, seed);
+    queue.head = 0;
+    for (int i = 0; i < kMaxPreview; ++i) queue.ring[i] = static_cast<Uint8>(randomizerNext(queue.gen));
+}
+
+int pieceQueuePop(PieceQueue& queue) {
+    const int piece = queue.ring[queue.head];
+    // The freed slot becomes the back of the queue
+    queue.ring[queue.head] = static_cast<Uint8>(randomizerNext(queue.gen));
+    queue.head = static_cast<Uint8>((queue.head + 1) % kMaxPreview);
+    return piece;
+}
+
+int pieceQueuePeek(const PieceQueue& queue, int i) {
+    return queue.ring[(queue.head + i) % kMaxPreview];
+}
@@ -0,0 +1,498 @@
+#include "replay.h"
+#include "tetris_utils.h"
+#include "alloc_check.h"
+#include "bot.h"
+#include "log.h"
+#include "trace.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+namespace {
+    constexpr char kLastGamePath[] = "last_game.trp";
+    constexpr unsigned char kMagic[4] = { 'T', 'R', 'P', 'L' };
+    constexpr Uint16 kReplayVersion = 2;
+    constexpr size_t kHeaderSizeV1 = 32;
+    constexpr size_t kHeaderSize = 36;
+    constexpr size_t kKeyframeHeaderSize = 10;
+    constexpr size_t kEventReserve = 1 << 16;
+    constexpr size_t kKeyframeReserve = 1 << 16;
+    constexpr Uint32 kKeyframeBudget = 32;     // event bytes per keyframe byte, about 3%
+    constexpr Uint32 kTypicalKeyframeSize = 160;
+
+    enum SnapshotFlags : Uint8 {
+        kHoldUsed = 1 << 0,
+        kPieceLanded = 1 << 1,
+        kPieceLandedOnce = 1 << 2,
+        kAlternateIOffset = 1 << 3,
+        kNewPiece = 1 << 4,
+        kHardDrop = 1 << 5,
+    };
+
+    Replay recording;
+    bool recordingActive = false;
+    bool playbackActive = false;
+    Uint32 eventBytesSinceKeyframe = 0;
+    Uint32 lastKeyframeTick = 0;
+    Uint32 lastKeyframeSize = kTypicalKeyframeSize;
+
+    Replay playback;
+    size_t nextEvent = 0;
+    bool seeking = false;
+    bool divergenceReported = false;
+
+    void putBytes(std::vector<Uint8>& out, Uint64 v, int bytes) {
+        for (int i = 0; i < bytes; ++i) out.push_back(static_cast<Uint8>(v >> (8 * i)));
+    }
+
+    Uint64 getBytes(const Uint8* p, int bytes) {
+        Uint64 v = 0;
+        for (int i = 0; i < bytes; ++i) v |= static_cast<Uint64>(p[i]) << (8 * i);
+        return v;
+    }
+
+    Uint32 lebSize(Uint32 v) {
+        Uint32 n = 1;
+        while (v >>= 7) n++;
+        return n;
+    }
+
+    // Snapshot of everything the simulation reads, taken between ticks while no rows
+    // are being cleared:
+    //   u16 rows[boardHeight] (bit x = filled) | colors, 4 bits per filled cell, row-major |
+    //   u8 piece | u8 rotation | i8 x | i8 y | i8 hold | u8 flags | u8 lock counter |
+    //   u8 moves used | u8 rotations used | u32 score | u32 lines | u8 level |
+    //   u32 pieces placed | u32 ticks since gravity | PieceQueue (generator, ring, head)
+    void writeSnapshot(std::vector<Uint8>& out) {
+        Uint8 nibble = 0;
+        bool half = false;
+        for (int y = 0; y < boardHeight; ++y) {
+            Uint16 row = 0;
+            for (int x = 0; x < boardWidth; ++x) if (board.current[x][y] != 0) row |= static_cast<Uint16>(1u << x);
+            putBytes(out, row, 2);
+        }
+        for (int y = 0; y < boardHeight; ++y) {
+            for (int x = 0; x < boardWidth; ++x) {
+                if (board.current[x][y] == 0) continue;
+                const Uint8 color = static_cast<Uint8>(std::min(board.current[x][y], 15));
+                if (half) out.push_back(static_cast<Uint8>(nibble | (color << 4)));
+                else nibble = color;
+                half = !half;
+            }
+        }
+        if (half) out.push_back(nibble);
+
+        out.push_back(static_cast<Uint8>(currentPiece.type));
+        out.push_back(static_cast<Uint8>(currentPiece.rotation));
+        out.push_back(static_cast<Uint8>(currentPiece.x));
+        out.push_back(static_cast<Uint8>(currentPiece.y));
+        out.push_back(static_cast<Uint8>(holdPiece.isEmpty() ? -1 : holdPiece.type));
+        out.push_back(static_cast<Uint8>((holdUsed ? kHoldUsed : 0) | (pieceLanded ? kPieceLanded : 0) |
+                                         (pieceLandedOnce ? kPieceLandedOnce : 0) |
+                                         (alternateIPieceRotationOffset ? kAlternateIOffset : 0) |
+                                         (newPiece ? kNewPiece : 0) | (hardDropFlag ? kHardDrop : 0)));
+        out.push_back(static_cast<Uint8>(std::min(lockDelayCounter, 255)));
+        out.push_back(static_cast<Uint8>(lockDelayMovesUsed));
+        out.push_back(static_cast<Uint8>(lockDelayRotationsUsed));
+        putBytes(out, static_cast<Uint32>(scoreValue), 4);
+        putBytes(out, static_cast<Uint32>(rowsCleared), 4);
+        out.push_back(static_cast<Uint8>(levelValue));
+        putBytes(out, static_cast<Uint32>(piecesPlaced), 4);
+        putBytes(out, (gameTimeNs() - lastDropTime) / kTickNs, 4);
+
+        const RandomizerState& gen = pieceQueue.gen;
+        for (Uint32 word : gen.rng.s) putBytes(out, word, 4);
+        out.push_back(static_cast<Uint8>(gen.kind));
+        out.push_back(gen.bagIndex);
+        out.insert(out.end(), gen.bag, gen.bag + sizeof(gen.bag));
+        out.insert(out.end(), gen.history, gen.history + sizeof(gen.history));
+        out.push_back(gen.firstDraw);
+        out.insert(out.end(), pieceQueue.ring, pieceQueue.ring + kMaxPreview);
+        out.push_back(pieceQueue.head);
+    }
+
+    bool readSnapshot(const ReplayKeyframe& key, const std::vector<Uint8>& data) {
+        if (key.offset + key.size > data.size() || key.size < 2 * boardHeight) return false;
+        const Uint8* p = data.data() + key.offset;
+        const Uint8* end = p + key.size;
+
+        Uint16 rows[boardHeight];
+        int filled = 0;
+        for (int y = 0; y < boardHeight; ++y) {
+            rows[y] = static_cast<Uint16>(getBytes(p + 2 * y, 2));
+            for (int x = 0; x < boardWidth; ++x) filled += (rows[y] >> x) & 1;
+        }
+        p += 2 * boardHeight;
+        const Uint8* colors = p;
+        p += (filled + 1) / 2;
+        const size_t tailSize = 9 + 4 + 4 + 1 + 4 + 4 + 16 + 2 + 14 + 4 + 1 + kMaxPreview + 1;
+        if (p + tailSize > end) return false;
+        if (p[0] >= kPieceTypeCount || p[1] > 3 || (p[4] != 0xFF && p[4] >= kPieceTypeCount)) return false;
+
+        int cell = 0;
+        for (int y = 0; y < boardHeight; ++y) {
+            for (int x = 0; x < boardWidth; ++x) {
+                if (!((rows[y] >> x) & 1)) {
+                    board.current[x][y] = 0;
+                    continue;
+                }
+                const Uint8 packed = colors[cell / 2];
+                board.current[x][y] = (cell & 1) ? packed >> 4 : packed & 0x0F;
+                cell++;
+            }
+        }
+
+        pickPiece = p[0];
+        currentPiece = pieceTypes[pickPiece];
+        setPieceRotation(currentPiece, p[1]);
+        currentPiece.x = static_cast<Sint8>(p[2]);
+        currentPiece.y = static_cast<Sint8>(p[3]);
+        holdPiece = p[4] == 0xFF ? Piece() : pieceTypes[p[4]];
+        const Uint8 flags = p[5];
+        holdUsed = flags & kHoldUsed;
+        pieceLanded = flags & kPieceLanded;
+        pieceLandedOnce = flags & kPieceLandedOnce;
+        alternateIPieceRotationOffset = flags & kAlternateIOffset;
+        newPiece = flags & kNewPiece;
+        hardDropFlag = flags & kHardDrop;
+        lockDelayCounter = p[6];
+        lockDelayMovesUsed = p[7];
+        lockDelayRotationsUsed = p[8];
+        p += 9;
+        scoreValue = static_cast<int>(getBytes(p, 4));
+        rowsCleared = static_cast<int>(getBytes(p + 4, 4));
+        levelValue = p[8];
+        dropSpeed = dropSpeedForLevel(levelValue);
+        piecesPlaced = static_cast<int>(getBytes(p + 9, 4));
+        gameTick = key.tick;
+        lastDropTime = gameTimeNs() - getBytes(p + 13, 4) * kTickNs;
+        p += 17;
+
+        RandomizerState& gen = pieceQueue.gen;
+        for (Uint32& word : gen.rng.s) {
+            word = static_cast<Uint32>(getBytes(p, 4));
+            p += 4;
+        }
+        gen.kind = static_cast<RandomizerKind>(std::min<Uint8>(p[0], static_cast<Uint8>(RandomizerKind::Count) - 1));
+        gen.bagIndex = p[1];
+        p += 2;
+        std::memcpy(gen.bag, p, sizeof(gen.bag));
+        p += sizeof(gen.bag);
+        std::memcpy(gen.history, p, sizeof(gen.history));
+        p += sizeof(gen.history);
+        gen.firstDraw = *p++;
+        std::memcpy(pieceQueue.ring, p, kMaxPreview);
+        p += kMaxPreview;
+        pieceQueue.head = static_cast<Uint8>(*p % kMaxPreview);
+        nextPickPiece = pieceQueuePeek(pieceQueue, 0);
+        nextPiece = pieceTypes[nextPickPiece];
+
+        clearingRows = false;
+        rowsToClear.clear();
+        clearAnimStep = 0;
+        return true;
+    }
+}
+
+void replayBeginRecording() {
+    if (playbackActive || botHeadless) return; // headless games skip the gameplay frames a replay steps through
+    if (recording.events.capacity() < kEventReserve) recording.events.reserve(kEventReserve);
+    if (recording.keyframeData.capacity() < kKeyframeReserve) recording.keyframeData.reserve(kKeyframeReserve);
+    recording.events.clear();
+    recording.keyframes.clear();
+    recording.keyframeData.clear();
+    eventBytesSinceKeyframe = 0;
+    lastKeyframeTick = 0;
+    lastKeyframeSize = kTypicalKeyframeSize;
+    recording.seed = gameSeed;
+    recording.randomizer = static_cast<Uint8>(randomizerKind);
+    recording.maxLevel = maxLevelAchieved;
+    recordingActive = true;
+}
+
+void replayRecordAction(Uint8 action) {
+    if (!recordingActive) return;
+    const Uint32 tick = static_cast<Uint32>(gameTick);
+    eventBytesSinceKeyframe += lebSize(tick - (recording.events.empty() ? 0 : recording.events.back().tick)) + 1;
+    recording.events.push_back(ReplayEvent{ tick, action });
+}
+
+void replayTickEnded() {
+    if (!recordingActive || clearingRows) return;
+    const Uint32 tick = static_cast<Uint32>(gameTick);
+    const Uint32 sinceKeyframe = tick - lastKeyframeTick;
+    if (sinceKeyframe < kKeyframeMinTicks) return;
+    if (sinceKeyframe < kKeyframeMaxTicks && eventBytesSinceKeyframe < kKeyframeBudget * lastKeyframeSize) return;
+
+    const size_t offset = recording.keyframeData.size();
+    writeSnapshot(recording.keyframeData);
+    lastKeyframeSize = static_cast<Uint32>(recording.keyframeData.size() - offset);
+    recording.keyframes.push_back(ReplayKeyframe{ tick, static_cast<Uint32>(recording.events.size()),
+                                                  static_cast<Uint32>(offset), static_cast<Uint16>(lastKeyframeSize) });
+    lastKeyframeTick = tick;
+    eventBytesSinceKeyframe = 0;
+}
+
+void replayFinishRecording(Uint32 ticks) {
+    if (!recordingActive) return;
+    recordingActive = false;
+    recording.ticks = ticks;
+    ALLOC_SCOPE(Save);
+    TRACE_SCOPE("saveReplay");
+    if (!saveReplay(kLastGamePath, recording)) LOG_WARN("Could not write %s", kLastGamePath);
+}
+
+void replayDiscardRecording() {
+    recordingActive = false;
+}
+
+void replayCaptureSnapshot(std::vector<Uint8>& out) {
+    writeSnapshot(out);
+}
+
+Uint32 replayStateHash() {
+    // FNV-1a
+    Uint32 h = 2166136261u;
+    auto mix = [&h](Uint32 v) {
+        for (int i = 0; i < 4; ++i) {
+            h = (h ^ (v & 0xFF)) * 16777619u;
+            v >>= 8;
+        }
+    };
+    for (int x = 0; x < boardWidth; ++x) {
+        for (int y = 0; y < boardHeight; ++y) h = (h ^ static_cast<Uint8>(board.current[x][y])) * 16777619u;
+    }
+    mix(static_cast<Uint32>(currentPiece.type) | (static_cast<Uint32>(currentPiece.rotation) << 8) |
+        (static_cast<Uint32>(currentPiece.x & 0xFF) << 16) | (static_cast<Uint32>(currentPiece.y & 0xFF) << 24));
+    for (Uint32 word : pieceQueue.gen.rng.s) mix(word);
+    return h;
+}
+
+void encodeReplay(const Replay& replay, std::vector<Uint8>& out) {
+    out.clear();
+    out.insert(out.end(), kMagic, kMagic + 4);
+    putBytes(out, kReplayVersion, 2);
+    out.push_back(replay.randomizer);
+    out.push_back(static_cast<Uint8>(replay.flags & ~kReplayHasHashes) | (replay.tickHashes.empty() ? 0 : kReplayHasHashes));
+    putBytes(out, replay.seed, 8);
+    putBytes(out, replay.ticks, 4);
+    putBytes(out, replay.events.size(), 4);
+    putBytes(out, static_cast<Uint32>(replay.maxLevel), 4);
+    putBytes(out, replay.keyframes.size(), 4);
+    putBytes(out, 0, 4); // event bytes, filled in below
+
+    Uint32 lastTick = 0;
+    for (const ReplayEvent& e : replay.events) {
+        Uint32 delta = e.tick - lastTick;
+        lastTick = e.tick;
+        do {
+            const Uint8 low = delta & 0x7F;
+            delta >>= 7;
+            out.push_back(delta ? (low | 0x80) : low);
+        } while (delta);
+        out.push_back(e.action);
+    }
+    const size_t eventBytes = out.size() - kHeaderSize;
+    for (int i = 0; i < 4; ++i) out[32 + i] = static_cast<Uint8>(eventBytes >> (8 * i));
+
+    for (const ReplayKeyframe& k : replay.keyframes) {
+        putBytes(out, k.tick, 4);
+        putBytes(out, k.eventIndex, 4);
+        putBytes(out, k.size, 2);
+        out.insert(out.end(), replay.keyframeData.begin() + k.offset, replay.keyframeData.begin() + k.offset + k.size);
+    }
+
+    if (!replay.tickHashes.empty()) {
+        putBytes(out, replay.hashStartTick, 4);
+        putBytes(out, replay.tickHashes.size(), 4);
+        for (Uint32 h : replay.tickHashes) putBytes(out, h, 4);
+    }
+}
+
+bool saveReplay(const char* path, const Replay& replay) {
+    std::vector<Uint8> out;
+    out.reserve(kHeaderSize + replay.events.size() * 2 + replay.keyframes.size() * kKeyframeHeaderSize +
+                replay.keyframeData.size() + replay.tickHashes.size() * 4 + 8);
+    encodeReplay(replay, out);
+    if (!replay.keyframes.empty()) {
+        const size_t eventBytes = static_cast<size_t>(getBytes(out.data() + 32, 4));
+        LOG_DEBUG("Replay %s: %zu events in %zu bytes, %zu keyframes in %zu bytes (%.1f%%)", path,
+                  replay.events.size(), eventBytes, replay.keyframes.size(), out.size() - kHeaderSize - eventBytes,
+                  100.0 * (out.size() - kHeaderSize - eventBytes) / out.size());
+    }
+
+    std::FILE* f = std::fopen(path, "wb");
+    if (!f) return false;
+    const bool ok = std::fwrite(out.data(), 1, out.size(), f) == out.size();
+    return std::fclose(f) == 0 && ok;
+}
+
+bool loadReplay(const char* path, Replay& replay) {
+    std::FILE* f = std::fopen(path, "rb");
+    if (!f) {
+        LOG_ERROR("Could not open replay %s", path);
+        return false;
+    }
+    std::vector<Uint8> data;
+    Uint8 chunk[4096];
+    for (size_t n; (n = std::fread(chunk, 1, sizeof(chunk), f)) > 0;) data.insert(data.end(), chunk, chunk + n);
+    std::fclose(f);
+
+    const Uint64 version = data.size() >= kHeaderSizeV1 ? getBytes(data.data() + 4, 2) : 0;
+    if (data.size() < kHeaderSizeV1 || std::memcmp(data.data(), kMagic, 4) != 0 ||
+        version < 1 || version > kReplayVersion || (version >= 2 && data.size() < kHeaderSize)) {
+        LOG_ERROR("%s is not a version 1-%d replay", path, kReplayVersion);
+        return false;
+    }
+    replay.randomizer = data[6] < static_cast<Uint8>(RandomizerKind::Count) ? data[6] : 0;
+    replay.flags = version >= 2 ? data[7] : 0;
+    replay.seed = getBytes(data.data() + 8, 8);
+    replay.ticks = static_cast<Uint32>(getBytes(data.data() + 16, 4));
+    const Uint32 count = static_cast<Uint32>(getBytes(data.data() + 20, 4));
+    replay.maxLevel = static_cast<int>(getBytes(data.data() + 24, 4));
+
+    if (count > data.size()) {
+        LOG_ERROR("Replay %s is truncated", path);
+        return false;
+    }
+    const Uint32 keyframeCount = version >= 2 ? static_cast<Uint32>(getBytes(data.data() + 28, 4)) : 0;
+    replay.events.clear();
+    replay.events.reserve(count);
+    replay.keyframes.clear();
+    replay.keyframeData.clear();
+    replay.tickHashes.clear();
+    replay.hashStartTick = 0;
+    size_t pos = version >= 2 ? kHeaderSize : kHeaderSizeV1;
+    Uint32 tick = 0;
+    for (Uint32 i = 0; i < count; ++i) {
+        Uint32 delta = 0;
+        for (int shift = 0;; shift += 7) {
+            if (pos >= data.size() || shift > 28) {
+                LOG_ERROR("Replay %s is truncated", path);
+                return false;
+            }
+            const Uint8 b = data[pos++];
+            delta |= static_cast<Uint32>(b & 0x7F) << shift;
+            if (!(b & 0x80)) break;
+        }
+        if (pos >= data.size()) {
+            LOG_ERROR("Replay %s is truncated", path);
+            return false;
+        }
+        tick += delta;
+        replay.events.push_back(ReplayEvent{ tick, data[pos++] });
+    }
+
+    // A damaged keyframe section only costs seek speed, so it is not an error
+    for (Uint32 i = 0; i < keyframeCount; ++i) {
+        if (pos + kKeyframeHeaderSize > data.size()) break;
+        ReplayKeyframe k;
+        k.tick = static_cast<Uint32>(getBytes(data.data() + pos, 4));
+        k.eventIndex = static_cast<Uint32>(getBytes(data.data() + pos + 4, 4));
+        k.size = static_cast<Uint16>(getBytes(data.data() + pos + 8, 2));
+        pos += kKeyframeHeaderSize;
+        if (pos + k.size > data.size() || k.eventIndex > count ||
+            (!replay.keyframes.empty() && k.tick <= replay.keyframes.back().tick)) {
+            LOG_WARN("Replay %s: ignoring keyframes from %u on", path, i);
+            break;
+        }
+        k.offset = static_cast<Uint32>(replay.keyframeData.size());
+        replay.keyframeData.insert(replay.keyframeData.end(), data.begin() + pos, data.begin() + pos + k.size);
+        replay.keyframes.push_back(k);
+        pos += k.size;
+    }
+
+    if (replay.flags & kReplayPartial) {
+        if (replay.keyframes.empty() || replay.keyframes.front().eventIndex != 0) {
+            LOG_ERROR("Replay %s has no starting keyframe", path);
+            return false;
+        }
+        replay.startTick = replay.keyframes.front().tick;
+    } else {
+        replay.startTick = 0;
+    }
+
+    if ((replay.flags & kReplayHasHashes) && pos + 8 <= data.size()) {
+        replay.hashStartTick = static_cast<Uint32>(getBytes(data.data() + pos, 4));
+        const Uint32 hashCount = static_cast<Uint32>(getBytes(data.data() + pos + 4, 4));
+        pos += 8;
+        if (hashCount <= (data.size() - pos) / 4) {
+            replay.tickHashes.resize(hashCount);
+            for (Uint32 i = 0; i < hashCount; ++i) replay.tickHashes[i] = static_cast<Uint32>(getBytes(data.data() + pos + 4 * i, 4));
+        }
+    }
+    return true;
+}
+
+void replayBeginPlayback(const Replay& replay) {
+    recordingActive = false;
+    playbackActive = true;
+    fixedSeedEnabled = true;
+    fixedSeed = replay.seed;
+    randomizerKind = static_cast<RandomizerKind>(replay.randomizer);
+    maxLevelAchieved = replay.maxLevel;
+}
+
+bool replayPlaybackActive() {
+    return playbackActive;
+}
+
+bool replayOpenPlayback(const char* path) {
+    if (!loadReplay(path, playback)) return false;
+    replayBeginPlayback(playback);
+    resetGameplayStateForNewGame();
+    nextEvent = 0;
+    divergenceReported = false;
+    if ((playback.flags & kReplayPartial) && !readSnapshot(playback.keyframes.front(), playback.keyframeData)) {
+        LOG_ERROR("Replay %s: the starting keyframe is damaged", path);
+        return false;
+    }
+    return true;
+}
+
+const Replay& playbackReplay() {
+    return playback;
+}
+
+void replayApplyTickEvents() {
+    const Uint64 hashIndex = gameTick - playback.hashStartTick;
+    if (!divergenceReported && gameTick >= playback.hashStartTick && hashIndex < playback.tickHashes.size() &&
+        playback.tickHashes[hashIndex] != replayStateHash()) {
+        LOG_WARN("Replay diverges from the recording at tick %llu", static_cast<unsigned long long>(gameTick));
+        divergenceReported = true;
+    }
+    while (nextEvent < playback.events.size() && playback.events[nextEvent].tick <= gameTick) {
+        applyInputAction(static_cast<InputAction>(playback.events[nextEvent++].action));
+    }
+}
+
+void replaySeek(Uint32 tick) {
+    tick = std::clamp(tick, playback.startTick, playback.ticks);
+    seeking = true;
+
+    // Restart from the nearest keyframe unless simulating on from here is shorter
+    auto after = std::upper_bound(playback.keyframes.begin(), playback.keyframes.end(), tick,
+                                  [](Uint32 t, const ReplayKeyframe& k) { return t < k.tick; });
+    const ReplayKeyframe* from = after == playback.keyframes.begin() ? nullptr : &*(after - 1);
+    if (tick < gameTick || (from && from->tick > gameTick)) {
+        if (from && readSnapshot(*from, playback.keyframeData)) {
+            nextEvent = from->eventIndex;
+        } else {
+            resetGameplayStateForNewGame();
+            nextEvent = 0;
+        }
+    }
+    while (gameTick < tick) {
+        replayApplyTickEvents();
+        if (!simulateGameplayTick()) break; // the game ended early; the replay does not match this build
+    }
+
+    seeking = false;
+    particles.clear();
+    score.loadFromRenderedText(std::to_string(scoreValue), { 0xFF, 0xFF, 0xFF, 0xFF });
+}
+
+bool replaySeeking() {
+    return seeking;
+}
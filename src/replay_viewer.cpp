@@ -0,0 +1,167 @@
+#include "replay_viewer.h"
+#include "replay.h"
+#include "globals.h"
+#include "tetris_utils.h"
+#include "frame_arena.h"
+#include "log.h"
+#include <algorithm>
+
+const char* replayViewerPath = nullptr;
+
+namespace {
+    constexpr float kTimelineMargin = 8.0f;
+    constexpr float kTimelineHeight = 12.0f;
+    constexpr float kTimelineGrab = 12.0f; // extra height above and below that still grabs the bar
+    constexpr Uint32 kSkipTicks = 5 * kScreenFps;
+
+    bool viewerActive = false;
+    bool viewerPaused = false;
+    bool scrubbing = false;
+    Uint32 shownTick = 0; // the frame on screen; gameTick is one past it
+    Uint32 firstTick = 0; // where the replay starts; later than 0 for flight recorder dumps
+    Uint32 lastTick = 0;  // the last frame before the game over tick
+
+    int seekCount = 0;
+    Uint64 seekNs = 0;
+    Uint64 worstSeekNs = 0;
+
+    SDL_FRect timelineRect() {
+        return { kTimelineMargin, kScreenHeight - kTimelineMargin - kTimelineHeight,
+                 kScreenWidth - 2 * kTimelineMargin, kTimelineHeight };
+    }
+
+    bool onTimeline(float x, float y) {
+        const SDL_FRect bar = timelineRect();
+        return x >= bar.x && x <= bar.x + bar.w && y >= bar.y - kTimelineGrab && y <= bar.y + bar.h + kTimelineGrab;
+    }
+
+    Uint32 tickAt(float x) {
+        const SDL_FRect bar = timelineRect();
+        const float t = std::clamp((x - bar.x) / bar.w, 0.0f, 1.0f);
+        return firstTick + static_cast<Uint32>(t * (lastTick - firstTick) + 0.5f);
+    }
+
+    // Seek to the start of tick, then play it: its actions, drawing, and the step to tick + 1
+    void showFrame(Uint32 tick) {
+        shownTick = std::clamp(tick, firstTick, lastTick);
+        if (gameTick != shownTick) {
+            const Uint64 start = SDL_GetTicksNS();
+            replaySeek(shownTick);
+            const Uint64 elapsed = SDL_GetTicksNS() - start;
+            seekCount++;
+            seekNs += elapsed;
+            worstSeekNs = std::max(worstSeekNs, elapsed);
+        }
+        replayApplyTickEvents();
+        runGameplayFrame();
+    }
+}
+
+int runReplayViewer() {
+    if (!replayOpenPlayback(replayViewerPath)) return 1;
+    const Replay& replay = playbackReplay();
+    if (replay.ticks <= replay.startTick) {
+        LOG_ERROR("Replay %s is empty", replayViewerPath);
+        return 1;
+    }
+    firstTick = replay.startTick;
+    lastTick = replay.ticks - 1;
+    LOG_INFO("Replay %s: %u ticks (%.1fs), %zu events, %zu keyframes", replayViewerPath, replay.ticks,
+             replay.ticks / static_cast<double>(kScreenFps), replay.events.size(), replay.keyframes.size());
+
+    viewerActive = true;
+    currentState = GameState::PLAYING;
+    showFrame(firstTick);
+
+    bool quit = false;
+    while (!quit) {
+        frameArena().reset();
+        if (viewerPaused && !scrubbing) SDL_WaitEventTimeout(nullptr, 100); // nothing moves until an event arrives
+
+        Uint32 target = shownTick;
+        bool jump = false;
+        SDL_Event e;
+        while (SDL_PollEvent(&e)) {
+            SDL_ConvertEventToRenderCoordinates(gRenderer, &e);
+            if (e.type == SDL_EVENT_QUIT) {
+                quit = true;
+            } else if (e.type == SDL_EVENT_KEY_DOWN) {
+                const bool shift = (e.key.mod & SDL_KMOD_SHIFT) != 0;
+                const Uint32 step = shift ? kSkipTicks : 1;
+                switch (e.key.key) {
+                    case SDLK_ESCAPE: quit = true; break;
+                    case SDLK_SPACE:
+                        viewerPaused = !viewerPaused;
+                        if (!viewerPaused && shownTick >= lastTick) { target = firstTick; jump = true; } // play again from the start
+                        break;
+                    case SDLK_RIGHT: viewerPaused = true; target = std::min(target + step, lastTick); jump = true; break;
+                    case SDLK_LEFT: viewerPaused = true; target = target > firstTick + step ? target - step : firstTick; jump = true; break;
+                    case SDLK_PAGEDOWN: target = std::min(target + kSkipTicks, lastTick); jump = true; break;
+                    case SDLK_PAGEUP: target = target > firstTick + kSkipTicks ? target - kSkipTicks : firstTick; jump = true; break;
+                    case SDLK_HOME: target = firstTick; jump = true; break;
+                    case SDLK_END: viewerPaused = true; target = lastTick; jump = true; break;
+                    default: break;
+                }
+            } else if (e.type == SDL_EVENT_MOUSE_BUTTON_DOWN && e.button.button == SDL_BUTTON_LEFT &&
+                       onTimeline(e.button.x, e.button.y)) {
+                scrubbing = true;
+                target = tickAt(e.button.x);
+                jump = true;
+            } else if (e.type == SDL_EVENT_MOUSE_MOTION && scrubbing) {
+                target = tickAt(e.motion.x);
+                jump = true;
+            } else if (e.type == SDL_EVENT_MOUSE_BUTTON_UP && e.button.button == SDL_BUTTON_LEFT) {
+                scrubbing = false;
+            }
+        }
+        if (quit) break;
+
+        if (jump) {
+            if (target != shownTick) showFrame(target);
+        } else if (!viewerPaused && !scrubbing) {
+            if (shownTick < lastTick) showFrame(shownTick + 1);
+            else viewerPaused = true; // hold the last frame
+        }
+    }
+
+    viewerActive = false;
+    if (seekCount > 0) {
+        LOG_INFO("Replay seeks: %d, average %.2f ms, worst %.2f ms", seekCount,
+                 seekNs / 1e6 / seekCount, worstSeekNs / 1e6);
+    }
+    return 0;
+}
+
+void renderReplayTimeline() {
+    if (!viewerActive) return;
+
+    const SDL_FRect bar = timelineRect();
+    SDL_BlendMode oldMode;
+    SDL_GetRenderDrawBlendMode(gRenderer, &oldMode);
+    SDL_SetRenderDrawBlendMode(gRenderer, SDL_BLENDMODE_BLEND);
+
+    SDL_SetRenderDrawColor(gRenderer, 0, 0, 0, 170);
+    SDL_RenderFillRect(gRenderer, &bar);
+
+    const Uint32 span = lastTick - firstTick;
+    const float progress = span > 0 ? static_cast<float>(shownTick - firstTick) / span : 1.0f;
+    const SDL_FRect played{ bar.x, bar.y, bar.w * progress, bar.h };
+    SDL_SetRenderDrawColor(gRenderer, 120, 170, 255, 200);
+    SDL_RenderFillRect(gRenderer, &played);
+
+    // Keyframes as ticks under the bar: seeks land on the one to their left
+    SDL_SetRenderDrawColor(gRenderer, 255, 255, 255, 110);
+    for (const ReplayKeyframe& k : playbackReplay().keyframes) {
+        const float x = bar.x + bar.w * std::min(1.0f, static_cast<float>(k.tick - firstTick) / std::max<Uint32>(span, 1));
+        SDL_RenderLine(gRenderer, x, bar.y + bar.h / 2, x, bar.y + bar.h);
+    }
+
+    const float headX = bar.x + bar.w * progress;
+    const SDL_FRect head{ headX - 2.0f, bar.y - 3.0f, 4.0f, bar.h + 6.0f };
+    SDL_SetRenderDrawColor(gRenderer, 255, 255, 255, viewerPaused ? 255 : 200);
+    SDL_RenderFillRect(gRenderer, &head);
+
+    SDL_SetRenderDrawColor(gRenderer, 255, 255, 255, 200);
+    SDL_RenderRect(gRenderer, &bar);
+    SDL_SetRenderDrawBlendMode(gRenderer, oldMode);
+}
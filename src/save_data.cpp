@@ -0,0 +1,285 @@
+#include "save_data.h"
+#include "globals.h"
+#include "randomizer.h"
+#include "advisor.h"
+#include "alloc_check.h"
+#include "log.h"
+#include "trace.h"
+#include <algorithm>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <thread>
+
+#ifdef _WIN32
+#include <io.h>
+#define TETRIS_FSYNC(fd) _commit(fd)
+#else
+#include <unistd.h>
+#define TETRIS_FSYNC(fd) fsync(fd)
+#endif
+
+namespace {
+    // File layout (all little-endian):
+    //   "TSAV" | u32 version | u32 payload bytes | payload (i32 per field) | u32 crc32
+    // The crc covers everything before it. The version only changes when existing
+    // fields change meaning; new fields are appended without a bump.
+    constexpr char kSavePath[] = "tetris_save.dat";
+    constexpr char kTempPath[] = "tetris_save.dat.tmp";
+    constexpr unsigned char kMagic[4] = { 'T', 'S', 'A', 'V' };
+    constexpr Uint32 kSaveVersion = 1;
+    constexpr size_t kHeaderSize = 12;
+
+    // Pre-versioned files: bool, int, bool, then 12 ints, written unpadded in host order
+    constexpr size_t kLegacyFieldCount = 15;
+    constexpr size_t kLegacySize = 2 * sizeof(bool) + 13 * sizeof(int);
+
+    constexpr int SaveData::* kSaveFields[] = {
+        &SaveData::fullscreen,
+        &SaveData::windowSize,
+        &SaveData::gridLines,
+        &SaveData::blockGap,
+        &SaveData::placementPreview,
+        &SaveData::hardDropKey,
+        &SaveData::holdKey,
+        &SaveData::rotateClockwiseKey,
+        &SaveData::rotateCounterClockwiseKey,
+        &SaveData::hardDropButton,
+        &SaveData::holdButton,
+        &SaveData::rotateClockwiseButton,
+        &SaveData::rotateCounterClockwiseButton,
+        &SaveData::highScore,
+        &SaveData::maxLevel,
+        &SaveData::randomizer,
+        &SaveData::previewDepth,
+        &SaveData::placementHint,
+    };
+    constexpr size_t kFieldCount = SDL_arraysize(kSaveFields);
+    constexpr size_t kFileSize = kHeaderSize + kFieldCount * 4 + 4;
+
+    // In-memory copy of what is (or is about to be) on disk; authoritative after startup
+    SaveData persisted;
+
+    std::mutex saveMutex;
+    std::condition_variable saveCv;
+    std::thread saveThread;
+    SaveData pendingSave;
+    bool savePending = false;
+    bool saveStopping = false;
+
+    void putU32(unsigned char* p, Uint32 v) {
+        p[0] = static_cast<unsigned char>(v);
+        p[1] = static_cast<unsigned char>(v >> 8);
+        p[2] = static_cast<unsigned char>(v >> 16);
+        p[3] = static_cast<unsigned char>(v >> 24);
+    }
+
+    Uint32 getU32(const unsigned char* p) {
+        return static_cast<Uint32>(p[0]) | (static_cast<Uint32>(p[1]) << 8) |
+               (static_cast<Uint32>(p[2]) << 16) | (static_cast<Uint32>(p[3]) << 24);
+    }
+
+    void serialize(const SaveData& data, unsigned char (&out)[kFileSize]) {
+        std::memcpy(out, kMagic, 4);
+        putU32(out + 4, kSaveVersion);
+        putU32(out + 8, static_cast<Uint32>(kFieldCount * 4));
+        unsigned char* p = out + kHeaderSize;
+        for (auto field : kSaveFields) {
+            putU32(p, static_cast<Uint32>(data.*field));
+            p += 4;
+        }
+        putU32(p, SDL_crc32(0, out, kFileSize - 4));
+    }
+
+    bool parseVersioned(const unsigned char* bytes, size_t size, SaveData& out) {
+        if (size < kHeaderSize + 4 || std::memcmp(bytes, kMagic, 4) != 0) return false;
+        const Uint32 version = getU32(bytes + 4);
+        const Uint32 payloadSize = getU32(bytes + 8);
+        if (payloadSize % 4 != 0 || kHeaderSize + payloadSize + 4 != size) {
+            LOG_WARN("Save file has a bad length, ignoring it");
+            return false;
+        }
+        if (SDL_crc32(0, bytes, size - 4) != getU32(bytes + size - 4)) {
+            LOG_WARN("Save file checksum mismatch, ignoring it");
+            return false;
+        }
+        if (version != kSaveVersion) {
+            LOG_WARN("Save file version %u is not supported (expected %u)", version, kSaveVersion);
+            return false;
+        }
+        const size_t count = std::min<size_t>(payloadSize / 4, kFieldCount);
+        for (size_t i = 0; i < count; ++i) {
+            out.*kSaveFields[i] = static_cast<int>(getU32(bytes + kHeaderSize + i * 4));
+        }
+        return true;
+    }
+
+    void parseLegacy(const unsigned char* bytes, SaveData& out) {
+        bool b = false;
+        size_t offset = 0;
+        for (size_t i = 0; i < kLegacyFieldCount; ++i) {
+            // Fields 0 and 2 (fullscreen, grid lines) were written as bool
+            if (i == 0 || i == 2) {
+                std::memcpy(&b, bytes + offset, sizeof(b));
+                out.*kSaveFields[i] = b ? 1 : 0;
+                offset += sizeof(b);
+            } else {
+                std::memcpy(&(out.*kSaveFields[i]), bytes + offset, sizeof(int));
+                offset += sizeof(int);
+            }
+        }
+    }
+
+    void applyToGlobals(const SaveData& data) {
+        fullscreenEnabled = data.fullscreen != 0;
+        WindowSizeMenuSelection = data.windowSize;
+        gridLinesEnabled = data.gridLines != 0;
+        blockGapSelection = std::clamp(data.blockGap, 0, static_cast<int>(SDL_arraysize(blockGapValues)) - 1);
+        placementPreviewSelection = data.placementPreview;
+        hardDropKey = static_cast<SDL_Keycode>(data.hardDropKey);
+        holdKey = static_cast<SDL_Keycode>(data.holdKey);
+        rotateClockwiseKey = static_cast<SDL_Keycode>(data.rotateClockwiseKey);
+        rotateCounterClockwiseKey = static_cast<SDL_Keycode>(data.rotateCounterClockwiseKey);
+        hardDropControllerBind = static_cast<SDL_GamepadButton>(data.hardDropButton);
+        holdControllerBind = static_cast<SDL_GamepadButton>(data.holdButton);
+        rotateClockwiseControllerBind = static_cast<SDL_GamepadButton>(data.rotateClockwiseButton);
+        rotateCounterClockwiseControllerBind = static_cast<SDL_GamepadButton>(data.rotateCounterClockwiseButton);
+        spacing = blockGapValues[blockGapSelection];
+        if (data.randomizer >= 0 && data.randomizer < static_cast<int>(RandomizerKind::Count)) {
+            randomizerKind = static_cast<RandomizerKind>(data.randomizer);
+        }
+        previewDepth = std::clamp(data.previewDepth, 1, kMaxPreview);
+        placementHintEnabled = data.placementHint != 0;
+        if (data.highScore > highScoreValue) highScoreValue = data.highScore;
+        if (data.maxLevel > maxLevelAchieved) maxLevelAchieved = data.maxLevel;
+    }
+
+    SaveData captureFromGlobals() {
+        SaveData data;
+        data.fullscreen = fullscreenEnabled ? 1 : 0;
+        data.windowSize = WindowSizeMenuSelection;
+        data.gridLines = gridLinesEnabled ? 1 : 0;
+        data.blockGap = blockGapSelection;
+        data.placementPreview = placementPreviewSelection;
+        data.hardDropKey = static_cast<int>(hardDropKey);
+        data.holdKey = static_cast<int>(holdKey);
+        data.rotateClockwiseKey = static_cast<int>(rotateClockwiseKey);
+        data.rotateCounterClockwiseKey = static_cast<int>(rotateCounterClockwiseKey);
+        data.hardDropButton = static_cast<int>(hardDropControllerBind);
+        data.holdButton = static_cast<int>(holdControllerBind);
+        data.rotateClockwiseButton = static_cast<int>(rotateClockwiseControllerBind);
+        data.rotateCounterClockwiseButton = static_cast<int>(rotateCounterClockwiseControllerBind);
+        data.randomizer = static_cast<int>(randomizerKind);
+        data.previewDepth = previewDepth;
+        data.placementHint = placementHintEnabled ? 1 : 0;
+        data.highScore = std::max(highScoreValue, persisted.highScore);
+        data.maxLevel = std::max({ levelValue, maxLevelAchieved, persisted.maxLevel });
+        return data;
+    }
+
+    // Write to a temp file, force it to disk, then rename over the real file so a
+    // crash at any point leaves either the old or the new save intact
+    bool writeAtomically(const SaveData& data) {
+        unsigned char bytes[kFileSize];
+        serialize(data, bytes);
+
+        FILE* f = std::fopen(kTempPath, "wb");
+        if (!f) {
+            LOG_ERROR("Failed to open %s for writing.", kTempPath);
+            return false;
+        }
+        bool ok = std::fwrite(bytes, 1, sizeof(bytes), f) == sizeof(bytes);
+        ok = ok && std::fflush(f) == 0 && TETRIS_FSYNC(fileno(f)) == 0;
+        if (std::fclose(f) != 0) ok = false;
+        if (!ok) {
+            LOG_ERROR("Failed to write %s", kTempPath);
+            SDL_RemovePath(kTempPath);
+            return false;
+        }
+        if (!SDL_RenamePath(kTempPath, kSavePath)) {
+            LOG_ERROR("Failed to replace %s: %s", kSavePath, SDL_GetError());
+            return false;
+        }
+        LOG_INFO("Saved data: High Score=%d, Max Level=%d", data.highScore, data.maxLevel);
+        return true;
+    }
+
+    void saveThreadMain() {
+        ALLOC_SCOPE(Save);
+        traceSetThreadName("save");
+        std::unique_lock<std::mutex> lock(saveMutex);
+        for (;;) {
+            saveCv.wait(lock, [] { return savePending || saveStopping; });
+            if (savePending) {
+                SaveData data = pendingSave;
+                savePending = false;
+                lock.unlock();
+                {
+                    TRACE_SCOPE("save write");
+                    writeAtomically(data);
+                }
+                lock.lock();
+                continue;
+            }
+            return; // stopping and nothing left to write
+        }
+    }
+
+    void queueWrite(const SaveData& data) {
+        {
+            std::lock_guard<std::mutex> lock(saveMutex);
+            if (saveStopping) {
+                // Shutting down: no thread left to hand it to
+                writeAtomically(data);
+                return;
+            }
+            pendingSave = data; // overwrites any write that has not started yet
+            savePending = true;
+            if (!saveThread.joinable()) saveThread = std::thread(saveThreadMain);
+        }
+        saveCv.notify_one();
+    }
+}
+
+void readSaveData() {
+    size_t size = 0;
+    void* raw = SDL_LoadFile(kSavePath, &size);
+    if (!raw) return; // first run
+
+    const unsigned char* bytes = static_cast<const unsigned char*>(raw);
+    SaveData loaded;
+    bool migrate = false;
+    bool ok = parseVersioned(bytes, size, loaded);
+    if (!ok && size == kLegacySize && std::memcmp(bytes, kMagic, 4) != 0) {
+        parseLegacy(bytes, loaded);
+        ok = true;
+        migrate = true;
+        LOG_INFO("Migrating legacy save file to version %u", kSaveVersion);
+    }
+    SDL_free(raw);
+    if (!ok) return;
+
+    persisted = loaded;
+    applyToGlobals(loaded);
+    LOG_INFO("Loaded save data: High Score=%d, Max Level=%d", highScoreValue, maxLevelAchieved);
+    if (migrate) queueWrite(persisted);
+}
+
+void writeSaveData() {
+    ALLOC_SCOPE(Save);
+    TRACE_SCOPE("writeSaveData");
+    SaveData data = captureFromGlobals();
+    if (std::memcmp(&data, &persisted, sizeof(SaveData)) == 0) return; // nothing changed
+    persisted = data;
+    queueWrite(data);
+}
+
+void flushSaveData() {
+    {
+        std::lock_guard<std::mutex> lock(saveMutex);
+        saveStopping = true;
+    }
+    saveCv.notify_one();
+    if (saveThread.joinable()) saveThread.join();
+}
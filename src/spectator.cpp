@@ -0,0 +1,472 @@
+#include "spectator.h"
+#include "game_snapshot.h"
+#include "row_board.h"
+#include "globals.h"
+#include "tetris_utils.h"
+#include "replay.h"
+#include "frame_arena.h"
+#include "palette.h"
+#include "board_grid.h"
+#include "trace.h"
+#include "log.h"
+#include <algorithm>
+#include <climits>
+#include <cstring>
+
+int spectatorBoards = 0;
+std::vector<const char*> spectatorReplays;
+
+namespace {
+    constexpr int kSideCells = 4;         // NEXT and HOLD at half size to the right of each well
+    constexpr float kMargin = 4.0f;
+    constexpr float kLabelHeight = 10.0f; // HUD text above each well
+    constexpr BoardGridSpacing kGridSpacing{ kSideCells, kMargin, kLabelHeight };
+    constexpr int kBotMoveTicks = 4;      // a bot presses one key this often
+    constexpr int kRestartTicks = 3 * kScreenFps; // the final board stays up this long
+    constexpr char kFirstGlyph = ' ';
+    constexpr char kLastGlyph = '~';
+    constexpr int kGlyphCount = kLastGlyph - kFirstGlyph + 1;
+    constexpr int kAtlasWidth = 512;
+
+    struct GlyphAtlas {
+        SDL_Texture* texture = nullptr;
+        float width = 0;
+        float height = 0;
+        float lineHeight = 0;
+        SDL_FRect glyphs[kGlyphCount] = {}; // source rects in pixels
+    };
+
+    // One slot of the grid
+    struct Game {
+        GameSnapshot state;
+        GameSnapshot start; // replays: the state they start over from
+        const Replay* replay = nullptr; // null for a bot game
+        int maxLevel = 0;               // the level select limit it was played with; IncreaseLevel depends on it
+        char name[32] = "";
+        size_t nextEvent = 0;
+        bool over = false;
+        int overTicks = 0;
+        int gamesPlayed = 0;
+
+        // Bot games: where the current piece goes
+        int plannedFor = -1; // state.pieces when the plan was made
+        int targetRotation = 0;
+        int targetX = 0;
+        int lastX = 0;       // where the piece was at the last key, to spot a blocked move
+        int lastRotation = 0;
+        int moveCooldown = 0;
+
+        // What was last drawn, and the vertices it was drawn with
+        bool dirty = true;
+        GameSnapshot shown;
+        std::vector<SDL_Vertex> cells;
+        std::vector<SDL_Vertex> text;
+    };
+
+    bool active = false;
+    bool gridPaused = false;
+    int gameCount = 0;
+    Game games[kSpectatorMaxBoards];
+    std::vector<Replay> replays; // never resized once games point into it
+    GlyphAtlas atlas;
+    Uint64 botSeed = 0;
+
+    // Every board's vertices back to back, rebuilt when any board changed
+    std::vector<SDL_Vertex> cellVertices;
+    std::vector<SDL_Vertex> textVertices;
+    std::vector<int> quadIndices; // 0 1 2 2 3 0 for every quad, shared by both layers
+    std::vector<SDL_FRect> wells; // laid out once
+
+    GridFrameStats stats;
+    Uint64 rebuilds = 0;
+
+    SDL_FColor cellColor(int color, float shade) {
+        const SDL_Color c = colorFromValue(color);
+        return { c.r / 255.0f * shade, c.g / 255.0f * shade, c.b / 255.0f * shade, 1.0f };
+    }
+
+    // Printable ASCII in rows, white on transparent so vertex colors tint it
+    bool buildGlyphAtlas() {
+        if (!gFont) return false;
+        SDL_Surface* rendered[kGlyphCount] = {};
+        int x = 0, y = 0, rowHeight = 0;
+        for (int i = 0; i < kGlyphCount; ++i) {
+            const char c = static_cast<char>(kFirstGlyph + i);
+            rendered[i] = TTF_RenderText_Blended(gFont, &c, 1, { 0xFF, 0xFF, 0xFF, 0xFF });
+            int w = 0, h = 0;
+            if (rendered[i]) { w = rendered[i]->w; h = rendered[i]->h; }
+            else TTF_GetStringSize(gFont, &c, 1, &w, &h);
+            if (x + w + 1 > kAtlasWidth) { x = 0; y += rowHeight + 1; rowHeight = 0; }
+            atlas.glyphs[i] = { static_cast<float>(x), static_cast<float>(y), static_cast<float>(w), static_cast<float>(h) };
+            atlas.lineHeight = std::max(atlas.lineHeight, static_cast<float>(h));
+            rowHeight = std::max(rowHeight, h);
+            x += w + 1;
+        }
+        SDL_Surface* sheet = SDL_CreateSurface(kAtlasWidth, y + rowHeight, SDL_PIXELFORMAT_RGBA32);
+        for (int i = 0; i < kGlyphCount; ++i) {
+            if (!rendered[i]) continue;
+            if (sheet) {
+                const SDL_FRect& g = atlas.glyphs[i];
+                SDL_Rect to{ static_cast<int>(g.x), static_cast<int>(g.y), static_cast<int>(g.w), static_cast<int>(g.h) };
+                SDL_SetSurfaceBlendMode(rendered[i], SDL_BLENDMODE_NONE); // copy the alpha, not blend it onto nothing
+                SDL_BlitSurface(rendered[i], nullptr, sheet, &to);
+            }
+            SDL_DestroySurface(rendered[i]);
+        }
+        if (!sheet) return false;
+        atlas.width = static_cast<float>(sheet->w);
+        atlas.height = static_cast<float>(sheet->h);
+        atlas.texture = SDL_CreateTextureFromSurface(gRenderer, sheet);
+        SDL_DestroySurface(sheet);
+        if (!atlas.texture) return false;
+        SDL_SetTextureScaleMode(atlas.texture, SDL_SCALEMODE_LINEAR); // drawn well below the font's size
+        return true;
+    }
+
+    void pushQuad(std::vector<SDL_Vertex>& out, const SDL_FRect& r, SDL_FColor color, const SDL_FRect& uv) {
+        out.push_back({ { r.x, r.y }, color, { uv.x, uv.y } });
+        out.push_back({ { r.x + r.w, r.y }, color, { uv.x + uv.w, uv.y } });
+        out.push_back({ { r.x + r.w, r.y + r.h }, color, { uv.x + uv.w, uv.y + uv.h } });
+        out.push_back({ { r.x, r.y + r.h }, color, { uv.x, uv.y + uv.h } });
+    }
+
+    // Text from the atlas at the given height, cut off at maxWidth; returns the width used
+    float pushText(std::vector<SDL_Vertex>& out, const char* s, float x, float y, float height, SDL_FColor color,
+                   float maxWidth) {
+        if (!atlas.texture || atlas.lineHeight <= 0) return 0;
+        const float scale = height / atlas.lineHeight;
+        float pen = 0;
+        for (; *s; ++s) {
+            const char c = *s >= kFirstGlyph && *s <= kLastGlyph ? *s : '?';
+            const SDL_FRect& g = atlas.glyphs[c - kFirstGlyph];
+            if (pen + g.w * scale > maxWidth) break;
+            if (c != ' ') {
+                pushQuad(out, { x + pen, y, g.w * scale, g.h * scale }, color,
+                         { g.x / atlas.width, g.y / atlas.height, g.w / atlas.width, g.h / atlas.height });
+            }
+            pen += g.w * scale;
+        }
+        return pen;
+    }
+
+    BoardLayout layoutOf(int index) {
+        return boardGridLayout(index, gameCount, kGridSpacing);
+    }
+
+    // True if the board would be drawn differently: timers and lock delay are not drawn
+    bool drawnChanged(const Game& g) {
+        const GameSnapshot& a = g.state;
+        const GameSnapshot& b = g.shown;
+        auto samePiece = [](const Piece& p, const Piece& q) {
+            return p.type == q.type && p.rotation == q.rotation && p.x == q.x && p.y == q.y && p.isEmpty() == q.isEmpty();
+        };
+        return std::memcmp(a.board.current, b.board.current, sizeof(a.board.current)) != 0 ||
+               !samePiece(a.current, b.current) || !samePiece(a.next, b.next) || !samePiece(a.hold, b.hold) ||
+               a.score != b.score || a.lines != b.lines || a.clearingRows != b.clearingRows;
+    }
+
+    void pushPieceCells(std::vector<SDL_Vertex>& out, const Piece& piece, float x, float y, float cell, SDL_FColor color) {
+        for (int sy = 0; sy < piece.height; ++sy) {
+            for (int sx = 0; sx < piece.width; ++sx) {
+                if (piece.cell(sx, sy)) pushQuad(out, { x + sx * cell + 1, y + sy * cell + 1, cell - 2, cell - 2 }, color, {});
+            }
+        }
+    }
+
+    void rebuildBoard(int index) {
+        Game& g = games[index];
+        const GameSnapshot& s = g.state;
+        const BoardLayout l = layoutOf(index);
+        const float cellSize = std::max(l.cell - 2, 1.0f);
+        g.cells.clear();
+        for (int x = 0; x < boardWidth; ++x) {
+            for (int y = 0; y < boardHeight; ++y) {
+                if (s.board.current[x][y] == 0) continue;
+                pushQuad(g.cells, { l.x + x * l.cell + 1, l.y + y * l.cell + 1, cellSize, cellSize },
+                         cellColor(s.board.current[x][y], g.over ? 0.4f : kLockedShade), {});
+            }
+        }
+        if (!g.over && !s.clearingRows) {
+            Piece ghost = s.current;
+            ghost.y = maxDrop(s.current, s.board);
+            pushPieceCells(g.cells, ghost, l.x + ghost.x * l.cell, l.y + ghost.y * l.cell, l.cell, { 0.25f, 0.25f, 0.25f, 1.0f });
+            pushPieceCells(g.cells, s.current, l.x + s.current.x * l.cell, l.y + s.current.y * l.cell, l.cell,
+                           cellColor(s.current.color, 1.0f));
+        }
+        const float side = l.x + (boardWidth + 1) * l.cell;
+        const float mini = l.cell / 2;
+        pushPieceCells(g.cells, s.next, side, l.y + l.cell, mini, cellColor(s.next.color, 1.0f));
+        if (!s.hold.isEmpty()) pushPieceCells(g.cells, s.hold, side, l.y + 5 * l.cell, mini, cellColor(s.hold.color, 1.0f));
+
+        // Name on the left of the label line, score and lines after it as space allows
+        g.text.clear();
+        const float width = (boardWidth + kSideCells) * l.cell;
+        const float textY = l.y - kLabelHeight;
+        char line[32];
+        SDL_snprintf(line, sizeof(line), " %d L%d", s.score, s.lines);
+        const SDL_FColor white{ 1.0f, 1.0f, 1.0f, 1.0f };
+        const float nameW = pushText(g.text, g.name, l.x, textY, kLabelHeight - 1, { 0.7f, 0.8f, 1.0f, 1.0f }, width / 2);
+        pushText(g.text, line, l.x + nameW, textY, kLabelHeight - 1, white, width - nameW);
+        if (g.over) {
+            pushText(g.text, "GAME OVER", l.x + 2, l.y + boardHeight * l.cell / 2, kLabelHeight, { 1.0f, 0.3f, 0.3f, 1.0f },
+                     boardWidth * l.cell);
+        }
+        g.shown = s;
+        g.dirty = false;
+        rebuilds++;
+    }
+
+    void growQuadIndices(size_t quads) {
+        for (size_t q = quadIndices.size() / 6; q < quads; ++q) {
+            const int v = static_cast<int>(q * 4);
+            quadIndices.insert(quadIndices.end(), { v, v + 1, v + 2, v + 2, v + 3, v });
+        }
+    }
+
+    // Rebuild the boards that changed; false if none did and last frame's vertices still hold
+    bool rebuildChanged() {
+        bool any = false;
+        for (int i = 0; i < gameCount; ++i) {
+            Game& g = games[i];
+            if (!g.dirty && !drawnChanged(g)) continue;
+            rebuildBoard(i);
+            any = true;
+        }
+        if (!any) return false;
+        cellVertices.clear();
+        textVertices.clear();
+        for (int i = 0; i < gameCount; ++i) {
+            cellVertices.insert(cellVertices.end(), games[i].cells.begin(), games[i].cells.end());
+            textVertices.insert(textVertices.end(), games[i].text.begin(), games[i].text.end());
+        }
+        growQuadIndices(std::max(cellVertices.size(), textVertices.size()) / 4);
+        return true;
+    }
+
+    void renderGrid() {
+        SDL_SetRenderDrawColor(gRenderer, 0, 0, 0, 255);
+        SDL_RenderClear(gRenderer);
+
+        SDL_SetRenderDrawColor(gRenderer, 255, 255, 255, 255);
+        SDL_RenderRects(gRenderer, wells.data(), static_cast<int>(wells.size()));
+        if (!cellVertices.empty()) {
+            SDL_RenderGeometry(gRenderer, nullptr, cellVertices.data(), static_cast<int>(cellVertices.size()),
+                               quadIndices.data(), static_cast<int>(cellVertices.size() / 4 * 6));
+        }
+        if (!textVertices.empty()) {
+            SDL_RenderGeometry(gRenderer, atlas.texture, textVertices.data(), static_cast<int>(textVertices.size()),
+                               quadIndices.data(), static_cast<int>(textVertices.size() / 4 * 6));
+        }
+        if (gridPaused) SDL_RenderDebugText(gRenderer, kMargin, kScreenHeight - kMargin - 8, "PAUSED (Space)");
+    }
+
+    // Drops the piece as planned, one key every kBotMoveTicks; actions go in before the tick
+    void queueBotMove(Game& g, InputActionList& actions) {
+        const GameSnapshot& s = g.state;
+        if (s.clearingRows) return;
+        if (g.plannedFor != s.pieces) {
+            Uint16 rows[boardHeight];
+            for (int y = 0; y < boardHeight; ++y) {
+                Uint16 row = 0;
+                for (int x = 0; x < boardWidth; ++x) {
+                    if (s.board.current[x][y] != 0) row = static_cast<Uint16>(row | (1u << x));
+                }
+                rows[y] = row;
+            }
+            const int type = s.current.type;
+            int best = INT_MAX;
+            for (int rot = 0; rot < kDistinctRotations[type]; ++rot) {
+                const RowShape& shape = kRowShapes.shapes[type][rot];
+                for (int col = 0; col + shape.width <= boardWidth; ++col) {
+                    if (!rowShapeFits(rows, shape, col, 0)) continue;
+                    int y = 0;
+                    while (rowShapeFits(rows, shape, col, y + 1)) ++y;
+                    Uint16 after[boardHeight];
+                    std::memcpy(after, rows, sizeof(after));
+                    const int lines = lockRowShape(after, shape, col, y);
+                    const int cost = rowBoardCost(after) - kLinesWeight * lines;
+                    if (cost < best) { best = cost; g.targetRotation = rot; g.targetX = col; }
+                }
+            }
+            g.plannedFor = s.pieces;
+            g.lastX = -1;
+            g.moveCooldown = kBotMoveTicks;
+        }
+        if (--g.moveCooldown > 0) return;
+        g.moveCooldown = kBotMoveTicks;
+        const Piece& p = s.current;
+        const bool blocked = p.x == g.lastX && p.rotation == g.lastRotation; // the last key did nothing
+        g.lastX = p.x;
+        g.lastRotation = p.rotation;
+        if (blocked) actions.push_back(InputAction::HardDrop); // drop where it is
+        else if (p.rotation != g.targetRotation) {
+            actions.push_back(g.targetRotation == (p.rotation + 3) % 4 ? InputAction::RotateCounterClockwise
+                                                                       : InputAction::RotateClockwise);
+        }
+        else if (p.x > g.targetX) actions.push_back(InputAction::MoveLeft);
+        else if (p.x < g.targetX) actions.push_back(InputAction::MoveRight);
+        else actions.push_back(InputAction::HardDrop);
+    }
+
+    void startGame(Game& g) {
+        if (g.replay) {
+            g.state = g.start;
+            g.nextEvent = std::lower_bound(g.replay->events.begin(), g.replay->events.end(), g.replay->startTick,
+                                           [](const ReplayEvent& e, Uint32 t) { return e.tick < t; }) -
+                          g.replay->events.begin();
+        } else {
+            const bool savedFixed = fixedSeedEnabled;
+            const Uint64 savedSeed = fixedSeed;
+            fixedSeedEnabled = true;
+            fixedSeed = botSeed++;
+            resetGameplayStateForNewGame();
+            replayDiscardRecording();
+            captureGameSnapshot(g.state);
+            fixedSeedEnabled = savedFixed;
+            fixedSeed = savedSeed;
+            g.plannedFor = -1;
+        }
+        g.over = false;
+        g.overTicks = 0;
+        g.dirty = true;
+    }
+
+    void stepGame(Game& g) {
+        if (g.over) {
+            if (++g.overTicks >= kRestartTicks) {
+                g.gamesPlayed++;
+                startGame(g);
+            }
+            return;
+        }
+        InputActionList actions;
+        if (!g.replay) queueBotMove(g, actions);
+        restoreGameSnapshot(g.state);
+        const int savedMaxLevel = maxLevelAchieved;
+        maxLevelAchieved = g.maxLevel;
+        if (g.replay) {
+            const std::vector<ReplayEvent>& events = g.replay->events;
+            while (g.nextEvent < events.size() && events[g.nextEvent].tick <= gameTick) {
+                applyInputAction(static_cast<InputAction>(events[g.nextEvent++].action));
+            }
+        }
+        for (InputAction action : actions) applyInputAction(action);
+        const int savedHighScore = highScoreValue; // the local best is not at stake
+        bool alive = simulateGameplayTick();
+        highScoreValue = savedHighScore;
+        maxLevelAchieved = savedMaxLevel;
+        if (g.replay && gameTick > g.replay->ticks) alive = false;
+        captureGameSnapshot(g.state);
+        if (!alive) {
+            g.over = true;
+            g.dirty = true; // greyed out, with GAME OVER
+        }
+    }
+
+    // Loads the replays and starts every slot; false if a replay could not be read
+    bool setUp() {
+        gameCount = spectatorBoards > 0 ? spectatorBoards : static_cast<int>(spectatorReplays.size());
+        if (gameCount < 1 || gameCount > kSpectatorMaxBoards) {
+            LOG_ERROR("--spectate takes 1 to %d boards", kSpectatorMaxBoards);
+            return false;
+        }
+        if (static_cast<int>(spectatorReplays.size()) > gameCount) {
+            LOG_WARN("Spectator: %zu replays for %d boards; the rest are not shown", spectatorReplays.size(), gameCount);
+        }
+        // Opening a replay switches to its randomizer and level limit; each game keeps its own
+        // limit to step with, and bot games keep the player's
+        const RandomizerKind savedRandomizer = randomizerKind;
+        const int savedMaxLevel = maxLevelAchieved;
+        const int replayCount = std::min(gameCount, static_cast<int>(spectatorReplays.size()));
+        replays.clear();
+        replays.reserve(replayCount);
+        for (int i = 0; i < replayCount; ++i) {
+            // Opened as the one playback so partial replays start from their keyframe
+            if (!replayOpenPlayback(spectatorReplays[i])) return false;
+            replays.push_back(playbackReplay());
+            Game& g = games[i];
+            g.replay = &replays.back();
+            g.maxLevel = g.replay->maxLevel;
+            captureGameSnapshot(g.start);
+            const char* base = SDL_strrchr(spectatorReplays[i], '/');
+            SDL_strlcpy(g.name, base ? base + 1 : spectatorReplays[i], sizeof(g.name));
+        }
+        randomizerKind = savedRandomizer;
+        maxLevelAchieved = savedMaxLevel;
+        botSeed = fixedSeedEnabled ? fixedSeed : SDL_GetPerformanceCounter() ^ SDL_GetTicksNS();
+        for (int i = 0; i < gameCount; ++i) {
+            Game& g = games[i];
+            if (!g.replay) {
+                SDL_snprintf(g.name, sizeof(g.name), "BOT %d", i + 1);
+                g.maxLevel = maxLevelAchieved;
+            }
+            startGame(g);
+        }
+
+        wells.clear();
+        for (int i = 0; i < gameCount; ++i) {
+            const BoardLayout l = layoutOf(i);
+            wells.push_back({ l.x - 1, l.y - 1, boardWidth * l.cell + 2, boardHeight * l.cell + 2 });
+        }
+        LOG_INFO("Spectator: %d boards, %d replays, cell %.0f px", gameCount, replayCount, layoutOf(0).cell);
+        return true;
+    }
+}
+
+int runSpectator() {
+    active = true;
+    if (!setUp()) {
+        active = false;
+        return 1;
+    }
+    if (!buildGlyphAtlas()) LOG_WARN("Spectator: could not build the glyph atlas; boards are drawn without text");
+    currentState = GameState::PLAYING;
+
+    bool quit = false;
+    while (!quit) {
+        capTimer.start();
+        frameArena().reset();
+        const Uint64 frameStart = SDL_GetTicksNS();
+
+        SDL_Event e;
+        while (SDL_PollEvent(&e)) {
+            if (e.type == SDL_EVENT_QUIT) quit = true;
+            if (e.type == SDL_EVENT_KEY_DOWN && e.key.key == SDLK_ESCAPE) quit = true;
+            if (e.type == SDL_EVENT_KEY_DOWN && e.key.key == SDLK_SPACE && !e.key.repeat) gridPaused = !gridPaused;
+        }
+        if (quit) break;
+
+        if (!gridPaused) {
+            TRACE_SCOPE("spectator tick");
+            for (int i = 0; i < gameCount; ++i) stepGame(games[i]);
+        }
+        const Uint64 simulated = SDL_GetTicksNS();
+        {
+            TRACE_SCOPE("spectator rebuild");
+            rebuildChanged();
+        }
+        const Uint64 built = SDL_GetTicksNS();
+        {
+            TRACE_SCOPE("spectator render");
+            renderGrid();
+        }
+        const Uint64 rendered = SDL_GetTicksNS();
+        SDL_RenderPresent(gRenderer);
+
+        stats.add(frameStart, simulated, built, rendered);
+        capFrameRate();
+    }
+
+    active = false;
+    if (atlas.texture) SDL_DestroyTexture(atlas.texture);
+    atlas.texture = nullptr;
+    stats.log("Spectator", gameCount);
+    if (stats.frames > 0) {
+        LOG_INFO("Spectator: %.1f boards rebuilt a frame", static_cast<double>(rebuilds) / stats.frames);
+    }
+    return 0;
+}
+
+bool spectatorActive() {
+    return active;
+}
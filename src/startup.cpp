@@ -0,0 +1,107 @@
+#include "startup.h"
+#include "globals.h"
+#include "asset_registry.h"
+#include <future>
+
+namespace {
+    constexpr int kImageCount = static_cast<int>(StartupImage::Count);
+
+    std::future<SDL_Surface*> imageDecodes[kImageCount];
+    std::future<TTF_Font*> fontLoad;
+    bool gamepadsReady = false;
+
+    struct StartupMark { const char* stage; Uint64 ns; };
+    StartupMark marks[16];
+    int markCount = 0;
+    bool firstFrameLogged = false;
+
+    // Images are pre-sized RGBA from the build-time packer, so this is only an RLE
+    // expand; still done off the main thread so window creation never waits on it
+    void launchDecode(StartupImage image, const char* assetName) {
+        imageDecodes[static_cast<int>(image)] = std::async(std::launch::async, [assetName] {
+            return createSurfaceFromAsset(assetName);
+        });
+    }
+}
+
+void beginStartupDecodes(bool wantSplash) {
+    startupMark("decodes launched");
+
+    launchDecode(StartupImage::WindowIcon, "window_icon");
+    if (wantSplash) {
+        launchDecode(StartupImage::SplashLogo, "splash_logo");
+    }
+    launchDecode(StartupImage::MenuLogo, "menu_logo");
+
+    // TTF_Init is cheap and must happen before any font is opened
+    if (TTF_Init() == false) {
+        SDL_Log("SDL_ttf could not initialize! SDL_ttf error: %s\n", SDL_GetError());
+        return;
+    }
+    fontLoad = std::async(std::launch::async, [] {
+        SDL_IOStream* io_stream = openAssetStream("pixeboy_font");
+        if (!io_stream) return static_cast<TTF_Font*>(nullptr);
+        return TTF_OpenFontIO(io_stream, true, 24); // true = auto close stream
+    });
+}
+
+SDL_Surface* takeDecodedImage(StartupImage image, bool wait) {
+    auto& decode = imageDecodes[static_cast<int>(image)];
+    if (!decode.valid()) return nullptr;
+    if (!wait && decode.wait_for(std::chrono::seconds(0)) != std::future_status::ready) return nullptr;
+    return decode.get();
+}
+
+TTF_Font* waitForFont() {
+    if (!fontLoad.valid()) return nullptr;
+    TTF_Font* font = fontLoad.get();
+    startupMark("font opened");
+    return font;
+}
+
+void ensureGamepadSubsystem() {
+    if (gamepadsReady) return;
+    if (SDL_InitSubSystem(SDL_INIT_GAMEPAD) == false) {
+        SDL_Log("SDL gamepad subsystem could not initialize: %s", SDL_GetError());
+        return;
+    }
+    gamepadsReady = true;
+    startupMark("gamepad subsystem");
+    AcquireFirstGamepadIfNone();
+}
+
+bool gamepadSubsystemReady() {
+    return gamepadsReady;
+}
+
+void startupMark(const char* stage) {
+    if (markCount < static_cast<int>(SDL_arraysize(marks))) {
+        marks[markCount++] = StartupMark{ stage, SDL_GetTicksNS() };
+    }
+}
+
+void startupFirstInteractiveFrame() {
+    if (firstFrameLogged) return;
+    firstFrameLogged = true;
+    startupMark("first interactive frame");
+
+    const Uint64 origin = marks[0].ns;
+    for (int i = 0; i < markCount; ++i) {
+        SDL_Log("startup %-24s %8.2f ms", marks[i].stage, (marks[i].ns - origin) / 1000000.0);
+    }
+    SDL_Log("time to first interactive frame: %.2f ms", (marks[markCount - 1].ns - origin) / 1000000.0);
+
+    // Deferred until now so device enumeration never delays the first frame
+    ensureGamepadSubsystem();
+}
+
+void shutdownStartupDecodes() {
+    for (auto& decode : imageDecodes) {
+        if (decode.valid()) {
+            if (SDL_Surface* surface = decode.get()) SDL_DestroySurface(surface);
+        }
+    }
+    if (fontLoad.valid()) {
+        if (TTF_Font* font = fontLoad.get()) TTF_CloseFont(font);
+    }
+}
@@ -1,10 +1,30 @@
 #include "tetris_utils.h"
 #include "globals.h"
+#include "latency.h"
+#include "save_data.h"
+#include "game_history.h"
+#include "alloc_check.h"
+#include "frame_arena.h"
+#include "log.h"
+#include "audio.h"
+#include "bot.h"
+#include "replay.h"
+#include "offscreen_render.h"
+#include "position.h"
+#include "replay_viewer.h"
+#include "trace.h"
+#include "flight_recorder.h"
+#include "advisor.h"
+#include "finesse.h"
+#include "undo_history.h"
+#include "palette.h"
+#include "netplay.h"
+#include "versus.h"
+#include "spectator.h"
 #include <iostream>
 #include <math.h>
 #include <climits>
 #include <algorithm>
-#include <fstream>
 
 namespace {
     // Map from current rotation state to the SRS wall-kick table index
@@ -13,14 +33,15 @@ namespace {
     constexpr int SRS_INDEX_CW[4]  = {0, 1, 2, 3};
     constexpr int SRS_INDEX_CCW[4] = {4, 7, 6, 5};
 
-    // Find occupied horizontal bounds (min/max column) in a shape
-    std::pair<int,int> occupiedXBounds(const std::vector<std::vector<int>>& shape) {
-        int h = static_cast<int>(shape.size());
-        int w = h ? static_cast<int>(shape[0].size()) : 0;
-        int minCol = w, maxCol = -1;
-        for (int sy = 0; sy < h; ++sy) {
-            for (int sx = 0; sx < w; ++sx) {
-                if (shape[sy][sx] != 0) {
+    // Enough sparkles for a 4-row clear plus a hard drop, so play never grows the vector
+    constexpr size_t kParticleReserve = 2048;
+
+    // Find occupied horizontal bounds (min/max column) of a piece's cells
+    std::pair<int,int> occupiedXBounds(const Piece& piece) {
+        int minCol = piece.width, maxCol = -1;
+        for (int sy = 0; sy < piece.height; ++sy) {
+            for (int sx = 0; sx < piece.width; ++sx) {
+                if (piece.cell(sx, sy)) {
                     if (sx < minCol) minCol = sx;
                     if (sx > maxCol) maxCol = sx;
                 }
@@ -30,26 +51,37 @@ namespace {
         return {minCol, maxCol};
     }
 
+    // Kick candidates for one rotation attempt, kept on the stack
+    struct KickList {
+        std::pair<int,int> offsets[8];
+        int count = 0;
+        const std::pair<int,int>* begin() const { return offsets; }
+        const std::pair<int,int>* end() const { return offsets + count; }
+    };
+
     // Prioritize offsets to reduce sideways crawl when landed: prefer dx==0 first
-    std::vector<std::pair<int,int>> prioritizeOffsets(const std::vector<std::pair<int,int>>& in) {
-        if (!pieceLanded) return in; // keep original SRS order while falling
-        std::vector<std::pair<int,int>> zeros;
-        std::vector<std::pair<int,int>> nonzeros;
-        zeros.reserve(in.size());
-        nonzeros.reserve(in.size());
-        for (auto& o : in) {
-            if (o.first == 0) zeros.push_back(o); else nonzeros.push_back(o);
+    KickList prioritizeOffsets(const std::vector<std::pair<int,int>>& in) {
+        KickList out;
+        for (const auto& o : in) {
+            if (out.count == static_cast<int>(SDL_arraysize(out.offsets))) break;
+            out.offsets[out.count++] = o;
         }
-        // Stable by |dx| to minimize crawl if we must move horizontally
-        std::stable_sort(nonzeros.begin(), nonzeros.end(), [](auto a, auto b){
+        if (!pieceLanded) return out; // keep original SRS order while falling
+        // Stable insertion sort: dx==0 first, then by |dx| to minimize crawl if we must
+        // move horizontally, small vertical first as tie-breaker
+        auto before = [](const std::pair<int,int>& a, const std::pair<int,int>& b) {
+            if ((a.first == 0) != (b.first == 0)) return a.first == 0;
+            if (a.first == 0) return false; // zeros keep their SRS order
             int da = std::abs(a.first), db = std::abs(b.first);
             if (da != db) return da < db;
-            return a.second < b.second; // small vertical first as tie-breaker
-        });
-        std::vector<std::pair<int,int>> out;
-        out.reserve(in.size());
-        out.insert(out.end(), zeros.begin(), zeros.end());
-        out.insert(out.end(), nonzeros.begin(), nonzeros.end());
+            return a.second < b.second;
+        };
+        for (int i = 1; i < out.count; ++i) {
+            const auto o = out.offsets[i];
+            int j = i;
+            for (; j > 0 && before(o, out.offsets[j - 1]); --j) out.offsets[j] = out.offsets[j - 1];
+            out.offsets[j] = o;
+        }
         return out;
     }
 }
@@ -58,7 +90,7 @@ bool checkPlacement(const Piece& piece, const Board& board, int newX, int newY)
     bool placementValid = true;
     for (int sx = 0; sx < piece.width; ++sx) {
         for (int sy = 0; sy < piece.height; ++sy) {
-            if (piece.shape[sy][sx] != 0) {
+            if (piece.cell(sx, sy)) {
                 int boardX = piece.x + sx + newX;
                 int boardY = piece.y + sy + newY;
                 if (boardX < 0 || boardX >= boardWidth || boardY < 0 || boardY >= boardHeight || board.current[boardX][boardY] != 0) {
@@ -74,9 +106,10 @@ bool checkPlacement(const Piece& piece, const Board& board, int newX, int newY)
 void pieceSet(const Piece& piece, Board& board, int color) {
     for (int sx = 0; sx < piece.width; ++sx) {
         for (int sy = 0; sy < piece.height; ++sy) {
-            if (piece.shape[sy][sx] != 0) {
+            if (piece.cell(sx, sy)) {
                 int boardX = piece.x + sx;
                 int boardY = piece.y + sy;
+                SDL_assert(boardX >= 0 && boardX < boardWidth && boardY >= 0 && boardY < boardHeight);
                 board.current[boardX][boardY] = color;
             }
         }
@@ -89,7 +122,7 @@ int maxDrop(const Piece& piece, const Board& board) {
         bool collision = false;
         for (int sx = 0; sx < piece.width; ++sx) {
             for (int sy = 0; sy < piece.height; ++sy) {
-                if (piece.shape[sy][sx] != 0) {
+                if (piece.cell(sx, sy)) {
                     int boardX = piece.x + sx;
                     int boardY = dropY + sy;
                     if (boardY >= boardHeight || board.current[boardX][boardY] != 0) {
@@ -112,18 +145,9 @@ int maxDrop(const Piece& piece, const Board& board) {
 }
 
 void rotateIPieceClockwise() {
-    std::vector<std::vector<int>> newShape(currentPiece.width, std::vector<int>(currentPiece.height, 0));
-    for (int sx = 0; sx < currentPiece.width; ++sx) {
-        for (int sy = 0; sy < currentPiece.height; ++sy) {
-            newShape[sx][currentPiece.height - 1 - sy] = currentPiece.shape[sy][sx];
-        }
-    }
-
+    const int fromRot = currentPiece.rotation;
     Piece rotatedPiece = currentPiece;
-    rotatedPiece.shape = newShape;
-    rotatedPiece.width = currentPiece.height;
-    rotatedPiece.height = currentPiece.width;
-    rotatedPiece.rotation = (currentPiece.rotation + 1) % 4;
+    setPieceRotation(rotatedPiece, (currentPiece.rotation + 1) % 4);
 
     if (rotatedPiece.rotation % 4 == 1 || rotatedPiece.rotation % 4 == 3) 
     {
@@ -148,18 +172,18 @@ void rotateIPieceClockwise() {
 
     // Use correct SRS table for I piece (CW) based on current state
     int idx = SRS_INDEX_CW[currentPiece.rotation];
-    SDL_Log("I CW from %d to %d using idx %d", currentPiece.rotation, rotatedPiece.rotation, idx);
+    LOG_EVENT(Trace, "rotate.cw", currentPiece.type, currentPiece.rotation, rotatedPiece.rotation, idx, 0, 0);
     auto tries = prioritizeOffsets(wallKickOffsetsI[idx]);
     bool applied = false;
     for (const auto& offset: tries) {
         if (checkPlacement(rotatedPiece, board, offset.first, offset.second)) {
-            currentPiece.shape = newShape;
+            currentPiece.mask = rotatedPiece.mask;
             std::swap(currentPiece.width, currentPiece.height);
             currentPiece.rotation = (currentPiece.rotation + 1) % 4;
 
             currentPiece.x = rotatedPiece.x + offset.first;
             currentPiece.y = rotatedPiece.y + offset.second;
-            SDL_Log("I CW kick applied: (%d,%d)", offset.first, offset.second);
+            LOG_EVENT(Trace, "rotate.cw.kick", currentPiece.type, fromRot, currentPiece.rotation, idx, offset.first, offset.second);
             // Lock delay: count and reset only on successful rotation while grounded
             if (pieceLandedOnce && pieceLanded) {
                 if (lockDelayRotationsUsed < maxLockDelayRotations) {
@@ -173,7 +197,7 @@ void rotateIPieceClockwise() {
     }
     if (!applied) {
         // Edge assist: mirror dx when at a wall
-        auto [minCol, maxCol] = occupiedXBounds(newShape);
+        auto [minCol, maxCol] = occupiedXBounds(rotatedPiece);
         bool rightWall = (rotatedPiece.x + maxCol) >= boardWidth;
         bool leftWall  = (rotatedPiece.x + minCol) < 0;
         bool rotated = false;
@@ -181,12 +205,12 @@ void rotateIPieceClockwise() {
             for (const auto& o : tries) {
                 auto m = std::make_pair(-o.first, o.second);
                 if (checkPlacement(rotatedPiece, board, m.first, m.second)) {
-                    currentPiece.shape = newShape;
+                    currentPiece.mask = rotatedPiece.mask;
                     std::swap(currentPiece.width, currentPiece.height);
                     currentPiece.rotation = (currentPiece.rotation + 1) % 4;
                     currentPiece.x = rotatedPiece.x + m.first;
                     currentPiece.y = rotatedPiece.y + m.second;
-                    SDL_Log("I CW edge-assist kick applied: (%d,%d)", m.first, m.second);
+                    LOG_EVENT(Trace, "rotate.cw.edge", currentPiece.type, fromRot, currentPiece.rotation, 0, m.first, m.second);
                     // Lock delay: count and reset only on successful rotation while grounded
                     if (pieceLandedOnce && pieceLanded) {
                         if (lockDelayRotationsUsed < maxLockDelayRotations) {
@@ -207,12 +231,12 @@ void rotateIPieceClockwise() {
                     int dx = nudge + o.first;
                     int dy = o.second;
                     if (checkPlacement(rotatedPiece, board, dx, dy)) {
-                        currentPiece.shape = newShape;
+                        currentPiece.mask = rotatedPiece.mask;
                         std::swap(currentPiece.width, currentPiece.height);
                         currentPiece.rotation = targetRot;
                         currentPiece.x = rotatedPiece.x + dx;
                         currentPiece.y = rotatedPiece.y + dy;
-                        SDL_Log("I CW nudge-assist applied: base %d, kick (%d,%d)", nudge, o.first, o.second);
+                        LOG_EVENT(Trace, "rotate.cw.nudge", currentPiece.type, fromRot, currentPiece.rotation, nudge, o.first, o.second);
                         // Lock delay: count and reset only on successful rotation while grounded
                         if (pieceLandedOnce && pieceLanded) {
                             if (lockDelayRotationsUsed < maxLockDelayRotations) {
@@ -231,34 +255,25 @@ void rotateIPieceClockwise() {
 }
 
 void rotatePieceClockwise() {
-    std::vector<std::vector<int>> newShape(currentPiece.width, std::vector<int>(currentPiece.height, 0));
-    for (int sx = 0; sx < currentPiece.width; ++sx) {
-        for (int sy = 0; sy < currentPiece.height; ++sy) {
-            newShape[sx][currentPiece.height - 1 - sy] = currentPiece.shape[sy][sx];
-        }
-    }
-
+    const int fromRot = currentPiece.rotation;
     Piece rotatedPiece = currentPiece;
-    rotatedPiece.shape = newShape;
-    rotatedPiece.width = currentPiece.height;
-    rotatedPiece.height = currentPiece.width;
-    rotatedPiece.rotation = (currentPiece.rotation + 1) % 4;
+    setPieceRotation(rotatedPiece, (currentPiece.rotation + 1) % 4);
     
     // Use correct SRS table for JLSTZ (CW) based on current state
     int idx = SRS_INDEX_CW[currentPiece.rotation];
-    SDL_Log("CW from %d to %d using idx %d", currentPiece.rotation, rotatedPiece.rotation, idx);
+    LOG_EVENT(Trace, "rotate.cw", currentPiece.type, currentPiece.rotation, rotatedPiece.rotation, idx, 0, 0);
     auto tries = prioritizeOffsets(wallKickOffsets[idx]);
     bool applied = false;
     for (const auto& offset : tries) {
         if (checkPlacement(rotatedPiece, board, offset.first, offset.second)) {
-            currentPiece.shape = newShape;
+            currentPiece.mask = rotatedPiece.mask;
             std::swap(currentPiece.width, currentPiece.height);
             
             currentPiece.x = rotatedPiece.x + offset.first;
             currentPiece.y = rotatedPiece.y + offset.second;
             currentPiece.rotation = (currentPiece.rotation + 1) % 4;
 
-            SDL_Log("CW kick applied: (%d,%d)", offset.first, offset.second);
+            LOG_EVENT(Trace, "rotate.cw.kick", currentPiece.type, fromRot, currentPiece.rotation, idx, offset.first, offset.second);
             // Lock delay: count and reset only on successful rotation while grounded
             if (pieceLandedOnce && pieceLanded) {
                 if (lockDelayRotationsUsed < maxLockDelayRotations) {
@@ -271,7 +286,7 @@ void rotatePieceClockwise() {
         }
     }
     if (!applied) {
-        auto [minCol, maxCol] = occupiedXBounds(newShape);
+        auto [minCol, maxCol] = occupiedXBounds(rotatedPiece);
         bool rightWall = (rotatedPiece.x + maxCol) >= boardWidth;
         bool leftWall  = (rotatedPiece.x + minCol) < 0;
         bool rotated = false;
@@ -279,12 +294,12 @@ void rotatePieceClockwise() {
             for (const auto& o : tries) {
                 auto m = std::make_pair(-o.first, o.second);
                 if (checkPlacement(rotatedPiece, board, m.first, m.second)) {
-                    currentPiece.shape = newShape;
+                    currentPiece.mask = rotatedPiece.mask;
                     std::swap(currentPiece.width, currentPiece.height);
                     currentPiece.x = rotatedPiece.x + m.first;
                     currentPiece.y = rotatedPiece.y + m.second;
                     currentPiece.rotation = (currentPiece.rotation + 1) % 4;
-                    SDL_Log("CW edge-assist kick applied: (%d,%d)", m.first, m.second);
+                    LOG_EVENT(Trace, "rotate.cw.edge", currentPiece.type, fromRot, currentPiece.rotation, 0, m.first, m.second);
                     // Lock delay: count and reset only on successful rotation while grounded
                     if (pieceLandedOnce && pieceLanded) {
                         if (lockDelayRotationsUsed < maxLockDelayRotations) {
@@ -304,12 +319,12 @@ void rotatePieceClockwise() {
                     int dx = nudge + o.first;
                     int dy = o.second;
                     if (checkPlacement(rotatedPiece, board, dx, dy)) {
-                        currentPiece.shape = newShape;
+                        currentPiece.mask = rotatedPiece.mask;
                         std::swap(currentPiece.width, currentPiece.height);
                         currentPiece.x = rotatedPiece.x + dx;
                         currentPiece.y = rotatedPiece.y + dy;
                         currentPiece.rotation = targetRot;
-                        SDL_Log("CW nudge-assist applied: base %d, kick (%d,%d)", nudge, o.first, o.second);
+                        LOG_EVENT(Trace, "rotate.cw.nudge", currentPiece.type, fromRot, currentPiece.rotation, nudge, o.first, o.second);
                         // Lock delay: count and reset only on successful rotation while grounded
                         if (pieceLandedOnce && pieceLanded) {
                             if (lockDelayRotationsUsed < maxLockDelayRotations) {
@@ -328,18 +343,9 @@ void rotatePieceClockwise() {
 }
 
 void rotateIPieceCounterClockwise() {
-    std::vector<std::vector<int>> newShape(currentPiece.width, std::vector<int>(currentPiece.height, 0));
-    for (int sx = 0; sx < currentPiece.width; ++sx) {
-        for (int sy = 0; sy < currentPiece.height; ++sy) {
-            newShape[currentPiece.width - 1 - sx][sy] = currentPiece.shape[sy][sx];
-        }
-    }
-
+    const int fromRot = currentPiece.rotation;
     Piece rotatedPiece = currentPiece;
-    rotatedPiece.shape = newShape;
-    rotatedPiece.width = currentPiece.height;
-    rotatedPiece.height = currentPiece.width;
-    rotatedPiece.rotation = (currentPiece.rotation + 3) % 4; // CCW without negative modulo
+    setPieceRotation(rotatedPiece, (currentPiece.rotation + 3) % 4); // CCW without negative modulo
 
     if (rotatedPiece.rotation % 4 == 1 || rotatedPiece.rotation % 4 == 3) 
     {
@@ -364,18 +370,18 @@ void rotateIPieceCounterClockwise() {
 
     // Use correct SRS table for I piece (CCW) based on current state
     int idxCCW = SRS_INDEX_CCW[currentPiece.rotation];
-    SDL_Log("I CCW from %d to %d using idx %d", currentPiece.rotation, rotatedPiece.rotation, idxCCW);
+    LOG_EVENT(Trace, "rotate.ccw", currentPiece.type, currentPiece.rotation, rotatedPiece.rotation, idxCCW, 0, 0);
     auto tries = prioritizeOffsets(wallKickOffsetsI[idxCCW]);
     bool applied = false;
     for (const auto& offset: tries) {
         if (checkPlacement(rotatedPiece, board, offset.first, offset.second)) {
-            currentPiece.shape = newShape;
+            currentPiece.mask = rotatedPiece.mask;
             std::swap(currentPiece.width, currentPiece.height);
             currentPiece.rotation = (currentPiece.rotation + 3) % 4; // CCW safely
 
             currentPiece.x = rotatedPiece.x + offset.first;
             currentPiece.y = rotatedPiece.y + offset.second;
-            SDL_Log("I CCW kick applied: (%d,%d)", offset.first, offset.second);
+            LOG_EVENT(Trace, "rotate.ccw.kick", currentPiece.type, fromRot, currentPiece.rotation, idxCCW, offset.first, offset.second);
             // Lock delay: count and reset only on successful rotation while grounded
             if (pieceLandedOnce && pieceLanded) {
                 if (lockDelayRotationsUsed < maxLockDelayRotations) {
@@ -388,7 +394,7 @@ void rotateIPieceCounterClockwise() {
         }
     }
     if (!applied) {
-        auto [minCol, maxCol] = occupiedXBounds(newShape);
+        auto [minCol, maxCol] = occupiedXBounds(rotatedPiece);
         bool rightWall = (rotatedPiece.x + maxCol) >= boardWidth;
         bool leftWall  = (rotatedPiece.x + minCol) < 0;
         bool rotated = false;
@@ -396,12 +402,12 @@ void rotateIPieceCounterClockwise() {
             for (const auto& o : tries) {
                 auto m = std::make_pair(-o.first, o.second);
                 if (checkPlacement(rotatedPiece, board, m.first, m.second)) {
-                    currentPiece.shape = newShape;
+                    currentPiece.mask = rotatedPiece.mask;
                     std::swap(currentPiece.width, currentPiece.height);
                     currentPiece.rotation = (currentPiece.rotation + 3) % 4; // CCW
                     currentPiece.x = rotatedPiece.x + m.first;
                     currentPiece.y = rotatedPiece.y + m.second;
-                    SDL_Log("I CCW edge-assist kick applied: (%d,%d)", m.first, m.second);
+                    LOG_EVENT(Trace, "rotate.ccw.edge", currentPiece.type, fromRot, currentPiece.rotation, 0, m.first, m.second);
                     // Lock delay: count and reset only on successful rotation while grounded
                     if (pieceLandedOnce && pieceLanded) {
                         if (lockDelayRotationsUsed < maxLockDelayRotations) {
@@ -421,12 +427,12 @@ void rotateIPieceCounterClockwise() {
                     int dx = nudge + o.first;
                     int dy = o.second;
                     if (checkPlacement(rotatedPiece, board, dx, dy)) {
-                        currentPiece.shape = newShape;
+                        currentPiece.mask = rotatedPiece.mask;
                         std::swap(currentPiece.width, currentPiece.height);
                         currentPiece.rotation = targetRot;
                         currentPiece.x = rotatedPiece.x + dx;
                         currentPiece.y = rotatedPiece.y + dy;
-                        SDL_Log("I CCW nudge-assist applied: base %d, kick (%d,%d)", nudge, o.first, o.second);
+                        LOG_EVENT(Trace, "rotate.ccw.nudge", currentPiece.type, fromRot, currentPiece.rotation, nudge, o.first, o.second);
                         // Lock delay: count and reset only on successful rotation while grounded
                         if (pieceLandedOnce && pieceLanded) {
                             if (lockDelayRotationsUsed < maxLockDelayRotations) {
@@ -445,32 +451,23 @@ void rotateIPieceCounterClockwise() {
 }
 
 void rotatePieceCounterClockwise() {
-    std::vector<std::vector<int>> newShape(currentPiece.width, std::vector<int>(currentPiece.height, 0));
-    for (int sx = 0; sx < currentPiece.width; ++sx) {
-        for (int sy = 0; sy < currentPiece.height; ++sy) {
-            newShape[currentPiece.width - 1 - sx][sy] = currentPiece.shape[sy][sx];
-        }
-    }
-
+    const int fromRot = currentPiece.rotation;
     Piece rotatedPiece = currentPiece;
-    rotatedPiece.shape = newShape;
-    rotatedPiece.width = currentPiece.height;
-    rotatedPiece.height = currentPiece.width;
-    rotatedPiece.rotation = (currentPiece.rotation + 3) % 4; // CCW target state
+    setPieceRotation(rotatedPiece, (currentPiece.rotation + 3) % 4); // CCW target state
     
     int idx = SRS_INDEX_CCW[currentPiece.rotation];
-    SDL_Log("CCW from %d to %d using idx %d", currentPiece.rotation, rotatedPiece.rotation, idx);
+    LOG_EVENT(Trace, "rotate.ccw", currentPiece.type, currentPiece.rotation, rotatedPiece.rotation, idx, 0, 0);
     auto tries = prioritizeOffsets(wallKickOffsets[idx]);
     bool applied = false;
     for (const auto& offset : tries) {
         if (checkPlacement(rotatedPiece, board, offset.first, offset.second)) {
-            currentPiece.shape = newShape;
+            currentPiece.mask = rotatedPiece.mask;
             std::swap(currentPiece.width, currentPiece.height);
             
             currentPiece.x = rotatedPiece.x + offset.first;
             currentPiece.y = rotatedPiece.y + offset.second;
             currentPiece.rotation = (currentPiece.rotation + 3) % 4; // CCW safely
-            SDL_Log("CCW kick applied: (%d,%d)", offset.first, offset.second);
+            LOG_EVENT(Trace, "rotate.ccw.kick", currentPiece.type, fromRot, currentPiece.rotation, idx, offset.first, offset.second);
             // Lock delay: count and reset only on successful rotation while grounded
             if (pieceLandedOnce && pieceLanded) {
                 if (lockDelayRotationsUsed < maxLockDelayRotations) {
@@ -483,7 +480,7 @@ void rotatePieceCounterClockwise() {
         }
     }
     if (!applied) {
-        auto [minCol, maxCol] = occupiedXBounds(newShape);
+        auto [minCol, maxCol] = occupiedXBounds(rotatedPiece);
         bool rightWall = (rotatedPiece.x + maxCol) >= boardWidth;
         bool leftWall  = (rotatedPiece.x + minCol) < 0;
         bool rotated = false;
@@ -491,12 +488,12 @@ void rotatePieceCounterClockwise() {
             for (const auto& o : tries) {
                 auto m = std::make_pair(-o.first, o.second);
                 if (checkPlacement(rotatedPiece, board, m.first, m.second)) {
-                    currentPiece.shape = newShape;
+                    currentPiece.mask = rotatedPiece.mask;
                     std::swap(currentPiece.width, currentPiece.height);
                     currentPiece.x = rotatedPiece.x + m.first;
                     currentPiece.y = rotatedPiece.y + m.second;
                     currentPiece.rotation = (currentPiece.rotation + 3) % 4;
-                    SDL_Log("CCW edge-assist kick applied: (%d,%d)", m.first, m.second);
+                    LOG_EVENT(Trace, "rotate.ccw.edge", currentPiece.type, fromRot, currentPiece.rotation, 0, m.first, m.second);
                     // Lock delay: count and reset only on successful rotation while grounded
                     if (pieceLandedOnce && pieceLanded) {
                         if (lockDelayRotationsUsed < maxLockDelayRotations) {
@@ -516,12 +513,12 @@ void rotatePieceCounterClockwise() {
                     int dx = nudge + o.first;
                     int dy = o.second;
                     if (checkPlacement(rotatedPiece, board, dx, dy)) {
-                        currentPiece.shape = newShape;
+                        currentPiece.mask = rotatedPiece.mask;
                         std::swap(currentPiece.width, currentPiece.height);
                         currentPiece.x = rotatedPiece.x + dx;
                         currentPiece.y = rotatedPiece.y + dy;
                         currentPiece.rotation = targetRot;
-                        SDL_Log("CCW nudge-assist applied: base %d, kick (%d,%d)", nudge, o.first, o.second);
+                        LOG_EVENT(Trace, "rotate.ccw.nudge", currentPiece.type, fromRot, currentPiece.rotation, nudge, o.first, o.second);
                         // Lock delay: count and reset only on successful rotation while grounded
                         if (pieceLandedOnce && pieceLanded) {
                             if (lockDelayRotationsUsed < maxLockDelayRotations) {
@@ -545,28 +542,14 @@ void resetRotation() {
     }
     else 
     {
-        while (currentPiece.rotation != 0) { // rotate back to original position
-            std::vector<std::vector<int>> newShape(currentPiece.width, std::vector<int>(currentPiece.height, 0));
-            for (int sx = 0; sx < currentPiece.width; ++sx) {
-                for (int sy = 0; sy < currentPiece.height; ++sy) {
-                    newShape[sx][currentPiece.height - 1 - sy] = currentPiece.shape[sy][sx];
-                }
-            }
-            currentPiece.shape = newShape;
-            std::swap(currentPiece.width, currentPiece.height);
-            currentPiece.rotation = (currentPiece.rotation + 1) % 4;
-            newShape = std::vector<std::vector<int>>(currentPiece.width, std::vector<int>(currentPiece.height, 0));
-        }
+        setPieceRotation(currentPiece, 0); // back to the spawn orientation
     }
 }
 
 void firstHold() {
     holdPiece = currentPiece;
-    pickPiece = std::rand() % 7; // Generates a random number between 0 and 6 inclusive
-    //std::cout << "Picked piece: " << pickPiece << std::endl;
-    currentPiece = pieceTypes[nextPickPiece]; // Select a new random piece
-    nextPickPiece = std::rand() % 7; // Randomly select the next piece
-    nextPiece = pieceTypes[nextPickPiece]; // Update next piece
+    pickPiece = popNextPiece(); // Next piece from the queue
+    currentPiece = pieceTypes[pickPiece];
     currentPiece.y = 0;
     currentPiece.x = boardWidth / 2;
 }
@@ -578,9 +561,10 @@ void pieceSwap() {
 }
 
 void spawnParticles(const Piece& piece) {
+    if (!gRenderer || silentSimulation()) return; // headless, or not drawn
     for (int sx = 0; sx < piece.width; ++sx) {
         for (int sy = 0; sy < piece.height; ++sy) {
-            if (piece.shape[sy][sx] != 0) {
+            if (piece.cell(sx, sy)) {
                 int numSparkles = 8 + std::rand() % 8; // More sparkles per block
                 for (int i = 0; i < numSparkles; ++i) {
                     Particle p;
@@ -608,6 +592,7 @@ void spawnParticles(const Piece& piece) {
 }
 
 void spawnParticlesAt(int x, int y, int color) {
+    if (silentSimulation()) return;
     int numSparkles = 8 + std::rand() % 8;
     for (int i = 0; i < numSparkles; ++i) {
         Particle p;
@@ -638,7 +623,7 @@ void spawnParticlesAt(int x, int y, int color) {
 static inline bool isCurrentPieceCell(int x, int y) {
     for (int sx = 0; sx < currentPiece.width; ++sx) {
         for (int sy = 0; sy < currentPiece.height; ++sy) {
-            if (currentPiece.shape[sy][sx] != 0) {
+            if (currentPiece.cell(sx, sy)) {
                 if (x == currentPiece.x + sx && y == currentPiece.y + sy) return true;
             }
         }
@@ -650,7 +635,7 @@ static inline bool isCurrentPieceCell(int x, int y) {
 static bool collidesAt(const Piece& piece, int px, int py, const Board& b) {
     for (int sx = 0; sx < piece.width; ++sx) {
         for (int sy = 0; sy < piece.height; ++sy) {
-            if (piece.shape[sy][sx] == 0) continue;
+            if (!piece.cell(sx, sy)) continue;
             int bx = px + sx;
             int by = py + sy;
             if (bx < 0 || bx >= boardWidth || by < 0 || by >= boardHeight) return true;
@@ -672,22 +657,9 @@ static int computeGhostY(const Piece& piece, const Board& b) {
     return gy;
 }
 
-// Map piece color index to an SDL_Color (same palette as board rendering)
-static SDL_Color colorFromValue(int val) {
-    switch (val) {
-        case 1: return SDL_Color{0, 255, 255, 255};   // cyan (I)
-        case 2: return SDL_Color{255, 255, 0, 255};   // yellow (O)
-        case 3: return SDL_Color{128, 0, 128, 255};   // purple (T)
-        case 4: return SDL_Color{255, 0, 0, 255};     // blue (J)
-        case 5: return SDL_Color{0, 0, 255, 255};     // orange (L)
-        case 6: return SDL_Color{0, 255, 0, 255};     // green (S)
-        case 7: return SDL_Color{255, 0, 0, 255};     // red (Z)
-        default: return SDL_Color{127, 127, 127, 255};
-    }
-}
-
 // Render a hollow, translucent ghost piece at the landing position and highlight grid cells in-between
 void renderGhostPiece() {
+    TRACE_SCOPE("renderGhostPiece");
     if (clearingRows) return; // skip during clear animation
 
     int gy = computeGhostY(currentPiece, board);
@@ -706,7 +678,7 @@ void renderGhostPiece() {
     // Draw ghost as hollow rectangles
     for (int sx = 0; sx < currentPiece.width; ++sx) {
         for (int sy = 0; sy < currentPiece.height; ++sy) {
-            if (currentPiece.shape[sy][sx] == 0) continue;
+            if (!currentPiece.cell(sx, sy)) continue;
 
             int gx = currentPiece.x + sx;
             int gyCell = gy + sy;
@@ -734,7 +706,7 @@ void renderGhostPiece() {
                 // Find occupied rows for this column
                 int minSy = INT_MAX, maxSy = INT_MIN;
                 for (int sy = 0; sy < currentPiece.height; ++sy) {
-                    if (currentPiece.shape[sy][sx] != 0) {
+                    if (currentPiece.cell(sx, sy)) {
                         minSy = std::min(minSy, sy);
                         maxSy = std::max(maxSy, sy);
                     }
@@ -764,105 +736,57 @@ void renderGhostPiece() {
     SDL_SetRenderDrawBlendMode(gRenderer, oldMode);
 }
 
-void renderBoardBlocks() {
-    // Render the current blocks on the board
-    std::vector<SDL_FRect> blockRects;
+// Draw every occupied board cell with one SDL_RenderFillRects call per color instead
+// of one call per block. Locked blocks are darkened; with highlightFalling the cells of
+// the falling piece keep their full color.
+static void renderBoardCells(bool highlightFalling) {
+    constexpr int kBuckets = 2 * SDL_arraysize(kPalette); // each color, locked and falling
+
+    auto bucketOf = [highlightFalling](int x, int y) {
+        const bool falling = highlightFalling && isCurrentPieceCell(x, y);
+        return paletteIndex(board.current[x][y]) * 2 + (falling ? 1 : 0);
+    };
+
+    // Count first so each list is sized once in the frame arena
+    int counts[kBuckets] = {};
+    for (int x = 0; x < boardWidth; ++x)
+        for (int y = 0; y < boardHeight; ++y)
+            if (board.current[x][y] != 0) counts[bucketOf(x, y)]++;
+
+    FrameVector<SDL_FRect> rects[kBuckets];
+    for (int i = 0; i < kBuckets; ++i) rects[i].reserve(counts[i]);
     for (int x = 0; x < boardWidth; ++x) {
         for (int y = 0; y < boardHeight; ++y) {
-            if (board.current[x][y] != 0) {
-                SDL_FRect rect{ static_cast<float>(x * blockSize), static_cast<float>(y * blockSize), blockSize, blockSize };
-                blockRects.push_back(rect);
-            }
+            if (board.current[x][y] == 0) continue;
+            rects[bucketOf(x, y)].push_back(SDL_FRect{ static_cast<float>(x * blockSize) + spacing / 2,
+                                                       static_cast<float>(y * blockSize) + spacing / 2,
+                                                       blockSize - spacing,
+                                                       blockSize - spacing });
         }
     }
 
-    // Render the rectangles for the blocks
-    if (!blockRects.empty()) {
-        // Render rectangles for the blocks with individual colors
-        for (size_t i = 0; i < blockRects.size(); ++i) {
-            for (int x = 0; x < boardWidth; ++x) {
-                for (int y = 0; y < boardHeight; ++y) {
-                    int val = board.current[x][y];
-                    if (val != 0) {
-                        SDL_FRect rect{ static_cast<float>(x * blockSize) + spacing / 2,
-                                        static_cast<float>(y * blockSize) + spacing / 2,
-                                        blockSize - spacing,
-                                        blockSize - spacing };
-                        SDL_Color color;
-                        switch (val) {
-                            case 1: color = {0, 255, 255, 255}; break; //cyan
-                            case 2: color = {255, 255, 0, 255}; break; //yellow
-                            case 3: color = {128, 0, 128, 255}; break; //purple
-                            case 4: color = {255, 0, 0, 255}; break; //blue
-                            case 5: color = {0, 0, 255, 255}; break; //orange
-                            case 6: color = {0, 255, 0, 255}; break; //green
-                            case 7: color = {255, 0, 0, 255}; break; //red
-                            default: color = {127, 127, 127, 255}; break; //grey
-                        }
-                        // Check if this block is part of the current falling piece
-                        bool isCurrentPieceBlock = false;
-                        for (int sx = 0; sx < currentPiece.width; ++sx) {
-                            for (int sy = 0; sy < currentPiece.height; ++sy) {
-                                if (currentPiece.shape[sy][sx] != 0 &&
-                                    x == currentPiece.x + sx &&
-                                    y == currentPiece.y + sy) {
-                                    isCurrentPieceBlock = true;
-                                    break;
-                                }
-                            }
-                            if (isCurrentPieceBlock) break;
-                        }
-                        // Only darken locked pieces
-                        if (!isCurrentPieceBlock) {
-                            color.r = static_cast<Uint8>(color.r * 0.7f);
-                            color.g = static_cast<Uint8>(color.g * 0.7f);
-                            color.b = static_cast<Uint8>(color.b * 0.7f);
-                        }
-                        SDL_SetRenderDrawColor(gRenderer, color.r, color.g, color.b, color.a);
-                        SDL_RenderFillRect(gRenderer, &rect);
-                    }
-                }
-            }
-        }
+    for (int i = 0; i < kBuckets; ++i) {
+        if (rects[i].empty()) continue;
+        const SDL_Color color = (i & 1) ? kPalette[i / 2] : shadedColor(kPalette[i / 2], kLockedShade);
+        SDL_SetRenderDrawColor(gRenderer, color.r, color.g, color.b, color.a);
+        SDL_RenderFillRects(gRenderer, rects[i].data(), static_cast<int>(rects[i].size()));
     }
+}
+
+void renderBoardBlocks() {
+    TRACE_SCOPE("renderBoardBlocks");
+    // Render the current blocks on the board, the falling piece at full brightness
+    renderBoardCells(true);
 
     if (placementPreviewSelection != 2 ) {// Draw the ghost on top of the locked blocks (but before presenting)
         renderGhostPiece();
     }
+    renderPlacementHint();
 }
 
 void renderBoardBlocksDuringAnimation() {
     // Draw the blocks
-    for (int x = 0; x < boardWidth; ++x) {
-        for (int y = 0; y < boardHeight; ++y) {
-            int val = board.current[x][y];
-            if (val != 0) {
-                SDL_FRect rect{ static_cast<float>(x * blockSize) + spacing / 2,
-                                static_cast<float>(y * blockSize) + spacing / 2,
-                                blockSize - spacing,
-                                blockSize - spacing };
-                SDL_Color color;
-                switch (val) {
-                    case 1: color = {0, 255, 255, 255}; break; //cyan
-                    case 2: color = {255, 255, 0, 255}; break; //yellow
-                    case 3: color = {128, 0, 128, 255}; break; //purple
-                    case 4: color = {255, 0, 0, 255}; break; //blue
-                    case 5: color = {0, 0, 255, 255}; break; //orange
-                    case 6: color = {0, 255, 0, 255}; break; //green
-                    case 7: color = {255, 0, 0, 255}; break; //red
-                    default: color = {127, 127, 127, 255}; break; //grey
-                }
-                
-                color.r = static_cast<Uint8>(color.r * 0.7f);
-                color.g = static_cast<Uint8>(color.g * 0.7f);
-                color.b = static_cast<Uint8>(color.b * 0.7f);
-                        
-                SDL_SetRenderDrawColor(gRenderer, color.r, color.g, color.b, color.a);
-                SDL_RenderFillRect(gRenderer, &rect);
-                
-            }
-        }
-    }
+    renderBoardCells(false);
 }
 
 // Game Over animation: fill the entire board with grey blocks row-by-row, left-to-right
@@ -875,7 +799,8 @@ void animateGameOverFill(int cellDelayMs /*=12*/) {
         for (int x = 0; x < boardWidth; ++x) {
             board.current[x][y] = greyVal;
 
-            // Draw the frame
+            // Draw the frame (each step is a frame of its own for the arena)
+            frameArena().reset();
             renderUI();
             renderBoardBlocksDuringAnimation();
 
@@ -884,13 +809,17 @@ void animateGameOverFill(int cellDelayMs /*=12*/) {
             gameOverLabel.loadFromRenderedText("GAME OVER", textColor);
             gameOverLabel.render(200, 300);
 
+            if (offscreenRenderActive()) {
+                if (x == boardWidth - 1) offscreenCaptureFrame(); // one frame per row, no waiting
+                continue;
+            }
             SDL_RenderPresent(gRenderer);
             SDL_Delay(cellDelayMs);
         }
     }
 
     // Brief pause with filled board
-    SDL_Delay(3000);
+    if (!offscreenRenderActive()) SDL_Delay(3000);
 
     clearingRows = savedClearing;
 }
@@ -919,8 +848,8 @@ static inline void renderTetrisFlash(Uint64 nowNs) {
     SDL_SetRenderDrawBlendMode(gRenderer, oldMode);
 }
 
-void animateRowClear() {
-    Uint64 now = SDL_GetTicksNS();
+void animateRowClear(bool draw) {
+    Uint64 now = gameTimeNs();
     int animFrame = ((now - clearAnimStart) * clearAnimSteps) / clearAnimDuration;
     if (animFrame > clearAnimStep) {
         clearAnimStep = animFrame;
@@ -942,43 +871,48 @@ void animateRowClear() {
         }
     }
 
-    renderUI();
+    if (draw) {
+        renderUI();
 
-    renderBoardBlocksDuringAnimation();
+        renderBoardBlocksDuringAnimation();
 
-    renderParticles();
+        renderParticles();
 
-    // Draw white flash overlay (only active for 4-line clears)
-    renderTetrisFlash(now);
+        // Draw white flash overlay (only active for 4-line clears)
+        renderTetrisFlash(now);
 
-    SDL_RenderPresent(gRenderer);
+        presentGameplayFrame();
+    }
 
     // Pause for animation duration
     if (now - clearAnimStart >= clearAnimDuration) {
-        // Shift rows down
-        for (int row : rowsToClear) {
-            for (int y = row; y > 0; --y) {
-                for (int x = 0; x < boardWidth; ++x) {
-                    board.current[x][y] = board.current[x][y - 1];
-                }
-            }
+        collapseClearedRows();
+    }
+}
+
+void collapseClearedRows() {
+    // Shift rows down
+    for (int row : rowsToClear) {
+        for (int y = row; y > 0; --y) {
             for (int x = 0; x < boardWidth; ++x) {
-                board.current[x][0] = 0;
+                board.current[x][y] = board.current[x][y - 1];
             }
         }
-        clearingRows = false;
-        rowsToClear.clear();
+        for (int x = 0; x < boardWidth; ++x) {
+            board.current[x][0] = 0;
+        }
     }
-    capFrameRate();
+    clearingRows = false;
+    rowsToClear.clear();
 }
 
-bool checkGameOver() {
+bool spawnBlocked() {
     bool gameOver = false;
     for (int sx = 0; sx < currentPiece.width; ++sx) 
     {
         for (int sy = 0; sy < currentPiece.height; ++sy) 
         {
-            if (currentPiece.shape[sy][sx] != 0) 
+            if (currentPiece.cell(sx, sy)) 
             {
                 int boardX = currentPiece.x + sx;
                 int boardY = currentPiece.y + sy;
@@ -991,38 +925,42 @@ bool checkGameOver() {
         }
         if (gameOver) break;
     }
+    return gameOver;
+}
+
+bool checkGameOver() {
+    const bool gameOver = spawnBlocked();
     if (gameOver) {
         // Render "Game Over" animation
         animateGameOverFill(12);
 
-        //write save data
-        writeSaveData();
-        maxLevelAchieved = std::max(levelValue, maxLevelAchieved);
-
+        replayFinishRecording(static_cast<Uint32>(gameTick));
+        if (botActive()) {
+            botGameOver(); // bot games stay out of the save file and leaderboard
+        } else if (gameCountsForRecords()) {
+            //write save data and history
+            writeSaveData();
+            recordFinishedGame();
+            maxLevelAchieved = std::max(levelValue, maxLevelAchieved);
+        }
         // Reset game state instead of restarting main
-        scoreValue = 0;
-        levelValue = 0;
-        rowsCleared = 0;
-        levelIncrease = 0;
-        dropSpeed = 900000000;
-        holdPiece = Piece();
-        holdUsed = false;
-        for (int x = 0; x < boardWidth; ++x)
-            for (int y = 0; y < boardHeight; ++y)
-                board.current[x][y] = 0;
-        pickPiece = std::rand() % 7;
-        nextPickPiece = std::rand() % 7;
-        currentPiece = pieceTypes[pickPiece];
-        nextPiece = pieceTypes[nextPickPiece];
-        currentPiece.x = boardWidth / 2;
-        currentPiece.y = 0;
-        score.loadFromRenderedText(std::to_string(scoreValue), { 0xFF, 0xFF, 0xFF, 0xFF });
-        level.loadFromRenderedText(std::to_string(levelValue+1), { 0xFF, 0xFF, 0xFF, 0xFF });
-        newPiece = false;
+        resetGameplayStateForNewGame();
     }
     return gameOver;
 }
 
+// Replay seeking and netplay rollbacks are replayed within a frame, and local versus and
+// the spectator grid draw their boards themselves, from board coordinates particles do not fit
+bool silentSimulation() {
+    return replaySeeking() || netplayResimulating() || versusActive() || spectatorActive();
+}
+
+// Bot games, replays being watched and offscreen renders are not the player's games, and a
+// practice game with a placement taken back is not a fair one
+bool gameCountsForRecords() {
+    return !botActive() && !offscreenRenderActive() && !replayPlaybackActive() && !undoHistoryTookBack();
+}
+
 void resetGameplayStateForNewGame() {
     pieceTypes[0] = iPiece;
     pieceTypes[1] = oPiece;
@@ -1042,9 +980,12 @@ void resetGameplayStateForNewGame() {
     holdUsed = false;
     newPiece = false;
     hardDropFlag = false;
+    alternateIPieceRotationOffset = false;
 
     clearingRows = false;
     rowsToClear.clear();
+    rowsToClear.reserve(boardHeight);
+    particles.reserve(kParticleReserve);
     clearAnimStart = 0;
     clearAnimStep = 0;
 
@@ -1054,14 +995,19 @@ void resetGameplayStateForNewGame() {
     pieceLanded = false;
     pieceLandedOnce = false;
 
+    gameTick = 0;
+    lastDropTime = 0;
+
     for (int x = 0; x < boardWidth; ++x) {
         for (int y = 0; y < boardHeight; ++y) {
             board.current[x][y] = 0;
         }
     }
 
-    pickPiece = drawPieceIndex();
-    nextPickPiece = drawPieceIndex();
+    beginGameStats();
+    replayBeginRecording();
+    flightGameStarted();
+    pickPiece = popNextPiece();
 
     if (pickPiece < 0 || pickPiece > 6) pickPiece = 0;
     if (nextPickPiece < 0 || nextPickPiece > 6) nextPickPiece = 1;
@@ -1069,10 +1015,10 @@ void resetGameplayStateForNewGame() {
     currentPiece = pieceTypes[pickPiece];
     nextPiece = pieceTypes[nextPickPiece];
 
-    if (currentPiece.width <= 0 || currentPiece.height <= 0 || currentPiece.shape.empty()) {
+    if (currentPiece.isEmpty()) {
         currentPiece = iPiece;
     }
-    if (nextPiece.width <= 0 || nextPiece.height <= 0 || nextPiece.shape.empty()) {
+    if (nextPiece.isEmpty()) {
         nextPiece = oPiece;
     }
 
@@ -1081,146 +1027,16 @@ void resetGameplayStateForNewGame() {
 
     score.loadFromRenderedText(std::to_string(scoreValue), { 0xFF, 0xFF, 0xFF, 0xFF });
     level.loadFromRenderedText(std::to_string(levelValue + 1), { 0xFF, 0xFF, 0xFF, 0xFF });
-}
-
-void readSaveData() {
-    std::ifstream saveFile("tetris_save.dat", std::ios::binary);
-    if (saveFile.is_open()) {
-        bool fs = false;
-        int wsms = 0;
-        bool glenabled = true;
-        int bg = 0;
-        int pps = 0;
-        SDL_Keycode hdk = SDLK_SPACE;
-        SDL_Keycode hk = SDLK_H;
-        SDL_Keycode rck = SDLK_UP;
-        SDL_Keycode rcck = SDLK_LCTRL;
-        SDL_GamepadButton hdcb = static_cast<SDL_GamepadButton>(SDL_GAMEPAD_BUTTON_SOUTH);
-        SDL_GamepadButton hcb = static_cast<SDL_GamepadButton>(SDL_GAMEPAD_BUTTON_LEFT_SHOULDER);
-        SDL_GamepadButton rccb = static_cast<SDL_GamepadButton>(SDL_GAMEPAD_BUTTON_WEST);
-        SDL_GamepadButton rcccb = static_cast<SDL_GamepadButton>(SDL_GAMEPAD_BUTTON_EAST);
-        int savedHighScore = 0;
-        int savedLevel = 0;
-        saveFile.read(reinterpret_cast<char*>(&fs), sizeof(fs));
-        saveFile.read(reinterpret_cast<char*>(&wsms), sizeof(wsms));
-        saveFile.read(reinterpret_cast<char*>(&glenabled), sizeof(glenabled));
-        saveFile.read(reinterpret_cast<char*>(&bg), sizeof(bg));
-        saveFile.read(reinterpret_cast<char*>(&pps), sizeof(pps));
-        saveFile.read(reinterpret_cast<char*>(&hdk), sizeof(hdk));
-        saveFile.read(reinterpret_cast<char*>(&hk), sizeof(hk));
-        saveFile.read(reinterpret_cast<char*>(&rck), sizeof(rck));
-        saveFile.read(reinterpret_cast<char*>(&rcck), sizeof(rcck));
-        saveFile.read(reinterpret_cast<char*>(&hdcb), sizeof(hdcb));
-        saveFile.read(reinterpret_cast<char*>(&hcb), sizeof(hcb));
-        saveFile.read(reinterpret_cast<char*>(&rccb), sizeof(rccb));
-        saveFile.read(reinterpret_cast<char*>(&rcccb), sizeof(rcccb));
-        saveFile.read(reinterpret_cast<char*>(&savedHighScore), sizeof(savedHighScore));
-        saveFile.read(reinterpret_cast<char*>(&savedLevel), sizeof(savedLevel));
-        saveFile.close();
-        fullscreenEnabled = fs;
-        WindowSizeMenuSelection = wsms;
-        gridLinesEnabled = glenabled;
-        blockGapSelection = bg;
-        placementPreviewSelection = pps;
-        hardDropKey = hdk;
-        holdKey = hk;
-        rotateClockwiseKey = rck;
-        rotateCounterClockwiseKey = rcck;
-        hardDropControllerBind = hdcb;
-        holdControllerBind = hcb;
-        rotateClockwiseControllerBind = rccb;
-        rotateCounterClockwiseControllerBind = rcccb;
-        spacing = blockGapValues[blockGapSelection];
-        if (savedHighScore > highScoreValue) highScoreValue = savedHighScore;
-        if (savedLevel > maxLevelAchieved) maxLevelAchieved = savedLevel;
-        SDL_Log("Loaded save data: High Score=%d, Max Level=%d", highScoreValue, maxLevelAchieved);
-    }
-}
 
-void writeSaveData() {
-    bool fs = fullscreenEnabled;
-    int wsms = WindowSizeMenuSelection;
-    bool glenabled = gridLinesEnabled;
-    int bg = blockGapSelection;
-    int pps = placementPreviewSelection;
-    int hdk = hardDropKey;
-    int hk = holdKey;
-    int rck = rotateClockwiseKey;
-    int rcck = rotateCounterClockwiseKey;
-    int hdcb = hardDropControllerBind;
-    int hcb = holdControllerBind;
-    int rccb = rotateClockwiseControllerBind;
-    int rcccb = rotateCounterClockwiseControllerBind;
-    int savedHighScore = 0;
-    int savedLevel = 0;
-    // Read previous values
-    std::ifstream inFile("tetris_save.dat", std::ios::binary);
-    if (inFile.is_open()) {
-        bool prev_fs = false;
-        int prev_wsms = 0;
-        bool prev_glenabled = true;
-        int prev_bg = 0;
-        int prev_pps = 0;
-        int prev_hdk = SDLK_SPACE;
-        int prev_hk = SDLK_H;
-        int prev_rck = SDLK_UP;
-        int prev_rcck = SDLK_LCTRL;
-        int prev_hdcb = static_cast<int>(SDL_GAMEPAD_BUTTON_SOUTH);
-        int prev_hcb = static_cast<int>(SDL_GAMEPAD_BUTTON_LEFT_SHOULDER);
-        int prev_rccb = static_cast<int>(SDL_GAMEPAD_BUTTON_WEST);
-        int prev_rcccb = static_cast<int>(SDL_GAMEPAD_BUTTON_EAST);
-        int prevHighScore = 0;
-        int prevLevel = 0;
-        inFile.read(reinterpret_cast<char*>(&prev_fs), sizeof(prev_fs));
-        inFile.read(reinterpret_cast<char*>(&prev_wsms), sizeof(prev_wsms));
-        inFile.read(reinterpret_cast<char*>(&prev_glenabled), sizeof(prev_glenabled));
-        inFile.read(reinterpret_cast<char*>(&prev_bg), sizeof(prev_bg));
-        inFile.read(reinterpret_cast<char*>(&prev_pps), sizeof(prev_pps));
-        inFile.read(reinterpret_cast<char*>(&prev_hdk), sizeof(prev_hdk));
-        inFile.read(reinterpret_cast<char*>(&prev_hk), sizeof(prev_hk));
-        inFile.read(reinterpret_cast<char*>(&prev_rck), sizeof(prev_rck));
-        inFile.read(reinterpret_cast<char*>(&prev_rcck), sizeof(prev_rcck));
-        inFile.read(reinterpret_cast<char*>(&prev_hdcb), sizeof(prev_hdcb));
-        inFile.read(reinterpret_cast<char*>(&prev_hcb), sizeof(prev_hcb));
-        inFile.read(reinterpret_cast<char*>(&prev_rccb), sizeof(prev_rccb));
-        inFile.read(reinterpret_cast<char*>(&prev_rcccb), sizeof(prev_rcccb));
-        inFile.read(reinterpret_cast<char*>(&prevHighScore), sizeof(prevHighScore));
-        inFile.read(reinterpret_cast<char*>(&prevLevel), sizeof(prevLevel));
-        inFile.close();
-        savedHighScore = prevHighScore;
-        savedLevel = prevLevel;
-    }
-    int outHighScore = std::max(highScoreValue, savedHighScore);
-    int outLevel = std::max(levelValue, savedLevel);
-    SDL_Log("levelValue: %d, savedLevel: %d, outLevel: %d", levelValue, savedLevel, outLevel);
-    SDL_Log("Saving data: High Score=%d, Max Level=%d", outHighScore, outLevel);
-    std::ofstream saveFile("tetris_save.dat", std::ios::binary);
-    if (saveFile.is_open()) {
-        saveFile.write(reinterpret_cast<const char*>(&fs), sizeof(fs));
-        saveFile.write(reinterpret_cast<const char*>(&wsms), sizeof(wsms));
-        saveFile.write(reinterpret_cast<const char*>(&glenabled), sizeof(glenabled));
-        saveFile.write(reinterpret_cast<const char*>(&bg), sizeof(bg));
-        saveFile.write(reinterpret_cast<const char*>(&pps), sizeof(pps));
-        saveFile.write(reinterpret_cast<const char*>(&hdk), sizeof(hdk));
-        saveFile.write(reinterpret_cast<const char*>(&hk), sizeof(hk));
-        saveFile.write(reinterpret_cast<const char*>(&rck), sizeof(rck));
-        saveFile.write(reinterpret_cast<const char*>(&rcck), sizeof(rcck));
-        saveFile.write(reinterpret_cast<const char*>(&hdcb), sizeof(hdcb));
-        saveFile.write(reinterpret_cast<const char*>(&hcb), sizeof(hcb));
-        saveFile.write(reinterpret_cast<const char*>(&rccb), sizeof(rccb));
-        saveFile.write(reinterpret_cast<const char*>(&rcccb), sizeof(rcccb));
-        saveFile.write(reinterpret_cast<const char*>(&outHighScore), sizeof(outHighScore));
-        saveFile.write(reinterpret_cast<const char*>(&outLevel), sizeof(outLevel));
-        saveFile.close();
-    } else {
-        SDL_Log("Failed to open save file for writing.");
-    }
+    applyStartPosition(); // --position
+    finesseNewGame();
+    undoHistoryReset(); // --practice
 }
 
 bool pieceLandedOnce = false;
 
 void autoDrop(bool canPlaceNextPiece){
-    Uint64 now = SDL_GetTicksNS();
+    Uint64 now = gameTimeNs();
     if (now - lastDropTime >= dropSpeed && canPlaceNextPiece) {
         currentPiece.y += 1;
         lastDropTime = now;
@@ -1253,15 +1069,17 @@ void handleLockDelay(bool canPlaceNextPiece) {
 
 void handlePieceLanded() {
     if (newPiece || hardDropFlag) { 
+        finessePieceLocked();
         for (int sx = 0; sx < currentPiece.width; ++sx) {
             for (int sy = 0; sy < currentPiece.height; ++sy) {
-                if (currentPiece.shape[sy][sx] != 0) {
+                if (currentPiece.cell(sx, sy)) {
                     int boardX = currentPiece.x + sx;
                     int boardY = currentPiece.y + sy;
                     board.current[boardX][boardY] = currentPiece.color;
                 }
             }
         }
+        piecesPlaced++;
 
         int fullRows[boardHeight];
 
@@ -1292,7 +1110,7 @@ void handlePieceLanded() {
 
         if (!clearingRows && clearedRows > 0) {
             clearingRows = true;
-            clearAnimStart = SDL_GetTicksNS();
+            clearAnimStart = gameTimeNs();
             clearAnimStep = 0;
             rowsToClear.clear();
             for (int i = 0; i < boardHeight; ++i) {
@@ -1305,42 +1123,31 @@ void handlePieceLanded() {
             }
         }
 
-        switch (clearedRows)
-            {
-            case 1:
-                scoreValue += 40*(levelValue+1); // Bonus for clearing one row
-                break;
-            case 2:
-                scoreValue += 100*(levelValue+1); // Bonus for clearing two rows
-                break;
-            case 3:
-                scoreValue += 300*(levelValue+1); // Bonus for clearing three rows
-                break;
-            case 4:
-                scoreValue += 1200*(levelValue+1); // Bonus for clearing four rows (Tetris)
-            default:
-                break;
-            }
+        if (clearedRows == 4) playSound(SoundEffect::Tetris);
+        else if (clearedRows > 0) playSound(SoundEffect::LineClear);
+        else if (!hardDropFlag) playSound(SoundEffect::Lock); // a hard drop has its own impact sound
+
+        scoreValue += lineClearScore(clearedRows, levelValue);
 
-            score.loadFromRenderedText( std::to_string(scoreValue), { 0xFF, 0xFF, 0xFF, 0xFF } );
-            if (scoreValue > highScoreValue) {
+            if (!silentSimulation()) score.loadFromRenderedText( std::to_string(scoreValue), { 0xFF, 0xFF, 0xFF, 0xFF } );
+            if (scoreValue > highScoreValue && !silentSimulation() && gameCountsForRecords()) {
                 highScoreValue = scoreValue;
                 highScore.loadFromRenderedText( std::to_string(highScoreValue), { 0xFF, 0xFF, 0xFF, 0xFF } );
             }
 
             rowsCleared += clearedRows;
 
-            int calculatedLevel = rowsCleared / 10;
+            int calculatedLevel = levelForLines(rowsCleared);
             if (calculatedLevel > levelValue) {
                 levelValue = calculatedLevel;
-                dropSpeed = std::max(50000000, 900000000 - (levelValue * 70000000)); // Cap at 0.05s drop speed
+                dropSpeed = dropSpeedForLevel(levelValue);
+                playSound(SoundEffect::LevelUp);
             }
 
         currentPiece.y = 0; // Reset for next falling piece
         currentPiece.x = boardWidth / 2; // Reset horizontal position to center
-        currentPiece = pieceTypes[nextPickPiece]; // Select a new random piece
-        nextPickPiece = std::rand() % 7; // Randomly select the next piece
-        nextPiece = pieceTypes[nextPickPiece]; // Update next piece
+        pickPiece = popNextPiece();
+        currentPiece = pieceTypes[pickPiece]; // Next piece from the queue
         newPiece = false;
         hardDropFlag = false;
         holdUsed = false; // Reset hold usage for the new piece
@@ -1354,6 +1161,60 @@ void handlePieceLanded() {
     }
 }
 
+// Restart the piece sequence; the same seed and randomizer always give the same pieces
+void seedPieceRandomizer(Uint64 seed) {
+    pieceQueueInit(pieceQueue, randomizerKind, seed);
+    nextPickPiece = pieceQueuePeek(pieceQueue, 0);
+    nextPiece = pieceTypes[nextPickPiece];
+}
+
+// Take the front of the queue and refresh the NEXT preview
+int popNextPiece() {
+    const int piece = pieceQueuePop(pieceQueue);
+    nextPickPiece = pieceQueuePeek(pieceQueue, 0);
+    nextPiece = pieceTypes[nextPickPiece];
+    return piece;
+}
+
+#ifdef TETRIS_ALLOC_CHECK
+bool checkPiecePathAllocations() {
+    // Everything touched below is plain data, so a byte copy is a full snapshot
+    const Piece savedCurrent = currentPiece;
+    const Piece savedNext = nextPiece;
+    const Piece savedHold = holdPiece;
+    const PieceQueue savedQueue = pieceQueue;
+    const int savedPick = pickPiece;
+    const int savedNextPick = nextPickPiece;
+    Board scratch;
+
+    const Uint64 before = heapAllocationCount();
+    for (int i = 0; i < 2 * kMaxPreview; ++i) {
+        pickPiece = popNextPiece(); // spawn
+        currentPiece = pieceTypes[pickPiece];
+        currentPiece.x = boardWidth / 2;
+        currentPiece.y = 0;
+        resetRotation();
+        if (holdPiece.isEmpty()) firstHold(); else pieceSwap(); // hold, then swap on later passes
+        currentPiece.y = maxDrop(currentPiece, scratch); // lock
+        pieceSet(currentPiece, scratch, currentPiece.color);
+    }
+    const Uint64 allocations = heapAllocationCount() - before;
+
+    currentPiece = savedCurrent;
+    nextPiece = savedNext;
+    holdPiece = savedHold;
+    pieceQueue = savedQueue;
+    pickPiece = savedPick;
+    nextPickPiece = savedNextPick;
+
+    if (allocations != 0) {
+        SDL_Log("Piece spawn/hold/lock path made %llu heap allocations", static_cast<unsigned long long>(allocations));
+    }
+    SDL_assert_always(allocations == 0);
+    return allocations == 0;
+}
+#endif
+
 std::string chooseWindowTitle() {
     int alternateIndex = std::rand() % 10;
     if (alternateIndex == 0) {
@@ -1364,8 +1225,9 @@ std::string chooseWindowTitle() {
 }
 
 Piece pieceTypes[7] = { iPiece, oPiece, tPiece, lPiece, jPiece, sPiece, zPiece }; // Array of piece types
-int pickPiece = drawPieceIndex();  // Randomly select the current piece from pieceTypes 
-int nextPickPiece = drawPieceIndex(); // Randomly select the next piece from pieceTypes
+PieceQueue pieceQueue{}; // Upcoming pieces; reseeded at the start of every game
+int pickPiece = 0;      // Current piece index into pieceTypes
+int nextPickPiece = 1;  // First piece in the preview queue
 Piece currentPiece = pieceTypes[pickPiece]; // Initialize current piece
 Piece nextPiece = pieceTypes[nextPickPiece]; // Initialize next piece
 
@@ -1381,6 +1243,7 @@ Piece holdPiece; // Piece to hold
 bool newPiece{ false }; // To track if a new piece is needed
 bool holdUsed{ false }; // To track if hold was used in the current turn
 int rowsCleared = 0; // To track number of cleared rows
+int piecesPlaced = 0; // Pieces locked this game (for history/PPS)
 int levelIncrease = 0; // To track level increase threshold
 bool hardDropFlag = false; // To track if hard drop was used
 bool alternateIPieceRotationOffset = false; // To alternate I piece rotation offsets
@@ -1396,11 +1259,102 @@ const int maxLockDelayRotations = 5; // Max rotations allowed during lock delay
 bool pieceLanded = false; // True if just landed, false if still falling
 
 Board board; // The game board
+Uint64 gameTick = 0; // Gameplay frames simulated this game
+
+void applyInputAction(InputAction action) {
+    replayRecordAction(static_cast<Uint8>(action));
+    flightRecordAction(static_cast<Uint8>(action));
+    switch (action) {
+        case InputAction::MoveLeft: moveLeft(); break;
+        case InputAction::MoveRight: moveRight(); break;
+        case InputAction::RotateClockwise: rotateClockwise(); break;
+        case InputAction::RotateCounterClockwise: rotateCounterClockwise(); break;
+        case InputAction::SoftDrop: softDrop(); break;
+        case InputAction::HardDrop: hardDrop(); break;
+        case InputAction::Hold: hold(); break;
+        case InputAction::IncreaseLevel: increaseLevel(); break;
+        default: break; // Pause is a menu change, not part of the game
+    }
+}
+
+void presentGameplayFrame() {
+    renderReplayTimeline();
+    renderAllocOverlay();
+    renderLatencyMarker();
+    latencyRenderSubmitted();
+    offscreenCaptureFrame();
+    {
+        TRACE_SCOPE("SDL_RenderPresent");
+        SDL_RenderPresent( gRenderer ); //update screen
+    }
+    latencyFramePresented();
+}
+
+// One tick of PLAYING. Silent ticks (replay seeking) skip drawing and the frame cap,
+// and stop at a blocked spawn instead of running the game over sequence.
+static bool stepGameplay(bool draw) {
+    allocSetSubsystem(AllocSubsystem::Render);
+    if (draw) renderUI();
+
+    if (clearingRows) {
+        animateRowClear(draw); // Skip rest of the frame while animating
+    } else {
+        //check game over
+        allocSetSubsystem(AllocSubsystem::Simulation);
+        if (currentPiece.y == 0) {
+            if (!draw) { if (spawnBlocked()) { return false; } }
+            else if (checkGameOver()) { return false; } // Skip rest of the frame and start new game
+        }
+
+        if (draw) advisorUpdate(); // hand a changed position to the hint worker while the board holds only locked cells
+
+        // Check if the piece can be placed at its next position
+        bool canPlaceNext = checkPlacement(currentPiece, board, 0, 1);
+
+        // Place the current piece's shape onto the board at its current position
+        pieceSet(currentPiece, board, currentPiece.color);
+
+        if (draw) {
+            allocSetSubsystem(AllocSubsystem::Render);
+            renderBoardBlocks();
+
+            renderParticles();
+
+            presentGameplayFrame();
+            allocSetSubsystem(AllocSubsystem::Simulation);
+        }
+
+        if (!newPiece) { pieceSet(currentPiece, board); } // Clear the piece's current position on the board
+
+        autoDrop(canPlaceNext); // Handle automatic piece dropping based on drop speed
+
+        handleLockDelay(canPlaceNext); // Handle lock delay if the piece has landed
+
+        handlePieceLanded(); // Handle piece landing and row clearing
+    }
+    undoHistoryTick(); // record a lock once any rows it cleared have collapsed
+
+    gameTick++;
+    replayTickEnded();
+    flightTickEnded();
+    if (draw) capFrameRate();
+    return true;
+}
+
+void runGameplayFrame() {
+    TRACE_SCOPE("gameplay frame");
+    stepGameplay(true);
+}
+
+bool simulateGameplayTick() {
+    return stepGameplay(false);
+}
 
 void moveLeft() {
     if (checkPlacement(currentPiece, board, -1, 0)){ //check if can move left
         pieceSet(currentPiece, board); //clear current position
         currentPiece.x -= 1; //move left
+        playSound(SoundEffect::Move);
         // Lock delay: count and reset only on successful horizontal move while grounded
         if (pieceLandedOnce && pieceLanded) {
             if (lockDelayMovesUsed < maxLockDelayMoves) {
@@ -1415,6 +1369,7 @@ void moveRight() {
     if (checkPlacement(currentPiece, board, 1, 0)){ //check if can move right
         pieceSet(currentPiece, board); //clear current position
         currentPiece.x += 1; //move right
+        playSound(SoundEffect::Move);
         // Lock delay: count and reset only on successful horizontal move while grounded
         if (pieceLandedOnce && pieceLanded) {
             if (lockDelayMovesUsed < maxLockDelayMoves) {
@@ -1428,9 +1383,10 @@ void moveRight() {
 void rotateClockwise() {
     // Hard guard: prevent further rotations on ground if rotation budget is exhausted
     if (pieceLandedOnce && pieceLanded && lockDelayRotationsUsed >= maxLockDelayRotations) {
-        SDL_Log("Rotation CW blocked: rotation budget exhausted during lock delay");
+        LOG_DEBUG("Rotation CW blocked: rotation budget exhausted during lock delay");
         return;
     }
+    const int fromRot = currentPiece.rotation;
     if (currentPiece.width == currentPiece.height) { // Dont perform rotation if O piece
         return;
     }
@@ -1441,14 +1397,16 @@ void rotateClockwise() {
     {
         rotatePieceClockwise();
     }
+    if (currentPiece.rotation != fromRot) playSound(SoundEffect::Rotate);
 }
 
 void rotateCounterClockwise() {
     // Hard guard: prevent further rotations on ground if rotation budget is exhausted
     if (pieceLandedOnce && pieceLanded && lockDelayRotationsUsed >= maxLockDelayRotations) {
-        SDL_Log("Rotation CCW blocked: rotation budget exhausted during lock delay");
+        LOG_DEBUG("Rotation CCW blocked: rotation budget exhausted during lock delay");
         return;
     }
+    const int fromRot = currentPiece.rotation;
     if (currentPiece.width == currentPiece.height) { // Dont perform rotation if O piece
         return;
     }
@@ -1459,6 +1417,7 @@ void rotateCounterClockwise() {
     {
         rotatePieceCounterClockwise();
     }
+    if (currentPiece.rotation != fromRot) playSound(SoundEffect::Rotate);
 }
 
 void softDrop() {
@@ -1473,13 +1432,14 @@ void hardDrop() {
     currentPiece.y = maxDrop(currentPiece, board); //move down to max drop
     spawnParticles(currentPiece); //spawn particles at hard drop location
     hardDropFlag = true; //set hard drop flag
+    playSound(SoundEffect::HardDrop);
 }
 
 void hold() {
     pieceSet(currentPiece, board); //clear current position
     if (!holdUsed){ //if hold not used this turn
         resetRotation();
-        if (holdPiece.shape.empty()) {
+        if (holdPiece.isEmpty()) {
             firstHold(); //first time holding a piece
         } else {
             pieceSwap(); //swap current and hold pieces
@@ -1495,7 +1455,8 @@ void pauseGame() {
 void increaseLevel() {
     if (levelValue < maxLevelAchieved) {
         levelValue++;
-        rowsCleared += 10; // Ensure level corresponds to rows cleared
-        dropSpeed = std::max(50000000, 900000000 - (levelValue * 70000000)); // Cap at 0.05s drop speed
+        rowsCleared += kLinesPerLevel; // Ensure level corresponds to rows cleared
+        dropSpeed = dropSpeedForLevel(levelValue);
+        playSound(SoundEffect::LevelUp);
     }
 }
\ No newline at end of file
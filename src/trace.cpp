@@ -0,0 +1,144 @@
+#include "trace.h"
+#include "log.h"
+#include "thread_rings.h"
+#include <chrono>
+#include <cstdio>
+
+std::atomic<bool> traceEnabled{ false };
+const char* traceOutPath = nullptr;
+
+namespace {
+    constexpr size_t kRingSize = 4096; // spans per thread, power of two
+    constexpr int kMaxRings = 32;      // threads that may trace
+    constexpr size_t kNameSize = 32;
+    constexpr auto kDrainInterval = std::chrono::milliseconds(10);
+    constexpr Uint64 kInstant = ~0ull; // durNs of a zero-length marker
+    constexpr const char* kDefaultPath = "trace.json";
+
+    struct TraceEvent {
+        const char* name;
+        Uint64 startNs;
+        Uint64 durNs;
+    };
+
+    struct TrackInfo {
+        char name[kNameSize] = {};
+        bool described = false; // writer only: thread_name metadata written this session
+    };
+
+    using TraceRings = ThreadRings<TraceEvent, kRingSize, kMaxRings, TrackInfo>;
+    TraceRings rings; // a thread that cannot get one is not traced
+    thread_local const char* threadName = nullptr;
+
+    std::FILE* out = nullptr;
+    const char* outPath = nullptr;
+    RingDrainThread writer;
+    bool firstRecord = true;
+    Uint64 recordsWritten = 0;
+    Uint64 recordsDropped = 0;
+
+    TraceRings::Ring* ringForThisThread() {
+        return rings.ringForThisThread([](TraceRings::Ring& ring) {
+            if (threadName) SDL_snprintf(ring.info.name, kNameSize, "%s", threadName);
+            else SDL_snprintf(ring.info.name, kNameSize, "thread %d", ring.index + 1);
+        });
+    }
+
+    void push(const TraceEvent& e) {
+        TraceRings::Ring* ring = ringForThisThread();
+        if (!ring) return;
+        TraceEvent* slot = rings.claim(*ring);
+        if (!slot) return;
+        *slot = e;
+        rings.publish(*ring);
+    }
+
+    int tidOf(const TraceRings::Ring& ring) { return ring.index + 1; }
+
+    const char* separator() {
+        const char* s = firstRecord ? "" : ",\n";
+        firstRecord = false;
+        return s;
+    }
+
+    // Trace-event timestamps are in microseconds; three decimals keep the nanoseconds
+    void writeEvent(TraceRings::Ring& ring, const TraceEvent& e) {
+        if (!ring.info.described) {
+            std::fprintf(out, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"%s\"}}",
+                         separator(), tidOf(ring), ring.info.name);
+            ring.info.described = true;
+        }
+        const unsigned long long ts = e.startNs;
+        if (e.durNs == kInstant) {
+            std::fprintf(out, "%s{\"name\":\"%s\",\"ph\":\"i\",\"s\":\"t\",\"pid\":1,\"tid\":%d,\"ts\":%llu.%03llu}",
+                         separator(), e.name, tidOf(ring), ts / 1000, ts % 1000);
+        } else {
+            const unsigned long long dur = e.durNs;
+            std::fprintf(out, "%s{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%llu.%03llu,\"dur\":%llu.%03llu}",
+                         separator(), e.name, tidOf(ring), ts / 1000, ts % 1000, dur / 1000, dur % 1000);
+        }
+        recordsWritten++;
+    }
+
+    void drainRings() {
+        rings.drain(writeEvent, [](TraceRings::Ring&, Uint64 dropped) { recordsDropped += dropped; });
+    }
+}
+
+bool traceStart(const char* path) {
+    if (traceEnabled.load()) return true;
+    out = std::fopen(path, "wb");
+    if (!out) {
+        LOG_ERROR("Could not open %s for the trace", path);
+        return false;
+    }
+    outPath = path;
+    std::fputs("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n", out);
+    firstRecord = true;
+    recordsWritten = 0;
+    recordsDropped = 0;
+    std::fprintf(out, "%s{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"tetris\"}}", separator());
+
+    // Register the caller now so its first span does not allocate, and forget spans
+    // that finished after the previous session stopped
+    ringForThisThread();
+    rings.discard([](TraceRings::Ring& ring) { ring.info.described = false; });
+
+    writer.start(kDrainInterval, drainRings);
+    traceEnabled.store(true, std::memory_order_release);
+    LOG_INFO("Tracing to %s", path);
+    return true;
+}
+
+void traceStop() {
+    if (!traceEnabled.exchange(false)) return;
+    writer.stop();
+
+    std::fputs("\n]}\n", out);
+    const bool ok = std::fclose(out) == 0;
+    out = nullptr;
+    if (!ok) LOG_ERROR("Could not finish writing %s", outPath);
+    else LOG_INFO("Trace: %llu records written to %s", static_cast<unsigned long long>(recordsWritten), outPath);
+    if (recordsDropped > 0) {
+        LOG_WARN("Trace: %llu spans dropped (ring full)", static_cast<unsigned long long>(recordsDropped));
+    }
+}
+
+void traceToggle() {
+    if (traceEnabled.load()) traceStop();
+    else traceStart(traceOutPath ? traceOutPath : kDefaultPath);
+}
+
+void traceSetThreadName(const char* name) {
+    threadName = name;
+}
+
+void traceRecord(const char* name, Uint64 startNs) {
+    const Uint64 endNs = SDL_GetTicksNS();
+    push(TraceEvent{ name, startNs, endNs - startNs });
+}
+
+void traceInstant(const char* name) {
+    if (!traceEnabled.load(std::memory_order_relaxed)) return;
+    push(TraceEvent{ name, SDL_GetTicksNS(), kInstant });
+}
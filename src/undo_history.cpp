@@ -0,0 +1,287 @@
+#include "undo_history.h"
+#include "globals.h"
+#include "tetris_utils.h"
+#include "replay.h"
+#include "flight_recorder.h"
+#include "log.h"
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+
+bool practiceModeEnabled = false;
+
+namespace {
+    constexpr size_t kMaxEntries = 10000;
+    constexpr Uint32 kRowBytes = 1u << 19; // a power of two, so positions wrap with a mask
+    constexpr Uint32 kRowDeltaSize = 9;    // u8 row | u64 old row xor new row
+    constexpr int kMaxDrawsPerPiece = 16;  // further apart than this, the queue was replaced
+    constexpr Uint8 kNoHold = 0xFF;
+
+    enum EntryFlags : Uint8 {
+        kHoldUsed = 1 << 0,
+        kAlternateIOffset = 1 << 1,
+    };
+
+    // The state when one piece spawned; its row deltas lead here from the entry before
+    struct Entry {
+        Uint32 rowStart; // position of its first row delta in the ring
+        Uint32 draws;    // pieces taken from the queue since the game started
+        Uint32 score;
+        Uint32 pieces;
+        Uint16 lines;
+        Uint8 rowCount;
+        Uint8 current;
+        Uint8 hold;      // kNoHold if empty
+        Uint8 level;
+        Uint8 flags;     // EntryFlags
+    };
+    static_assert(sizeof(Entry) <= 24, "an entry should stay small");
+
+    std::vector<Entry> entries; // ring of kMaxEntries
+    std::vector<Uint8> rowRing; // ring of kRowBytes
+    Uint64 first = 0;  // oldest entry kept
+    Uint64 end = 0;    // one past the newest
+    Uint64 cursor = 0; // the entry the game is at
+    Uint32 rowEnd = 0; // where the next row delta goes
+
+    Uint64 shownRows[boardHeight]; // the board of the cursor entry, packed
+    PieceQueue startQueue;         // the queue when the game started
+    PieceQueue drawnQueue;         // startQueue after the newest entry's draws
+    Uint32 drawnCount = 0;
+    Entry locked;                  // the state when the last piece locked, recorded once the rows settle
+    PieceQueue lockedQueue;
+    bool lockPending = false;
+    bool tookBack = false;
+    int startHighScore = 0;        // the high score before this game raised it
+    Uint64 undos = 0;
+    Uint64 redos = 0;
+
+    Entry& at(Uint64 index) { return entries[index % kMaxEntries]; }
+
+    Uint64 packRow(int y) {
+        Uint64 row = 0;
+        for (int x = 0; x < boardWidth; ++x) {
+            row |= static_cast<Uint64>(std::min(board.current[x][y], 15) & 0xF) << (4 * x);
+        }
+        return row;
+    }
+
+    void unpackRow(int y, Uint64 row) {
+        for (int x = 0; x < boardWidth; ++x) board.current[x][y] = static_cast<int>((row >> (4 * x)) & 0xF);
+    }
+
+    bool sameQueue(const PieceQueue& a, const PieceQueue& b) {
+        const RandomizerState& g = a.gen;
+        const RandomizerState& h = b.gen;
+        return std::memcmp(g.rng.s, h.rng.s, sizeof(g.rng.s)) == 0 && g.bagIndex == h.bagIndex &&
+               std::memcmp(g.bag, h.bag, sizeof(g.bag)) == 0 && std::memcmp(g.history, h.history, sizeof(g.history)) == 0 &&
+               g.firstDraw == h.firstDraw && g.kind == h.kind && std::memcmp(a.ring, b.ring, kMaxPreview) == 0 &&
+               a.head == b.head;
+    }
+
+    // Bytes in use from the oldest row delta that can still be applied to the write position
+    Uint32 rowBytesUsed() {
+        if (end - first < 2) return 0;
+        return rowEnd - at(first + 1).rowStart;
+    }
+
+    void dropOldest() {
+        first++;
+        if (cursor < first) cursor = first;
+    }
+
+    // The state of the live game as an entry; the caller fills in the row deltas
+    Entry describeLiveGame() {
+        Entry e{};
+        e.draws = drawnCount;
+        e.score = static_cast<Uint32>(scoreValue);
+        e.pieces = static_cast<Uint32>(piecesPlaced);
+        e.lines = static_cast<Uint16>(std::min(rowsCleared, 0xFFFF));
+        e.current = static_cast<Uint8>(pickPiece);
+        e.hold = holdPiece.isEmpty() ? kNoHold : static_cast<Uint8>(holdPiece.type);
+        e.level = static_cast<Uint8>(std::min(levelValue, 255));
+        e.flags = static_cast<Uint8>((holdUsed ? kHoldUsed : 0) | (alternateIPieceRotationOffset ? kAlternateIOffset : 0));
+        return e;
+    }
+
+    // Starts over from the live game, which becomes the only entry
+    void restart() {
+        lockPending = false;
+        first = end = cursor = 0;
+        rowEnd = 0;
+        startQueue = drawnQueue = pieceQueue;
+        drawnCount = 0;
+        for (int y = 0; y < boardHeight; ++y) shownRows[y] = packRow(y);
+        Entry e = describeLiveGame();
+        e.rowStart = rowEnd;
+        at(end++) = e;
+    }
+
+    // The queue is the last recorded one with a few more pieces drawn, or it was replaced
+    bool catchUpDraws(const PieceQueue& queue) {
+        PieceQueue q = drawnQueue;
+        for (int n = 0; n <= kMaxDrawsPerPiece; ++n) {
+            if (sameQueue(q, queue)) {
+                drawnQueue = q;
+                drawnCount += n;
+                return true;
+            }
+            pieceQueuePop(q);
+        }
+        return false;
+    }
+
+    // Records the locked entry once the board holds only locked cells
+    void record() {
+        lockPending = false;
+        if (!catchUpDraws(lockedQueue)) {
+            LOG_DEBUG("Undo history: the piece queue was replaced; starting over");
+            restart();
+            return;
+        }
+        end = cursor + 1; // a new placement after an undo: the redo entries are gone
+        rowEnd = at(cursor).rowStart + at(cursor).rowCount * kRowDeltaSize;
+
+        Uint64 changed[boardHeight];
+        Uint8 changedRows[boardHeight];
+        int count = 0;
+        for (int y = 0; y < boardHeight; ++y) {
+            const Uint64 row = packRow(y);
+            if (row == shownRows[y]) continue;
+            changed[count] = row ^ shownRows[y];
+            changedRows[count++] = static_cast<Uint8>(y);
+            shownRows[y] = row;
+        }
+
+        const Uint32 bytes = count * kRowDeltaSize;
+        while (end - first >= kMaxEntries || rowBytesUsed() + bytes > kRowBytes) dropOldest();
+        Entry e = locked;
+        e.draws = drawnCount;
+        e.rowStart = rowEnd;
+        e.rowCount = static_cast<Uint8>(count);
+        for (int i = 0; i < count; ++i) {
+            rowRing[rowEnd++ & (kRowBytes - 1)] = changedRows[i];
+            for (int b = 0; b < 8; ++b) rowRing[rowEnd++ & (kRowBytes - 1)] = static_cast<Uint8>(changed[i] >> (8 * b));
+        }
+        at(end++) = e;
+        cursor = end - 1;
+    }
+
+    // Xor an entry's row deltas into the board: forward onto the entry before, or back from it
+    void applyRows(const Entry& e) {
+        Uint32 p = e.rowStart;
+        for (int i = 0; i < e.rowCount; ++i) {
+            const int y = rowRing[p++ & (kRowBytes - 1)];
+            Uint64 delta = 0;
+            for (int b = 0; b < 8; ++b) delta |= static_cast<Uint64>(rowRing[p++ & (kRowBytes - 1)]) << (8 * b);
+            shownRows[y] ^= delta;
+            unpackRow(y, shownRows[y]);
+        }
+    }
+
+    // Everything but the board, back to the moment the entry's piece spawned
+    void restoreEntry(const Entry& e) {
+        pieceQueue = startQueue;
+        for (Uint32 i = 0; i < e.draws; ++i) pieceQueuePop(pieceQueue);
+        drawnQueue = pieceQueue;
+        drawnCount = e.draws;
+        nextPickPiece = pieceQueuePeek(pieceQueue, 0);
+        nextPiece = pieceTypes[nextPickPiece];
+
+        pickPiece = e.current;
+        currentPiece = pieceTypes[pickPiece];
+        currentPiece.x = boardWidth / 2;
+        currentPiece.y = 0;
+        holdPiece = e.hold == kNoHold ? Piece() : pieceTypes[e.hold];
+        holdUsed = e.flags & kHoldUsed;
+        alternateIPieceRotationOffset = e.flags & kAlternateIOffset;
+        newPiece = false;
+        hardDropFlag = false;
+        pieceLanded = false;
+        pieceLandedOnce = false;
+        lockDelayCounter = 0;
+        lockDelayMovesUsed = 0;
+        lockDelayRotationsUsed = 0;
+
+        scoreValue = static_cast<int>(e.score);
+        rowsCleared = e.lines;
+        levelValue = e.level;
+        dropSpeed = dropSpeedForLevel(levelValue);
+        piecesPlaced = static_cast<int>(e.pieces);
+        lastDropTime = gameTimeNs(); // a full gravity interval before the piece moves
+
+        score.loadFromRenderedText(std::to_string(scoreValue), { 0xFF, 0xFF, 0xFF, 0xFF });
+        level.loadFromRenderedText(std::to_string(levelValue + 1), { 0xFF, 0xFF, 0xFF, 0xFF });
+        particles.clear();
+
+        // Inputs no longer rebuild this game: it is not a replay and not saved, and what it
+        // added to the high score so far is taken back with it
+        if (!tookBack) {
+            replayDiscardRecording();
+            highScoreValue = startHighScore;
+            highScore.loadFromRenderedText(std::to_string(highScoreValue), { 0xFF, 0xFF, 0xFF, 0xFF });
+        }
+        tookBack = true;
+        flightGameStarted();
+    }
+
+    // Undo and redo start from a recorded piece, so they wait for a row clear to collapse
+    bool settled() {
+        if (!practiceModeEnabled || entries.empty() || clearingRows) return false;
+        undoHistoryTick();
+        return true;
+    }
+}
+
+void undoHistoryReset() {
+    if (!practiceModeEnabled) return;
+    if (entries.empty()) {
+        entries.resize(kMaxEntries);
+        rowRing.resize(kRowBytes);
+    }
+    if (undos + redos > 0) {
+        LOG_INFO("Practice: %llu undos, %llu redos; %llu pieces held in %.1f KB of rows",
+                 static_cast<unsigned long long>(undos), static_cast<unsigned long long>(redos),
+                 static_cast<unsigned long long>(end - first), rowBytesUsed() / 1024.0);
+    }
+    tookBack = false;
+    startHighScore = highScoreValue;
+    undos = redos = 0;
+    restart();
+}
+
+void undoHistoryTick() {
+    if (!practiceModeEnabled || entries.empty()) return;
+    if (!lockPending && static_cast<Uint32>(piecesPlaced) != at(cursor).pieces) {
+        // The next piece has just spawned; later inputs (a hold during the clear) are not part of it
+        locked = describeLiveGame();
+        lockedQueue = pieceQueue;
+        lockPending = true;
+    }
+    if (lockPending && !clearingRows) record();
+}
+
+bool undoPlacement() {
+    if (!settled() || cursor == first) return false;
+    applyRows(at(cursor));
+    cursor--;
+    restoreEntry(at(cursor));
+    undos++;
+    LOG_DEBUG("Undo: back to piece %u", at(cursor).pieces);
+    return true;
+}
+
+bool redoPlacement() {
+    if (!settled() || cursor + 1 >= end) return false;
+    cursor++;
+    applyRows(at(cursor));
+    restoreEntry(at(cursor));
+    redos++;
+    LOG_DEBUG("Redo: on to piece %u", at(cursor).pieces);
+    return true;
+}
+
+bool undoHistoryTookBack() {
+    return tookBack;
+}
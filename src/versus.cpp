@@ -0,0 +1,516 @@
+#include "versus.h"
+#include "netplay.h"
+#include "bot.h"
+#include "globals.h"
+#include "tetris_utils.h"
+#include "replay.h"
+#include "startup.h"
+#include "frame_arena.h"
+#include "palette.h"
+#include "board_grid.h"
+#include "trace.h"
+#include "log.h"
+#include <algorithm>
+
+int versusPlayers = 0;
+VersusMatch versusMatch{};
+
+namespace {
+    constexpr int kGarbageColor = 8; // drawn grey
+    constexpr int kGarbageForLines[5] = { 0, 0, 1, 2, 4 };
+    constexpr int kMaxGarbagePerLock = 8;
+    constexpr int kSideCells = 6;  // NEXT, HOLD and the garbage meter to the right of each board
+    constexpr float kMargin = 8.0f;
+    constexpr float kLabelHeight = 12.0f;
+    constexpr BoardGridSpacing kGridSpacing{ kSideCells, kMargin, kLabelHeight };
+
+    enum class Controls { None, LeftKeys, RightKeys, Gamepad };
+
+    struct KeyMap {
+        SDL_Keycode left, right, softDrop, hardDrop, rotateCW, rotateCCW, hold;
+    };
+    constexpr KeyMap kLeftKeys{ SDLK_A, SDLK_D, SDLK_S, SDLK_W, SDLK_E, SDLK_Q, SDLK_LSHIFT };
+    constexpr KeyMap kRightKeys{ SDLK_LEFT, SDLK_RIGHT, SDLK_DOWN, SDLK_UP, SDLK_SLASH, SDLK_PERIOD, SDLK_RSHIFT };
+
+    struct HeldButton {
+        bool held = false;
+        Uint64 pressedAt = 0;
+        Uint64 lastRepeatAt = 0;
+    };
+
+    // Whoever is holding the controls of a board; the board itself is in versusMatch
+    struct Player {
+        Controls controls = Controls::None;
+        SDL_Gamepad* pad = nullptr;
+        InputActionList actions;
+        HeldButton left, right, down;
+        int lastDir = 0; // -1 or 1: the direction pressed last wins while both are held
+    };
+
+    bool active = false;
+    int playerCount = 0;
+    Player players[kVersusMaxPlayers];
+    int localBoard = -1; // online: the board this side controls
+
+    GridFrameStats stats;
+
+    const KeyMap* keyMapOf(const Player& p) {
+        if (p.controls == Controls::LeftKeys) return &kLeftKeys;
+        if (p.controls == Controls::RightKeys) return &kRightKeys;
+        return nullptr;
+    }
+
+    const char* controlsName(const Player& p) {
+        switch (p.controls) {
+            case Controls::LeftKeys: return "keyboard left";
+            case Controls::RightKeys: return "keyboard right";
+            case Controls::Gamepad: return SDL_GetGamepadName(p.pad);
+            default: return "none";
+        }
+    }
+
+    // Online only the local board takes controls: a gamepad, or else the arrow keys
+    bool controlledHere(int index) { return localBoard < 0 || index == localBoard; }
+
+    void assignControls() {
+        int padCount = 0;
+        SDL_JoystickID* ids = gamepadSubsystemReady() ? SDL_GetGamepads(&padCount) : nullptr;
+        int nextPad = 0;
+        Controls keyHalves[2] = { Controls::LeftKeys, Controls::RightKeys };
+        int nextHalf = localBoard < 0 ? 0 : 1;
+        for (int i = 0; i < playerCount; ++i) {
+            Player& p = players[i];
+            p.controls = Controls::None;
+            if (!controlledHere(i)) continue;
+            while (!p.pad && nextPad < padCount) p.pad = SDL_OpenGamepad(ids[nextPad++]);
+            if (p.pad) p.controls = Controls::Gamepad;
+        }
+        // Keyboard halves go to the players with no pad, starting from the left
+        for (int i = 0; i < playerCount && nextHalf < 2; ++i) {
+            if (controlledHere(i) && players[i].controls == Controls::None) players[i].controls = keyHalves[nextHalf++];
+        }
+        if (ids) SDL_free(ids);
+        for (int i = 0; i < playerCount; ++i) {
+            if (!controlledHere(i)) continue;
+            if (players[i].controls == Controls::None) LOG_WARN("Versus: P%d has no controls; connect a gamepad", i + 1);
+            else LOG_INFO("Versus: P%d on %s", i + 1, controlsName(players[i]));
+        }
+    }
+
+    void releaseGamepads() {
+        for (int i = 0; i < playerCount; ++i) {
+            if (players[i].pad) SDL_CloseGamepad(players[i].pad);
+            players[i].pad = nullptr;
+        }
+    }
+
+    void clearInput() {
+        for (Player& p : players) {
+            p.actions.count = 0;
+            p.left = p.right = p.down = HeldButton{};
+            p.lastDir = 0;
+        }
+    }
+
+    void startLocalMatch() {
+        clearInput();
+        versusStartMatch(playerCount, fixedSeedEnabled ? fixedSeed : SDL_GetPerformanceCounter() ^ SDL_GetTicksNS());
+    }
+
+    void press(Player& p, InputAction action) {
+        const Uint64 now = SDL_GetTicks();
+        p.actions.push_back(action);
+        if (action == InputAction::MoveLeft) { p.left = { true, now, now }; p.lastDir = -1; }
+        if (action == InputAction::MoveRight) { p.right = { true, now, now }; p.lastDir = 1; }
+        if (action == InputAction::SoftDrop) p.down = { true, now, now };
+    }
+
+    void release(Player& p, InputAction action) {
+        if (action == InputAction::MoveLeft) { p.left.held = false; if (p.right.held) p.lastDir = 1; }
+        if (action == InputAction::MoveRight) { p.right.held = false; if (p.left.held) p.lastDir = -1; }
+        if (action == InputAction::SoftDrop) p.down.held = false;
+    }
+
+    InputAction keyAction(const KeyMap& keys, SDL_Keycode key) {
+        if (key == keys.left) return InputAction::MoveLeft;
+        if (key == keys.right) return InputAction::MoveRight;
+        if (key == keys.softDrop) return InputAction::SoftDrop;
+        if (key == keys.hardDrop) return InputAction::HardDrop;
+        if (key == keys.rotateCW) return InputAction::RotateClockwise;
+        if (key == keys.rotateCCW) return InputAction::RotateCounterClockwise;
+        if (key == keys.hold) return InputAction::Hold;
+        return InputAction::None;
+    }
+
+    InputAction buttonAction(Uint8 button) {
+        if (button == SDL_GAMEPAD_BUTTON_DPAD_LEFT) return InputAction::MoveLeft;
+        if (button == SDL_GAMEPAD_BUTTON_DPAD_RIGHT) return InputAction::MoveRight;
+        if (button == SDL_GAMEPAD_BUTTON_DPAD_DOWN) return InputAction::SoftDrop;
+        if (button == hardDropControllerBind) return InputAction::HardDrop;
+        if (button == holdControllerBind) return InputAction::Hold;
+        if (button == rotateClockwiseControllerBind) return InputAction::RotateClockwise;
+        if (button == rotateCounterClockwiseControllerBind) return InputAction::RotateCounterClockwise;
+        return InputAction::None;
+    }
+
+    Player* playerWithPad(SDL_JoystickID id) {
+        for (int i = 0; i < playerCount; ++i) {
+            if (players[i].pad && SDL_GetGamepadID(players[i].pad) == id) return &players[i];
+        }
+        return nullptr;
+    }
+
+    // Returns false to quit
+    bool handleEvent(const SDL_Event& e) {
+        switch (e.type) {
+            case SDL_EVENT_QUIT: return false;
+            case SDL_EVENT_KEY_DOWN:
+                if (e.key.key == SDLK_ESCAPE) return false;
+                if (e.key.repeat) break; // DAS/ARR is ours
+                if (versusMatch.over && localBoard < 0 && e.key.key == SDLK_R) { startLocalMatch(); break; }
+                for (int i = 0; i < playerCount; ++i) {
+                    const KeyMap* keys = keyMapOf(players[i]);
+                    const InputAction action = keys ? keyAction(*keys, e.key.key) : InputAction::None;
+                    if (action != InputAction::None) press(players[i], action);
+                }
+                break;
+            case SDL_EVENT_KEY_UP:
+                for (int i = 0; i < playerCount; ++i) {
+                    const KeyMap* keys = keyMapOf(players[i]);
+                    if (keys) release(players[i], keyAction(*keys, e.key.key));
+                }
+                break;
+            case SDL_EVENT_GAMEPAD_BUTTON_DOWN:
+                if (versusMatch.over && localBoard < 0 && e.gbutton.button == SDL_GAMEPAD_BUTTON_START) {
+                    startLocalMatch();
+                    break;
+                }
+                if (Player* p = playerWithPad(e.gbutton.which)) {
+                    const InputAction action = buttonAction(e.gbutton.button);
+                    if (action != InputAction::None) press(*p, action);
+                }
+                break;
+            case SDL_EVENT_GAMEPAD_BUTTON_UP:
+                if (Player* p = playerWithPad(e.gbutton.which)) release(*p, buttonAction(e.gbutton.button));
+                break;
+            case SDL_EVENT_GAMEPAD_ADDED:
+                for (int i = 0; i < playerCount; ++i) {
+                    if (!controlledHere(i) || players[i].controls != Controls::None) continue;
+                    players[i].pad = SDL_OpenGamepad(e.gdevice.which);
+                    if (players[i].pad) {
+                        players[i].controls = Controls::Gamepad;
+                        LOG_INFO("Versus: P%d on %s", i + 1, controlsName(players[i]));
+                    }
+                    break;
+                }
+                break;
+            case SDL_EVENT_GAMEPAD_REMOVED:
+                if (Player* p = playerWithPad(e.gdevice.which)) {
+                    SDL_CloseGamepad(p->pad);
+                    p->pad = nullptr;
+                    p->controls = Controls::None;
+                    p->left.held = p->right.held = p->down.held = false;
+                    LOG_WARN("Versus: P%d's gamepad was removed", static_cast<int>(p - players) + 1);
+                }
+                break;
+            default: break;
+        }
+        return true;
+    }
+
+    // DAS/ARR for one player, with the same timings as single player
+    void queueRepeats(Player& p, Uint64 now) {
+        HeldButton* h = p.lastDir < 0 ? &p.left : p.lastDir > 0 ? &p.right : nullptr;
+        if (h && h->held && now - h->pressedAt >= kDAS_MS && now - h->lastRepeatAt >= kARR_MS) {
+            p.actions.push_back(p.lastDir < 0 ? InputAction::MoveLeft : InputAction::MoveRight);
+            h->lastRepeatAt = now;
+        }
+        if (p.down.held && now - p.down.pressedAt >= kDAS_MS && now - p.down.lastRepeatAt >= kSoftDrop_ARR_MS) {
+            p.actions.push_back(InputAction::SoftDrop);
+            p.down.lastRepeatAt = now;
+        }
+    }
+
+    void sendGarbage(int from, int rows) {
+        VersusBoard& sender = versusMatch.boards[from];
+        const int cancelled = std::min(rows, sender.pendingGarbage);
+        sender.pendingGarbage -= cancelled;
+        rows -= cancelled;
+        if (rows == 0) return;
+        for (int step = 0; step < versusMatch.players; ++step) {
+            const int target = (sender.nextTarget + step) % versusMatch.players;
+            if (target == from || !versusMatch.boards[target].alive) continue;
+            versusMatch.boards[target].pendingGarbage += rows;
+            sender.linesSent += rows;
+            sender.nextTarget = (target + 1) % versusMatch.players;
+            return;
+        }
+    }
+
+    // On the live globals of the board being stepped; false if the stack is pushed out the top
+    bool raiseGarbage(VersusBoard& b) {
+        const int rows = std::min(b.pendingGarbage, kMaxGarbagePerLock);
+        b.pendingGarbage -= rows;
+        bool toppedOut = false;
+        for (int x = 0; x < boardWidth; ++x) {
+            for (int y = 0; y < rows; ++y) toppedOut |= board.current[x][y] != 0;
+            for (int y = 0; y + rows < boardHeight; ++y) board.current[x][y] = board.current[x][y + rows];
+        }
+        const int gap = xoshiroBelow(versusMatch.garbageRng, boardWidth);
+        for (int x = 0; x < boardWidth; ++x) {
+            for (int y = boardHeight - rows; y < boardHeight; ++y) board.current[x][y] = x == gap ? 0 : kGarbageColor;
+        }
+        return !toppedOut;
+    }
+
+    void stepBoard(int index, const InputActionList& actions) {
+        VersusBoard& b = versusMatch.boards[index];
+        restoreGameSnapshot(b.state);
+        for (InputAction action : actions) applyInputAction(action);
+
+        const int linesBefore = rowsCleared;
+        const int piecesBefore = piecesPlaced;
+        const int savedHighScore = highScoreValue; // the single-player best is not at stake
+        bool alive = simulateGameplayTick();
+        highScoreValue = savedHighScore;
+        const int lines = rowsCleared - linesBefore;
+        if (alive && lines > 0) sendGarbage(index, kGarbageForLines[std::min(lines, 4)]);
+        else if (alive && piecesPlaced != piecesBefore && b.pendingGarbage > 0) alive = raiseGarbage(b);
+        captureGameSnapshot(b.state);
+        b.alive = alive;
+    }
+
+    void stepLocalMatch() {
+        const Uint64 now = SDL_GetTicks();
+        bool wasAlive[kVersusMaxPlayers];
+        for (int i = 0; i < playerCount; ++i) {
+            queueRepeats(players[i], now);
+            wasAlive[i] = versusMatch.boards[i].alive;
+        }
+        InputActionList actions[kVersusMaxPlayers];
+        for (int i = 0; i < playerCount; ++i) {
+            actions[i] = players[i].actions;
+            players[i].actions.count = 0;
+        }
+        versusStep(actions);
+
+        for (int i = 0; i < playerCount; ++i) {
+            const VersusBoard& b = versusMatch.boards[i];
+            if (wasAlive[i] && !b.alive) {
+                LOG_INFO("Versus: P%d is out after %d pieces, %d lines, %d garbage sent", i + 1, b.state.pieces,
+                         b.state.lines, b.linesSent);
+            }
+        }
+        if (versusMatch.over) {
+            if (versusMatch.winner >= 0) LOG_INFO("Versus: P%d wins", versusMatch.winner + 1);
+            else LOG_INFO("Versus: draw");
+        }
+    }
+
+    // Online input for this tick: buttons held now or pressed since the last tick
+    Uint8 heldButtons(Player& p) {
+        Uint8 buttons = (p.left.held ? kNetLeft : 0) | (p.right.held ? kNetRight : 0) | (p.down.held ? kNetSoftDrop : 0);
+        for (InputAction action : p.actions) buttons |= netButtonFor(action);
+        p.actions.count = 0;
+        return buttons;
+    }
+
+    BoardLayout layoutOf(int index) {
+        return boardGridLayout(index, playerCount, kGridSpacing);
+    }
+
+    constexpr int kBuckets = 2 * SDL_arraysize(kPalette); // each color, locked and falling
+
+    void addPieceCells(FrameVector<SDL_FRect>* rects, const Piece& piece, float x, float y, float cell) {
+        const int bucket = paletteIndex(piece.color) * 2 + 1;
+        for (int sy = 0; sy < piece.height; ++sy) {
+            for (int sx = 0; sx < piece.width; ++sx) {
+                if (piece.cell(sx, sy)) rects[bucket].push_back({ x + sx * cell + 1, y + sy * cell + 1, cell - 2, cell - 2 });
+            }
+        }
+    }
+
+    void renderMatch() {
+        SDL_SetRenderDrawColor(gRenderer, 0, 0, 0, 255);
+        SDL_RenderClear(gRenderer);
+
+        // Every board's cells, sorted by color, so the whole match is a handful of draw calls
+        FrameVector<SDL_FRect> rects[kBuckets];
+        FrameVector<SDL_FRect> ghosts;
+        FrameVector<SDL_FRect> wells;
+        FrameVector<SDL_FRect> garbage;
+        for (int i = 0; i < versusMatch.players; ++i) {
+            const GameSnapshot& s = versusMatch.boards[i].state;
+            const BoardLayout l = layoutOf(i);
+            wells.push_back({ l.x - 1, l.y - 1, boardWidth * l.cell + 2, boardHeight * l.cell + 2 });
+            for (int x = 0; x < boardWidth; ++x) {
+                for (int y = 0; y < boardHeight; ++y) {
+                    if (s.board.current[x][y] == 0) continue;
+                    rects[paletteIndex(s.board.current[x][y]) * 2].push_back(
+                        { l.x + x * l.cell + 1, l.y + y * l.cell + 1, l.cell - 2, l.cell - 2 });
+                }
+            }
+            if (versusMatch.boards[i].alive && !s.clearingRows) {
+                Piece ghost = s.current;
+                ghost.y = maxDrop(s.current, s.board);
+                for (int sy = 0; sy < ghost.height; ++sy) {
+                    for (int sx = 0; sx < ghost.width; ++sx) {
+                        if (ghost.cell(sx, sy)) ghosts.push_back({ l.x + (ghost.x + sx) * l.cell + 1,
+                                                                   l.y + (ghost.y + sy) * l.cell + 1, l.cell - 2, l.cell - 2 });
+                    }
+                }
+                addPieceCells(rects, s.current, l.x + s.current.x * l.cell, l.y + s.current.y * l.cell, l.cell);
+            }
+            const float side = l.x + (boardWidth + 1) * l.cell;
+            const float mini = l.cell / 2;
+            addPieceCells(rects, s.next, side, l.y + l.cell, mini);
+            if (!s.hold.isEmpty()) addPieceCells(rects, s.hold, side, l.y + 5 * l.cell, mini);
+            const float meter = std::min(versusMatch.boards[i].pendingGarbage, boardHeight) * l.cell;
+            if (meter > 0) garbage.push_back({ l.x + boardWidth * l.cell + 2, l.y + boardHeight * l.cell - meter, 3, meter });
+        }
+
+        SDL_SetRenderDrawColor(gRenderer, 255, 255, 255, 255);
+        SDL_RenderRects(gRenderer, wells.data(), static_cast<int>(wells.size()));
+        SDL_SetRenderDrawColor(gRenderer, 90, 90, 90, 255);
+        if (!ghosts.empty()) SDL_RenderRects(gRenderer, ghosts.data(), static_cast<int>(ghosts.size()));
+        for (int i = 0; i < kBuckets; ++i) {
+            if (rects[i].empty()) continue;
+            const SDL_Color color = (i & 1) ? kPalette[i / 2] : shadedColor(kPalette[i / 2], kLockedShade);
+            SDL_SetRenderDrawColor(gRenderer, color.r, color.g, color.b, color.a);
+            SDL_RenderFillRects(gRenderer, rects[i].data(), static_cast<int>(rects[i].size()));
+        }
+        SDL_SetRenderDrawColor(gRenderer, 255, 60, 60, 255);
+        if (!garbage.empty()) SDL_RenderFillRects(gRenderer, garbage.data(), static_cast<int>(garbage.size()));
+
+        // Labels and results in the debug font: no text textures to re-render as scores change
+        char text[48];
+        for (int i = 0; i < versusMatch.players; ++i) {
+            const VersusBoard& b = versusMatch.boards[i];
+            const BoardLayout l = layoutOf(i);
+            SDL_SetRenderDrawColor(gRenderer, 255, 255, 255, 255);
+            SDL_snprintf(text, sizeof(text), "P%d%s %d  L%d", i + 1, i == localBoard ? " (you)" : "", b.state.score,
+                         b.state.lines);
+            SDL_RenderDebugText(gRenderer, l.x, l.y - kLabelHeight, text);
+            if (b.alive && !versusMatch.over) continue;
+            const float midY = l.y + boardHeight * l.cell / 2;
+            const bool won = i == versusMatch.winner;
+            SDL_SetRenderDrawColor(gRenderer, 255, won ? 220 : 80, won ? 0 : 80, 255);
+            SDL_RenderDebugText(gRenderer, l.x + 4, midY, won ? "WINNER" : "KO");
+        }
+        SDL_SetRenderDrawColor(gRenderer, 255, 255, 255, 255);
+        if (netplayEnabled()) {
+            netplayStatusText(text, sizeof(text));
+            SDL_RenderDebugText(gRenderer, kMargin, kScreenHeight - kMargin - 8, text);
+        } else if (versusMatch.over) {
+            SDL_RenderDebugText(gRenderer, kMargin, kScreenHeight - kMargin - 8, "R / Start: rematch   Esc: quit");
+        }
+    }
+}
+
+void versusStartMatch(int players, Uint64 seed) {
+    // Every board gets the same pieces: the games are reset with one seed
+    const bool savedFixed = fixedSeedEnabled;
+    const Uint64 savedSeed = fixedSeed;
+    fixedSeedEnabled = true;
+    fixedSeed = seed;
+    versusMatch.players = players;
+    for (int i = 0; i < players; ++i) {
+        VersusBoard& b = versusMatch.boards[i];
+        resetGameplayStateForNewGame();
+        replayDiscardRecording();
+        captureGameSnapshot(b.state);
+        b.alive = true;
+        b.pendingGarbage = 0;
+        b.linesSent = 0;
+        b.nextTarget = (i + 1) % players;
+    }
+    fixedSeedEnabled = savedFixed;
+    fixedSeed = savedSeed;
+    xoshiroSeed(versusMatch.garbageRng, seed ^ 0x9E3779B97F4A7C15ull);
+    versusMatch.winner = -1;
+    versusMatch.over = false;
+    LOG_INFO("Versus: %d players, seed %llu", players, static_cast<unsigned long long>(seed));
+}
+
+void versusStep(const InputActionList* actions) {
+    for (int i = 0; i < versusMatch.players; ++i) {
+        if (versusMatch.boards[i].alive) stepBoard(i, actions[i]);
+    }
+
+    int alive = 0, last = -1;
+    for (int i = 0; i < versusMatch.players; ++i) {
+        if (versusMatch.boards[i].alive) { alive++; last = i; }
+    }
+    if (alive <= 1) {
+        versusMatch.over = true;
+        versusMatch.winner = last;
+    }
+}
+
+int runVersus() {
+    const bool online = netplayEnabled();
+    if (!online && (versusPlayers < 2 || versusPlayers > kVersusMaxPlayers)) {
+        LOG_ERROR("--versus takes 2 to %d players", kVersusMaxPlayers);
+        return 1;
+    }
+    const bool headless = online && botHeadless; // --net-test with no window
+    if (online && !netplayOpen()) return 1;
+    playerCount = online ? 2 : versusPlayers;
+    if (!headless) ensureGamepadSubsystem();
+    active = true;
+    currentState = GameState::PLAYING;
+    if (!online) {
+        assignControls();
+        startLocalMatch();
+    }
+
+    bool quit = false;
+    NetStatus status = NetStatus::Connecting;
+    while (!quit) {
+        capTimer.start();
+        frameArena().reset();
+        const Uint64 frameStart = SDL_GetTicksNS();
+
+        SDL_Event e;
+        while (!headless && SDL_PollEvent(&e)) {
+            if (!handleEvent(e)) quit = true;
+        }
+        if (quit) break;
+
+        {
+            TRACE_SCOPE("versus tick");
+            if (online) {
+                status = netplayFrame(localBoard >= 0 ? heldButtons(players[localBoard]) : 0);
+                if (localBoard < 0 && status != NetStatus::Connecting && status != NetStatus::Disconnected) {
+                    localBoard = netplayLocalBoard();
+                    clearInput();
+                    if (!headless) assignControls();
+                }
+                if (headless && (status == NetStatus::Finished || status == NetStatus::Disconnected)) quit = true;
+            } else if (!versusMatch.over) {
+                stepLocalMatch();
+            }
+        }
+        const Uint64 simulated = SDL_GetTicksNS();
+        if (!headless) {
+            TRACE_SCOPE("versus render");
+            renderMatch();
+        }
+        const Uint64 rendered = SDL_GetTicksNS();
+        if (!headless) SDL_RenderPresent(gRenderer);
+
+        stats.add(frameStart, simulated, simulated, rendered);
+        capFrameRate();
+    }
+
+    active = false;
+    releaseGamepads();
+    stats.log("Versus", playerCount);
+    if (!online) return 0;
+    const bool inSync = netplayClose();
+    return inSync && status != NetStatus::Disconnected ? 0 : 1;
+}
+
+bool versusActive() {
+    return active;
+}
@@ -0,0 +1,231 @@
+// Build-time asset packer. Decodes the PNGs under assets/, shrinks them to the largest
+// size the game ever draws them at, and writes everything into one blob plus a
+// generated source file that links the blob in and describes it (see asset_registry.h).
+//
+// usage: asset_packer --out-dir <dir> [--scale <f>] [--c-array]
+//                     [image <name> <png> <maxW> <maxH>]... [raw <name> <file>]...
+//
+// maxW/maxH are logical (640x640 screen) units; --scale multiplies them so images stay
+// sharp in the largest window preset. Images are never scaled up.
+
+#include <SDL3/SDL.h>
+#include <SDL3_image/SDL_image.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace {
+    struct PackedAsset {
+        std::string name;
+        bool image;
+        bool rle;
+        int width;
+        int height;
+        size_t offset;
+        size_t size;
+        size_t decodedSize;
+    };
+
+    std::vector<unsigned char> blob;
+    std::vector<PackedAsset> packed;
+
+    bool readFile(const char* path, std::vector<unsigned char>& out) {
+        std::ifstream in(path, std::ios::binary);
+        if (!in) return false;
+        out.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+        return true;
+    }
+
+    void alignBlob() {
+        while (blob.size() % 16 != 0) blob.push_back(0);
+    }
+
+    // PackBits over 32-bit pixels: header byte with the high bit set is a run of
+    // (h & 0x7F) + 1 copies of the next pixel, otherwise h + 1 literal pixels follow.
+    // Logos are mostly flat colour and transparent margins, so this gets most of
+    // PNG's size back while decoding at memcpy speed.
+    void rleEncode(const unsigned char* px, size_t count, std::vector<unsigned char>& out) {
+        auto same = [&](size_t a, size_t b) { return std::memcmp(px + a * 4, px + b * 4, 4) == 0; };
+        size_t i = 0;
+        while (i < count) {
+            size_t run = 1;
+            while (i + run < count && run < 128 && same(i, i + run)) ++run;
+            if (run >= 2) {
+                out.push_back(static_cast<unsigned char>(0x80 | (run - 1)));
+                out.insert(out.end(), px + i * 4, px + i * 4 + 4);
+                i += run;
+                continue;
+            }
+            size_t lit = 1;
+            while (i + lit < count && lit < 128 && !(i + lit + 1 < count && same(i + lit, i + lit + 1))) ++lit;
+            out.push_back(static_cast<unsigned char>(lit - 1));
+            out.insert(out.end(), px + i * 4, px + (i + lit) * 4);
+            i += lit;
+        }
+    }
+
+    bool packImage(const char* name, const char* path, int maxW, int maxH, float scale) {
+        SDL_Surface* loaded = IMG_Load(path);
+        if (!loaded) {
+            std::fprintf(stderr, "asset_packer: %s: %s\n", path, SDL_GetError());
+            return false;
+        }
+        SDL_Surface* rgba = SDL_ConvertSurface(loaded, SDL_PIXELFORMAT_RGBA32);
+        SDL_DestroySurface(loaded);
+        if (!rgba) {
+            std::fprintf(stderr, "asset_packer: %s: %s\n", path, SDL_GetError());
+            return false;
+        }
+
+        const float fit = std::min({ maxW * scale / rgba->w, maxH * scale / rgba->h, 1.0f });
+        if (fit < 1.0f) {
+            const int w = std::max(1, static_cast<int>(std::lround(rgba->w * fit)));
+            const int h = std::max(1, static_cast<int>(std::lround(rgba->h * fit)));
+            SDL_Surface* scaled = SDL_ScaleSurface(rgba, w, h, SDL_SCALEMODE_LINEAR);
+            if (!scaled) {
+                std::fprintf(stderr, "asset_packer: %s: %s\n", path, SDL_GetError());
+                SDL_DestroySurface(rgba);
+                return false;
+            }
+            SDL_DestroySurface(rgba);
+            rgba = scaled;
+        }
+
+        std::vector<unsigned char> pixels(static_cast<size_t>(rgba->w) * rgba->h * 4);
+        for (int y = 0; y < rgba->h; ++y) {
+            std::memcpy(pixels.data() + static_cast<size_t>(y) * rgba->w * 4,
+                        static_cast<const unsigned char*>(rgba->pixels) + y * rgba->pitch,
+                        static_cast<size_t>(rgba->w) * 4);
+        }
+
+        std::vector<unsigned char> encoded;
+        rleEncode(pixels.data(), pixels.size() / 4, encoded);
+        const bool rle = encoded.size() < pixels.size();
+        const std::vector<unsigned char>& stored = rle ? encoded : pixels;
+
+        alignBlob();
+        packed.push_back(PackedAsset{ name, true, rle, rgba->w, rgba->h, blob.size(), stored.size(), pixels.size() });
+        blob.insert(blob.end(), stored.begin(), stored.end());
+        std::printf("asset_packer: %-12s %4dx%-4d %8zu bytes%s\n", name, rgba->w, rgba->h, stored.size(), rle ? " (rle)" : "");
+        SDL_DestroySurface(rgba);
+        return true;
+    }
+
+    bool packRaw(const char* name, const char* path) {
+        std::vector<unsigned char> data;
+        if (!readFile(path, data)) {
+            std::fprintf(stderr, "asset_packer: could not read %s\n", path);
+            return false;
+        }
+        alignBlob();
+        packed.push_back(PackedAsset{ name, false, false, 0, 0, blob.size(), data.size(), data.size() });
+        blob.insert(blob.end(), data.begin(), data.end());
+        std::printf("asset_packer: %-12s %8zu bytes\n", name, data.size());
+        return true;
+    }
+
+    bool writeOutputs(const std::string& outDir, bool cArray) {
+        std::string binPath = outDir + "/tetris_assets.bin";
+        std::ofstream bin(binPath, std::ios::binary);
+        bin.write(reinterpret_cast<const char*>(blob.data()), static_cast<std::streamsize>(blob.size()));
+        if (!bin) {
+            std::fprintf(stderr, "asset_packer: could not write %s\n", binPath.c_str());
+            return false;
+        }
+
+        std::string srcPath = outDir + "/tetris_assets.cpp";
+        FILE* f = std::fopen(srcPath.c_str(), "w");
+        if (!f) {
+            std::fprintf(stderr, "asset_packer: could not write %s\n", srcPath.c_str());
+            return false;
+        }
+        std::fprintf(f, "// Generated by asset_packer - do not edit\n#include \"asset_registry.h\"\n\n");
+
+        if (cArray) {
+            // Compilers without GNU inline assembly get the blob as a plain array
+            std::fprintf(f, "alignas(16) static const unsigned char tetris_asset_blob[] = {");
+            for (size_t i = 0; i < blob.size(); ++i) {
+                std::fprintf(f, "%s0x%02x,", (i % 16 == 0) ? "\n    " : "", blob[i]);
+            }
+            std::fprintf(f, "\n    0x00\n};\n\n");
+        } else {
+            std::replace(binPath.begin(), binPath.end(), '\\', '/');
+            std::fprintf(f,
+                "#if defined(_WIN32)\n"
+                "#define TETRIS_ASSET_SECTION \".section .rdata,\\\"dr\\\"\\n\"\n"
+                "#else\n"
+                "#define TETRIS_ASSET_SECTION \".section .rodata\\n\"\n"
+                "#endif\n\n"
+                "__asm__(TETRIS_ASSET_SECTION\n"
+                "        \".balign 16\\n\"\n"
+                "        \".global tetris_asset_blob\\n\"\n"
+                "        \"tetris_asset_blob:\\n\"\n"
+                "        \".incbin \\\"%s\\\"\\n\"\n"
+                "        \".byte 0\\n\"\n"
+                "        \".text\\n\");\n\n"
+                "extern \"C\" const unsigned char tetris_asset_blob[];\n\n",
+                binPath.c_str());
+        }
+
+        std::fprintf(f, "const AssetEntry kAssetTable[] = {\n");
+        for (const auto& a : packed) {
+            std::fprintf(f, "    { \"%s\", AssetKind::%s, AssetEncoding::%s, %d, %d, %zuu, %zuu, %zuu },\n",
+                         a.name.c_str(), a.image ? "Image" : "Raw", a.rle ? "RleRgba" : "Raw",
+                         a.width, a.height, a.offset, a.size, a.decodedSize);
+        }
+        std::fprintf(f, "};\n\nconst int kAssetCount = %zu;\n", packed.size());
+        std::fprintf(f, "const unsigned char* const kAssetBlob = tetris_asset_blob;\n");
+        const bool ok = std::ferror(f) == 0;
+        std::fclose(f);
+        return ok;
+    }
+
+    int usage() {
+        std::fprintf(stderr,
+            "usage: asset_packer --out-dir <dir> [--scale <f>] [--c-array]\n"
+            "                    [image <name> <png> <maxW> <maxH>]... [raw <name> <file>]...\n");
+        return 2;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    std::string outDir;
+    float scale = 1.0f;
+    bool cArray = false;
+
+    int i = 1;
+    for (; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--out-dir" && i + 1 < argc) {
+            outDir = argv[++i];
+        } else if (arg == "--scale" && i + 1 < argc) {
+            scale = static_cast<float>(std::atof(argv[++i]));
+        } else if (arg == "--c-array") {
+            cArray = true;
+        } else {
+            break;
+        }
+    }
+    if (outDir.empty() || scale <= 0.0f) return usage();
+
+    while (i < argc) {
+        std::string kind = argv[i];
+        if (kind == "image" && i + 4 < argc) {
+            if (!packImage(argv[i + 1], argv[i + 2], std::atoi(argv[i + 3]), std::atoi(argv[i + 4]), scale)) return 1;
+            i += 5;
+        } else if (kind == "raw" && i + 2 < argc) {
+            if (!packRaw(argv[i + 1], argv[i + 2])) return 1;
+            i += 3;
+        } else {
+            return usage();
+        }
+    }
+    if (packed.empty()) return usage();
+
+    return writeOutputs(outDir, cArray) ? 0 : 1;
+}
@@ -0,0 +1,199 @@
+// Reference bot for the game's bot protocol (see include/bot.h). For every State it
+// tries each rotation and column of the current and held piece, drops it, scores the
+// resulting stack and answers with the best Placement.
+//
+// usage: example_bot                  speak the protocol on stdin/stdout
+//        example_bot --socket <path>  listen on a UNIX socket and serve one game process
+//
+//   ./example_bot --socket /tmp/tetris-bot & ./tetris --bot-socket /tmp/tetris-bot --headless --bot-games 10
+
+#include "bot.h"
+#include "piece.h"
+#include "randomizer.h"
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace {
+    int readFd = STDIN_FILENO;
+    int writeFd = STDOUT_FILENO;
+
+    bool readExactly(Uint8* out, size_t size) {
+        while (size > 0) {
+            const ssize_t n = read(readFd, out, size);
+            if (n <= 0) return false;
+            out += n;
+            size -= static_cast<size_t>(n);
+        }
+        return true;
+    }
+
+    bool writeAll(const Uint8* data, size_t size) {
+        while (size > 0) {
+            const ssize_t n = write(writeFd, data, size);
+            if (n <= 0) return false;
+            data += n;
+            size -= static_cast<size_t>(n);
+        }
+        return true;
+    }
+
+    Uint16 get16(const Uint8* p) { return static_cast<Uint16>(p[0] | (p[1] << 8)); }
+    Uint32 get32(const Uint8* p) { return get16(p) | (static_cast<Uint32>(get16(p + 2)) << 16); }
+
+    struct Position {
+        Uint16 rows[boardHeight]; // top row first, bit x = column x
+    };
+
+    bool fits(const Position& pos, const PieceShape& s, int x, int y) {
+        if (x < 0 || x + s.width > boardWidth || y + s.height > boardHeight) return false;
+        for (int sy = 0; sy < s.height; ++sy) {
+            for (int sx = 0; sx < s.width; ++sx) {
+                if ((s.mask >> (sy * 4 + sx) & 1u) && (pos.rows[y + sy] >> (x + sx) & 1u)) return false;
+            }
+        }
+        return true;
+    }
+
+    // Lower is better: stack height, holes and bumpiness, with cleared lines rewarded
+    double evaluate(Position pos, const PieceShape& s, int x, int y) {
+        for (int sy = 0; sy < s.height; ++sy) {
+            for (int sx = 0; sx < s.width; ++sx) {
+                if (s.mask >> (sy * 4 + sx) & 1u) pos.rows[y + sy] |= static_cast<Uint16>(1u << (x + sx));
+            }
+        }
+        const Uint16 full = static_cast<Uint16>((1u << boardWidth) - 1);
+        int lines = 0;
+        for (int row = boardHeight - 1; row >= 0; --row) {
+            if (pos.rows[row] != full) continue;
+            lines++;
+            for (int r = row; r > 0; --r) pos.rows[r] = pos.rows[r - 1];
+            pos.rows[0] = 0;
+            row++;
+        }
+
+        int heights[boardWidth];
+        int holes = 0;
+        for (int col = 0; col < boardWidth; ++col) {
+            heights[col] = 0;
+            for (int row = 0; row < boardHeight; ++row) {
+                if (pos.rows[row] >> col & 1u) {
+                    if (!heights[col]) heights[col] = boardHeight - row;
+                } else if (heights[col]) {
+                    holes++;
+                }
+            }
+        }
+        int aggregate = 0;
+        int bumpiness = 0;
+        for (int col = 0; col < boardWidth; ++col) {
+            aggregate += heights[col];
+            if (col > 0) bumpiness += heights[col] > heights[col - 1] ? heights[col] - heights[col - 1] : heights[col - 1] - heights[col];
+        }
+        return 0.51 * aggregate + 0.36 * holes + 0.18 * bumpiness - 0.76 * lines;
+    }
+
+    struct Choice {
+        double score;
+        int rotation;
+        int x;
+    };
+
+    Choice bestFor(const Position& pos, int type) {
+        Choice best{ 1e9, 0, 0 };
+        for (int rot = 0; rot < 4; ++rot) {
+            const PieceShape& s = kPieceShapes.shapes[type][rot];
+            for (int x = 0; x + s.width <= boardWidth; ++x) {
+                if (!fits(pos, s, x, 0)) continue;
+                int y = 0;
+                while (fits(pos, s, x, y + 1)) y++;
+                const double score = evaluate(pos, s, x, y);
+                if (score < best.score) best = Choice{ score, rot, x };
+            }
+        }
+        return best;
+    }
+
+    bool answer(const Uint8* p, size_t length) {
+        const auto start = std::chrono::steady_clock::now();
+        if (length < 17 + kMaxPreview + 2 * boardHeight) return false;
+        const Uint32 seq = get32(p);
+        const int piece = p[4];
+        const int hold = p[8];
+        const bool holdUsed = p[9] != 0;
+        const int next = p[10];
+        Position pos;
+        const Uint8* rows = p + 10 + kMaxPreview + 7;
+        for (int y = 0; y < boardHeight; ++y) pos.rows[y] = get16(rows + 2 * y);
+
+        Choice best = bestFor(pos, piece);
+        bool useHold = false;
+        if (!holdUsed) {
+            const Choice held = bestFor(pos, hold == 0xFF ? next : hold);
+            if (held.score < best.score) {
+                best = held;
+                useHold = true;
+            }
+        }
+
+        const Uint32 thinkNs = static_cast<Uint32>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start).count());
+        const Uint8 reply[] = {
+            static_cast<Uint8>(BotMessage::Placement), 11, 0,
+            static_cast<Uint8>(seq), static_cast<Uint8>(seq >> 8), static_cast<Uint8>(seq >> 16), static_cast<Uint8>(seq >> 24),
+            static_cast<Uint8>(thinkNs), static_cast<Uint8>(thinkNs >> 8), static_cast<Uint8>(thinkNs >> 16), static_cast<Uint8>(thinkNs >> 24),
+            static_cast<Uint8>(useHold), static_cast<Uint8>(best.rotation), static_cast<Uint8>(best.x),
+        };
+        return writeAll(reply, sizeof(reply));
+    }
+
+    bool listenOn(const char* path) {
+        sockaddr_un addr{};
+        addr.sun_family = AF_UNIX;
+        if (std::strlen(path) >= sizeof(addr.sun_path)) return false;
+        std::strcpy(addr.sun_path, path);
+        unlink(path);
+        const int server = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (server < 0 || bind(server, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0 || listen(server, 1) != 0) return false;
+        const int client = accept(server, nullptr, nullptr);
+        close(server);
+        unlink(path);
+        if (client < 0) return false;
+        readFd = writeFd = client;
+        return true;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    if (argc == 3 && std::strcmp(argv[1], "--socket") == 0) {
+        if (!listenOn(argv[2])) {
+            std::fprintf(stderr, "example_bot: could not listen on %s\n", argv[2]);
+            return 1;
+        }
+    }
+
+    Uint8 header[3];
+    Uint8 payload[65536];
+    Uint32 games = 0;
+    while (readExactly(header, sizeof(header))) {
+        const size_t length = get16(header + 1);
+        if (!readExactly(payload, length)) break;
+        switch (static_cast<BotMessage>(header[0])) {
+            case BotMessage::State:
+                if (!answer(payload, length)) return 1;
+                break;
+            case BotMessage::GameOver:
+                if (length >= 10) {
+                    std::fprintf(stderr, "example_bot: game %u over, score %u, %u lines, %u pieces\n",
+                                 ++games, get32(payload), get16(payload + 4), get32(payload + 6));
+                }
+                break;
+            default:
+                break;
+        }
+    }
+    return 0;
+}